@@ -168,9 +168,10 @@ function(UHD_ADD_PYTEST test_name)
             WORKING_DIRECTORY "${UHD_BINARY_DIR}/python"
         )
     endif(ENABLE_QEMU_UNITTESTS)
-    # Include ${UHD_BINARY_DIR}/utils/ for testing the python utils
+    # Include ${UHD_BINARY_DIR}/utils/ for testing the python utils, and
+    # ${UHD_BINARY_DIR}/tests/common/ for the mock streamer module
     if(APPLE)
-        set(env_vars "DYLD_LIBRARY_PATH=${UHD_BINARY_DIR}/lib/:${Boost_LIBRARY_DIRS};PYTHONPATH=${UHD_BINARY_DIR}/python:${UHD_SOURCE_DIR}/tests/common:${UHD_BINARY_DIR}/utils/")
+        set(env_vars "DYLD_LIBRARY_PATH=${UHD_BINARY_DIR}/lib/:${Boost_LIBRARY_DIRS};PYTHONPATH=${UHD_BINARY_DIR}/python:${UHD_SOURCE_DIR}/tests/common:${UHD_BINARY_DIR}/tests/common:${UHD_BINARY_DIR}/utils/")
         if(UHD_ADD_PYTEST_MODULE_PATH)
             set(env_vars "${env_vars};UHD_MODULE_PATH=${UHD_ADD_PYTEST_MODULE_PATH}")
         endif()
@@ -180,7 +181,7 @@ function(UHD_ADD_PYTEST test_name)
     elseif(MSVC)
         string(REPLACE ";" "\\;" WIN_PATH "$ENV{PATH}")
     # MSVC is a multi-config generator in CMake, so we must specify the config value
-        set(env_vars "PATH=${WIN_PATH}\\;${UHD_BINARY_DIR}\\lib\\$<CONFIG>\\;${Boost_LIBRARY_DIRS};PYTHONPATH=${UHD_BINARY_DIR}\\python\\$<CONFIG>\\;${UHD_SOURCE_DIR}\\tests\\common\\;${UHD_BINARY_DIR}\\utils")
+        set(env_vars "PATH=${WIN_PATH}\\;${UHD_BINARY_DIR}\\lib\\$<CONFIG>\\;${Boost_LIBRARY_DIRS};PYTHONPATH=${UHD_BINARY_DIR}\\python\\$<CONFIG>\\;${UHD_SOURCE_DIR}\\tests\\common\\;${UHD_BINARY_DIR}\\tests\\common\\$<CONFIG>\\;${UHD_BINARY_DIR}\\utils")
         if(UHD_ADD_PYTEST_MODULE_PATH)
             set(env_vars "${env_vars};UHD_MODULE_PATH=${UHD_ADD_PYTEST_MODULE_PATH}")
         endif()
@@ -189,7 +190,7 @@ function(UHD_ADD_PYTEST test_name)
             "${env_vars}"
             )
     else()
-        set(env_vars "LD_LIBRARY_PATH=${UHD_BINARY_DIR}/lib/:${Boost_LIBRARY_DIRS};PYTHONPATH=${UHD_BINARY_DIR}/python:${UHD_SOURCE_DIR}/tests/common:${UHD_BINARY_DIR}/utils/")
+        set(env_vars "LD_LIBRARY_PATH=${UHD_BINARY_DIR}/lib/:${Boost_LIBRARY_DIRS};PYTHONPATH=${UHD_BINARY_DIR}/python:${UHD_SOURCE_DIR}/tests/common:${UHD_BINARY_DIR}/tests/common:${UHD_BINARY_DIR}/utils/")
         if(UHD_ADD_PYTEST_MODULE_PATH)
             set(env_vars "${env_vars};UHD_MODULE_PATH=${UHD_ADD_PYTEST_MODULE_PATH}")
         endif()
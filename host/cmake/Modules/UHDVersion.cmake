@@ -21,7 +21,7 @@ find_package(Git QUIET)
 ########################################################################
 set(UHD_VERSION_MAJOR      4)
 set(UHD_VERSION_API        11)
-set(UHD_VERSION_ABI        0)
+set(UHD_VERSION_ABI        1)
 set(UHD_VERSION_PATCH      0)
 #TODO add a version tag variable which allows to store additional 
 #     branch information instead of overwriting the patch version.
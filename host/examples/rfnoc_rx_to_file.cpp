@@ -15,12 +15,12 @@
 #include <uhd/types/tune_request.hpp>
 #include <uhd/utils/graph_utils.hpp>
 #include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/sample_recorder.hpp>
 #include <uhd/utils/thread.hpp>
 #include <boost/program_options.hpp>
 #include <chrono>
 #include <complex>
 #include <csignal>
-#include <fstream>
 #include <functional>
 #include <iostream>
 #include <thread>
@@ -41,6 +41,7 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
     const size_t samps_per_buff,
     const double rx_rate,
     const unsigned long long num_requested_samples,
+    const std::string& recorder_args,
     double time_requested       = 0.0,
     bool bw_summary             = false,
     bool stats                  = false,
@@ -51,9 +52,9 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
 
     uhd::rx_metadata_t md;
     std::vector<samp_type> buff(samps_per_buff);
-    std::ofstream outfile;
+    uhd::sample_recorder::sptr recorder;
     if (not file.empty()) {
-        outfile.open(file.c_str(), std::ofstream::binary);
+        recorder = uhd::sample_recorder::make({file}, uhd::device_addr_t(recorder_args));
     }
     bool overflow_message = true;
 
@@ -124,8 +125,8 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
 
         num_total_samps += num_rx_samps;
 
-        if (outfile.is_open()) {
-            outfile.write((const char*)&buff.front(), num_rx_samps * sizeof(samp_type));
+        if (recorder) {
+            recorder->write(0, &buff.front(), num_rx_samps * sizeof(samp_type));
         }
 
         if (bw_summary) {
@@ -153,8 +154,8 @@ void recv_to_file(uhd::rx_streamer::sptr rx_stream,
         num_post_samps = rx_stream->recv(&buff.front(), buff.size(), md, 3.0);
     } while (num_post_samps and md.error_code == uhd::rx_metadata_t::ERROR_CODE_NONE);
 
-    if (outfile.is_open())
-        outfile.close();
+    if (recorder)
+        recorder->close();
 
     if (stats) {
         std::cout << std::endl;
@@ -301,7 +302,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         "\n";
     // variables to be set by po
     std::string args, file, format, ant, subdev, ref, wirefmt, streamargs, block_id,
-        block_props;
+        block_props, recorder_args;
     size_t total_num_samps, spb, spp, radio_id, radio_chan, block_port;
     double rate, freq, gain, bw, total_time, setup_time, lo_offset;
 
@@ -337,6 +338,9 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("sizemap", "Track and display a breakdown of received packet sizes on exit. This helps diagnose "
             "streaming performance and packetization issues.")
         ("null", "Run without writing to file.")
+        ("recorder-args", po::value<std::string>(&recorder_args)->default_value(""), "Arguments for the sample "
+            "recorder which writes the file in the background, e.g. \"block_size=8388608\"."
+            "\nSee uhd::sample_recorder for the supported arguments.")
         ("continue", "Continue streaming even if a bad packet is received.")
         ("args", po::value<std::string>(&args)->default_value(""), "Single USRP device selection and "
             "configuration arguments."
@@ -630,6 +634,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         spb,                \
         rate,               \
         total_num_samps,    \
+        recorder_args,      \
         total_time,         \
         bw_summary,         \
         stats,              \
@@ -10,6 +10,7 @@
 #include <uhd/types/tune_request.hpp>
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/sample_recorder.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/program_options.hpp>
@@ -28,8 +29,8 @@
 #include <chrono>
 #include <complex>
 #include <csignal>
-#include <fstream>
 #include <iostream>
+#include <map>
 #include <numeric>
 #include <regex>
 #include <thread>
@@ -140,6 +141,21 @@ double disk_rate_check(const size_t sample_type_size,
 }
 #endif
 
+/*
+ * Get the SigMF data type for a CPU format
+ */
+std::string get_sigmf_datatype(const std::string& cpu_format)
+{
+    static const std::map<std::string, std::string> datatypes = {
+        {"fc64", "cf64_le"},
+        {"fc32", "cf32_le"},
+        {"sc16", "ci16_le"},
+        {"f64", "rf64_le"},
+        {"f32", "rf32_le"},
+        {"s16", "ri16_le"},
+    };
+    return datatypes.at(cpu_format);
+}
 
 template <typename samp_type>
 void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
@@ -154,6 +170,8 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     double time_requested            = 0.0,
     bool stats                       = false,
     bool null                        = false,
+    const std::string& recorder_args = "",
+    bool sigmf                       = false,
     bool enable_size_map             = false,
     bool continue_on_bad_packet      = false,
     const std::string& thread_prefix = "")
@@ -181,25 +199,40 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
         std::exit(EXIT_FAILURE);
     }
 
-    std::vector<std::ofstream> outfiles(rx_stream->get_num_channels());
-    std::string filename;
-    for (size_t ch = 0; ch < rx_stream->get_num_channels(); ch++) {
-        if (not null) {
+    // The recorder writes the samples to disk in the background, so a slow
+    // write doesn't hold up recv()
+    uhd::sample_recorder::sptr recorder;
+    if (not null) {
+        std::vector<std::string> filenames;
+        for (size_t ch = 0; ch < rx_stream->get_num_channels(); ch++) {
             if (rx_stream->get_num_channels() == 1) { // single channel
-                filename = file;
+                filenames.push_back(file);
             } else { // multiple channels
                 // check if file extension exists
                 if (file.find('.') != std::string::npos) {
                     const std::string base_name = file.substr(0, file.find_last_of('.'));
                     const std::string extension = file.substr(file.find_last_of('.'));
-                    filename = base_name + "_" + "ch" + std::to_string(channel_nums[ch])
-                               + extension;
+                    filenames.push_back(base_name + "_" + "ch"
+                                        + std::to_string(channel_nums[ch]) + extension);
                 } else {
                     // file extension does not exist
-                    filename = file + "_" + "ch" + std::to_string(channel_nums[ch]);
+                    filenames.push_back(
+                        file + "_" + "ch" + std::to_string(channel_nums[ch]));
                 }
             }
-            outfiles[ch].open(filename.c_str(), std::ofstream::binary);
+        }
+        recorder =
+            uhd::sample_recorder::make(filenames, uhd::device_addr_t(recorder_args));
+
+        if (sigmf) {
+            uhd::sample_recorder::sigmf_meta_t meta;
+            meta.datatype    = get_sigmf_datatype(cpu_format);
+            meta.sample_rate = usrp->get_rx_rate(channel_nums[0]);
+            for (const size_t chan : channel_nums) {
+                meta.frequencies.push_back(usrp->get_rx_freq(chan));
+            }
+            meta.hw = usrp->get_mboard_name();
+            recorder->write_sigmf_meta(meta);
         }
     }
 
@@ -272,11 +305,8 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
 
         num_total_samps += num_rx_samps;
 
-        for (size_t ch = 0; ch < rx_stream->get_num_channels(); ch++) {
-            if (outfiles[ch].is_open()) {
-                outfiles[ch].write(
-                    (const char*)buffs[ch], num_rx_samps * sizeof(samp_type));
-            }
+        if (recorder) {
+            recorder->write(buffs, num_rx_samps * sizeof(samp_type));
         }
 
         last_update_samps += num_rx_samps;
@@ -295,10 +325,8 @@ void recv_to_file(uhd::usrp::multi_usrp::sptr usrp,
     stream_cmd.stream_mode = uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS;
     rx_stream->issue_stream_cmd(stream_cmd);
 
-    for (size_t i = 0; i < outfiles.size(); i++) {
-        if (outfiles[i].is_open()) {
-            outfiles[i].close();
-        }
+    if (recorder) {
+        recorder->close();
     }
 
     for (size_t i = 0; i < rx_stream->get_num_channels(); i++) {
@@ -439,7 +467,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         "                          --duration 0.01 --file \"lte_5mhz.dat\" --multi-streamer\n";
     // clang-format on
     // variables to be set by po
-    std::string args, file, type, ant, subdev, ref, otw, channels;
+    std::string args, file, type, ant, subdev, ref, otw, channels, recorder_args;
     size_t total_num_samps, spb;
     double rate, freq, gain, bw, total_time, setup_time, lo_offset;
 
@@ -530,6 +558,10 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("sizemap", "Track and display a breakdown of received packet sizes on exit. This helps diagnose "
             "streaming performance and packetization issues. Use with multi-streamer option if CPU limits stream rate.")
         ("null", "Run without writing to file.")
+        ("recorder-args", po::value<std::string>(&recorder_args)->default_value(""), "Arguments for the sample "
+            "recorder which writes the files in the background, e.g. \"num_threads=4,direct_io=0\"."
+            "\nSee uhd::sample_recorder for the supported arguments.")
+        ("sigmf", "Write a SigMF metadata file next to each data file.")
         ("continue", "Continue streaming even if a bad packet is received.")
         ("skip-lo", "Skip checking and waiting for hardware locks (LO, reference, MIMO synchronization) "
             "before starting reception.")
@@ -558,6 +590,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     bool bw_summary             = vm.count("progress") > 0;
     bool stats                  = vm.count("stats") > 0;
     bool null                   = vm.count("null") > 0;
+    bool sigmf                  = vm.count("sigmf") > 0;
     bool enable_size_map        = vm.count("sizemap") > 0;
     bool continue_on_bad_packet = vm.count("continue") > 0;
     bool multithread = (vm.count("multi-streamer") || vm.count("multi_streamer")) > 0;
@@ -727,6 +760,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         total_time,                                                                  \
         stats,                                                                       \
         null,                                                                        \
+        recorder_args,                                                               \
+        sigmf,                                                                       \
         enable_size_map,                                                             \
         continue_on_bad_packet,                                                      \
         th_prefix)
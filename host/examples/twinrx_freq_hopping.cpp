@@ -7,6 +7,8 @@
 
 // FFT conversion
 #include "ascii_art_dft.hpp"
+#include <uhd/property_tree.hpp>
+#include <uhd/rfnoc/radio_control.hpp>
 #include <uhd/usrp/multi_usrp.hpp>
 #include <uhd/utils/safe_main.hpp>
 #include <boost/program_options.hpp>
@@ -29,8 +31,9 @@
  * calculation itself, resulting in a faster tune time. This example shows how to take
  * advantage of this as follows:
  *
- * 1. Tune across the given frequency range, storing the calculated LO frequencies along
- *    the way.
+ * 1. Tune across the given frequency range once, with tune plan recording enabled on
+ *    the LO1 synthesizers. Every hop then only loads the stored synthesizer settings
+ *    instead of calculating them.
  * 2. Use timed commands to tell the TwinRX to receive bursts of samples at given
  * intervals.
  * 3. For each frequency, tune the LOs for the inactive channel for the next frequency and
@@ -62,6 +65,22 @@ size_t UNUSED_CHAN = 1;
 const int X300_COMMAND_FIFO_DEPTH = 16;
 
 
+// Enable or disable LO1 tune plan recording of a channel. The TwinRX has no
+// multi_usrp API for this, so go through the property tree of the radio.
+static void set_lo1_tune_plan_recording(const size_t chan, const bool enable)
+{
+    const uhd::fs_path lo1_path = uhd::fs_path("dboard/rx_frontends")
+                                  / usrp->get_rx_subdev_spec().at(chan).sd_name
+                                  / "los/LO1/tune_plans";
+    auto tree = usrp->get_radio_control(chan).get_tree();
+    tree->access<bool>(lo1_path / "record").set(enable);
+    if (!enable) {
+        std::cout << "LO1 tune plans of channel " << chan << ": "
+                  << tree->access<std::vector<double>>(lo1_path / "freqs").get().size()
+                  << "\n";
+    }
+}
+
 // This is a helper function for receiving samples from the USRP
 static void twinrx_recv(recv_buff_t& buffer)
 {
@@ -202,7 +221,22 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     // Set up buffers
     buffs = recv_buffs_t(rf_freqs.size(), recv_buff_t(spb));
 
+    // Run through the hops once, so the LO1 synthesizers of both channels store the
+    // settings of every frequency they are tuned to
+    std::cout << "Making tune plans..." << std::endl;
+    set_lo1_tune_plan_recording(ACTIVE_CHAN, true);
+    set_lo1_tune_plan_recording(UNUSED_CHAN, true);
+    for (size_t i = 0; i < rf_freqs.size(); i++) {
+        std::string lo_src = (i % 2) ? "companion" : "internal";
+        usrp->set_rx_lo_source(lo_src, uhd::usrp::multi_usrp::ALL_LOS, ACTIVE_CHAN);
+        usrp->set_rx_freq(rf_freqs[(i + 1) % rf_freqs.size()], UNUSED_CHAN);
+        usrp->set_rx_freq(rf_freqs[i], ACTIVE_CHAN);
+    }
+    set_lo1_tune_plan_recording(ACTIVE_CHAN, false);
+    set_lo1_tune_plan_recording(UNUSED_CHAN, false);
+
     // Tune the active channel to the first frequency and reset the USRP's time
+    usrp->set_rx_lo_source("internal", uhd::usrp::multi_usrp::ALL_LOS, ACTIVE_CHAN);
     usrp->set_rx_freq(rf_freqs[0], ACTIVE_CHAN);
     usrp->set_time_now(uhd::time_spec_t(0.0));
 
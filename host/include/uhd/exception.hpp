@@ -172,6 +172,17 @@ struct UHD_API access_error : runtime_error
     void dynamic_throw(void) const override;
 };
 
+/*! Raised when the result of an arithmetic operation is too large to be
+ * represented.
+ */
+struct UHD_API overflow_error : runtime_error
+{
+    overflow_error(const std::string& what);
+    unsigned code(void) const override;
+    overflow_error* dynamic_clone(void) const override;
+    void dynamic_throw(void) const override;
+};
+
 /*! Base class for errors that occur outside of UHD.
  */
 struct UHD_API environment_error : exception
@@ -58,7 +58,8 @@ public: // Methods
      * that no nodes receive stale data.
      * Nodes and their dependencies are resolved only if they are
      * dirty i.e. their contained values have changed since the
-     * last resolve.
+     * last resolve. Dirty nodes that neither depend on the specified
+     * node nor feed into any of its dependants are left dirty.
      * This call requires an acyclic expert graph.
      *
      * \param node_name Name of the node to start resolving from
@@ -22,6 +22,7 @@
 #include <mutex>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 namespace uhd { namespace experts {
 
@@ -112,6 +113,17 @@ public:
         os << addr.to_string();
         return os.str();
     }
+
+    static std::string print(const std::vector<double>& vals)
+    {
+        std::ostringstream os;
+        os << "[";
+        for (size_t i = 0; i < vals.size(); i++) {
+            os << (i == 0 ? "" : ", ") << vals[i];
+        }
+        os << "]";
+        return os.str();
+    }
 };
 
 /*!---------------------------------------------------------
@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace uhd {
@@ -215,6 +216,58 @@ struct UHD_API_HEADER fs_path : std::string
 UHD_API fs_path operator/(const fs_path&, const fs_path&);
 UHD_API fs_path operator/(const fs_path&, size_t);
 
+/*!
+ * A handle to a property in a uhd::property_tree.
+ *
+ * Accessing a property by its path means parsing the path and locking the
+ * tree on every call. A handle looks up the path once, when it is created,
+ * and refers to the property directly after that. Accessing a property through
+ * its handle doesn't touch the tree at all, so handles are the preferred way
+ * to access properties that are used frequently, e.g., from a control loop.
+ *
+ * A handle keeps its property alive. If the property is removed from the tree
+ * (and possibly replaced by a new one at the same path), the handle keeps
+ * referring to the removed property.
+ */
+template <typename T>
+class UHD_API_HEADER property_handle
+{
+public:
+    //! Create an empty handle
+    property_handle(void) = default;
+
+    property_handle(std::shared_ptr<property<T>> prop, const fs_path& path)
+        : _prop(std::move(prop)), _path(path)
+    {
+    }
+
+    //! Get the path the property was looked up at
+    const fs_path& get_path(void) const
+    {
+        return _path;
+    }
+
+    //! True if the handle refers to a property
+    explicit operator bool(void) const
+    {
+        return bool(_prop);
+    }
+
+    property<T>& operator*(void) const
+    {
+        return *_prop;
+    }
+
+    property<T>* operator->(void) const
+    {
+        return _prop.get();
+    }
+
+private:
+    std::shared_ptr<property<T>> _prop;
+    fs_path _path;
+};
+
 /*!
  * The property tree provides a file system structure for accessing properties.
  */
@@ -250,6 +303,10 @@ public:
     template <typename T>
     property<T>& access(const fs_path& path);
 
+    //! Get a handle to a property in the tree, see uhd::property_handle
+    template <typename T>
+    property_handle<T> get_handle(const fs_path& path);
+
     //! Pop a property off the tree, and returns the property
     template <typename T>
     std::shared_ptr<property<T>> pop(const fs_path& path);
@@ -263,7 +320,7 @@ private:
         const fs_path& path, const std::shared_ptr<property_iface>& prop) = 0;
 
     //! Internal access property with wild-card type
-    virtual std::shared_ptr<property_iface>& _access(const fs_path& path) const = 0;
+    virtual std::shared_ptr<property_iface> _access(const fs_path& path) const = 0;
 };
 
 } // namespace uhd
@@ -194,6 +194,17 @@ property<T>& property_tree::access(const fs_path& path)
     return *ptr;
 }
 
+template <typename T>
+property_handle<T> property_tree::get_handle(const fs_path& path)
+{
+    auto ptr = std::dynamic_pointer_cast<property<T>>(this->_access(path));
+    if (!ptr) {
+        throw uhd::type_error(
+            "Property " + path + " exists, but was accessed with wrong type");
+    }
+    return property_handle<T>(std::move(ptr), path);
+}
+
 template <typename T>
 typename std::shared_ptr<property<T>> property_tree::pop(const fs_path& path)
 {
@@ -12,6 +12,7 @@
 #include <uhd/types/time_spec.hpp>
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -196,6 +197,21 @@ public:
         return _reg_iface_holder.regs().peek32(_get_addr(addr, instance), time);
     }
 
+    /*! Read a 32-bit register implemented in the NoC block without waiting for
+     * the result, cf. register_iface::peek32_async().
+     *
+     * \param addr The byte address of the register to read from (truncated to 20 bits).
+     * \param instance The index of the block of registers to which the read applies.
+     * \param time The time at which the transaction should be executed.
+     * \return A future that holds the value of the register
+     */
+    inline std::future<uint32_t> peek32_async(uint32_t addr,
+        const size_t instance = 0,
+        time_spec_t time      = uhd::time_spec_t::ASAP)
+    {
+        return _reg_iface_holder.regs().peek32_async(_get_addr(addr, instance), time);
+    }
+
     /*! Read two consecutive 32-bit registers implemented in the NoC block
      * and return them as one 64-bit value.
      *
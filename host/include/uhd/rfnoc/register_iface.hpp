@@ -10,7 +10,9 @@
 #include <uhd/types/time_spec.hpp>
 #include <boost/optional.hpp>
 #include <cstdint>
+#include <exception>
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -165,6 +167,9 @@ public:
      * This method should be called when multiple writes need to happen that are
      * at non-consecutive addresses. For consecutive writes, cf. block_poke32().
      *
+     * Note: Under the hood, the implementation may combine writes to
+     * consecutive addresses into block writes.
+     *
      * \param addrs The byte addresses of the registers to write to
      *              (each truncated to 20 bits).
      * \param data New values of these registers. The lengths of data and addr
@@ -246,6 +251,46 @@ public:
      */
     virtual uint32_t peek32(uint32_t addr, time_spec_t time = uhd::time_spec_t::ASAP) = 0;
 
+    /*! Read a 32-bit register implemented in the NoC block without waiting
+     * for the result.
+     *
+     * The read request is sent right away, but the response is only collected
+     * when get() is called on the returned future. This way, many reads can be
+     * in flight at the same time, and reading several registers only takes a
+     * single round trip to the device:
+     *
+     * ~~~{.cpp}
+     * auto compat = regs().peek32_async(REG_COMPAT_NUM);
+     * auto width  = regs().peek32_async(REG_RADIO_WIDTH);
+     * const uint32_t compat_val = compat.get();
+     * const uint32_t width_val  = width.get();
+     * ~~~
+     *
+     * The returned future may be deferred, i.e., it only supports get() and
+     * wait(). The default implementation performs a peek32() and returns a
+     * future that is already ready.
+     *
+     * \param addr The byte address of the register to read from (truncated to 20 bits).
+     * \param time The time at which the transaction should be executed.
+     * \return A future that holds the value of the register
+     *
+     * The following exceptions are thrown when calling get() on the future:
+     * \throws op_failed if the transaction fails
+     * \throws op_timeout if no response is received
+     * \throws op_seqerr if a sequence error occurs
+     */
+    virtual std::future<uint32_t> peek32_async(
+        uint32_t addr, time_spec_t time = uhd::time_spec_t::ASAP)
+    {
+        std::promise<uint32_t> result;
+        try {
+            result.set_value(peek32(addr, time));
+        } catch (...) {
+            result.set_exception(std::current_exception());
+        }
+        return result.get_future();
+    }
+
     /*! Read two consecutive 32-bit registers implemented in the NoC block
      * and return them as one 64-bit value.
      *
@@ -473,4 +518,73 @@ public:
 
 }; // class register_iface
 
+/*! Collects register writes to send them in as few control packets as possible
+ *
+ * Writes are stored until commit() is called, which passes them on to
+ * register_iface::multi_poke32(). The register interface may then combine
+ * writes to consecutive addresses into block writes, so a sequence like the
+ * following only requires a single control packet:
+ *
+ * ~~~{.cpp}
+ * register_write_batch batch(regs());
+ * batch.poke32(0x100, 1);
+ * batch.poke32(0x104, 2);
+ * batch.poke64(0x108, 3);
+ * batch.commit();
+ * ~~~
+ *
+ * Writes are executed in the order they were added. Writes that were never
+ * committed are discarded.
+ */
+class register_write_batch
+{
+public:
+    register_write_batch(register_iface& iface) : _iface(iface) {}
+
+    //! Add a write of a 32-bit register to the batch
+    void poke32(uint32_t addr, uint32_t data)
+    {
+        _addrs.push_back(addr);
+        _data.push_back(data);
+    }
+
+    //! Add writes of two consecutive 32-bit registers to the batch
+    void poke64(uint32_t addr, uint64_t data)
+    {
+        poke32(addr, uint32_t(data & 0xFFFFFFFF));
+        poke32(addr + 4, uint32_t((data >> 32) & 0xFFFFFFFF));
+    }
+
+    //! Return the number of writes that haven't been committed yet
+    size_t size() const
+    {
+        return _addrs.size();
+    }
+
+    /*! Send all writes in the batch and clear it
+     *
+     * \param time The time at which the first write should be executed.
+     * \param ack Should the completion of the last write be acknowledged?
+     *
+     * \throws op_failed if an ACK is requested and the transaction fails
+     * \throws op_timeout if an ACK is requested and no response is received
+     * \throws op_seqerr if an ACK is requested and a sequence error occurs
+     * \throws op_timeerr if an ACK is requested and a time error occurs (late command)
+     */
+    void commit(uhd::time_spec_t time = uhd::time_spec_t::ASAP, bool ack = false)
+    {
+        if (_addrs.empty()) {
+            return;
+        }
+        _iface.multi_poke32(_addrs, _data, time, ack);
+        _addrs.clear();
+        _data.clear();
+    }
+
+private:
+    register_iface& _iface;
+    std::vector<uint32_t> _addrs;
+    std::vector<uint32_t> _data;
+};
+
 }} /* namespace uhd::rfnoc */
@@ -330,6 +330,46 @@ public:
         const double timeout  = 0.1,
         const bool one_packet = false) = 0;
 
+    //! Typedef for read-only pointers to received packet payloads, one per channel
+    typedef std::vector<const void*> wire_buffs_type;
+
+    /*! Receive one packet per channel without copying or converting samples
+     *
+     * Instead of converting samples into user-provided buffers like recv(),
+     * this call returns pointers to the payloads of the received packets
+     * themselves. The samples are in the over-the-wire format of the streamer
+     * (see stream_args_t::otw_format). For formats where the CPU format of
+     * the same name is a plain copy of the wire format (e.g., sc16 or sc8),
+     * the payload can be processed as if it were in that CPU format.
+     *
+     * The packets stay with the application until release_recv_buffs() is
+     * called, and the transport cannot reuse their buffers until then. The
+     * next call to get_recv_buffs() or recv() releases them as well. Hold on
+     * to packets only as long as needed, or the device will overrun.
+     *
+     * If a previous recv() call left part of a packet unread, this call
+     * returns the remainder of that packet, and \p metadata.fragment_offset
+     * is set accordingly. \p metadata is set as it would be by recv() with
+     * \p one_packet set, and error handling is the same as for recv().
+     *
+     * Not all streamers support this call. The default implementation throws
+     * a uhd::not_implemented_error.
+     *
+     * \param[out] buffs pointers to the payload of each channel's packet
+     * \param[out] metadata data to fill describing the packets
+     * \param timeout the timeout in seconds to wait for a packet
+     * \return the number of samples per channel in \p buffs, or 0 on error
+     */
+    virtual size_t get_recv_buffs(
+        wire_buffs_type& buffs, rx_metadata_t& metadata, const double timeout = 0.1);
+
+    /*! Release the packets returned by the last call to get_recv_buffs()
+     *
+     * After this call, the pointers returned by get_recv_buffs() are no longer
+     * valid. It is safe to call this if no packets are held.
+     */
+    virtual void release_recv_buffs(void);
+
     /*!
      * Issue a stream command to the usrp device.
      * This tells the usrp to send samples into the host.
@@ -25,7 +25,37 @@ public:
     typedef std::shared_ptr<buffer_pool> sptr;
     typedef void* ptr_type;
 
-    ~buffer_pool() = default;
+    //! Size of the pages backing the memory of a pool
+    enum class page_size_t {
+        //! Regular pages from the heap
+        DEFAULT,
+        //! 2 MiB huge pages
+        HUGE_2M,
+        //! 1 GiB huge pages
+        HUGE_1G
+    };
+
+    //! No NUMA node, i.e., the memory is not bound to a node
+    static constexpr int NO_NUMA_NODE = -1;
+
+    //! Requested placement of the memory of a pool
+    struct mem_params_t
+    {
+        page_size_t page_size = page_size_t::DEFAULT;
+        //! NUMA node to bind the memory to
+        int numa_node = NO_NUMA_NODE;
+    };
+
+    //! Actual placement of the memory of a pool
+    struct placement_t
+    {
+        //! Size of the pages in bytes, 0 if unknown
+        size_t page_size = 0;
+        //! NUMA node the memory is bound to
+        int numa_node = NO_NUMA_NODE;
+    };
+
+    ~buffer_pool();
 
     /*!
      * Make a new buffer pool.
@@ -37,6 +67,26 @@ public:
     static sptr make(
         const size_t num_buffs, const size_t buff_size, const size_t alignment = 16);
 
+    /*!
+     * Make a new buffer pool in huge pages and/or on a NUMA node.
+     *
+     * Huge pages and NUMA binding are only available on Linux. If the huge
+     * pages can't be allocated (e.g., because none are reserved) or the memory
+     * can't be bound to the node, the pool falls back to regular pages or
+     * unbound memory, respectively. Use get_placement() to find out where the
+     * memory ended up. All memory is touched on allocation.
+     *
+     * \param num_buffs the number of buffers to allocate
+     * \param buff_size the size of each buffer in bytes
+     * \param alignment the alignment boundary in bytes
+     * \param mem_params the requested placement of the memory
+     * \return a new buffer pool buff_size X num_buffs
+     */
+    static sptr make(const size_t num_buffs,
+        const size_t buff_size,
+        const size_t alignment,
+        const mem_params_t& mem_params);
+
     //! Get a pointer to the buffer start at the specified index
     ptr_type at(const size_t index) const
     {
@@ -49,14 +99,17 @@ public:
         return _ptrs.size();
     }
 
+    //! Get the placement of the memory of this pool
+    placement_t get_placement() const;
+
 private:
-    buffer_pool(std::vector<ptr_type>&& ptrs, std::unique_ptr<char[]> mem)
-        : _ptrs(std::move(ptrs)), _mem(std::move(mem))
-    {
-    }
+    //! Owns the memory, and knows how it was allocated
+    struct mem_holder;
+
+    buffer_pool(std::vector<ptr_type>&& ptrs, std::unique_ptr<mem_holder> mem);
 
     std::vector<ptr_type> _ptrs;
-    std::unique_ptr<char[]> _mem;
+    std::unique_ptr<mem_holder> _mem;
 };
 
 }} // namespace uhd::transport
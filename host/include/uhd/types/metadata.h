@@ -110,6 +110,12 @@ UHD_API uhd_error uhd_rx_metadata_has_time_spec(
 UHD_API uhd_error uhd_rx_metadata_time_spec(
     uhd_rx_metadata_handle h, int64_t* full_secs_out, double* frac_secs_out);
 
+//! Time of first sample as a tick count, at a tick rate of rate_num / rate_den Hz
+UHD_API uhd_error uhd_rx_metadata_tick_time(uhd_rx_metadata_handle h,
+    int64_t* ticks_out,
+    uint64_t* rate_num_out,
+    uint64_t* rate_den_out);
+
 //! Fragmentation flag
 UHD_API uhd_error uhd_rx_metadata_more_fragments(
     uhd_rx_metadata_handle h, bool* result_out);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <uhd/config.hpp>
+#include <uhd/types/tick_time.hpp>
 #include <uhd/types/time_spec.hpp>
 #include <stdint.h>
 #include <string>
@@ -41,6 +42,7 @@ struct UHD_API rx_metadata_t
         eov_positions_count = 0;
         error_code          = ERROR_CODE_NONE;
         out_of_sequence     = false;
+        tick_time           = tick_time_t();
     }
 
     //! Has time specification?
@@ -139,6 +141,20 @@ struct UHD_API rx_metadata_t
     //! of order.
     bool out_of_sequence;
 
+    /*!
+     * Time of the first sample as an integer tick count of the device.
+     *
+     * This is the same time as time_spec, but without any rounding: The tick
+     * count is the timestamp of the packet, and the tick rate is the tick
+     * rate of the device. If the first sample of a fragment doesn't fall on
+     * a tick, the tick rate is a multiple of the device's tick rate (see
+     * tick_time_t::operator+=()). If that rate is out of range for a late
+     * timestamp, the time is rounded to the device's tick rate instead, and
+     * only time_spec holds the time between the ticks (see
+     * tick_time_t::add_rounded()). Only valid if has_time_spec is true.
+     */
+    tick_time_t tick_time;
+
     /*!
      * Convert a rx_metadata_t into a pretty print string.
      *
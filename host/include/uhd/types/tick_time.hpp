@@ -0,0 +1,146 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <stdint.h>
+#include <boost/operators.hpp>
+
+namespace uhd {
+
+/*!
+ * A tick_time_t holds a time as an integer count of clock ticks, together
+ * with the tick rate as a fraction of two integers.
+ *
+ * Unlike time_spec_t, a tick_time_t does not use floating point. Adding
+ * sample counts to it and comparing it is exact, no matter how large the
+ * tick count grows. Only the conversion to a time_spec_t rounds.
+ *
+ * When two tick_time_t values with different rates are added, the result
+ * uses the least common multiple of both rates, so that both can be
+ * represented exactly. For example, adding a sample count at 50 MHz to a
+ * tick count at 200 MHz results in a tick count at 200 MHz.
+ */
+class UHD_API tick_time_t : boost::additive<tick_time_t>,
+                            boost::equality_comparable<tick_time_t>
+{
+public:
+    //! A tick rate in Hz, stored as the reduced fraction num / den
+    class UHD_API rate_t : boost::equality_comparable<rate_t>
+    {
+    public:
+        /*!
+         * Create a tick rate from a fraction.
+         * \param num the numerator
+         * \param den the denominator (default = 1)
+         * \throws uhd::value_error if num or den is zero
+         */
+        explicit rate_t(uint64_t num = 1, uint64_t den = 1);
+
+        /*!
+         * Create a tick rate from a real-valued rate in Hz.
+         * Rates which are not integers are approximated by the closest
+         * fraction with a denominator of up to 2^20, e.g., 200e6 / 3.
+         * \param rate the rate in Hz
+         * \throws uhd::value_error if the rate is not positive
+         */
+        static rate_t from_double(double rate);
+
+        //! Get the numerator of the rate
+        uint64_t get_num(void) const;
+
+        //! Get the denominator of the rate
+        uint64_t get_den(void) const;
+
+        //! Get the rate as a real-valued rate in Hz
+        double to_double(void) const;
+
+    private:
+        uint64_t _num;
+        uint64_t _den;
+    };
+
+    /*!
+     * Create a tick_time_t from a tick count.
+     * \param ticks an integer count of ticks
+     * \param rate the number of ticks per second (default = 1 Hz)
+     */
+    tick_time_t(int64_t ticks = 0, const rate_t& rate = rate_t());
+
+    //! Get the tick count
+    int64_t get_ticks(void) const;
+
+    //! Get the tick rate
+    const rate_t& get_rate(void) const;
+
+    /*!
+     * Convert the tick count into a time_spec_t.
+     * The whole seconds are exact, only the fractional seconds are rounded.
+     * \return the time as a time_spec_t
+     */
+    time_spec_t to_time_spec(void) const;
+
+    /*!
+     * Implement addable interface
+     * \throws uhd::overflow_error if the rates differ and either time can't be
+     *         represented at their common rate
+     */
+    tick_time_t& operator+=(const tick_time_t&);
+    /*!
+     * Implement subtractable interface
+     * \throws uhd::overflow_error if the rates differ and either time can't be
+     *         represented at their common rate
+     */
+    tick_time_t& operator-=(const tick_time_t&);
+
+    /*!
+     * Add a time, and round it to this rate if the sum can't be exact.
+     *
+     * This is the same as operator+=(), except when the common rate of both
+     * times is out of range, e.g., for a large tick count and a rate which
+     * doesn't divide this rate. The time then keeps its rate, and rhs is added
+     * rounded to the nearest tick. This never throws.
+     *
+     * \param rhs the time to add
+     * eturn true if the sum is exact, false if it was rounded
+     */
+    bool add_rounded(const tick_time_t& rhs);
+
+private:
+    //! Bring both times to their common rate, return false if it is out of range
+    bool _to_common_rate(tick_time_t& rhs);
+
+    int64_t _ticks;
+    rate_t _rate;
+};
+
+UHD_API bool operator==(const tick_time_t::rate_t&, const tick_time_t::rate_t&);
+
+UHD_API bool operator==(const tick_time_t&, const tick_time_t&);
+
+UHD_INLINE uint64_t tick_time_t::rate_t::get_num(void) const
+{
+    return this->_num;
+}
+
+UHD_INLINE uint64_t tick_time_t::rate_t::get_den(void) const
+{
+    return this->_den;
+}
+
+UHD_INLINE int64_t tick_time_t::get_ticks(void) const
+{
+    return this->_ticks;
+}
+
+UHD_INLINE const tick_time_t::rate_t& tick_time_t::get_rate(void) const
+{
+    return this->_rate;
+}
+
+} // namespace uhd
@@ -0,0 +1,150 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/types/ref_vector.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd {
+
+/*! Writes received samples to files from a pool of background threads
+ *
+ * Writing to disk from the thread that calls uhd::rx_streamer::recv() turns
+ * every file system stall into an overflow. The sample recorder decouples the
+ * two: write() only copies the samples into a ring of preallocated, aligned
+ * blocks, and writer threads flush full blocks to disk. The caller only has
+ * to wait if all blocks of a channel are waiting to be written, i.e. if the
+ * disk can't keep up on average.
+ *
+ * Every channel is written to its own file. The following recorder arguments
+ * are supported:
+ *
+ * - `block_size`: Size of each block in bytes, which is also the size of
+ *   every write to disk. Rounded up to a multiple of 4 KiB. Defaults to
+ *   4 MiB.
+ * - `num_blocks`: Number of blocks per channel. Defaults to 16.
+ * - `num_threads`: Number of writer threads. Defaults to the number of
+ *   channels.
+ * - `direct_io`: On Linux, bypass the page cache by opening files with
+ *   O_DIRECT. Defaults to 1. If the file system does not support it, the
+ *   recorder falls back to regular writes.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto recorder = uhd::sample_recorder::make({"rx_ch0.dat", "rx_ch1.dat"});
+ * while (streaming) {
+ *     const size_t num_samps = rx_stream->recv(buffs, spb, md);
+ *     recorder->write(buffs, num_samps * sizeof(std::complex<short>));
+ * }
+ * recorder->close();
+ * \endcode
+ */
+class UHD_API sample_recorder : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<sample_recorder>;
+
+    //! Typedef for one buffer per channel
+    typedef ref_vector<const void*> buffs_type;
+
+    //! Recorder statistics
+    struct stats_t
+    {
+        //! Number of bytes written to disk, summed over all channels
+        uint64_t bytes_written = 0;
+        //! Number of times write() had to wait for a free block
+        uint64_t num_stalls = 0;
+        //! Total time write() spent waiting for free blocks, in seconds
+        double stall_time = 0.0;
+        //! Largest number of blocks that were waiting to be written at once
+        size_t max_pending_blocks = 0;
+    };
+
+    //! Information for SigMF metadata files
+    struct sigmf_meta_t
+    {
+        //! SigMF data type of the samples, e.g. "ci16_le" or "cf32_le"
+        std::string datatype;
+        //! Sample rate in Hz
+        double sample_rate = 0.0;
+        /*! Center frequency in Hz, either one per channel, or a single value
+         *  for all channels. Leave empty to omit the frequency.
+         */
+        std::vector<double> frequencies;
+        //! Free-form description of the recording, may be empty
+        std::string description;
+        //! Description of the hardware used for the recording, may be empty
+        std::string hw;
+        //! ISO 8601 time of the first sample, may be empty
+        std::string datetime;
+    };
+
+    virtual ~sample_recorder(void) = 0;
+
+    /*! Append samples to the file of one channel
+     *
+     * The data is copied, so \p data can be reused when this call returns.
+     * Blocks if all blocks of the channel are waiting to be written.
+     *
+     * \param chan the channel index, i.e. the index of the file
+     * \param data the data to write
+     * \param num_bytes the number of bytes to write
+     * \throws uhd::io_error if a previous write to disk failed
+     */
+    virtual void write(const size_t chan, const void* data, const size_t num_bytes) = 0;
+
+    /*! Append samples to the files of all channels
+     *
+     * \param buffs one buffer per channel
+     * \param num_bytes the number of bytes to write from each buffer
+     * \throws uhd::io_error if a previous write to disk failed
+     */
+    virtual void write(const buffs_type& buffs, const size_t num_bytes) = 0;
+
+    /*! Write a SigMF metadata file next to each data file
+     *
+     * The metadata file has the name of the data file, with its extension
+     * replaced by `.sigmf-meta`. Data files that don't have the `.sigmf-data`
+     * extension are referenced from the metadata as a non-conforming dataset.
+     */
+    virtual void write_sigmf_meta(const sigmf_meta_t& meta) = 0;
+
+    /*! Flush all samples to disk and close the files
+     *
+     * Called by the destructor if needed. Unlike the destructor, this call
+     * reports errors.
+     *
+     * \throws uhd::io_error if writing to disk failed
+     */
+    virtual void close(void) = 0;
+
+    //! Get the recorder statistics
+    virtual stats_t get_stats(void) const = 0;
+
+    //! Get the number of channels
+    virtual size_t get_num_channels(void) const = 0;
+
+    /*! Create a sample recorder
+     *
+     * The files are created or truncated right away.
+     *
+     * \param filenames the name of the file for each channel
+     * \param args recorder arguments, see the class description
+     * \throws uhd::io_error if a file cannot be opened
+     */
+    static sptr make(const std::vector<std::string>& filenames,
+        const device_addr_t& args = device_addr_t());
+};
+
+} // namespace uhd
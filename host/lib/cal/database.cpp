@@ -14,6 +14,8 @@
 #include <ctime>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -123,6 +125,22 @@ std::string get_cal_path_fs(const std::string& key, const std::string& serial)
     return key + "_" + serial + CAL_EXT;
 }
 
+/*! Cache of cal data files that were read before
+ *
+ * Devices read their cal data every time they are initialized, and often more
+ * than once per session (e.g., once per channel). Entries are keyed by the file
+ * path, and are only used if the file's size and modification time still match,
+ * so files that are changed outside of UHD are re-read.
+ */
+struct fs_cache_entry
+{
+    fs::file_time_type mtime;
+    uintmax_t size;
+    std::vector<uint8_t> data;
+};
+std::mutex fs_cache_mutex;
+std::map<std::string, fs_cache_entry> fs_cache;
+
 //! Return true if a cal data resource with given key exists
 bool has_cal_data_fs(const std::string& key, const std::string& serial)
 {
@@ -151,10 +169,19 @@ std::vector<uint8_t> get_cal_data_fs(const std::string& key, const std::string&
             std::string("The following cal data file exceeds maximum size limitations: ")
             + cal_file_path.string());
     }
+    const auto mtime = fs::last_write_time(cal_file_path);
+    std::lock_guard<std::mutex> lock(fs_cache_mutex);
+    auto cache_it = fs_cache.find(cal_file_path.string());
+    if (cache_it != fs_cache.end() && cache_it->second.mtime == mtime
+        && cache_it->second.size == filesize) {
+        UHD_LOG_TRACE(LOG_ID, "Using cached data for " << cal_file_path);
+        return cache_it->second.data;
+    }
     std::vector<uint8_t> result(filesize, 0);
     std::ifstream file(cal_file_path.string(), std::ios::binary);
     UHD_LOG_TRACE(LOG_ID, "Reading " << filesize << " bytes from " << cal_file_path);
     file.read(reinterpret_cast<char*>(&result[0]), filesize);
+    fs_cache[cal_file_path.string()] = {mtime, filesize, result};
     return result;
 }
 
@@ -264,6 +291,12 @@ void database::write_cal_data(const std::string& key,
         fs::rename(fs::path(cal_file_path), cal_file_path_backup);
     }
 
+    {
+        // The modification time might not have a fine enough resolution to
+        // tell the new file from the old one
+        std::lock_guard<std::mutex> lock(fs_cache_mutex);
+        fs_cache.erase(cal_file_path);
+    }
     std::ofstream file(cal_file_path, std::ios::binary);
     UHD_LOG_DEBUG(LOG_ID, "Writing to " << cal_file_path);
     file.write(reinterpret_cast<const char*>(cal_data.data()), cal_data.size());
@@ -9,7 +9,9 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/interpolation.hpp>
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <string>
 
 using namespace uhd::usrp::cal;
@@ -60,26 +62,26 @@ public:
 
     std::complex<double> get_cal_coeff(const double freq) const override
     {
-        UHD_ASSERT_THROW(!_coeffs.empty());
-        // Find the first coefficient in the map that maps to a larger frequency
-        // than freq (or equal)
-        auto next_coeff = _coeffs.lower_bound(freq);
-        if (next_coeff == _coeffs.end()) {
+        const lut_type& lut = _get_lut();
+        UHD_ASSERT_THROW(!lut.empty());
+        // Find the first coefficient that maps to a larger frequency than freq
+        // (or equal)
+        const size_t next_coeff = lut.lower_bound(freq);
+        if (next_coeff == lut.size()) {
             // This means freq is larger than our biggest key, and thus we
             // can't interpolate. We return the coeffs of the largest key.
-            return _coeffs.rbegin()->second;
+            return lut.value(next_coeff - 1);
         }
-        if (next_coeff == _coeffs.begin()) {
+        if (next_coeff == 0) {
             // This means freq is smaller than our smallest key, and thus we
             // can't interpolate. We return the coeffs of the smallest key.
-            return _coeffs.begin()->second;
+            return lut.value(0);
         }
         // Stash away freqs and coeffs for easier code
-        const auto hi_freq  = next_coeff->first;
-        const auto hi_coeff = next_coeff->second;
-        next_coeff--;
-        const auto lo_coeff = next_coeff->second;
-        const auto lo_freq  = next_coeff->first; // lo == low, not LO
+        const auto hi_freq  = lut.key(next_coeff);
+        const auto hi_coeff = lut.value(next_coeff);
+        const auto lo_coeff = lut.value(next_coeff - 1);
+        const auto lo_freq  = lut.key(next_coeff - 1); // lo == low, not LO
         // Now, we're guaranteed to be between two points
         if (_interp == interp_mode::NEAREST_NEIGHBOR) {
             return (hi_freq - freq) < (freq - lo_freq) ? hi_coeff : lo_coeff;
@@ -99,12 +101,14 @@ public:
     {
         _coeffs[freq] = coeff;
         _supp[freq]   = {suppression_abs, suppression_delta};
+        _lut_dirty    = true;
     }
 
     void clear() override
     {
         _coeffs.clear();
         _supp.clear();
+        _lut_dirty = true;
     }
 
     /**************************************************************************
@@ -171,15 +175,35 @@ public:
             // runtime (and not future storage)
             _supp[it->freq()] = {it->suppression_abs(), it->suppression_delta()};
         }
+        _lut_dirty = true;
     }
 
 
 private:
+    using lut_type = lookup_table<double, std::complex<double>>;
+
+    //! Return the LUT, compiling it first if _coeffs changed since the last call
+    const lut_type& _get_lut() const
+    {
+        if (_lut_dirty.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(_lut_mutex);
+            if (_lut_dirty.load(std::memory_order_relaxed)) {
+                _lut = lut_type(_coeffs);
+                _lut_dirty.store(false, std::memory_order_release);
+            }
+        }
+        return _lut;
+    }
+
     std::string _name;
     std::string _serial;
     uint64_t _timestamp;
     using coeffs_type = std::map<double, std::complex<double>>;
     coeffs_type _coeffs;
+    //! Compiled form of _coeffs, which is what get_cal_coeff() uses (see _get_lut())
+    mutable lut_type _lut;
+    mutable std::atomic<bool> _lut_dirty{false};
+    mutable std::mutex _lut_mutex;
     // Abs suppression, delta suppression
     std::map<double, std::pair<double, double>> _supp;
 
@@ -10,7 +10,9 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/interpolation.hpp>
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <string>
 
 using namespace uhd::usrp::cal;
@@ -86,9 +88,9 @@ public:
                             + std::to_string(min_power) + " dBm, "
                             + std::to_string(max_power) + " dBm)"));
         }
-        const int temp                           = temperature.value_or(_default_temp);
-        _data[temp][static_cast<uint64_t>(freq)] = {
-            gain_power_map, reverse_map(gain_power_map), min_power, max_power};
+        const int temp = temperature.value_or(_default_temp);
+        _add_power_table(gain_power_map, min_power, max_power, freq, temp);
+        _luts_dirty = true;
     }
 
     // Note: This is very similar to at_bilin_interp(), but we can't use that
@@ -102,30 +104,31 @@ public:
         const uint64_t freqi = static_cast<uint64_t>(freq);
         const auto& table    = _get_table(temperature);
 
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
+        const auto f_idxs  = table.get_bounding_indices(freqi);
+        const uint64_t f1i = table.key(f_idxs.first);
+        const uint64_t f2i = table.key(f_idxs.second);
+        const auto& g2p1   = table.value(f_idxs.first)->g2p_lut;
         // Frequency is out of bounds
         if (f1i == f2i) {
-            return at_lin_interp(table.at(f1i).g2p, gain);
+            return g2p1.at_lin_interp(gain);
         }
+        const auto& g2p2      = table.value(f_idxs.second)->g2p_lut;
         const double f1       = static_cast<double>(f1i);
         const double f2       = static_cast<double>(f2i);
-        const auto gain_iters = get_bounding_iterators(table.at(f1).g2p, gain);
-        const double gain1    = gain_iters.first->first;
-        const double gain2    = gain_iters.second->first;
+        const auto gain_idxs  = g2p1.get_bounding_indices(gain);
+        const double gain1    = g2p1.key(gain_idxs.first);
+        const double gain2    = g2p1.key(gain_idxs.second);
         // Gain is out of bounds
         if (gain1 == gain2) {
-            return linear_interp(
-                freq, f1, table.at(f1i).g2p.at(gain1), f2, table.at(f2i).g2p.at(gain1));
+            return linear_interp(freq, f1, g2p1.at(gain1), f2, g2p2.at(gain1));
         }
 
         // Both gain and freq are within bounds: Bi-Linear interpolation
         // Find power values
-        const auto power11 = table.at(f1i).g2p.at(gain1);
-        const auto power12 = table.at(f1i).g2p.at(gain2);
-        const auto power21 = table.at(f2i).g2p.at(gain1);
-        const auto power22 = table.at(f2i).g2p.at(gain2);
+        const auto power11 = g2p1.at(gain1);
+        const auto power12 = g2p1.at(gain2);
+        const auto power21 = g2p2.at(gain1);
+        const auto power22 = g2p2.at(gain2);
 
         return bilinear_interp(
             freq, gain, f1, gain1, f2, gain2, power11, power12, power21, power22);
@@ -134,6 +137,7 @@ public:
     void clear() override
     {
         _data.clear();
+        _luts_dirty = true;
     }
 
     void set_temperature(const int temperature) override
@@ -159,7 +163,7 @@ public:
     uhd::meta_range_t get_power_limits(
         const double freq, const std::optional<int> temperature = {}) const override
     {
-        const auto table = at_nearest(_get_table(temperature), uint64_t(freq));
+        const auto& table = *_get_table(temperature).at_nearest(uint64_t(freq));
         return uhd::meta_range_t(table.min_power, table.max_power);
     }
 
@@ -172,13 +176,15 @@ public:
         const auto& table          = _get_table(temperature);
         const double power_coerced = get_power_limits(freq, temperature).clip(power_dbm);
 
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
+        const auto f_idxs  = table.get_bounding_indices(freqi);
+        const uint64_t f1i = table.key(f_idxs.first);
+        const uint64_t f2i = table.key(f_idxs.second);
+        const auto& p2g1   = table.value(f_idxs.first)->p2g_lut;
         if (f1i == f2i) {
             // Frequency is out of bounds
-            return at_lin_interp(table.at(f1i).p2g, power_coerced);
+            return p2g1.at_lin_interp(power_coerced);
         }
+        const auto& p2g2 = table.value(f_idxs.second)->p2g_lut;
 
         // NOTE: bilinear_interp() does not interpolate on an arbitrary tetragon,
         // but requires the coordinates to be on a rectangular grid. Due to the
@@ -188,31 +194,28 @@ public:
         // nearest-neighbor-interpolate the grid coordinates for the power.
         // This snap-to-grid adds another error, which can be counteracted by
         // good choice of frequency and gain points on which to sample.
-        const auto f1pwr_iters = get_bounding_iterators(table.at(f1i).p2g, power_coerced);
-        const double f1pwr1    = f1pwr_iters.first->first;
-        const double f1pwr2    = f1pwr_iters.second->first;
-        const auto f2pwr_iters = get_bounding_iterators(table.at(f2i).p2g, power_coerced);
-        const double f2pwr1    = f2pwr_iters.first->first;
-        const double f2pwr2    = f2pwr_iters.second->first;
-        const double f1        = static_cast<double>(f1i);
-        const double f2        = static_cast<double>(f2i);
-        const double pwr1      = linear_interp(freq, f1, f1pwr1, f2, f2pwr1);
-        const double pwr2      = linear_interp(freq, f1, f1pwr2, f2, f2pwr2);
+        const auto f1pwr_idxs = p2g1.get_bounding_indices(power_coerced);
+        const double f1pwr1   = p2g1.key(f1pwr_idxs.first);
+        const double f1pwr2   = p2g1.key(f1pwr_idxs.second);
+        const auto f2pwr_idxs = p2g2.get_bounding_indices(power_coerced);
+        const double f2pwr1   = p2g2.key(f2pwr_idxs.first);
+        const double f2pwr2   = p2g2.key(f2pwr_idxs.second);
+        const double f1       = static_cast<double>(f1i);
+        const double f2       = static_cast<double>(f2i);
+        const double pwr1     = linear_interp(freq, f1, f1pwr1, f2, f2pwr1);
+        const double pwr2     = linear_interp(freq, f1, f1pwr2, f2, f2pwr2);
         // Power is out of bounds (this shouldn't happen after coercing, but this
         // is just another good sanity check on our data)
         if (pwr1 == pwr2) {
-            return linear_interp(freq,
-                f1,
-                at_nearest(table.at(f1i).p2g, pwr1),
-                f2,
-                at_nearest(table.at(f2i).p2g, pwr2));
+            return linear_interp(
+                freq, f1, p2g1.at_nearest(pwr1), f2, p2g2.at_nearest(pwr2));
         }
         // Both gain and freq are within bounds => Bi-Linear interpolation
         // Find gain values:
-        const auto gain11 = table.at(f1i).p2g.at(f1pwr1);
-        const auto gain12 = table.at(f1i).p2g.at(f1pwr2);
-        const auto gain21 = table.at(f2i).p2g.at(f2pwr1);
-        const auto gain22 = table.at(f2i).p2g.at(f2pwr2);
+        const auto gain11 = p2g1.value(f1pwr_idxs.first);
+        const auto gain12 = p2g1.value(f1pwr_idxs.second);
+        const auto gain21 = p2g2.value(f2pwr_idxs.first);
+        const auto gain22 = p2g2.value(f2pwr_idxs.second);
         return bilinear_interp(
             freq, power_coerced, f1, pwr1, f2, pwr2, gain11, gain12, gain21, gain22);
     }
@@ -300,13 +303,14 @@ public:
                 for (auto g_it = power_map->begin(); g_it != power_map->end(); ++g_it) {
                     power.insert({g_it->gain(), g_it->power_dbm()});
                 }
-                add_power_table(power,
+                _add_power_table(power,
                     f_it->min_power(),
                     f_it->max_power(),
                     f_it->freq(),
                     temperature);
             }
         }
+        _luts_dirty = true;
     }
 
 
@@ -314,19 +318,73 @@ private:
     // We map the gain to power, and power to gain, in different data structures.
     // This is suboptimal w.r.t. memory usage (it duplicates the keys/values),
     // but helps us with the algorithms above.
+    //
+    // Lookups don't use the maps directly, but their compiled forms (see
+    // lookup_table), which are rebuilt on the first lookup after the maps
+    // change.
     struct pwr_cal_table
     {
         std::map<double, double> g2p; //!< Maps gain to power
         std::map<double, double> p2g; //!< Maps power to gain
         double min_power;
         double max_power;
+        lookup_table<double, double> g2p_lut; //!< Compiled form of g2p
+        lookup_table<double, double> p2g_lut; //!< Compiled form of p2g
     };
 
     using freq_table_map = std::map<uint64_t /* freq */, pwr_cal_table>;
+    //! Compiled form of a freq_table_map. Points into the map's entries.
+    using freq_table_lut = lookup_table<uint64_t /* freq */, const pwr_cal_table*>;
+
+    void _add_power_table(const std::map<double, double>& gain_power_map,
+        const double min_power,
+        const double max_power,
+        const double freq,
+        const int temperature)
+    {
+        const auto power_gain_map = reverse_map(gain_power_map);
+        _data[temperature][static_cast<uint64_t>(freq)] = {gain_power_map,
+            power_gain_map,
+            min_power,
+            max_power,
+            lookup_table<double, double>(gain_power_map),
+            lookup_table<double, double>(power_gain_map)};
+    }
+
+    //! Build the frequency lookup table for one temperature
+    static freq_table_lut _compile(const freq_table_map& freq_tables)
+    {
+        std::map<uint64_t, const pwr_cal_table*> tables;
+        for (const auto& freq_table_pair : freq_tables) {
+            tables.emplace(freq_table_pair.first, &freq_table_pair.second);
+        }
+        return freq_table_lut(tables);
+    }
+
+    //! Return the LUTs, compiling them first if _data changed since the last call
+    const std::map<int, freq_table_lut>& _get_luts() const
+    {
+        if (_luts_dirty.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(_luts_mutex);
+            if (_luts_dirty.load(std::memory_order_relaxed)) {
+                _luts.clear();
+                for (const auto& temp_freq_pair : _data) {
+                    _luts.emplace(temp_freq_pair.first, _compile(temp_freq_pair.second));
+                }
+                _luts_dirty.store(false, std::memory_order_release);
+            }
+        }
+        return _luts;
+    }
 
-    freq_table_map _get_table(const std::optional<int> temperature) const
+    //! Return the compiled table for the temperature closest to the given one
+    const freq_table_lut& _get_table(const std::optional<int> temperature) const
     {
-        return at_nearest(_data, temperature.value_or(_default_temp));
+        const int temp        = temperature.value_or(_default_temp);
+        const auto temp_iters = get_bounding_iterators(_get_luts(), temp);
+        return (temp_iters.second->first - temp < temp - temp_iters.first->first)
+                   ? temp_iters.second->second
+                   : temp_iters.first->second;
     }
 
     std::string _name;
@@ -335,6 +393,10 @@ private:
 
     //! The actual gain table
     std::map<int /* temp */, freq_table_map> _data;
+    //! Compiled form of _data, which is what lookups use (see _get_luts())
+    mutable std::map<int /* temp */, freq_table_lut> _luts;
+    mutable std::atomic<bool> _luts_dirty{false};
+    mutable std::mutex _luts_mutex;
     double _ref_gain  = 0.0;
     int _default_temp = NORMAL_TEMPERATURE;
 };
@@ -10,7 +10,7 @@
 
 using namespace uhd::convert;
 
-DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
@@ -48,7 +48,7 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD)
     xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
 }
 
-DECLARE_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
@@ -84,7 +84,7 @@ DECLARE_CONVERTER(fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD)
     xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
 }
 
-DECLARE_CONVERTER(fc32, 1, sc16_chdr, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(fc32, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
     sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
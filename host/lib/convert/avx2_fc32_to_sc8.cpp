@@ -11,7 +11,7 @@
 using namespace uhd::convert;
 
 template <const int shuf>
-UHD_INLINE __m256i pack_sc32_4x(const __m256& in0,
+UHD_TARGET_AVX2 UHD_INLINE __m256i pack_sc32_4x(const __m256& in0,
     const __m256& in1,
     const __m256& in2,
     const __m256& in3,
@@ -41,7 +41,7 @@ UHD_INLINE __m256i pack_sc32_4x(const __m256& in0,
     return _mm256_packs_epi16(shuf_lo, shuf_hi);
 }
 
-DECLARE_CONVERTER(fc32, 1, sc8_item32_be, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(fc32, 1, sc8_item32_be, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
@@ -69,7 +69,7 @@ DECLARE_CONVERTER(fc32, 1, sc8_item32_be, 1, PRIORITY_SIMD)
     xx_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
 }
 
-DECLARE_CONVERTER(fc32, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(fc32, 1, sc8_item32_le, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
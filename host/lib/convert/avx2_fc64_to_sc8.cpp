@@ -10,7 +10,7 @@
 
 using namespace uhd::convert;
 
-UHD_INLINE __m256i pack_sc8_item32_4x(
+UHD_TARGET_AVX2 UHD_INLINE __m256i pack_sc8_item32_4x(
     const __m256i& in0, const __m256i& in1, const __m256i& in2, const __m256i& in3)
 {
     const __m256i shuffled_in0_lo = _mm256_permute2x128_si256(in0, in1, 0x20);
@@ -20,10 +20,13 @@ UHD_INLINE __m256i pack_sc8_item32_4x(
 
     const __m256i lo = _mm256_packs_epi32(shuffled_in0_lo, shuffled_in0_hi);
     const __m256i hi = _mm256_packs_epi32(shuffled_in1_lo, shuffled_in1_hi);
-    return _mm256_packs_epi16(lo, hi);
+
+    const __m256i shuffled_lo = _mm256_permute2x128_si256(lo, hi, 0x20);
+    const __m256i shuffled_hi = _mm256_permute2x128_si256(lo, hi, 0x31);
+    return _mm256_packs_epi16(shuffled_lo, shuffled_hi);
 }
 
-UHD_INLINE __m256i pack_sc32_4x(
+UHD_TARGET_AVX2 UHD_INLINE __m256i pack_sc32_4x(
     const __m256d& lo, const __m256d& hi, const __m256d& scalar)
 {
     const __m128i tmpi_lo = _mm256_cvttpd_epi32(_mm256_mul_pd(hi, scalar));
@@ -32,7 +35,7 @@ UHD_INLINE __m256i pack_sc32_4x(
     return _mm256_set_m128i(tmpi_hi, tmpi_lo);
 }
 
-DECLARE_CONVERTER(fc64, 1, sc8_item32_be, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(fc64, 1, sc8_item32_be, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
@@ -66,12 +69,14 @@ DECLARE_CONVERTER(fc64, 1, sc8_item32_be, 1, PRIORITY_SIMD)
     xx_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
 }
 
-DECLARE_CONVERTER(fc64, 1, sc8_item32_le, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(fc64, 1, sc8_item32_le, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
 
-    const __m256d scalar = _mm256_set1_pd(scale_factor);
+    const __m256d scalar  = _mm256_set1_pd(scale_factor);
+    const __m256i bswap32 = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7,
+        0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
 
     size_t i = 0;
 
@@ -87,12 +92,11 @@ DECLARE_CONVERTER(fc64, 1, sc8_item32_le, 1, PRIORITY_SIMD)
         __m256d tmp7 = _mm256_loadu_pd(reinterpret_cast<const double*>(input + i + 14));
 
         /* interleave */
-        __m256i tmpi = pack_sc8_item32_4x(pack_sc32_4x(tmp0, tmp1, scalar),
-            pack_sc32_4x(tmp2, tmp3, scalar),
-            pack_sc32_4x(tmp4, tmp5, scalar),
-            pack_sc32_4x(tmp6, tmp7, scalar));
-        tmpi         = _mm256_or_si256(
-            _mm256_srli_epi16(tmpi, 8), _mm256_slli_epi16(tmpi, 8)); /*byteswap*/
+        __m256i tmpi = pack_sc8_item32_4x(pack_sc32_4x(tmp1, tmp0, scalar),
+            pack_sc32_4x(tmp3, tmp2, scalar),
+            pack_sc32_4x(tmp5, tmp4, scalar),
+            pack_sc32_4x(tmp7, tmp6, scalar));
+        tmpi         = _mm256_shuffle_epi8(tmpi, bswap32); /* byteswap */
 
         /* store to output */
         _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + j), tmpi);
@@ -0,0 +1,85 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_pack_sc12.hpp"
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*
+ * Pack 8 sc16 samples into sc12_chdr format and store them to output. Writes
+ * 28 bytes to output, the last 4 of which are zero.
+ */
+UHD_TARGET_AVX2 UHD_FORCE_INLINE void store_chdr_sc12_8x(
+    const __m256i in, uint8_t* output)
+{
+    /* keep the upper 12 bits of I and Q, in bits 0..23 of each 32-bit lane */
+    const __m256i re =
+        _mm256_and_si256(_mm256_srli_epi32(in, 4), _mm256_set1_epi32(0x00000fff));
+    const __m256i im =
+        _mm256_and_si256(_mm256_srli_epi32(in, 8), _mm256_set1_epi32(0x00fff000));
+
+    /* drop the unused top byte of every lane, leaving 12 bytes per 128 bits */
+    const __m256i tmpi = _mm256_shuffle_epi8(_mm256_or_si256(re, im),
+        _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+
+    /* the second store overwrites the 4 unused bytes of the first one */
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(output + 0), _mm256_castsi256_si128(tmpi));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(output + 12), _mm256_extracti128_si256(tmpi, 1));
+}
+
+DECLARE_TARGET_CONVERTER(fc32, 1, sc12_chdr, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    uint8_t* output     = reinterpret_cast<uint8_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+
+    // Every iteration writes 28 bytes, i.e., past the 8 samples being converted
+    for (; i + 9 < nsamps; i += 8) {
+        /* load from input and scale */
+        __m256 tmplo = _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m256 tmphi = _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 4));
+        tmplo        = _mm256_mul_ps(tmplo, scalar);
+        tmphi        = _mm256_mul_ps(tmphi, scalar);
+
+        /* convert to int16 with saturation: [s0 s1 s4 s5 | s2 s3 s6 s7] */
+        __m256i tmpi =
+            _mm256_packs_epi32(_mm256_cvtps_epi32(tmplo), _mm256_cvtps_epi32(tmphi));
+
+        /* restore sample order */
+        tmpi = _mm256_permute4x64_epi64(tmpi, _MM_SHUFFLE(3, 1, 2, 0));
+
+        store_chdr_sc12_8x(tmpi, output + 3 * i);
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc12(input + i, output + 3 * i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(sc16, 1, sc12_chdr, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    uint8_t* output     = reinterpret_cast<uint8_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    // Every iteration writes 28 bytes, i.e., past the 8 samples being converted
+    for (; i + 9 < nsamps; i += 8) {
+        const __m256i tmpi =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        store_chdr_sc12_8x(tmpi, output + 3 * i);
+    }
+
+    // convert any remaining samples
+    sc16_to_chdr_sc12(input + i, output + 3 * i, nsamps - i);
+}
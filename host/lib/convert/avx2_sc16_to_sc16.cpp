@@ -10,7 +10,7 @@
 
 using namespace uhd::convert;
 
-DECLARE_CONVERTER(sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
@@ -35,7 +35,7 @@ DECLARE_CONVERTER(sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD)
     xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
 }
 
-DECLARE_CONVERTER(sc16, 1, sc16_item32_be, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(sc16, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
     item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
@@ -61,7 +61,7 @@ DECLARE_CONVERTER(sc16, 1, sc16_item32_be, 1, PRIORITY_SIMD)
     xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, 1.0);
 }
 
-DECLARE_CONVERTER(sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
     sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
@@ -86,7 +86,7 @@ DECLARE_CONVERTER(sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD)
     item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
 }
 
-DECLARE_CONVERTER(sc16_item32_be, 1, sc16, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(sc16_item32_be, 1, sc16, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
     sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
@@ -10,16 +10,15 @@
 
 using namespace uhd::convert;
 
-static const __m256i zeroi = _mm256_setzero_si256();
-
 template <const int shuf>
-UHD_INLINE void unpack_sc32_4x(const __m256i& in,
+UHD_TARGET_AVX2 UHD_INLINE void unpack_sc32_4x(const __m256i& in,
     __m256& out0,
     __m256& out1,
     __m256& out2,
     __m256& out3,
     const __m256& scalar)
 {
+    const __m256i zeroi = _mm256_setzero_si256();
     const __m256i tmplo = _mm256_unpacklo_epi8(zeroi, in); /* value in upper 8 bits */
     __m256i tmp0        = _mm256_shuffle_epi32(
         _mm256_unpacklo_epi16(zeroi, tmplo), shuf); /* value in upper 16 bits */
@@ -32,9 +31,19 @@ UHD_INLINE void unpack_sc32_4x(const __m256i& in,
     __m256i tmp3        = _mm256_shuffle_epi32(_mm256_unpackhi_epi16(zeroi, tmphi), shuf);
     out2                = _mm256_mul_ps(_mm256_cvtepi32_ps(tmp2), scalar);
     out3                = _mm256_mul_ps(_mm256_cvtepi32_ps(tmp3), scalar);
+
+    /* the unpacks work within 128-bit lanes, put the samples back in order */
+    const __m256 lane0 = _mm256_permute2f128_ps(out0, out1, 0x20);
+    const __m256 lane1 = _mm256_permute2f128_ps(out2, out3, 0x20);
+    const __m256 lane2 = _mm256_permute2f128_ps(out0, out1, 0x31);
+    const __m256 lane3 = _mm256_permute2f128_ps(out2, out3, 0x31);
+    out0               = lane0;
+    out1               = lane1;
+    out2               = lane2;
+    out3               = lane3;
 }
 
-DECLARE_CONVERTER(sc8_item32_be, 1, fc32, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(sc8_item32_be, 1, fc32, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
     fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
@@ -69,7 +78,7 @@ DECLARE_CONVERTER(sc8_item32_be, 1, fc32, 1, PRIORITY_SIMD)
     item32_sc8_to_xx<uhd::ntohx>(input + i, output + j, num_samps - j, scale_factor);
 }
 
-DECLARE_CONVERTER(sc8_item32_le, 1, fc32, 1, PRIORITY_SIMD)
+DECLARE_TARGET_CONVERTER(sc8_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
 {
     const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
     fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
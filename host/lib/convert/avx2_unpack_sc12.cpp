@@ -0,0 +1,86 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*
+ * Load 8 sc12_chdr samples and expand them into one 32-bit lane per sample,
+ * holding bytes 3k, 3k+1, 3k+1 and 3k+2 of sample k. I then sits in bits
+ * 0..11 of the lane, Q in bits 20..31. Reads 28 bytes from input.
+ */
+UHD_TARGET_AVX2 UHD_FORCE_INLINE __m256i load_chdr_sc12_8x(const uint8_t* input)
+{
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 0));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 12));
+    const __m256i tmpi = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+    return _mm256_shuffle_epi8(tmpi,
+        _mm256_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+            0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11));
+}
+
+DECLARE_TARGET_CONVERTER(sc12_chdr, 1, fc32, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
+{
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(inputs[0]);
+    fc32_t* output       = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m256 scalar  = _mm256_set1_ps(float(scale_factor));
+    const __m256i q_mask = _mm256_set1_epi32(0xfff00000);
+
+    size_t i = 0;
+
+    // Every iteration reads 28 bytes, i.e., past the 8 samples being converted
+    for (; i + 9 < nsamps; i += 8) {
+        const __m256i tmpi = load_chdr_sc12_8x(input + 3 * i);
+
+        /* move I and Q to the upper 12 bits of an int16 and sign-extend */
+        const __m256i re = _mm256_srai_epi32(_mm256_slli_epi32(tmpi, 20), 16);
+        const __m256i im = _mm256_srai_epi32(_mm256_and_si256(tmpi, q_mask), 16);
+
+        /* convert to float and scale */
+        const __m256 ref = _mm256_mul_ps(_mm256_cvtepi32_ps(re), scalar);
+        const __m256 imf = _mm256_mul_ps(_mm256_cvtepi32_ps(im), scalar);
+
+        /* interleave: [s0 s1 | s4 s5] and [s2 s3 | s6 s7] */
+        const __m256 tmplo = _mm256_unpacklo_ps(ref, imf);
+        const __m256 tmphi = _mm256_unpackhi_ps(ref, imf);
+
+        /* store to output in sample order */
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 0),
+            _mm256_permute2f128_ps(tmplo, tmphi, 0x20));
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 4),
+            _mm256_permute2f128_ps(tmplo, tmphi, 0x31));
+    }
+
+    // convert any remaining samples
+    chdr_sc12_to_xx(input + 3 * i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(sc12_chdr, 1, sc16, 1, PRIORITY_SIMD_AVX2, UHD_TARGET_AVX2)
+{
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(inputs[0]);
+    sc16_t* output       = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    // Every iteration reads 28 bytes, i.e., past the 8 samples being converted
+    for (; i + 9 < nsamps; i += 8) {
+        const __m256i tmpi = load_chdr_sc12_8x(input + 3 * i);
+
+        /* move I to the upper 12 bits of the lower int16, Q is already in place */
+        const __m256i re = _mm256_slli_epi16(tmpi, 4);
+        const __m256i im = _mm256_and_si256(tmpi, _mm256_set1_epi32(0xfff00000));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+            _mm256_blend_epi16(re, im, 0xaa));
+    }
+
+    // convert any remaining samples
+    chdr_sc12_to_sc16(input + 3 * i, output + i, nsamps - i);
+}
@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 16 fc32 samples to 16-bit I/Q (in host order) with saturation
+ */
+UHD_TARGET_AVX512 UHD_INLINE __m512i pack_fc32_16x_to_sc16(
+    const __m512& in0, const __m512& in1, const __m512& scalar)
+{
+    /* convert and scale */
+    const __m512i tmpi0 = _mm512_cvtps_epi32(_mm512_mul_ps(in0, scalar));
+    const __m512i tmpi1 = _mm512_cvtps_epi32(_mm512_mul_ps(in1, scalar));
+
+    /* unlike packs, the saturating down-conversion keeps the sample order */
+    return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtsepi32_epi16(tmpi0)),
+        _mm512_cvtsepi32_epi16(tmpi1),
+        1);
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512 tmplo = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmphi = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        __m512i tmpi = pack_fc32_16x_to_sc16(tmplo, tmphi, scalar);
+
+        /* swap 16-bit pairs */
+        tmpi = _mm512_rol_epi32(tmpi, 16);
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc32, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512 tmplo = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmphi = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        __m512i tmpi = pack_fc32_16x_to_sc16(tmplo, tmphi, scalar);
+
+        /* byteswap 16 bit words */
+        tmpi = _mm512_or_si512(_mm512_srli_epi16(tmpi, 8), _mm512_slli_epi16(tmpi, 8));
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(fc32, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512 tmplo = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmphi = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        const __m512i tmpi = pack_fc32_16x_to_sc16(tmplo, tmphi, scalar);
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,81 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 16 fc32 samples to 8-bit I/Q (eight item32) with saturation. The
+ * shuffle puts the four values of each item32 into wire order.
+ */
+template <const _MM_PERM_ENUM shuf>
+UHD_TARGET_AVX512 UHD_INLINE __m256i pack_fc32_16x_to_sc8(
+    const __m512& in0, const __m512& in1, const __m512& scalar)
+{
+    /* convert and scale */
+    __m512i tmpi0 = _mm512_cvtps_epi32(_mm512_mul_ps(in0, scalar));
+    __m512i tmpi1 = _mm512_cvtps_epi32(_mm512_mul_ps(in1, scalar));
+    tmpi0         = _mm512_shuffle_epi32(tmpi0, shuf);
+    tmpi1         = _mm512_shuffle_epi32(tmpi1, shuf);
+
+    /* unlike packs, the saturating down-conversion keeps the sample order */
+    return _mm256_set_m128i(_mm512_cvtsepi32_epi8(tmpi1), _mm512_cvtsepi32_epi8(tmpi0));
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc32, 1, sc8_item32_be, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+
+    for (size_t j = 0; i + 15 < nsamps; i += 16, j += 8) {
+        /* load from input */
+        __m512 tmp0 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmp1 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        /* convert, the values are already in order */
+        const __m256i tmpi = pack_fc32_16x_to_sc8<_MM_PERM_DCBA>(tmp0, tmp1, scalar);
+
+        /* store to output */
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + j), tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc32, 1, sc8_item32_le, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+
+    for (size_t j = 0; i + 15 < nsamps; i += 16, j += 8) {
+        /* load from input */
+        __m512 tmp0 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m512 tmp1 = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i + 8));
+
+        /* convert + reverse the values within each item32 */
+        const __m256i tmpi = pack_fc32_16x_to_sc8<_MM_PERM_ABCD>(tmp0, tmp1, scalar);
+
+        /* store to output */
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + j), tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc8<uhd::htowx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
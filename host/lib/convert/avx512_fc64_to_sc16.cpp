@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Load 16 fc64 samples and convert them to 16-bit I/Q (in host order) with
+ * saturation
+ */
+UHD_TARGET_AVX512 UHD_INLINE __m512i pack_fc64_16x_to_sc16(
+    const fc64_t* input, const __m512d& scalar)
+{
+    /* load from input */
+    const __m512d tmp0 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + 0));
+    const __m512d tmp1 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + 4));
+    const __m512d tmp2 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + 8));
+    const __m512d tmp3 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + 12));
+
+    /* convert and scale */
+    const __m256i tmpi0 = _mm512_cvttpd_epi32(_mm512_mul_pd(tmp0, scalar));
+    const __m256i tmpi1 = _mm512_cvttpd_epi32(_mm512_mul_pd(tmp1, scalar));
+    const __m256i tmpi2 = _mm512_cvttpd_epi32(_mm512_mul_pd(tmp2, scalar));
+    const __m256i tmpi3 = _mm512_cvttpd_epi32(_mm512_mul_pd(tmp3, scalar));
+
+    const __m512i tmpilo = _mm512_inserti64x4(_mm512_castsi256_si512(tmpi0), tmpi1, 1);
+    const __m512i tmpihi = _mm512_inserti64x4(_mm512_castsi256_si512(tmpi2), tmpi3, 1);
+
+    /* unlike packs, the saturating down-conversion keeps the sample order */
+    return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtsepi32_epi16(tmpilo)),
+        _mm512_cvtsepi32_epi16(tmpihi),
+        1);
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc64, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        __m512i tmpi = pack_fc64_16x_to_sc16(input + i, scalar);
+
+        /* swap 16-bit pairs */
+        tmpi = _mm512_rol_epi32(tmpi, 16);
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc64, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        __m512i tmpi = pack_fc64_16x_to_sc16(input + i, scalar);
+
+        /* byteswap 16 bit words */
+        tmpi = _mm512_or_si512(_mm512_srli_epi16(tmpi, 8), _mm512_slli_epi16(tmpi, 8));
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(fc64, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        const __m512i tmpi = pack_fc64_16x_to_sc16(input + i, scalar);
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, tmpi);
+    }
+
+    // convert remainder
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
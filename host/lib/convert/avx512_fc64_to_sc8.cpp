@@ -0,0 +1,90 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 8 fc64 samples to 8-bit I/Q (four item32) with saturation. The
+ * shuffle puts the four values of each item32 into wire order.
+ */
+template <const _MM_PERM_ENUM shuf>
+UHD_TARGET_AVX512 UHD_INLINE __m128i pack_fc64_8x_to_sc8(
+    const __m512d& in0, const __m512d& in1, const __m512d& scalar)
+{
+    /* convert and scale */
+    const __m256i tmpi0 = _mm512_cvttpd_epi32(_mm512_mul_pd(in0, scalar));
+    const __m256i tmpi1 = _mm512_cvttpd_epi32(_mm512_mul_pd(in1, scalar));
+
+    __m512i tmpi = _mm512_inserti64x4(_mm512_castsi256_si512(tmpi0), tmpi1, 1);
+    tmpi         = _mm512_shuffle_epi32(tmpi, shuf);
+
+    /* unlike packs, the saturating down-conversion keeps the sample order */
+    return _mm512_cvtsepi32_epi8(tmpi);
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc64, 1, sc8_item32_be, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (size_t j = 0; i + 15 < nsamps; i += 16, j += 8) {
+        /* load from input */
+        __m512d tmp0 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 0));
+        __m512d tmp1 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 4));
+        __m512d tmp2 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 8));
+        __m512d tmp3 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 12));
+
+        /* convert, the values are already in order */
+        const __m256i tmpi =
+            _mm256_set_m128i(pack_fc64_8x_to_sc8<_MM_PERM_DCBA>(tmp2, tmp3, scalar),
+                pack_fc64_8x_to_sc8<_MM_PERM_DCBA>(tmp0, tmp1, scalar));
+
+        /* store to output */
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + j), tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc8<uhd::htonx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(
+    fc64, 1, sc8_item32_le, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (size_t j = 0; i + 15 < nsamps; i += 16, j += 8) {
+        /* load from input */
+        __m512d tmp0 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 0));
+        __m512d tmp1 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 4));
+        __m512d tmp2 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 8));
+        __m512d tmp3 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + i + 12));
+
+        /* convert + reverse the values within each item32 */
+        const __m256i tmpi =
+            _mm256_set_m128i(pack_fc64_8x_to_sc8<_MM_PERM_ABCD>(tmp2, tmp3, scalar),
+                pack_fc64_8x_to_sc8<_MM_PERM_ABCD>(tmp0, tmp1, scalar));
+
+        /* store to output */
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + j), tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc8<uhd::htowx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
@@ -0,0 +1,106 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 16 samples of 16-bit I/Q (in host order) to fc64 and store them
+ */
+UHD_TARGET_AVX512 UHD_INLINE void unpack_sc16_16x_to_fc64(
+    const __m512i& in, fc64_t* output, const __m512d& scalar)
+{
+    /* sign-extend int16 to int32 */
+    const __m512i int32_lo = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(in));
+    const __m512i int32_hi = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(in, 1));
+
+    /* convert to double and scale */
+    const __m512d tmp0 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(int32_lo)), scalar);
+    const __m512d tmp1 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(int32_lo, 1)), scalar);
+    const __m512d tmp2 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(int32_hi)), scalar);
+    const __m512d tmp3 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(int32_hi, 1)), scalar);
+
+    /* store to output */
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 0), tmp0);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 4), tmp1);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 8), tmp2);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 12), tmp3);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc16_item32_le, 1, fc64, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512i tmpi = _mm512_loadu_si512(input + i);
+
+        /* swap 16-bit pairs: [imag, real] -> [real, imag] */
+        tmpi = _mm512_rol_epi32(tmpi, 16);
+
+        unpack_sc16_16x_to_fc64(tmpi, output + i, scalar);
+    }
+
+    // convert remainder
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc16_item32_be, 1, fc64, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512i tmpi = _mm512_loadu_si512(input + i);
+
+        /* byteswap within each 16-bit word */
+        tmpi = _mm512_or_si512(_mm512_srli_epi16(tmpi, 8), _mm512_slli_epi16(tmpi, 8));
+
+        unpack_sc16_16x_to_fc64(tmpi, output + i, scalar);
+    }
+
+    // convert remainder
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(sc16_chdr, 1, fc64, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc64_t* output      = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        const __m512i tmpi = _mm512_loadu_si512(input + i);
+
+        unpack_sc16_16x_to_fc64(tmpi, output + i, scalar);
+    }
+
+    // convert remainder
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,103 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+DECLARE_TARGET_CONVERTER(
+    sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512i m0 = _mm512_loadu_si512(input + i);
+
+        /* swap 16-bit pairs */
+        m0 = _mm512_rol_epi32(m0, 16);
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, m0);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc16, 1, sc16_item32_be, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512i m0 = _mm512_loadu_si512(input + i);
+
+        /* byteswap 16 bit words */
+        m0 = _mm512_or_si512(_mm512_srli_epi16(m0, 8), _mm512_slli_epi16(m0, 8));
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, m0);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htonx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512i m0 = _mm512_loadu_si512(input + i);
+
+        /* swap 16-bit pairs */
+        m0 = _mm512_rol_epi32(m0, 16);
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, m0);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc16_item32_be, 1, sc16, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    for (; i + 15 < nsamps; i += 16) {
+        /* load from input */
+        __m512i m0 = _mm512_loadu_si512(input + i);
+
+        /* byteswap 16 bit words */
+        m0 = _mm512_or_si512(_mm512_srli_epi16(m0, 8), _mm512_slli_epi16(m0, 8));
+
+        /* store to output */
+        _mm512_storeu_si512(output + i, m0);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htonx>(input + i, output + i, nsamps - i, 1.0);
+}
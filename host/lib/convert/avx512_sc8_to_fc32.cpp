@@ -0,0 +1,96 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 16 samples of 8-bit I/Q (eight item32) to fc32. The shuffle puts the
+ * four values of each item32 into sample order.
+ */
+template <const _MM_PERM_ENUM shuf>
+UHD_TARGET_AVX512 UHD_INLINE void unpack_sc8_16x_to_fc32(
+    const __m256i& in, __m512& out0, __m512& out1, const __m512& scalar)
+{
+    /* sign-extend int8 to int32 */
+    __m512i tmp0 = _mm512_cvtepi8_epi32(_mm256_castsi256_si128(in));
+    __m512i tmp1 = _mm512_cvtepi8_epi32(_mm256_extracti128_si256(in, 1));
+    tmp0         = _mm512_shuffle_epi32(tmp0, shuf);
+    tmp1         = _mm512_shuffle_epi32(tmp1, shuf);
+
+    /* convert to float and scale */
+    out0 = _mm512_mul_ps(_mm512_cvtepi32_ps(tmp0), scalar);
+    out1 = _mm512_mul_ps(_mm512_cvtepi32_ps(tmp1), scalar);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc8_item32_be, 1, fc32, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0, j = 0;
+    size_t num_samps = nsamps;
+
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::ntohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 15 < num_samps; j += 16, i += 8) {
+        /* load from input */
+        __m256i tmpi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        /* unpack, the values are already in order */
+        __m512 tmp0, tmp1;
+        unpack_sc8_16x_to_fc32<_MM_PERM_DCBA>(tmpi, tmp0, tmp1, scalar);
+
+        /* store to output */
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + j + 0), tmp0);
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + j + 8), tmp1);
+    }
+
+    // convert remainder
+    item32_sc8_to_xx<uhd::ntohx>(input + i, output + j, num_samps - j, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc8_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0, j = 0;
+    size_t num_samps = nsamps;
+
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::wtohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 15 < num_samps; j += 16, i += 8) {
+        /* load from input */
+        __m256i tmpi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        /* unpack + reverse the values within each item32 */
+        __m512 tmp0, tmp1;
+        unpack_sc8_16x_to_fc32<_MM_PERM_ABCD>(tmpi, tmp0, tmp1, scalar);
+
+        /* store to output */
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + j + 0), tmp0);
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + j + 8), tmp1);
+    }
+
+    // convert remainder
+    item32_sc8_to_xx<uhd::wtohx>(input + i, output + j, num_samps - j, scale_factor);
+}
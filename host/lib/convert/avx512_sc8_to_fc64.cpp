@@ -0,0 +1,98 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 16 samples of 8-bit I/Q (eight item32) to fc64 and store them. The
+ * shuffle puts the four values of each item32 into sample order.
+ */
+template <const _MM_PERM_ENUM shuf>
+UHD_TARGET_AVX512 UHD_INLINE void unpack_sc8_16x_to_fc64(
+    const __m256i& in, fc64_t* output, const __m512d& scalar)
+{
+    /* sign-extend int8 to int32 */
+    __m512i tmpi0 = _mm512_cvtepi8_epi32(_mm256_castsi256_si128(in));
+    __m512i tmpi1 = _mm512_cvtepi8_epi32(_mm256_extracti128_si256(in, 1));
+    tmpi0         = _mm512_shuffle_epi32(tmpi0, shuf);
+    tmpi1         = _mm512_shuffle_epi32(tmpi1, shuf);
+
+    /* convert to double and scale */
+    const __m512d tmp0 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(tmpi0)), scalar);
+    const __m512d tmp1 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(tmpi0, 1)), scalar);
+    const __m512d tmp2 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(tmpi1)), scalar);
+    const __m512d tmp3 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(tmpi1, 1)), scalar);
+
+    /* store to output */
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 0), tmp0);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 4), tmp1);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 8), tmp2);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 12), tmp3);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc8_item32_be, 1, fc64, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0, j = 0;
+    size_t num_samps = nsamps;
+
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::ntohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 15 < num_samps; j += 16, i += 8) {
+        /* load from input */
+        __m256i tmpi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        /* unpack, the values are already in order */
+        unpack_sc8_16x_to_fc64<_MM_PERM_DCBA>(tmpi, output + j, scalar);
+    }
+
+    // convert remainder
+    item32_sc8_to_xx<uhd::ntohx>(input + i, output + j, num_samps - j, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(
+    sc8_item32_le, 1, fc64, 1, PRIORITY_SIMD_AVX512, UHD_TARGET_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0, j = 0;
+    size_t num_samps = nsamps;
+
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::wtohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 15 < num_samps; j += 16, i += 8) {
+        /* load from input */
+        __m256i tmpi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        /* unpack + reverse the values within each item32 */
+        unpack_sc8_16x_to_fc64<_MM_PERM_ABCD>(tmpi, output + j, scalar);
+    }
+
+    // convert remainder
+    item32_sc8_to_xx<uhd::wtohx>(input + i, output + j, num_samps - j, scale_factor);
+}
@@ -14,30 +14,33 @@
 #include <complex>
 #include <limits>
 
-#define _DECLARE_CONVERTER(name, in_form, num_in, out_form, num_out, prio)    \
-    struct name : public uhd::convert::converter                              \
-    {                                                                         \
-        static sptr make(void)                                                \
-        {                                                                     \
-            return sptr(new name());                                          \
-        }                                                                     \
-        double scale_factor;                                                  \
-        void set_scalar(const double s)                                       \
-        {                                                                     \
-            scale_factor = s;                                                 \
-        }                                                                     \
-        void operator()(const input_type&, const output_type&, const size_t); \
-    };                                                                        \
-    UHD_STATIC_BLOCK(__register_##name##_##prio)                              \
-    {                                                                         \
-        uhd::convert::id_type id;                                             \
-        id.input_format  = #in_form;                                          \
-        id.num_inputs    = num_in;                                            \
-        id.output_format = #out_form;                                         \
-        id.num_outputs   = num_out;                                           \
-        uhd::convert::register_converter(id, &name::make, prio);              \
-    }                                                                         \
-    void name::operator()(                                                    \
+#define _DECLARE_CONVERTER(name, in_form, num_in, out_form, num_out, prio, target) \
+    struct name : public uhd::convert::converter                                   \
+    {                                                                              \
+        static sptr make(void)                                                     \
+        {                                                                          \
+            return sptr(new name());                                               \
+        }                                                                          \
+        double scale_factor;                                                       \
+        void set_scalar(const double s)                                            \
+        {                                                                          \
+            scale_factor = s;                                                      \
+        }                                                                          \
+        target void operator()(                                                    \
+            const input_type&, const output_type&, const size_t);                  \
+    };                                                                             \
+    UHD_STATIC_BLOCK(__register_##name##_##prio)                                   \
+    {                                                                              \
+        uhd::convert::id_type id;                                                  \
+        id.input_format  = #in_form;                                               \
+        id.num_inputs    = num_in;                                                 \
+        id.output_format = #out_form;                                              \
+        id.num_outputs   = num_out;                                                \
+        if (uhd::convert::simd_prio_supported(prio)) {                             \
+            uhd::convert::register_converter(id, &name::make, prio);               \
+        }                                                                          \
+    }                                                                              \
+    target void name::operator()(                                                  \
         const input_type& inputs, const output_type& outputs, const size_t nsamps)
 
 /*! Convenience macro to declare a single-function converter
@@ -60,7 +63,39 @@
         num_in,                                                                          \
         out_form,                                                                        \
         num_out,                                                                         \
-        prio)
+        prio, )
+
+/*! Declare a single-function converter which uses an x86 instruction set extension
+ *
+ * Like DECLARE_CONVERTER, but the conversion function is compiled for the
+ * given target (one of the UHD_TARGET_* macros below).
+ */
+#define DECLARE_TARGET_CONVERTER(in_form, num_in, out_form, num_out, prio, target)       \
+    _DECLARE_CONVERTER(__convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio, \
+        in_form,                                                                         \
+        num_in,                                                                          \
+        out_form,                                                                        \
+        num_out,                                                                         \
+        prio,                                                                            \
+        target)
+
+/*! Compile a function for an x86 instruction set extension
+ *
+ * The SSSE3, AVX2 and AVX-512 converters are built without ISA flags for their
+ * translation units, so that their registration code, and any out-of-line copy
+ * of an inline helper from a shared header, runs on every CPU. Only the
+ * conversion functions, and the helpers using intrinsics, are marked with these.
+ * MSVC allows intrinsics in any function, so they are empty there.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#    define UHD_TARGET_SSSE3  __attribute__((target("ssse3")))
+#    define UHD_TARGET_AVX2   __attribute__((target("avx2")))
+#    define UHD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#else
+#    define UHD_TARGET_SSSE3
+#    define UHD_TARGET_AVX2
+#    define UHD_TARGET_AVX512
+#endif
 
 /***********************************************************************
  * Setup priorities
@@ -73,11 +108,31 @@ static const int PRIORITY_SIMD = 2;
 static const int PRIORITY_TABLE =
     1; // tables require large cache, so they are slower on arm
 #else
-// We used to have ORC, too, so SIMD is 3
-static const int PRIORITY_SIMD  = 3;
-static const int PRIORITY_TABLE = 1;
+// We used to have ORC, too, so SIMD is 3. The x86 SIMD converters are built for
+// several instruction set extensions side by side, each with its own priority.
+static const int PRIORITY_SIMD        = 3; // SSE2
+static const int PRIORITY_SIMD_SSSE3  = 4;
+static const int PRIORITY_SIMD_AVX2   = 5;
+static const int PRIORITY_SIMD_AVX512 = 6; // AVX-512 F + BW
+static const int PRIORITY_TABLE       = 1;
 #endif
 
+namespace uhd { namespace convert {
+
+/*! Check if converters of a given priority can run on this CPU
+ *
+ * The SIMD priorities require CPU features that are detected at runtime. They
+ * can be capped further using the UHD_CONVERT_SIMD environment variable (one of
+ * "none", "sse2", "ssse3", "avx2", "avx512"), e.g. to benchmark lesser converters. All
+ * other priorities are always supported.
+ *
+ * Converters that require a CPU feature must only be registered if this returns
+ * true; DECLARE_CONVERTER takes care of this.
+ */
+bool simd_prio_supported(const priority_type prio);
+
+}} // namespace uhd::convert
+
 /***********************************************************************
  * Typedefs
  **********************************************************************/
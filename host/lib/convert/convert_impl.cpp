@@ -5,14 +5,23 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include "convert_common.hpp"
 #include <uhd/convert.hpp>
 #include <uhd/exception.hpp>
 #include <uhd/types/dict.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/static.hpp>
 #include <stdint.h>
+#include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 #include <complex>
+#include <cstdlib>
+#include <string>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <immintrin.h>
+#    include <intrin.h>
+#endif
 
 using namespace uhd;
 
@@ -54,6 +63,132 @@ typedef uhd::dict<convert::id_type,
     fcn_table_type;
 UHD_SINGLETON_FCN(fcn_table_type, get_table);
 
+/***********************************************************************
+ * Runtime CPU feature detection for the SIMD converters
+ **********************************************************************/
+namespace {
+
+//! x86 instruction set extensions used by converters, in ascending order
+enum class simd_tier { NONE, SSE2, SSSE3, AVX2, AVX512 };
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+simd_tier detect_simd_tier()
+{
+    // This may run from static initializers, before libgcc initialized its
+    // CPU model.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return simd_tier::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return simd_tier::AVX2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return simd_tier::SSSE3;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return simd_tier::SSE2;
+    }
+    return simd_tier::NONE;
+}
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+simd_tier detect_simd_tier()
+{
+    int regs[4]; // EAX, EBX, ECX, EDX
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    const bool has_sse2  = regs[3] & (1 << 26);
+    const bool has_ssse3 = regs[2] & (1 << 9);
+    // AVX state must also be enabled by the OS
+    const bool has_osxsave = regs[2] & (1 << 27);
+    const uint64_t xcr0    = has_osxsave ? _xgetbv(0) : 0;
+    const bool has_avx_os  = (xcr0 & 0x6) == 0x6;
+    // AVX-512 additionally needs the opmask and ZMM state
+    const bool has_avx512_os = (xcr0 & 0xE6) == 0xE6;
+    bool has_avx2            = false;
+    bool has_avx512          = false;
+    if (max_leaf >= 7 && has_avx_os) {
+        __cpuidex(regs, 7, 0);
+        has_avx2   = regs[1] & (1 << 5);
+        has_avx512 = has_avx512_os && (regs[1] & (1 << 16)) && (regs[1] & (1 << 30));
+    }
+    if (has_avx512) {
+        return simd_tier::AVX512;
+    }
+    if (has_avx2) {
+        return simd_tier::AVX2;
+    }
+    if (has_ssse3) {
+        return simd_tier::SSSE3;
+    }
+    if (has_sse2) {
+        return simd_tier::SSE2;
+    }
+    return simd_tier::NONE;
+}
+#else
+simd_tier detect_simd_tier()
+{
+    return simd_tier::NONE;
+}
+#endif
+
+//! Return the highest usable tier, which can be capped via UHD_CONVERT_SIMD
+simd_tier get_simd_tier()
+{
+    static const simd_tier tier = []() {
+        const simd_tier cpu_tier = detect_simd_tier();
+        const char* env          = std::getenv("UHD_CONVERT_SIMD");
+        if (env == nullptr) {
+            return cpu_tier;
+        }
+        const std::string max_tier_str =
+            boost::algorithm::to_lower_copy(std::string(env));
+        simd_tier max_tier = cpu_tier;
+        if (max_tier_str == "none") {
+            max_tier = simd_tier::NONE;
+        } else if (max_tier_str == "sse2") {
+            max_tier = simd_tier::SSE2;
+        } else if (max_tier_str == "ssse3") {
+            max_tier = simd_tier::SSSE3;
+        } else if (max_tier_str == "avx2") {
+            max_tier = simd_tier::AVX2;
+        } else if (max_tier_str == "avx512") {
+            max_tier = simd_tier::AVX512;
+        } else {
+            UHD_LOG_WARNING("CONVERT",
+                "Ignoring unknown UHD_CONVERT_SIMD value `"
+                    << env << "' (valid values: none, sse2, ssse3, avx2, avx512)");
+        }
+        return std::min(cpu_tier, max_tier);
+    }();
+    return tier;
+}
+
+} // namespace
+
+bool uhd::convert::simd_prio_supported(const priority_type prio)
+{
+#ifdef __ARM_NEON__
+    // NEON availability is decided at compile time
+    return true;
+#else
+    switch (prio) {
+        case PRIORITY_SIMD:
+            return get_simd_tier() >= simd_tier::SSE2;
+        case PRIORITY_SIMD_SSSE3:
+            return get_simd_tier() >= simd_tier::SSSE3;
+        case PRIORITY_SIMD_AVX2:
+            return get_simd_tier() >= simd_tier::AVX2;
+        case PRIORITY_SIMD_AVX512:
+            return get_simd_tier() >= simd_tier::AVX512;
+        default:
+            return true;
+    }
+#endif
+}
+
 /***********************************************************************
  * The registry functions
  **********************************************************************/
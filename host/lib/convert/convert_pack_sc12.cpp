@@ -142,6 +142,22 @@ static converter::sptr make_convert_sc16_1_to_sc12_item32_be_1(void)
     return converter::sptr(new convert_star_1_to_sc12_item32_1<short, uhd::ntohx>());
 }
 
+DECLARE_CONVERTER(fc32, 1, sc12_chdr, 1, PRIORITY_GENERAL)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    uint8_t* output     = reinterpret_cast<uint8_t*>(outputs[0]);
+
+    xx_to_chdr_sc12(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc16, 1, sc12_chdr, 1, PRIORITY_GENERAL)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    uint8_t* output     = reinterpret_cast<uint8_t*>(outputs[0]);
+
+    sc16_to_chdr_sc12(input, output, nsamps);
+}
+
 UHD_STATIC_BLOCK(register_convert_pack_sc12)
 {
     // uhd::convert::register_bytes_per_item("sc12", 3/*bytes*/); //registered in unpack
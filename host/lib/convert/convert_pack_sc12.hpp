@@ -105,3 +105,41 @@ void convert_star_4_to_sc12_item32_3(const std::complex<type>& in0,
     };
     pack<towire>(output, enable, iq);
 }
+
+/*
+ * sc12_chdr packs each complex sample into 3 bytes, the way it is stored in
+ * the payload of a CHDR packet:
+ *
+ *  byte 0   | byte 1          | byte 2
+ *  I[7:0]   | Q[3:0] I[11:8]  | Q[11:4]
+ *
+ * The 12 bits are the most significant bits of an sc16 sample, i.e., the
+ * format uses the same scaling as sc16_chdr.
+ */
+UHD_FORCE_INLINE void sc16_to_chdr_sc12_x1(const sc16_t& in, uint8_t* output)
+{
+    const uint16_t i = uint16_t(in.real()) >> 4;
+    const uint16_t q = uint16_t(in.imag()) >> 4;
+    output[0]        = uint8_t(i);
+    output[1]        = uint8_t((i >> 8) | (q << 4));
+    output[2]        = uint8_t(q >> 4);
+}
+
+UHD_FORCE_INLINE void sc16_to_chdr_sc12(
+    const sc16_t* input, uint8_t* output, const size_t nsamps)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        sc16_to_chdr_sc12_x1(input[i], output + 3 * i);
+    }
+}
+
+template <typename T>
+UHD_FORCE_INLINE void xx_to_chdr_sc12(const std::complex<T>* input,
+    uint8_t* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        sc16_to_chdr_sc12_x1(xx_to_sc16_x1(input[i], scale_factor), output + 3 * i);
+    }
+}
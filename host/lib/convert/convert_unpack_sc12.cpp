@@ -164,6 +164,22 @@ static converter::sptr make_convert_sc12_item32_be_1_to_sc16_1(void)
     return converter::sptr(new convert_sc12_item32_1_to_star_1<short, uhd::ntohx>());
 }
 
+DECLARE_CONVERTER(sc12_chdr, 1, fc32, 1, PRIORITY_GENERAL)
+{
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(inputs[0]);
+    fc32_t* output       = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    chdr_sc12_to_xx(input, output, nsamps, scale_factor);
+}
+
+DECLARE_CONVERTER(sc12_chdr, 1, sc16, 1, PRIORITY_GENERAL)
+{
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(inputs[0]);
+    sc16_t* output       = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    chdr_sc12_to_sc16(input, output, nsamps);
+}
+
 UHD_STATIC_BLOCK(register_convert_unpack_sc12)
 {
     uhd::convert::register_bytes_per_item("sc12", 3 /*bytes*/);
@@ -94,3 +94,34 @@ void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
     out2 = std::complex<type>(line1 >> 0 & 0xfff0, line12 >> 20 & 0xfff0);
     out3 = std::complex<type>(line2 >> 8 & 0xfff0, line2 << 4 & 0xfff0);
 }
+
+/*
+ * Unpack one sc12_chdr sample into the upper 12 bits of an sc16 sample. See
+ * convert_pack_sc12.hpp for the layout of the format.
+ */
+UHD_FORCE_INLINE sc16_t chdr_sc12_x1_to_sc16(const uint8_t* input)
+{
+    const uint16_t i = uint16_t((input[0] << 4) | (input[1] << 12));
+    const uint16_t q = uint16_t((input[1] & 0xf0) | (input[2] << 8));
+    return sc16_t(int16_t(i), int16_t(q));
+}
+
+UHD_FORCE_INLINE void chdr_sc12_to_sc16(
+    const uint8_t* input, sc16_t* output, const size_t nsamps)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] = chdr_sc12_x1_to_sc16(input + 3 * i);
+    }
+}
+
+template <typename T>
+UHD_FORCE_INLINE void chdr_sc12_to_xx(const uint8_t* input,
+    std::complex<T>* output,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        output[i] =
+            chdr_sc16_x1_to_xx<T>(chdr_sc12_x1_to_sc16(input + 3 * i), scale_factor);
+    }
+}
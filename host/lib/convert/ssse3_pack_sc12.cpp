@@ -50,7 +50,7 @@
 #define SC12_PACK_SHUFFLE3 8, 1, 8, 8, 3, 8, 8, 5, 8, 8, 7, 8, 8, 8, 8, 8
 
 template <typename type>
-inline void convert_star_4_to_sc12_item32_3(const std::complex<type>* in,
+UHD_TARGET_SSSE3 inline void convert_star_4_to_sc12_item32_3(const std::complex<type>* in,
     item32_sc12_3x& output,
     const double scalar,
     typename std::enable_if<std::is_same<type, float>::value>::type* = NULL)
@@ -85,7 +85,7 @@ inline void convert_star_4_to_sc12_item32_3(const std::complex<type>* in,
 }
 
 template <typename type>
-static void convert_star_4_to_sc12_item32_3(const std::complex<type>* in,
+UHD_TARGET_SSSE3 static void convert_star_4_to_sc12_item32_3(const std::complex<type>* in,
     item32_sc12_3x& output,
     const double,
     typename std::enable_if<std::is_same<type, short>::value>::type* = NULL)
@@ -122,7 +122,7 @@ struct convert_star_1_to_sc12_item32_2 : public converter
         _scalar = scalar;
     }
 
-    void operator()(const input_type& inputs,
+    UHD_TARGET_SSSE3 void operator()(const input_type& inputs,
         const output_type& outputs,
         const size_t nsamps) override
     {
@@ -235,8 +235,75 @@ static converter::sptr make_convert_sc16_1_to_sc12_item32_le_1(void)
     return converter::sptr(new convert_star_1_to_sc12_item32_2<short, uhd::wtohx>());
 }
 
+/*
+ * Pack 4 sc16 samples into the low 12 bytes of the register in sc12_chdr
+ * format. The upper 4 bytes are zeroed.
+ */
+UHD_TARGET_SSSE3 UHD_FORCE_INLINE __m128i pack_sc16_to_chdr_sc12_4x(const __m128i in)
+{
+    /* keep the upper 12 bits of I and Q, in bits 0..23 of each 32-bit lane */
+    const __m128i re = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi32(0x00000fff));
+    const __m128i im = _mm_and_si128(_mm_srli_epi32(in, 8), _mm_set1_epi32(0x00fff000));
+
+    /* drop the unused top byte of every lane */
+    return _mm_shuffle_epi8(_mm_or_si128(re, im),
+        _mm_set_epi8(-1, -1, -1, -1, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0));
+}
+
+DECLARE_TARGET_CONVERTER(fc32, 1, sc12_chdr, 1, PRIORITY_SIMD_SSSE3, UHD_TARGET_SSSE3)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    uint8_t* output     = reinterpret_cast<uint8_t*>(outputs[0]);
+
+    const __m128 scalar = _mm_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+
+    // Every store writes 16 bytes, i.e., past the 4 samples being converted
+    for (; i + 5 < nsamps; i += 4) {
+        /* load from input and scale */
+        __m128 tmplo = _mm_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        __m128 tmphi = _mm_loadu_ps(reinterpret_cast<const float*>(input + i + 2));
+        tmplo        = _mm_mul_ps(tmplo, scalar);
+        tmphi        = _mm_mul_ps(tmphi, scalar);
+
+        /* convert to int16 with saturation */
+        const __m128i tmpi =
+            _mm_packs_epi32(_mm_cvtps_epi32(tmplo), _mm_cvtps_epi32(tmphi));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 3 * i),
+            pack_sc16_to_chdr_sc12_4x(tmpi));
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc12(input + i, output + 3 * i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(sc16, 1, sc12_chdr, 1, PRIORITY_SIMD_SSSE3, UHD_TARGET_SSSE3)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    uint8_t* output     = reinterpret_cast<uint8_t*>(outputs[0]);
+
+    size_t i = 0;
+
+    // Every store writes 16 bytes, i.e., past the 4 samples being converted
+    for (; i + 5 < nsamps; i += 4) {
+        const __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 3 * i),
+            pack_sc16_to_chdr_sc12_4x(tmpi));
+    }
+
+    // convert any remaining samples
+    sc16_to_chdr_sc12(input + i, output + 3 * i, nsamps - i);
+}
+
 UHD_STATIC_BLOCK(register_sse_pack_sc12)
 {
+    if (not uhd::convert::simd_prio_supported(PRIORITY_SIMD_SSSE3)) {
+        return;
+    }
+
     uhd::convert::id_type id;
     id.num_inputs  = 1;
     id.num_outputs = 1;
@@ -244,10 +311,10 @@ UHD_STATIC_BLOCK(register_sse_pack_sc12)
     id.input_format  = "fc32";
     id.output_format = "sc12_item32_le";
     uhd::convert::register_converter(
-        id, &make_convert_fc32_1_to_sc12_item32_le_1, PRIORITY_SIMD);
+        id, &make_convert_fc32_1_to_sc12_item32_le_1, PRIORITY_SIMD_SSSE3);
 
     id.input_format  = "sc16";
     id.output_format = "sc12_item32_le";
     uhd::convert::register_converter(
-        id, &make_convert_sc16_1_to_sc12_item32_le_1, PRIORITY_SIMD);
+        id, &make_convert_sc16_1_to_sc12_item32_le_1, PRIORITY_SIMD_SSSE3);
 }
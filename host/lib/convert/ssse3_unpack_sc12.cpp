@@ -64,7 +64,7 @@ using namespace uhd::convert;
 #define SC12_PACK_SHUFFLE2 15, 14, 7, 6, 13, 12, 5, 4, 11, 10, 3, 2, 9, 8, 1, 0
 
 template <typename type, tohost32_type tohost>
-inline void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
+UHD_TARGET_SSSE3 inline void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
     std::complex<type>* out,
     double scalar,
     typename std::enable_if<std::is_same<type, float>::value>::type* = NULL)
@@ -96,7 +96,7 @@ inline void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
 }
 
 template <typename type, tohost32_type tohost>
-inline void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
+UHD_TARGET_SSSE3 inline void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
     std::complex<type>* out,
     double,
     typename std::enable_if<std::is_same<type, short>::value>::type* = NULL)
@@ -133,7 +133,7 @@ struct convert_sc12_item32_1_to_star_2 : public converter
         _scalar                 = scalar / unpack_growth;
     }
 
-    void operator()(const input_type& inputs,
+    UHD_TARGET_SSSE3 void operator()(const input_type& inputs,
         const output_type& outputs,
         const size_t nsamps) override
     {
@@ -219,18 +219,91 @@ static converter::sptr make_convert_sc12_item32_le_1_to_sc16_1(void)
     return converter::sptr(new convert_sc12_item32_1_to_star_2<short, uhd::wtohx>());
 }
 
+/*
+ * Expand 4 sc12_chdr samples (the low 12 bytes of the register) into one
+ * 32-bit lane per sample, holding bytes 3k, 3k+1, 3k+1 and 3k+2 of sample k.
+ * I then sits in bits 0..11 of the lane, Q in bits 20..31.
+ */
+#define SC12_CHDR_EXPAND_SHUFFLE 11, 10, 10, 9, 8, 7, 7, 6, 5, 4, 4, 3, 2, 1, 1, 0
+
+DECLARE_TARGET_CONVERTER(sc12_chdr, 1, fc32, 1, PRIORITY_SIMD_SSSE3, UHD_TARGET_SSSE3)
+{
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(inputs[0]);
+    fc32_t* output       = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m128 scalar  = _mm_set1_ps(float(scale_factor));
+    const __m128i expand = _mm_set_epi8(SC12_CHDR_EXPAND_SHUFFLE);
+    const __m128i q_mask = _mm_set1_epi32(0xfff00000);
+
+    size_t i = 0;
+
+    // Every load reads 16 bytes, i.e., past the 4 samples being converted
+    for (; i + 5 < nsamps; i += 4) {
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 3 * i));
+        tmpi         = _mm_shuffle_epi8(tmpi, expand);
+
+        /* move I and Q to the upper 12 bits of an int16 and sign-extend */
+        const __m128i re = _mm_srai_epi32(_mm_slli_epi32(tmpi, 20), 16);
+        const __m128i im = _mm_srai_epi32(_mm_and_si128(tmpi, q_mask), 16);
+
+        /* convert to float and scale */
+        const __m128 ref = _mm_mul_ps(_mm_cvtepi32_ps(re), scalar);
+        const __m128 imf = _mm_mul_ps(_mm_cvtepi32_ps(im), scalar);
+
+        /* interleave and store to output */
+        const __m128 tmplo = _mm_unpacklo_ps(ref, imf);
+        const __m128 tmphi = _mm_unpackhi_ps(ref, imf);
+        _mm_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm_storeu_ps(reinterpret_cast<float*>(output + i + 2), tmphi);
+    }
+
+    // convert any remaining samples
+    chdr_sc12_to_xx(input + 3 * i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_TARGET_CONVERTER(sc12_chdr, 1, sc16, 1, PRIORITY_SIMD_SSSE3, UHD_TARGET_SSSE3)
+{
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(inputs[0]);
+    sc16_t* output       = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m128i expand = _mm_set_epi8(SC12_CHDR_EXPAND_SHUFFLE);
+    const __m128i i_mask = _mm_set1_epi32(0x0000ffff);
+    const __m128i q_mask = _mm_set1_epi32(0xfff00000);
+
+    size_t i = 0;
+
+    // Every load reads 16 bytes, i.e., past the 4 samples being converted
+    for (; i + 5 < nsamps; i += 4) {
+        __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 3 * i));
+        tmpi         = _mm_shuffle_epi8(tmpi, expand);
+
+        /* move I and Q to the upper 12 bits of their int16 */
+        const __m128i re = _mm_and_si128(_mm_slli_epi16(tmpi, 4), i_mask);
+        const __m128i im = _mm_and_si128(tmpi, q_mask);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_or_si128(re, im));
+    }
+
+    // convert any remaining samples
+    chdr_sc12_to_sc16(input + 3 * i, output + i, nsamps - i);
+}
+
 UHD_STATIC_BLOCK(register_sse_unpack_sc12)
 {
+    if (not uhd::convert::simd_prio_supported(PRIORITY_SIMD_SSSE3)) {
+        return;
+    }
+
     uhd::convert::id_type id;
     id.num_inputs    = 1;
     id.num_outputs   = 1;
     id.output_format = "fc32";
     id.input_format  = "sc12_item32_le";
     uhd::convert::register_converter(
-        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD);
+        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD_SSSE3);
 
     id.output_format = "sc16";
     id.input_format  = "sc12_item32_le";
     uhd::convert::register_converter(
-        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD);
+        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD_SSSE3);
 }
@@ -36,6 +36,7 @@ make_exception_impl("NarrowingError",        narrowing_error,         value_erro
 make_exception_impl("RuntimeError",          runtime_error,           exception)
 make_exception_impl("NotImplementedError",   not_implemented_error,   runtime_error)
 make_exception_impl("AccessError",           access_error,            runtime_error)
+make_exception_impl("OverflowError",         overflow_error,          runtime_error)
 make_exception_impl("EnvironmentError",      environment_error,       exception)
 make_exception_impl("IOError",               io_error,                environment_error)
 make_exception_impl("OSError",               os_error,                environment_error)
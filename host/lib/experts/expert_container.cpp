@@ -14,8 +14,10 @@
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/topological_sort.hpp>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #ifdef UHD_EXPERT_LOGGING
 #    define EX_LOG(depth, str) _log(depth, str)
@@ -39,6 +41,7 @@ typedef boost::adjacency_list<boost::vecS, // Container used to represent the ed
 
 typedef std::map<std::string, expert_graph_t::vertex_descriptor> vertex_map_t;
 typedef std::list<expert_graph_t::vertex_descriptor> node_queue_t;
+typedef std::vector<expert_graph_t::vertex_descriptor> node_vector_t;
 
 typedef boost::graph_traits<expert_graph_t>::edge_iterator edge_iter;
 typedef boost::graph_traits<expert_graph_t>::vertex_iterator vertex_iter;
@@ -82,27 +85,38 @@ public:
         std::lock_guard<std::mutex> lock(_mutex);
         EX_LOG(0, str(boost::format("resolve_all(%s)") % (force ? "force" : "")));
         // Do a full resolve of the graph
-        _resolve_helper("", "", force);
+        _resolve_helper(_get_sorted_nodes(), force);
+        _full_resolve_pending = false;
     }
 
-    void resolve_from(const std::string&) override
+    void resolve_from(const std::string& node_name) override
     {
         std::lock_guard<std::recursive_mutex> resolve_lock(_resolve_mutex);
         std::lock_guard<std::mutex> lock(_mutex);
-        EX_LOG(0, "resolve_from (overridden to resolve_all)");
-        // Do a full resolve of the graph
-        // Not optimizing the traversal using node_name to reduce experts complexity
-        _resolve_helper("", "", false);
+        EX_LOG(0, str(boost::format("resolve_from(%s)") % node_name));
+        const expert_graph_t::vertex_descriptor vertex = _lookup_vertex(node_name);
+        if (_full_resolve_pending) {
+            // Nothing has been resolved since the graph was built, so every node
+            // is dirty and needs to be resolved anyway
+            _resolve_helper(_get_sorted_nodes(), false);
+            _full_resolve_pending = false;
+        } else {
+            _resolve_helper(_get_resolve_order(vertex, true), false);
+        }
     }
 
-    void resolve_to(const std::string&) override
+    void resolve_to(const std::string& node_name) override
     {
         std::lock_guard<std::recursive_mutex> resolve_lock(_resolve_mutex);
         std::lock_guard<std::mutex> lock(_mutex);
-        EX_LOG(0, "resolve_to (overridden to resolve_all)");
-        // Do a full resolve of the graph
-        // Not optimizing the traversal using node_name to reduce experts complexity
-        _resolve_helper("", "", false);
+        EX_LOG(0, str(boost::format("resolve_to(%s)") % node_name));
+        const expert_graph_t::vertex_descriptor vertex = _lookup_vertex(node_name);
+        if (_full_resolve_pending) {
+            _resolve_helper(_get_sorted_nodes(), false);
+            _full_resolve_pending = false;
+        } else {
+            _resolve_helper(_get_resolve_order(vertex, false), false);
+        }
     }
 
     dag_vertex_t& retrieve(const std::string& name) const override
@@ -306,6 +320,7 @@ protected:
             EX_LOG(1, str(boost::format("added vertex %s") % data_node->get_name()));
             _datanode_map.insert(
                 vertex_map_t::value_type(data_node->get_name(), gr_node));
+            _invalidate_resolve_order();
 
             // Add resolve callbacks
             if (resolve_mode == AUTO_RESOLVE_ON_WRITE
@@ -354,6 +369,7 @@ protected:
                 boost::add_vertex(worker, _expert_dag);
             EX_LOG(1, str(boost::format("added vertex %s") % worker->get_name()));
             _worker_map.insert(vertex_map_t::value_type(worker->get_name(), gr_node));
+            _invalidate_resolve_order();
 
             // For each input, add an edge from the input to this node
             for (const std::string& node_name : worker->get_inputs()) {
@@ -426,13 +442,23 @@ protected:
         // Release all nodes in the map
         _worker_map.clear();
         _datanode_map.clear();
+        _invalidate_resolve_order();
     }
 
 private:
-    void _resolve_helper(std::string start, std::string stop, bool force)
+    /*!
+     * Return all nodes of the graph in topological order. This ensures that
+     * for all dependencies, the dependant is always after all of its
+     * dependencies.
+     *
+     * The order is cached until the structure of the graph changes.
+     */
+    const node_vector_t& _get_sorted_nodes()
     {
-        // Sort the graph topologically. This ensures that for all dependencies, the
-        // dependant is always after all of its dependencies.
+        if (_sorted_nodes_valid) {
+            return _sorted_nodes;
+        }
+
         node_queue_t sorted_nodes;
         try {
             boost::topological_sort(_expert_dag, std::front_inserter(sorted_nodes));
@@ -451,50 +477,119 @@ private:
                     + edges);
             }
         }
-        if (sorted_nodes.empty())
-            return;
+        _sorted_nodes.assign(sorted_nodes.begin(), sorted_nodes.end());
+
+        // The graph only stores outgoing edges, but finding the dependencies
+        // of a node requires walking them backwards
+        _dependencies.assign(boost::num_vertices(_expert_dag), node_vector_t());
+        for (std::pair<edge_iter, edge_iter> ei = boost::edges(_expert_dag);
+             ei.first != ei.second;
+             ++ei.first) {
+            _dependencies[boost::target(*(ei.first), _expert_dag)].push_back(
+                boost::source(*(ei.first), _expert_dag));
+        }
+
+        _sorted_nodes_valid = true;
+        return _sorted_nodes;
+    }
+
+    /*!
+     * Return the nodes that must be resolved when a node changes, or before a
+     * node is read, in topological order.
+     *
+     * When resolving to a node, these are the node and everything it depends
+     * on. When resolving from a node, these are the node and everything that
+     * depends on it, plus the dependencies of all of those, so no worker reads
+     * stale inputs. Nodes that don't interact with the given node are left
+     * alone, even if they are dirty.
+     *
+     * The order is cached until the structure of the graph changes.
+     */
+    const node_vector_t& _get_resolve_order(
+        const expert_graph_t::vertex_descriptor vertex, const bool resolve_from)
+    {
+        std::map<expert_graph_t::vertex_descriptor, node_vector_t>& cache =
+            resolve_from ? _resolve_from_order : _resolve_to_order;
+        auto cached = cache.find(vertex);
+        if (cached != cache.end()) {
+            return cached->second;
+        }
+
+        const node_vector_t& sorted_nodes = _get_sorted_nodes();
+        std::vector<bool> included(boost::num_vertices(_expert_dag), false);
+        node_vector_t pending{vertex};
+        included[vertex] = true;
+
+        // Everything that depends on the node
+        node_vector_t dependants;
+        while (resolve_from and not pending.empty()) {
+            const expert_graph_t::vertex_descriptor v = pending.back();
+            pending.pop_back();
+            dependants.push_back(v);
+            for (auto ei = boost::out_edges(v, _expert_dag); ei.first != ei.second;
+                 ++ei.first) {
+                const expert_graph_t::vertex_descriptor t =
+                    boost::target(*(ei.first), _expert_dag);
+                if (not included[t]) {
+                    included[t] = true;
+                    pending.push_back(t);
+                }
+            }
+        }
+        if (resolve_from) {
+            pending = dependants;
+        }
 
-        // Determine the start and stop node. If one is not explicitly specified then
-        // resolve everything
-        expert_graph_t::vertex_descriptor start_vertex = sorted_nodes.front();
-        expert_graph_t::vertex_descriptor stop_vertex  = sorted_nodes.back();
-        if (not start.empty())
-            start_vertex = _lookup_vertex(start);
-        if (not stop.empty())
-            stop_vertex = _lookup_vertex(stop);
+        // Everything the nodes collected so far depend on
+        while (not pending.empty()) {
+            const expert_graph_t::vertex_descriptor v = pending.back();
+            pending.pop_back();
+            for (const expert_graph_t::vertex_descriptor s : _dependencies[v]) {
+                if (not included[s]) {
+                    included[s] = true;
+                    pending.push_back(s);
+                }
+            }
+        }
 
+        node_vector_t order;
+        for (const expert_graph_t::vertex_descriptor v : sorted_nodes) {
+            if (included[v]) {
+                order.push_back(v);
+            }
+        }
+        return cache.emplace(vertex, std::move(order)).first->second;
+    }
+
+    void _invalidate_resolve_order()
+    {
+        _sorted_nodes_valid = false;
+        _sorted_nodes.clear();
+        _dependencies.clear();
+        _resolve_from_order.clear();
+        _resolve_to_order.clear();
+        _full_resolve_pending = true;
+    }
+
+    void _resolve_helper(const node_vector_t& sorted_nodes, bool force)
+    {
         // First Pass: Resolve all nodes if they are dirty, in a topological order
         std::list<dag_vertex_t*> resolved_workers;
-        bool start_node_encountered = false;
-        for (node_queue_t::iterator node_iter = sorted_nodes.begin();
-             node_iter != sorted_nodes.end();
-             ++node_iter) {
-            // Determine if we are at or beyond the starting node
-            if (*node_iter == start_vertex)
-                start_node_encountered = true;
-
-            // Only resolve if the starting node has passed
-            if (start_node_encountered) {
-                dag_vertex_t& node = _get_vertex(*node_iter);
-                std::string node_val;
-                if (force or node.is_dirty()) {
-                    node.resolve();
-                    if (node.get_class() == CLASS_WORKER) {
-                        resolved_workers.push_back(&node);
-                    }
-                    EX_LOG(1,
-                        str(boost::format("resolved node %s (%s) [%s]") % node.get_name()
-                            % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
-                } else {
-                    EX_LOG(1,
-                        str(boost::format("skipped node %s (%s) [%s]") % node.get_name()
-                            % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
+        for (const expert_graph_t::vertex_descriptor vertex : sorted_nodes) {
+            dag_vertex_t& node = _get_vertex(vertex);
+            if (force or node.is_dirty()) {
+                node.resolve();
+                if (node.get_class() == CLASS_WORKER) {
+                    resolved_workers.push_back(&node);
                 }
+                EX_LOG(1,
+                    str(boost::format("resolved node %s (%s) [%s]") % node.get_name()
+                        % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
+            } else {
+                EX_LOG(1,
+                    str(boost::format("skipped node %s (%s) [%s]") % node.get_name()
+                        % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
             }
-
-            // Determine if we are beyond the stop node
-            if (*node_iter == stop_vertex)
-                break;
         }
 
         // Second Pass: Mark all the workers clean. The policy is that a worker will mark
@@ -554,6 +649,15 @@ private:
         _datanode_map; // A map from vertex name to vertex descriptor for data nodes
     std::mutex _mutex;
     std::recursive_mutex _resolve_mutex;
+
+    // Resolve order caches, invalidated whenever nodes are added or removed
+    bool _sorted_nodes_valid = false;
+    node_vector_t _sorted_nodes; // All nodes in topological order
+    std::vector<node_vector_t> _dependencies; // Incoming edges of every vertex
+    std::map<expert_graph_t::vertex_descriptor, node_vector_t> _resolve_from_order;
+    std::map<expert_graph_t::vertex_descriptor, node_vector_t> _resolve_to_order;
+    // Set until the first full resolve after the graph changed
+    bool _full_resolve_pending = true;
 };
 
 expert_container::sptr expert_container::make(const std::string& name)
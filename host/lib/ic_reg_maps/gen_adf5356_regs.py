@@ -153,6 +153,18 @@ uint32_t get_reg(uint8_t addr){
     }
     return reg;
 }
+
+void set_reg(uint8_t addr, uint32_t val){
+    switch(addr){
+    % for addr in range(13+1):
+    case ${addr}:
+        % for reg in filter(lambda r: r.get_addr() == addr, regs):
+        ${reg.get_name()} = static_cast<${reg.get_type()}>((val >> ${reg.get_shift()}) & ${reg.get_mask()});
+        % endfor
+        break;
+    % endfor
+    }
+}
 """
 
 if __name__ == "__main__":
@@ -623,6 +623,18 @@ uint16_t get_reg(int addr){
     return reg;
 }
 
+void set_reg(int addr, uint16_t val){
+    switch(addr){
+    % for addr in sorted(set(map(lambda r: r.get_addr(), regs))):
+    case ${addr}:
+        % for reg in filter(lambda r: r.get_addr() == addr, regs):
+        ${reg.get_name()} = static_cast<${reg.get_type()}>((val >> ${reg.get_shift()}) & ${reg.get_mask()});
+        % endfor
+        break;
+    % endfor
+    }
+}
+
 std::set<uint8_t> get_ro_regs()
 {
     return {107, 108, 109, 110, 111, 112, 113};
@@ -15,6 +15,7 @@
 #include <uhdlib/rfnoc/rx_flow_ctrl_state.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
 #include <memory>
 
 namespace uhd { namespace rfnoc {
@@ -236,6 +237,14 @@ public:
         info["chdr_hdr_len"]          = std::to_string(_hdr_len);
         info["src_epid"]              = std::to_string(_remote_epid);
         info["dst_epid"]              = std::to_string(_epid);
+        if (_recv_buff_placement.page_size) {
+            info["recv_buff_page_size"] =
+                std::to_string(_recv_buff_placement.page_size);
+            info["recv_buff_numa_node"] =
+                _recv_buff_placement.numa_node == transport::buffer_pool::NO_NUMA_NODE
+                    ? "none"
+                    : std::to_string(_recv_buff_placement.numa_node);
+        }
 
         // Determine flow control mode
         if (_fc_params.freq.bytes == 0 && _fc_params.freq.packets == 0) {
@@ -248,6 +257,11 @@ public:
             info["fc_mode"] = "mixed";
         }
 
+        if (_telemetry_switch.on()) {
+            _telemetry.to_info(info);
+            _recv_io->get_telemetry().to_info(info);
+        }
+
         return info;
     }
 
@@ -272,6 +286,14 @@ public:
         auto info      = _read_data_packet_info(buff);
         bool seq_error = _is_out_of_sequence(std::get<1>(info));
 
+        if (_telemetry_switch.on()) {
+            _telemetry.packets.add();
+            _telemetry.bytes.add(buff->packet_size());
+            if (seq_error) {
+                _telemetry.seq_errors.add();
+            }
+        }
+
         return std::make_tuple(std::move(buff), std::get<0>(info), seq_error);
     }
 
@@ -327,6 +349,9 @@ private:
                 // Resynchronize before updating fc_state, the strc payload
                 // contains counts before the strc packet itself
                 _fc_state.resynchronize(strc_counts);
+                if (_telemetry_switch.on()) {
+                    _telemetry.fc_resyncs.add();
+                }
 
                 // Update state that we received a packet
                 _fc_state.data_received(packet_size_rounded);
@@ -390,6 +415,9 @@ private:
         if (_fc_state.fc_resp_due()) {
             _fc_sender.send_strs(send_link, _fc_state.get_xfer_counts());
             _fc_state.fc_resp_sent();
+            if (_telemetry_switch.on()) {
+                _telemetry.fc_packets.add();
+            }
         }
     }
 
@@ -487,8 +515,21 @@ private:
     // Transport arguments
     uhd::device_addr_t _xport_args;
 
+    // Placement of the link's receive frame buffers
+    transport::buffer_pool::placement_t _recv_buff_placement;
+
     // Disconnect callback
     disconnect_callback_t _disconnect;
+
+    // Runtime switch for telemetry
+    const transport::telemetry_switch _telemetry_switch;
+
+    // Telemetry of this transport. The packet counters are written by the
+    // streamer thread, the flow control counters by the I/O thread.
+    transport::xport_telemetry _telemetry;
+
+    // Registration for periodic dumping of the telemetry
+    transport::telemetry_dumper::registration::uptr _telemetry_dump;
 };
 
 }} // namespace uhd::rfnoc
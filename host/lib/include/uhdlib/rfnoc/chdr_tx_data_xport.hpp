@@ -16,6 +16,8 @@
 #include <uhdlib/rfnoc/tx_flow_ctrl_state.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <atomic>
 #include <chrono>
 #include <climits>
 #include <memory>
@@ -174,6 +176,7 @@ public:
      * \param num_send_frames Num frames to reserve from the send link
      * \param fc_params Parameters for flow control
      * \param disconnect Callback function to disconnect the links
+     * \param xport_args Transport arguments, used for the telemetry settings
      */
     chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
         uhd::transport::recv_link_if::sptr recv_link,
@@ -183,7 +186,8 @@ public:
         const size_t num_send_frames,
         const fc_params_t fc_params,
         const chdr::strc_payload& strc_pyld,
-        disconnect_callback_t disconnect);
+        disconnect_callback_t disconnect,
+        const uhd::device_addr_t& xport_args = uhd::device_addr_t());
 
     /*! Destructor
      */
@@ -255,9 +259,21 @@ public:
      * Sends a TX data packet
      *
      * \param buff the frame buffer containing the packet to send
+     * \param flush whether packets queued on a link that batches sends must
+     *              go out along with this one, e.g., because it is the last
+     *              packet of a send() call
      */
-    void release_send_buff(buff_t::uptr buff)
+    void release_send_buff(buff_t::uptr buff, const bool flush = false)
     {
+        if (_telemetry_switch.on()) {
+            _telemetry.packets.add();
+            _telemetry.bytes.add(buff->packet_size());
+        }
+        // The send callback may run on another thread, so the buffer itself
+        // marks the packet to flush with
+        if (flush && _send_batching) {
+            _flush_buff.store(buff.get(), std::memory_order_release);
+        }
         _send_io->release_send_buff(std::move(buff));
     }
 
@@ -366,6 +382,9 @@ private:
                 _recv_packet->conv_to_host<uint64_t>());
             _fc_state.update_dest_recv_count(
                 {strs.xfer_count_bytes, static_cast<uint32_t>(strs.xfer_count_pkts)});
+            if (_telemetry_switch.on()) {
+                _telemetry.fc_packets.add();
+            }
 
             switch (strs.status) {
                 case chdr::STRS_OKAY:
@@ -375,6 +394,9 @@ private:
                     break;
                 case chdr::STRS_SEQERR:
                     UHD_LOG_FASTPATH("S");
+                    if (_telemetry_switch.on()) {
+                        _telemetry.seq_errors.add();
+                    }
                     if (_enqueue_async_msg) {
                         _enqueue_async_msg(
                             async_metadata_t::EVENT_CODE_SEQ_ERROR, false, 0);
@@ -420,7 +442,11 @@ private:
         // still occupy an integer multiple of word size bytes in the FPGA, so
         // we need to calculate appropriately.
         const size_t packet_size_rounded = _round_pkt_size(buff->packet_size());
-        send_link->release_send_buff(std::move(buff));
+        if (_send_batching) {
+            _release_send_buff_batched(std::move(buff), send_link);
+        } else {
+            send_link->release_send_buff(std::move(buff));
+        }
 
         _fc_state.data_sent(packet_size_rounded);
 
@@ -431,6 +457,40 @@ private:
                 _round_pkt_size(_fc_sender.send_strc_resync(send_link, xfer_counts));
             _fc_state.clear_fc_resync_req_pending();
             _fc_state.data_sent(strc_size);
+            if (_telemetry_switch.on()) {
+                _telemetry.fc_resyncs.add();
+            }
+        }
+
+        // If the next packet has to wait for flow control credits, the device
+        // can only return them once it has received everything queued on the
+        // link, so send it now.
+        if (_send_batching && !_fc_state.dest_has_space(_frame_size)) {
+            send_link->flush_send_buffs();
+        }
+    }
+
+    /*!
+     * Release a buffer to a link that batches sends
+     *
+     * Data packets are queued on the link so that it can send them together.
+     * Packets that end a burst or a send() call and any other packet types are
+     * sent right away (along with everything that was queued before them).
+     */
+    void _release_send_buff_batched(buff_t::uptr buff, transport::send_link_if* send_link)
+    {
+        _sent_packet->refresh(buff->data());
+        const auto header  = _sent_packet->get_chdr_header();
+        const auto type    = header.get_pkt_type();
+        buff_t* flush_buff = buff.get();
+        const bool flush   = _flush_buff.compare_exchange_strong(
+            flush_buff, nullptr, std::memory_order_acquire);
+
+        if ((type == chdr::PKT_TYPE_DATA_NO_TS || type == chdr::PKT_TYPE_DATA_WITH_TS)
+            && !header.get_eob() && !flush) {
+            send_link->release_send_buff_deferred(std::move(buff));
+        } else {
+            send_link->release_send_buff(std::move(buff));
         }
     }
 
@@ -481,6 +541,9 @@ private:
     // Packet to receive strs messages
     chdr::chdr_packet_writer::uptr _recv_packet;
 
+    // Packet to inspect outgoing packets in the send callback
+    chdr::chdr_packet_writer::uptr _sent_packet;
+
     // Payload for Stream Command Control
     chdr::strc_payload _strc_pyld;
 
@@ -504,6 +567,25 @@ private:
 
     // Disconnect callback
     disconnect_callback_t _disconnect;
+
+    // Send link, used for reporting statistics only
+    transport::send_link_if::sptr _send_link;
+
+    // Whether the send link batches packets released as deferred
+    bool _send_batching;
+
+    // Packet which has to flush the packets queued on the send link
+    std::atomic<buff_t*> _flush_buff{nullptr};
+
+    // Runtime switch for telemetry
+    const transport::telemetry_switch _telemetry_switch;
+
+    // Telemetry of this transport. The packet counters are written by the
+    // streamer thread, the flow control counters by the I/O thread.
+    transport::xport_telemetry _telemetry;
+
+    // Registration for periodic dumping of the telemetry
+    transport::telemetry_dumper::registration::uptr _telemetry_dump;
 };
 
 }} // namespace uhd::rfnoc
@@ -18,6 +18,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 #include <tuple>
 
@@ -178,9 +179,6 @@ private:
     using ForwardEdgePredicate = ForwardBackwardEdgePredicate<true>;
     using BackEdgePredicate    = ForwardBackwardEdgePredicate<false>;
 
-    //! Vertex predicate, only selects nodes with dirty props
-    struct DirtyNodePredicate;
-
     //! Vertex predicate, returns specific existing nodes
     struct FindNodePredicate;
 
@@ -275,15 +273,23 @@ private:
     }
 
     /*! Returns a list of all nodes that have dirty properties.
+     *
+     * Only the nodes in _maybe_dirty_nodes are checked. Nodes that turn out
+     * to be clean are removed from that set.
      */
     vertex_list_t _find_dirty_nodes();
 
+    /*! Mark all nodes in the graph as possibly having dirty properties
+     */
+    void _mark_all_nodes_maybe_dirty();
+
     /*! Returns nodes in topologically sorted order
      *
+     * The order is cached until the graph structure changes.
      *
      * \throws uhd::runtime_error if the graph was not sortable
      */
-    vertex_list_t _get_topo_sorted_nodes();
+    const vertex_list_t& _get_topo_sorted_nodes();
 
     /*! Add a node, but only if it's not already in the graph.
      *
@@ -370,6 +376,25 @@ private:
      */
     node_map_t _node_map;
 
+    /*! \brief Cached result of _get_topo_sorted_nodes()
+     *
+     * Only valid if _topo_sorted_nodes_valid is true. Anything that modifies
+     * the vertices or edges of _graph must reset that flag.
+     */
+    vertex_list_t _topo_sorted_nodes;
+    bool _topo_sorted_nodes_valid = false;
+
+    /*! \brief Nodes that may have dirty properties
+     *
+     * Nodes are added when they are added to the graph, when they trigger a
+     * property resolution, and when edge properties are forwarded to them.
+     * This way, looking for dirty nodes only needs to check the nodes that
+     * were affected by a property change, rather than the entire graph.
+     *
+     * Protected by _graph_mutex.
+     */
+    std::set<node_ref_t> _maybe_dirty_nodes;
+
     using action_tuple_t = std::tuple<node_ref_t, res_source_info, action_info::sptr>;
 
     /*! \brief FIFO for incoming actions.
@@ -17,6 +17,7 @@
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <memory>
+#include <string>
 
 namespace uhd { namespace rfnoc {
 
@@ -83,6 +84,17 @@ public:
      */
     virtual void reset_network() = 0;
 
+    /*! Return a key that identifies the device and the FPGA image it runs
+     *
+     * The management portal caches the topology of the device under this
+     * key, so the key must change whenever the topology might change. If the
+     * key is empty (the default), the topology is not cached.
+     */
+    virtual std::string get_topology_cache_key()
+    {
+        return "";
+    }
+
     /*! Return a reference to a clock iface
      *
      * The MB interface may interact with the hardware to determine clock
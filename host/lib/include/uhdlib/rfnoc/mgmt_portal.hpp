@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <string>
 
 namespace uhd { namespace rfnoc { namespace mgmt {
 
@@ -233,11 +234,18 @@ public:
      * local device endpoint, using the \p xport. The transport object is not
      * stored in the management portal.
      * The discovered topology will be stored within the referenced topo_graph.
+     *
+     * \param topology_cache_key If not empty, the results of the topology
+     *        discovery are cached on disk under this key, and later discoveries
+     *        with the same key only check a few nodes. The key must change
+     *        whenever the topology might change, e.g., when a different FPGA
+     *        image is loaded.
      */
     static uptr make(chdr_ctrl_xport& xport,
         const chdr::chdr_packet_factory& pkt_factory,
         sep_addr_t my_sep_addr,
-        uhd::rfnoc::detail::topo_graph_t::sptr topo_graph);
+        uhd::rfnoc::detail::topo_graph_t::sptr topo_graph,
+        const std::string& topology_cache_key = "");
 };
 
 }}} // namespace uhd::rfnoc::mgmt
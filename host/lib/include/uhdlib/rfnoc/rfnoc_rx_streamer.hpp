@@ -129,6 +129,9 @@ private:
     // Callback function to disconnect
     const disconnect_fn_t _disconnect_cb;
 
+    // Registrations for periodic dumping of the telemetry, one per channel
+    std::vector<transport::telemetry_dumper::registration::uptr> _telemetry_dumps;
+
     /*! True if we're in overrun handling mode. In overrun handling mode, we are
      * not doing regular streaming, but we are trying to get the streaming back
      * up and running after a previous overrun. This flag helps us to catch
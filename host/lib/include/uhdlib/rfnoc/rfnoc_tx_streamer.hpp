@@ -131,6 +131,9 @@ private:
 
     // Callback function to disconnect
     const disconnect_fn_t _disconnect_cb;
+
+    // Registrations for periodic dumping of the telemetry, one per channel
+    std::vector<transport::telemetry_dumper::registration::uptr> _telemetry_dumps;
 };
 
 }} // namespace uhd::rfnoc
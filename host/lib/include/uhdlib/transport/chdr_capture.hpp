@@ -0,0 +1,217 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/endianness.hpp>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+//! UDP port of the CHDR data endpoint on USRPs
+constexpr uint16_t CHDR_CAPTURE_DEVICE_PORT = 49153;
+
+//! File formats for CHDR captures
+enum class capture_format {
+    //! libpcap format (not pcapng), CHDR packets are the UDP payloads
+    PCAP,
+    //! CHDR packets back to back, each packet's size is its CHDR length field
+    RAW
+};
+
+/*! Return the capture format for a file name
+ *
+ * Files ending in .pcap or .cap are PCAP files, all others are RAW files.
+ */
+capture_format get_capture_format(const std::string& filename);
+
+//! Selects the packets to read from a capture
+struct chdr_capture_filter
+{
+    /*! Only read UDP packets sent from this port (PCAP only). The default
+     * selects the packets sent by the device. A value of 0 reads all UDP
+     * packets.
+     */
+    uint16_t udp_src_port = CHDR_CAPTURE_DEVICE_PORT;
+    //! If set, only read CHDR packets with this destination EPID
+    std::optional<uint16_t> dst_epid;
+};
+
+//! One side of a UDP connection. Addresses and ports are in host byte order.
+struct chdr_capture_endpoint
+{
+    uint32_t ip   = 0;
+    uint16_t port = 0;
+};
+
+/*! Reads CHDR packets from a capture file
+ *
+ * The entire file is loaded into memory on construction, so packets can be
+ * replayed without file I/O.
+ *
+ * PCAP files may be captured on Ethernet (also with VLAN tags), Linux
+ * "cooked" or raw IP interfaces, e.g., with tcpdump or Wireshark. Only IPv4/UDP
+ * packets are read. IP fragments and packets that were truncated by the
+ * capture are skipped.
+ */
+class chdr_capture_reader
+{
+public:
+    using sptr = std::shared_ptr<chdr_capture_reader>;
+
+    using filter_t = chdr_capture_filter;
+
+    /*!
+     * \param filename The capture file
+     * \param format The format of the capture file
+     * \param endianness The byte order of the CHDR packets (little endian for
+     *                   Ethernet links)
+     * \param filter Selects which packets to read
+     * \throws uhd::io_error if the file can't be read
+     * \throws uhd::value_error if the file isn't a valid capture
+     */
+    chdr_capture_reader(const std::string& filename,
+        const capture_format format,
+        const uhd::endianness_t endianness = uhd::ENDIANNESS_LITTLE,
+        const filter_t& filter             = filter_t());
+
+    //! Number of CHDR packets in the capture
+    size_t size() const
+    {
+        return _packets.size();
+    }
+
+    //! Contents of a packet
+    const uint8_t* data(const size_t index) const
+    {
+        return _data.data() + _packets[index].offset;
+    }
+
+    //! Size of a packet in bytes
+    size_t packet_size(const size_t index) const
+    {
+        return _packets[index].size;
+    }
+
+    /*! Capture time of a packet in ns, relative to the first packet
+     *
+     * RAW files don't have timestamps, all packets have a time of 0.
+     */
+    uint64_t time_ns(const size_t index) const
+    {
+        return _packets[index].time_ns;
+    }
+
+    //! Size of the largest packet in bytes
+    size_t get_max_packet_size() const
+    {
+        return _max_packet_size;
+    }
+
+    //! Number of packets in the capture that were skipped
+    size_t get_num_skipped() const
+    {
+        return _num_skipped;
+    }
+
+    //! Return the CHDR header of a packet in host byte order
+    uint64_t get_header(const size_t index) const;
+
+    //! Byte order of the CHDR packets
+    uhd::endianness_t get_endianness() const
+    {
+        return _endianness;
+    }
+
+private:
+    struct packet_t
+    {
+        size_t offset;
+        size_t size;
+        uint64_t time_ns;
+    };
+
+    void _read_pcap(const std::vector<uint8_t>& file_data);
+    void _read_raw(const std::vector<uint8_t>& file_data);
+    void _add_packet(const uint8_t* data, const size_t size, const uint64_t time_ns);
+
+    const uhd::endianness_t _endianness;
+    const filter_t _filter;
+    std::vector<uint8_t> _data;
+    std::vector<packet_t> _packets;
+    uint64_t _first_time_ns = 0;
+    size_t _max_packet_size = 0;
+    size_t _num_skipped     = 0;
+};
+
+/*! Writes CHDR packets to a capture file
+ *
+ * In PCAP files, every CHDR packet is wrapped into Ethernet, IPv4 and UDP
+ * headers with the given addresses, so the file can be inspected with the
+ * usual tools. The CHDR packets themselves are written as is.
+ *
+ * All methods are thread-safe.
+ */
+class chdr_capture_writer
+{
+public:
+    using sptr = std::shared_ptr<chdr_capture_writer>;
+
+    using endpoint_t = chdr_capture_endpoint;
+
+    /*!
+     * \throws uhd::io_error if the file can't be opened
+     */
+    chdr_capture_writer(const std::string& filename, const capture_format format);
+
+    ~chdr_capture_writer();
+
+    /*! Return a writer for a file, shared with all other users of that file
+     *
+     * The format is picked based on the file name, see get_capture_format().
+     */
+    static sptr get(const std::string& filename);
+
+    /*! Append a packet to the capture
+     *
+     * \param data The CHDR packet
+     * \param size The size of the packet in bytes
+     * \param src The sender of the packet (PCAP only)
+     * \param dst The receiver of the packet (PCAP only)
+     */
+    void write(const void* data,
+        const size_t size,
+        const endpoint_t& src = endpoint_t(),
+        const endpoint_t& dst = endpoint_t());
+
+    //! Write all buffered packets to the file
+    void flush();
+
+    //! Number of packets written
+    size_t get_num_packets() const;
+
+    /*! Return the endpoint for an IPv4 address and a port
+     *
+     * If \p ip_addr is not a valid IPv4 address, the address is set to 0.
+     */
+    static endpoint_t make_endpoint(const std::string& ip_addr, const uint16_t port);
+
+private:
+    mutable std::mutex _mutex;
+    const capture_format _format;
+    std::ofstream _file;
+    size_t _num_packets = 0;
+    uint16_t _ip_id     = 0;
+};
+
+}} // namespace uhd::transport
@@ -0,0 +1,327 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/transport/buffer_pool.hpp>
+#include <uhdlib/transport/chdr_capture.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/link_if.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+class chdr_replay_frame_buff : public frame_buff
+{
+public:
+    chdr_replay_frame_buff(void* mem)
+    {
+        _data = mem;
+    }
+};
+
+/*! Link which receives the CHDR packets of a capture
+ *
+ * This allows running the receive path (I/O services, CHDR transports,
+ * streamers and converters) without a device, with real traffic including its
+ * sequence errors, flow control resynchronization and burst patterns.
+ *
+ * Every received packet is copied out of the capture into one of the link's
+ * frame buffers, like a kernel or driver would copy it. Once the capture is
+ * exhausted, receiving times out. The capture can be replayed multiple times.
+ * On every repetition, the sequence numbers of the packets are shifted such
+ * that they continue where the previous repetition ended, so only sequence
+ * errors within the capture are reported. Timestamps are replayed unchanged.
+ *
+ * Packets sent to this link, such as flow control updates, are dropped.
+ */
+class chdr_replay_link : public recv_link_base<chdr_replay_link>,
+                         public send_link_base<chdr_replay_link>
+{
+public:
+    using sptr = std::shared_ptr<chdr_replay_link>;
+
+    //! How fast packets are received
+    enum class pacing_t {
+        //! Return a packet whenever one is requested
+        AS_FAST_AS_POSSIBLE,
+        //! Reproduce the packet arrival times of the capture (PCAP only)
+        CAPTURE_TIME,
+        //! Return packets at the rate of link_rate
+        LINK_RATE
+    };
+
+    struct params_t
+    {
+        pacing_t pacing = pacing_t::AS_FAST_AS_POSSIBLE;
+        //! Link rate in bytes/s for pacing_t::LINK_RATE
+        double link_rate = 0.0;
+        //! Number of times the capture is replayed. 0 replays it forever.
+        size_t num_loops = 1;
+        size_t num_recv_frames = 32;
+        //! Size of the receive frames. 0 uses the size of the largest packet.
+        size_t recv_frame_size = 0;
+        size_t num_send_frames = 32;
+        size_t send_frame_size = 8000;
+        //! Placement of the memory backing the frame buffers
+        buffer_pool::mem_params_t buff_mem_params;
+    };
+
+    /*! Make a new replay link
+     *
+     * \param capture The packets to replay
+     * \param params Link parameters
+     * \throws uhd::value_error if the parameters are invalid for this capture
+     */
+    static sptr make(chdr_capture_reader::sptr capture, const params_t& params);
+
+    //! Number of packets received from this link so far
+    size_t get_num_replayed() const
+    {
+        return _num_replayed.load(std::memory_order_relaxed);
+    }
+
+    //! Number of packets sent to this link so far
+    size_t get_num_sent() const
+    {
+        return _num_sent.load(std::memory_order_relaxed);
+    }
+
+    buffer_pool::placement_t get_recv_buff_placement() const override
+    {
+        return _recv_memory_pool->get_placement();
+    }
+
+    buffer_pool::placement_t get_send_buff_placement() const override
+    {
+        return _send_memory_pool->get_placement();
+    }
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<chdr_replay_link>;
+    using send_link_base_t = send_link_base<chdr_replay_link>;
+
+    // Friend declarations to allow base classes to call private methods
+    friend recv_link_base_t;
+    friend send_link_base_t;
+
+    chdr_replay_link(chdr_capture_reader::sptr capture,
+        const params_t& params,
+        const size_t recv_frame_size);
+
+    // Methods called by recv_link_base
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms);
+
+    void release_recv_buff_derived(frame_buff& /*buff*/)
+    {
+        // No-op
+    }
+
+    // Methods called by send_link_base
+    bool get_send_buff_derived(frame_buff& /*buff*/, int32_t /*timeout_ms*/)
+    {
+        return true;
+    }
+
+    void release_send_buff_derived(frame_buff& /*buff*/)
+    {
+        _num_sent.store(
+            _num_sent.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    //! Return the time at which the next packet is due
+    std::chrono::steady_clock::time_point _get_due_time() const;
+
+    //! Wait until the next packet is due, or return false on a timeout
+    bool _wait_for_next(int32_t timeout_ms);
+
+    chdr_capture_reader::sptr _capture;
+    const params_t _params;
+
+    buffer_pool::sptr _recv_memory_pool;
+    buffer_pool::sptr _send_memory_pool;
+    std::vector<chdr_replay_frame_buff> _recv_buffs;
+    std::vector<chdr_replay_frame_buff> _send_buffs;
+
+    //! For every packet, how far its sequence number moves on each repetition
+    std::vector<uint16_t> _seq_num_steps;
+    //! Duration of one repetition for pacing_t::CAPTURE_TIME
+    std::chrono::nanoseconds _loop_duration{0};
+
+    //! Index of the next packet in the capture
+    size_t _next_packet = 0;
+    //! Current repetition of the capture
+    size_t _loop = 0;
+    //! Bytes received so far, for pacing_t::LINK_RATE
+    uint64_t _num_bytes = 0;
+    std::chrono::steady_clock::time_point _start_time;
+    bool _started = false;
+
+    std::atomic<size_t> _num_replayed{0};
+    std::atomic<size_t> _num_sent{0};
+
+    adapter_id_t _adapter_id;
+};
+
+/*! Link which writes all packets that go through another link to a capture
+ *
+ * Received packets are written as sent from the device to the host, sent
+ * packets the other way around.
+ */
+class chdr_capture_link : public virtual recv_link_if, public virtual send_link_if
+{
+public:
+    using sptr       = std::shared_ptr<chdr_capture_link>;
+    using endpoint_t = chdr_capture_writer::endpoint_t;
+
+    /*! Make a new capture link
+     *
+     * \param send_link The link used to send packets
+     * \param recv_link The link used to receive packets
+     * \param writer The capture to write packets to
+     * \param device The address of the device (PCAP only)
+     * \param host The address of the host (PCAP only)
+     */
+    static sptr make(send_link_if::sptr send_link,
+        recv_link_if::sptr recv_link,
+        chdr_capture_writer::sptr writer,
+        const endpoint_t& device = endpoint_t(),
+        const endpoint_t& host   = endpoint_t());
+
+    // recv_link_if
+    size_t get_num_recv_frames() const override
+    {
+        return _recv_link->get_num_recv_frames();
+    }
+
+    size_t get_recv_frame_size() const override
+    {
+        return _recv_link->get_recv_frame_size();
+    }
+
+    frame_buff::uptr get_recv_buff(int32_t timeout_ms) override
+    {
+        auto buff = _recv_link->get_recv_buff(timeout_ms);
+        if (buff) {
+            _writer->write(buff->data(), buff->packet_size(), _device, _host);
+        }
+        return buff;
+    }
+
+    void release_recv_buff(frame_buff::uptr buff) override
+    {
+        _recv_link->release_recv_buff(std::move(buff));
+    }
+
+    buffer_pool::placement_t get_recv_buff_placement() const override
+    {
+        return _recv_link->get_recv_buff_placement();
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _recv_link->get_recv_adapter_id();
+    }
+
+    bool supports_recv_buff_out_of_order() const override
+    {
+        return _recv_link->supports_recv_buff_out_of_order();
+    }
+
+    // send_link_if
+    size_t get_num_send_frames() const override
+    {
+        return _send_link->get_num_send_frames();
+    }
+
+    size_t get_send_frame_size() const override
+    {
+        return _send_link->get_send_frame_size();
+    }
+
+    frame_buff::uptr get_send_buff(int32_t timeout_ms) override
+    {
+        return _send_link->get_send_buff(timeout_ms);
+    }
+
+    void release_send_buff(frame_buff::uptr buff) override
+    {
+        _write_send_buff(*buff);
+        _send_link->release_send_buff(std::move(buff));
+    }
+
+    void release_send_buff_deferred(frame_buff::uptr buff) override
+    {
+        _write_send_buff(*buff);
+        _send_link->release_send_buff_deferred(std::move(buff));
+    }
+
+    void flush_send_buffs() override
+    {
+        _send_link->flush_send_buffs();
+    }
+
+    size_t get_send_batch_size() const override
+    {
+        return _send_link->get_send_batch_size();
+    }
+
+    double get_packets_per_send_call() const override
+    {
+        return _send_link->get_packets_per_send_call();
+    }
+
+    buffer_pool::placement_t get_send_buff_placement() const override
+    {
+        return _send_link->get_send_buff_placement();
+    }
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _send_link->get_send_adapter_id();
+    }
+
+    bool supports_send_buff_out_of_order() const override
+    {
+        return _send_link->supports_send_buff_out_of_order();
+    }
+
+private:
+    chdr_capture_link(send_link_if::sptr send_link,
+        recv_link_if::sptr recv_link,
+        chdr_capture_writer::sptr writer,
+        const endpoint_t& device,
+        const endpoint_t& host);
+
+    void _write_send_buff(const frame_buff& buff)
+    {
+        if (buff.packet_size() != 0) {
+            _writer->write(buff.data(), buff.packet_size(), _host, _device);
+        }
+    }
+
+    send_link_if::sptr _send_link;
+    recv_link_if::sptr _recv_link;
+    chdr_capture_writer::sptr _writer;
+    const endpoint_t _device;
+    const endpoint_t _host;
+};
+
+}} // namespace uhd::transport
@@ -0,0 +1,226 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/utils/cast.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Pool of worker threads to run the per-channel sample conversion of a
+ * streamer in parallel.
+ *
+ * A call to run() splits the channels between the workers and the calling
+ * thread, and returns once all of them have been converted. Workers poll for
+ * new work for a short while after each run, so that back-to-back calls
+ * from a streaming loop don't pay for a thread wakeup. Workers that stay idle
+ * for longer go to sleep until the next call to run().
+ *
+ * The pool is configured through the following stream args:
+ * - convert_threads: Total number of threads that convert samples, including
+ *   the thread calling recv() or send(). Values of 0 or 1 disable the pool.
+ * - convert_thread_<N>_cpu: CPU to pin worker thread N to. Workers are
+ *   numbered from 0 to convert_threads - 2.
+ *
+ * run() is not thread safe, it must only be called from one thread at a time.
+ */
+class convert_worker_pool
+{
+public:
+    using uptr = std::unique_ptr<convert_worker_pool>;
+
+    //! Time a worker spins waiting for work before it goes to sleep
+    static constexpr std::chrono::microseconds SPIN_TIMEOUT{500};
+
+    /*!
+     * Create a pool of worker threads
+     *
+     * \param num_workers Number of worker threads (not counting the caller)
+     * \param cpu_affinity Map of worker index to CPU to pin the worker to.
+     *                     Workers not in the map are not pinned.
+     */
+    convert_worker_pool(
+        const size_t num_workers, const std::map<size_t, size_t>& cpu_affinity = {})
+    {
+        _workers.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; i++) {
+            std::vector<size_t> cpus;
+            if (cpu_affinity.count(i)) {
+                cpus.push_back(cpu_affinity.at(i));
+            }
+            _workers.emplace_back([this, cpus]() {
+                if (!cpus.empty()) {
+                    uhd::set_thread_affinity(cpus);
+                }
+                _worker_loop();
+            });
+            uhd::set_thread_name(&_workers.back(), "uhd_conv_" + std::to_string(i));
+        }
+    }
+
+    ~convert_worker_pool()
+    {
+        _running = false;
+        _generation.fetch_add(1, std::memory_order_release);
+        _generation.notify_all();
+        for (auto& worker : _workers) {
+            worker.join();
+        }
+    }
+
+    convert_worker_pool(const convert_worker_pool&)            = delete;
+    convert_worker_pool& operator=(const convert_worker_pool&) = delete;
+
+    /*!
+     * Create a pool from stream args
+     *
+     * \param args Stream args
+     * \param num_chans Number of channels of the streamer
+     * \return A worker pool, or nullptr if parallel conversion isn't requested
+     *         or can't help with this number of channels
+     */
+    static uptr make(const uhd::device_addr_t& args, const size_t num_chans)
+    {
+        const size_t num_threads = args.cast<size_t>("convert_threads", 1);
+        if (num_threads <= 1 || num_chans <= 1) {
+            return nullptr;
+        }
+        if (num_threads > num_chans) {
+            UHD_LOG_DEBUG("STREAMER",
+                "convert_threads=" << num_threads << " exceeds the number of channels, "
+                                   << "using " << num_chans << " threads.");
+        }
+
+        static const std::regex cpu_expr("^convert_thread_(\\d+)_cpu");
+        std::map<size_t, size_t> cpu_affinity;
+        for (const auto& key : args.keys()) {
+            std::smatch match;
+            if (std::regex_match(key, match, cpu_expr)) {
+                const size_t thread  = uhd::cast::from_str<size_t>(match.str(1));
+                cpu_affinity[thread] = args.cast<size_t>(key, 0);
+            }
+        }
+
+        return std::make_unique<convert_worker_pool>(
+            std::min(num_threads, num_chans) - 1, cpu_affinity);
+    }
+
+    //! Returns the number of threads that convert samples, including the caller
+    size_t get_num_threads() const
+    {
+        return _workers.size() + 1;
+    }
+
+    /*!
+     * Call fn(i) for every i in [0, num_tasks) and return when all calls have
+     * completed. The calls are spread across the workers and the calling
+     * thread, in no particular order.
+     */
+    template <typename fn_t>
+    UHD_FORCE_INLINE void run(const size_t num_tasks, const fn_t& fn)
+    {
+        _task_fn   = [](const void* ctx, const size_t i) {
+            (*static_cast<const fn_t*>(ctx))(i);
+        };
+        _task_ctx  = &fn;
+        _num_tasks = num_tasks;
+        _next_task.store(0, std::memory_order_relaxed);
+        _num_busy.store(_workers.size(), std::memory_order_relaxed);
+
+        // Publish the task to the workers. This and the check for sleeping
+        // workers must be sequentially consistent to pair with the worker
+        // going to sleep.
+        _generation.fetch_add(1);
+        if (_num_sleeping.load()) {
+            _generation.notify_all();
+        }
+
+        _run_tasks();
+
+        // Wait for the workers to finish their share. Yielding gives them a
+        // chance to run if there are fewer cores than threads.
+        while (_num_busy.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    using task_fn_t = void (*)(const void*, size_t);
+
+    void _worker_loop()
+    {
+        // Workers are created before the first call to run(), so they start
+        // from generation 0, even if the thread only gets to run later
+        uint64_t generation = 0;
+        while (true) {
+            // Spin for a while, then sleep until the next run
+            const auto spin_end = std::chrono::steady_clock::now() + SPIN_TIMEOUT;
+            uint64_t next_generation;
+            while ((next_generation = _generation.load(std::memory_order_acquire))
+                   == generation) {
+                if (std::chrono::steady_clock::now() > spin_end) {
+                    _num_sleeping.fetch_add(1);
+                    _generation.wait(generation);
+                    _num_sleeping.fetch_sub(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            generation = next_generation;
+
+            if (!_running) {
+                return;
+            }
+            _run_tasks();
+            _num_busy.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    UHD_FORCE_INLINE void _run_tasks()
+    {
+        size_t i;
+        while ((i = _next_task.fetch_add(1, std::memory_order_relaxed)) < _num_tasks) {
+            _task_fn(_task_ctx, i);
+        }
+    }
+
+    // Current task, written by run() before the generation is incremented
+    task_fn_t _task_fn    = nullptr;
+    const void* _task_ctx = nullptr;
+    size_t _num_tasks     = 0;
+
+    // Index of the next task to be claimed by a thread
+    alignas(64) std::atomic<size_t> _next_task{0};
+
+    // Number of workers that haven't finished the current run
+    alignas(64) std::atomic<size_t> _num_busy{0};
+
+    // Incremented by every call to run() to wake up the workers
+    alignas(64) std::atomic<uint64_t> _generation{0};
+
+    // Number of workers blocked waiting on _generation
+    std::atomic<size_t> _num_sleeping{0};
+
+    std::atomic<bool> _running{true};
+
+    std::vector<std::thread> _workers;
+};
+
+}} // namespace uhd::transport
@@ -8,8 +8,8 @@
 
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/utils/binary_log.hpp>
 #include <boost/dynamic_bitset.hpp>
-#include <boost/format.hpp>
 
 namespace uhd { namespace transport {
 
@@ -73,10 +73,9 @@ public:
                         xport->get_recv_buff(timeout_ms);
                 } catch (const uhd::value_error& e) {
                     // Bad packet
-                    UHD_LOGGER_ERROR("STREAMER")
-                        << boost::format(
-                               "The receive transport caught a value exception.\n%s")
-                               % e.what();
+                    UHD_LOG_BIN_ERROR("STREAMER",
+                        "The receive transport caught a value exception.\n{}",
+                        e.what());
                     return BAD_PACKET;
                 }
             }
@@ -104,8 +103,8 @@ public:
                     // If we haven't found a set of aligned packets after many
                     // iterations, return an alignment failure
                     if (iterations++ > ALIGNMENT_FAILURE_THRESHOLD) {
-                        UHD_LOGGER_ERROR("STREAMER")
-                            << "The rx streamer failed to time-align packets.";
+                        UHD_LOG_BIN_ERROR("STREAMER",
+                            "The rx streamer failed to time-align packets.");
                         return ALIGNMENT_FAILURE;
                     }
 
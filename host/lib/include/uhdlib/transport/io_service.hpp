@@ -37,6 +37,7 @@
 #pragma once
 
 #include <uhdlib/transport/link_if.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
 #include <functional>
 #include <memory>
 
@@ -163,12 +164,40 @@ public:
         return _num_recv_frames;
     }
 
+    /*!
+     * Turn telemetry of this I/O interface on or off. Must be called before
+     * the interface is used.
+     *
+     * \param telemetry the runtime telemetry switch
+     */
+    void set_telemetry_switch(const telemetry_switch telemetry)
+    {
+        _telemetry_switch = telemetry;
+    }
+
+    /*!
+     * Get the telemetry of this I/O interface. The values may be read from any
+     * thread.
+     *
+     * \return the telemetry, all zero if telemetry is off
+     */
+    const io_telemetry& get_telemetry(void) const
+    {
+        return _telemetry;
+    }
+
 protected:
     /*! Number of frames reserved on the send_link_if associated with this */
     size_t _num_send_frames;
 
     /*! Number of frames reserved on the recv_link_if associated with this */
     size_t _num_recv_frames;
+
+    /*! Runtime switch for telemetry */
+    telemetry_switch _telemetry_switch;
+
+    /*! Telemetry, written only by the thread that uses the interface */
+    io_telemetry _telemetry;
 };
 
 /*!
@@ -266,12 +295,40 @@ public:
         return _num_recv_frames;
     }
 
+    /*!
+     * Turn telemetry of this I/O interface on or off. Must be called before
+     * the interface is used.
+     *
+     * \param telemetry the runtime telemetry switch
+     */
+    void set_telemetry_switch(const telemetry_switch telemetry)
+    {
+        _telemetry_switch = telemetry;
+    }
+
+    /*!
+     * Get the telemetry of this I/O interface. The values may be read from any
+     * thread.
+     *
+     * \return the telemetry, all zero if telemetry is off
+     */
+    const io_telemetry& get_telemetry(void) const
+    {
+        return _telemetry;
+    }
+
 protected:
     /*! Number of frames reserved on the send_link_if associated with this */
     size_t _num_send_frames;
 
     /*! Number of frames reserved on the recv_link_if associated with this */
     size_t _num_recv_frames;
+
+    /*! Runtime switch for telemetry */
+    telemetry_switch _telemetry_switch;
+
+    /*! Telemetry, written only by the thread that uses the interface */
+    io_telemetry _telemetry;
 };
 
 /*!
@@ -6,11 +6,19 @@
 
 #pragma once
 
+#include <uhd/config.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <vector>
 
 namespace uhd { namespace transport {
+
+//! Default time after which packets queued by a batching send link are sent
+constexpr std::chrono::microseconds DEFAULT_SEND_FLUSH_DEADLINE{500};
+
 namespace detail {
 
 /*!
@@ -40,6 +48,11 @@ public:
         _buffs.push_back(buff);
     }
 
+    bool empty() const
+    {
+        return _buffs.empty();
+    }
+
 private:
     std::vector<frame_buff*> _buffs;
 };
@@ -61,17 +74,31 @@ private:
  * Additionally, the subclass must call preload_free_buf for each frame_buff
  * object it owns during initialization to add it to the free buffer pool.
  *
+ * If the link is created with a send batch size larger than one, packets
+ * released with release_send_buff_deferred() are queued and handed to the
+ * derived class in groups, using the following method:
+ *   void release_send_buffs_derived(frame_buff* const* buffs, size_t num_buffs);
+ * A default implementation which calls release_send_buff_derived() for every
+ * buffer is provided, derived classes may hide it with a version that sends
+ * all packets with a single call into the OS or driver.
+ *
  * \param derived_t type of the derived class
  */
 template <typename derived_t>
 class send_link_base : public virtual send_link_if
 {
 public:
-    send_link_base(const size_t num_frames, const size_t frame_size)
+    send_link_base(const size_t num_frames,
+        const size_t frame_size,
+        const size_t send_batch_size = 1,
+        const std::chrono::microseconds flush_deadline = DEFAULT_SEND_FLUSH_DEADLINE)
         : _send_frame_size(frame_size)
         , _num_send_frames(num_frames)
+        , _send_batch_size(std::max<size_t>(send_batch_size, 1))
+        , _flush_deadline(flush_deadline)
         , _free_send_buffs(num_frames)
     {
+        _deferred_send_buffs.reserve(_send_batch_size);
     }
 
     virtual ~send_link_base() = default;
@@ -86,8 +113,27 @@ public:
         return _send_frame_size;
     }
 
+    size_t get_send_batch_size() const override
+    {
+        return _send_batch_size;
+    }
+
+    double get_packets_per_send_call() const override
+    {
+        const size_t num_calls = _num_send_calls.load(std::memory_order_relaxed);
+        if (num_calls == 0) {
+            return 1.0;
+        }
+        return double(_num_sent_packets.load(std::memory_order_relaxed)) / num_calls;
+    }
+
     frame_buff::uptr get_send_buff(int32_t timeout_ms) override
     {
+        if (!_deferred_send_buffs.empty()
+            && (_free_send_buffs.empty() || _flush_deadline_expired())) {
+            flush_send_buffs();
+        }
+
         frame_buff* buff = _free_send_buffs.pop();
 
         // Call the derived class for link-specific implementation
@@ -106,10 +152,21 @@ public:
         frame_buff* buff_ptr = buff.release();
         assert(buff_ptr);
 
+        // Packets must go out in order, so anything that is still queued is
+        // sent together with this packet.
+        if (!_deferred_send_buffs.empty()) {
+            _defer_send_buff(buff_ptr);
+            flush_send_buffs();
+            return;
+        }
+
         if (buff_ptr->packet_size() != 0) {
             // Call the derived class for link-specific implementation
             auto* derived = static_cast<derived_t*>(this);
             derived->release_send_buff_derived(*buff_ptr);
+            if (_send_batch_size > 1) {
+                _count_send_call(1);
+            }
         }
 
         // Reset buff and re-add to free pool
@@ -117,7 +174,60 @@ public:
         _free_send_buffs.push(buff_ptr);
     }
 
+    void release_send_buff_deferred(frame_buff::uptr buff) override
+    {
+        if (_send_batch_size == 1) {
+            release_send_buff(std::move(buff));
+            return;
+        }
+
+        frame_buff* buff_ptr = buff.release();
+        assert(buff_ptr);
+
+        _defer_send_buff(buff_ptr);
+        if (_deferred_send_buffs.size() >= _send_batch_size
+            || _flush_deadline_expired()) {
+            flush_send_buffs();
+        }
+    }
+
+    void flush_send_buffs() override
+    {
+        if (_deferred_send_buffs.empty()) {
+            return;
+        }
+
+        // Call the derived class for link-specific implementation
+        auto* derived = static_cast<derived_t*>(this);
+        derived->release_send_buffs_derived(
+            _deferred_send_buffs.data(), _deferred_send_buffs.size());
+
+        _count_send_call(_deferred_send_buffs.size());
+
+        // Reset buffs and re-add to free pool
+        for (frame_buff* buff_ptr : _deferred_send_buffs) {
+            buff_ptr->set_packet_size(0);
+            _free_send_buffs.push(buff_ptr);
+        }
+        _deferred_send_buffs.clear();
+    }
+
 protected:
+    /*!
+     * Send a group of packets. This default implementation sends them one at
+     * a time, derived classes can hide it with a batched version.
+     *
+     * \param buffs the frame buffers to send, in order
+     * \param num_buffs the number of frame buffers
+     */
+    void release_send_buffs_derived(frame_buff* const* buffs, size_t num_buffs)
+    {
+        auto* derived = static_cast<derived_t*>(this);
+        for (size_t i = 0; i < num_buffs; i++) {
+            derived->release_send_buff_derived(*buffs[i]);
+        }
+    }
+
     /*!
      * Add buffer pointer to free buffer pool.
      *
@@ -132,9 +242,48 @@ protected:
     }
 
 private:
+    void _defer_send_buff(frame_buff* buff_ptr)
+    {
+        if (buff_ptr->packet_size() == 0) {
+            _free_send_buffs.push(buff_ptr);
+            return;
+        }
+        if (_deferred_send_buffs.empty()) {
+            _first_deferred_time = std::chrono::steady_clock::now();
+        }
+        _deferred_send_buffs.push_back(buff_ptr);
+    }
+
+    void _count_send_call(const size_t num_packets)
+    {
+        // Single writer, so no need for an atomic read-modify-write
+        _num_send_calls.store(_num_send_calls.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+        _num_sent_packets.store(
+            _num_sent_packets.load(std::memory_order_relaxed) + num_packets,
+            std::memory_order_relaxed);
+    }
+
+    bool _flush_deadline_expired() const
+    {
+        return std::chrono::steady_clock::now() - _first_deferred_time
+               >= _flush_deadline;
+    }
+
     size_t _send_frame_size;
     size_t _num_send_frames;
+    size_t _send_batch_size;
+    std::chrono::microseconds _flush_deadline;
     detail::free_buff_pool _free_send_buffs;
+
+    //! Packets queued by release_send_buff_deferred(), in send order
+    std::vector<frame_buff*> _deferred_send_buffs;
+    //! Time at which the oldest queued packet was released
+    std::chrono::steady_clock::time_point _first_deferred_time;
+
+    //! Statistics for batched sends
+    std::atomic<size_t> _num_send_calls{0};
+    std::atomic<size_t> _num_sent_packets{0};
 };
 
 /*!
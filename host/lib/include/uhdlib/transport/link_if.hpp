@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/transport/adapter_id.hpp>
+#include <uhd/transport/buffer_pool.hpp>
 #include <uhd/transport/frame_buff.hpp>
 #include <memory>
 
@@ -51,6 +52,55 @@ public:
      */
     virtual void release_send_buff(frame_buff::uptr buff) = 0;
 
+    /*!
+     * Queue a packet for sending and release the buffer. Links that support
+     * batched sends may hold on to the packet and send it together with
+     * subsequent ones. Queued packets are sent, in order, when the batch is
+     * full, when release_send_buff() or flush_send_buffs() are called, or when
+     * the link's flush deadline has expired at the time of the next call to
+     * the link.
+     *
+     * Links that do not support batched sends send the packet immediately.
+     *
+     * \param buff frame buffer containing packet data
+     */
+    virtual void release_send_buff_deferred(frame_buff::uptr buff)
+    {
+        release_send_buff(std::move(buff));
+    }
+
+    /*!
+     * Send all packets queued by release_send_buff_deferred().
+     */
+    virtual void flush_send_buffs() {}
+
+    /*!
+     * Get the maximum number of packets the link sends with a single call
+     * into the OS or driver.
+     */
+    virtual size_t get_send_batch_size() const
+    {
+        return 1;
+    }
+
+    /*!
+     * Get the average number of packets sent per call into the OS or driver
+     * since the link was created.
+     */
+    virtual double get_packets_per_send_call() const
+    {
+        return 1.0;
+    }
+
+    /*!
+     * Get the placement of the memory backing the send frame buffers. Links
+     * that don't manage their own memory return an unknown page size.
+     */
+    virtual buffer_pool::placement_t get_send_buff_placement() const
+    {
+        return {};
+    }
+
     /*!
      * Get the physical adapter id used for this link
      */
@@ -105,6 +155,15 @@ public:
      */
     virtual void release_recv_buff(frame_buff::uptr buff) = 0;
 
+    /*!
+     * Get the placement of the memory backing the receive frame buffers.
+     * Links that don't manage their own memory return an unknown page size.
+     */
+    virtual buffer_pool::placement_t get_recv_buff_placement() const
+    {
+        return {};
+    }
+
     /*!
      * Get the physical adapter ID used for this link
      */
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <uhd/transport/buffer_pool.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <string>
 #include <tuple>
 
 namespace uhd { namespace transport {
@@ -34,6 +36,15 @@ struct link_params_t
     size_t num_send_frames = 0;
     size_t recv_buff_size  = 0;
     size_t send_buff_size  = 0;
+    size_t recv_batch_size = 1;
+    size_t send_batch_size = 1;
+    //! Page size of the memory backing the frame buffers
+    buffer_pool::page_size_t buff_page_size = buffer_pool::page_size_t::DEFAULT;
+    /*! NUMA node to bind the frame buffers to: a node number, "nic" for the
+     *  node of the network interface, "thread" for the node of the thread
+     *  creating the link, or empty to not bind them
+     */
+    std::string buff_numa_node;
 };
 
 
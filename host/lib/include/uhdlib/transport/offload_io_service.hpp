@@ -7,6 +7,9 @@
 #pragma once
 
 #include <uhdlib/transport/io_service.hpp>
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -31,12 +34,45 @@ public:
     struct params_t
     {
         //! Array of CPU numbers to which to affinitize the offload thread.
-        std::vector<size_t> cpu_affinity_list;
+        std::vector<size_t> cpu_affinity_list{};
         //! The types of client that the I/O service needs to support.
         client_type_t client_type = BOTH_SEND_AND_RECV;
         //! The thread behavior when waiting for incoming packets If set to
         //! BLOCK, the client type must be set to either RECV_ONLY or SEND_ONLY.
         wait_mode_t wait_mode = POLL;
+        //! Number of offload threads. More than one thread requires the POLL
+        //! wait mode. Clients that share a link are always serviced by the
+        //! same thread, and are moved between threads to balance their load.
+        size_t num_threads = 1;
+        //! CPU numbers to which to affinitize each offload thread, indexed by
+        //! thread, if num_threads is greater than 1. Threads that are not in
+        //! the map are not affinitized.
+        std::map<size_t, std::vector<size_t>> thread_cpu_affinity{};
+        //! How often to rebalance clients between threads, if num_threads is
+        //! greater than 1
+        std::chrono::milliseconds rebalance_interval{100};
+        //! How often to log the utilization of each thread at DEBUG level, if
+        //! num_threads is greater than 1. The log is written when rebalancing,
+        //! so this is rounded up to a multiple of rebalance_interval.
+        std::chrono::milliseconds stats_log_interval{10000};
+    };
+
+    /*!
+     * Utilization counters of an offload thread. All counters accumulate
+     * from the time the I/O service is created.
+     */
+    struct thread_stats_t
+    {
+        //! Time the thread spent in polling passes that moved buffers
+        std::chrono::nanoseconds busy_time{0};
+        //! Time the thread has been running
+        std::chrono::nanoseconds total_time{0};
+        //! Number of buffers passed between links and clients
+        uint64_t num_buffs = 0;
+        //! Number of groups of clients moved to this thread by rebalancing
+        uint64_t num_migrations = 0;
+        //! Number of groups of clients currently serviced by the thread
+        size_t num_client_groups = 0;
     };
 
     /*!
@@ -50,6 +86,15 @@ public:
      *          in its own thread.
      */
     static sptr make(io_service::sptr io_srv, const params_t& params);
+
+    /*!
+     * Get the utilization counters of the offload threads. Counters are only
+     * kept if the I/O service was created with more than one thread. The
+     * utilization is also logged every params_t::stats_log_interval.
+     *
+     * \return One entry per thread, or an empty vector for a single thread
+     */
+    virtual std::vector<thread_stats_t> get_thread_stats() const = 0;
 };
 
 }} // namespace uhd::transport
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <uhd/transport/frame_buff.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
 #include <cassert>
 #include <chrono>
 #include <thread>
@@ -74,6 +75,25 @@ public:
     }
 
     frame_buff::uptr get_recv_buff(int32_t timeout_ms)
+    {
+        if (!_telemetry_switch.on()) {
+            return _pop_buff(timeout_ms);
+        }
+        const auto start      = telemetry_clock::now();
+        frame_buff::uptr buff = _pop_buff(timeout_ms);
+        _telemetry.add_buff(bool(buff), start);
+        return buff;
+    }
+
+    void release_recv_buff(frame_buff::uptr buff)
+    {
+        assert(buff);
+        _port->client_push(buff.release());
+        _num_frames_in_use--;
+    }
+
+private:
+    frame_buff::uptr _pop_buff(int32_t timeout_ms)
     {
         if (polling) {
             return detail::client_get_buff(
@@ -90,14 +110,6 @@ public:
         }
     }
 
-    void release_recv_buff(frame_buff::uptr buff)
-    {
-        assert(buff);
-        _port->client_push(buff.release());
-        _num_frames_in_use--;
-    }
-
-private:
     offload_recv_io()                       = delete;
     offload_recv_io(const offload_recv_io&) = delete;
 
@@ -141,6 +153,25 @@ public:
     }
 
     frame_buff::uptr get_send_buff(int32_t timeout_ms)
+    {
+        if (!_telemetry_switch.on()) {
+            return _pop_buff(timeout_ms);
+        }
+        const auto start      = telemetry_clock::now();
+        frame_buff::uptr buff = _pop_buff(timeout_ms);
+        _telemetry.add_buff(bool(buff), start);
+        return buff;
+    }
+
+    void release_send_buff(frame_buff::uptr buff)
+    {
+        assert(buff);
+        _port->client_push(buff.release());
+        _num_frames_in_use--;
+    }
+
+private:
+    frame_buff::uptr _pop_buff(int32_t timeout_ms)
     {
         if (polling) {
             return detail::client_get_buff(
@@ -157,14 +188,6 @@ public:
         }
     }
 
-    void release_send_buff(frame_buff::uptr buff)
-    {
-        assert(buff);
-        _port->client_push(buff.release());
-        _num_frames_in_use--;
-    }
-
-private:
     offload_send_io()                       = delete;
     offload_send_io(const offload_send_io&) = delete;
 
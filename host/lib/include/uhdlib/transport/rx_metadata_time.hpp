@@ -0,0 +1,42 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/types/tick_time.hpp>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Set the time of RX metadata to a number of samples after a packet time
+ *
+ * The tick time is exact whenever the tick and sample rates allow for it. If
+ * their common rate is out of range for the packet time, the tick time is
+ * rounded to the tick rate of the packet, and only time_spec keeps the time
+ * between the ticks. This never throws, so it can be used within recv().
+ *
+ * \param metadata the metadata to update
+ * \param time the time of the first sample of the packet
+ * \param num_samps the number of samples after the first one
+ * \param samp_rate the sample rate
+ */
+UHD_FORCE_INLINE void set_rx_metadata_time(rx_metadata_t& metadata,
+    const tick_time_t time,
+    const size_t num_samps,
+    const tick_time_t::rate_t& samp_rate)
+{
+    const tick_time_t offset(int64_t(num_samps), samp_rate);
+    metadata.tick_time = time;
+    if (metadata.tick_time.add_rounded(offset)) {
+        metadata.time_spec = metadata.tick_time.to_time_spec();
+    } else {
+        metadata.time_spec = time.to_time_spec() + offset.to_time_spec();
+    }
+}
+
+}} // namespace uhd::transport
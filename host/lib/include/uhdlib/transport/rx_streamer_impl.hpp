@@ -13,7 +13,10 @@
 #include <uhd/types/device_addr.hpp>
 #include <uhd/types/endianness.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/transport/convert_worker_pool.hpp>
+#include <uhdlib/transport/rx_metadata_time.hpp>
 #include <uhdlib/transport/rx_streamer_zero_copy.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
 #include <algorithm>
 #include <limits>
 #include <optional>
@@ -81,6 +84,8 @@ public:
         , _in_buffs(num_ports)
         , _chans_connected(num_ports, false)
         , _stream_info(num_ports, stream_args.args)
+        , _telemetry_switch(get_telemetry_switch(stream_args.args))
+        , _telemetry(num_ports)
     {
         if (stream_args.cpu_format.empty()) {
             throw uhd::value_error("[rx_stream] Must provide a cpu_format!");
@@ -89,7 +94,8 @@ public:
             throw uhd::value_error("[rx_stream] Must provide a otw_format!");
         }
         _setup_converters(num_ports, stream_args);
-        _zero_copy_streamer.set_samp_rate(_samp_rate);
+        _convert_pool = convert_worker_pool::make(stream_args.args, num_ports);
+        _zero_copy_streamer.set_samp_rate(_samp_rate.to_double());
         _zero_copy_streamer.set_bytes_per_item(_convert_info.bytes_per_otw_item);
 
         if (stream_args.args.has_key("spp")) {
@@ -159,9 +165,26 @@ public:
             // This handles cases where transport doesn't support get_xport_info()
         }
 
+        if (_telemetry_switch.on()) {
+            _telemetry[chan].to_info(stream_info);
+        }
         return stream_info;
     }
 
+    /*! Get the telemetry of a channel
+     *
+     * Unlike get_stream_info(), this may be called from any thread while
+     * streaming. Returns an empty dictionary if telemetry is off.
+     */
+    uhd::device_addr_t get_telemetry_info(const size_t chan) const
+    {
+        uhd::device_addr_t info;
+        if (_telemetry_switch.on()) {
+            _telemetry.at(chan).to_info(info);
+        }
+        return info;
+    }
+
     //! Update stream info
     void update_stream_info(
         const size_t chan, const std::string& key, const std::string& value)
@@ -192,6 +215,10 @@ public:
                                      "channels are connected!");
         }
 
+        if (_buffs_lent) {
+            release_recv_buffs();
+        }
+
         if (_error_metadata_cache.check(metadata)) {
             return 0;
         }
@@ -248,6 +275,56 @@ public:
         return total_samps_recv;
     }
 
+    //! Implementation of rx_streamer API method
+    size_t get_recv_buffs(uhd::rx_streamer::wire_buffs_type& buffs,
+        uhd::rx_metadata_t& metadata,
+        const double timeout) override
+    {
+        if (!_all_chans_connected) {
+            throw uhd::runtime_error("[rx_stream] Attempting to call get_recv_buffs() "
+                                     "before all channels are connected!");
+        }
+
+        release_recv_buffs();
+
+        if (_error_metadata_cache.check(metadata)) {
+            return 0;
+        }
+
+        detail::eov_data_wrapper eov_positions(metadata);
+
+        if (_buff_samps_remaining == 0) {
+            _buff_samps_remaining = _get_recv_buffs(
+                metadata, eov_positions, static_cast<int32_t>(timeout * 1000));
+            _fragment_offset_in_samps = 0;
+            _packet_time              = metadata.tick_time;
+        } else {
+            // Hand out the part of the packets that recv() didn't read yet
+            metadata = _last_fragment_metadata;
+            _set_fragment_time(metadata);
+        }
+        metadata.more_fragments  = false;
+        metadata.fragment_offset = _fragment_offset_in_samps;
+
+        // The packets now belong to the caller until release_recv_buffs()
+        const size_t num_samps = _buff_samps_remaining;
+        buffs.assign(_in_buffs.cbegin(), _in_buffs.cend());
+        _buffs_lent           = num_samps != 0;
+        _buff_samps_remaining = 0;
+        return num_samps;
+    }
+
+    //! Implementation of rx_streamer API method
+    void release_recv_buffs() override
+    {
+        if (_buffs_lent) {
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                _zero_copy_streamer.release_recv_buff(i);
+            }
+            _buffs_lent = false;
+        }
+    }
+
 protected:
     //! Configures scaling factor for conversion
     void set_scale_factor(const size_t chan, const double scale_factor)
@@ -283,14 +360,20 @@ protected:
     //! Configures sample rate for conversion of timestamp
     void set_samp_rate(const double rate)
     {
-        _samp_rate = rate;
-        _zero_copy_streamer.set_samp_rate(rate);
+        // Times can only be computed for positive rates, keep the last one
+        // until the rate is known
+        if (rate > 0) {
+            _samp_rate = tick_time_t::rate_t::from_double(rate);
+            _zero_copy_streamer.set_samp_rate(rate);
+        }
     }
 
     //! Configures tick rate for conversion of timestamp
     void set_tick_rate(const double rate)
     {
-        _zero_copy_streamer.set_tick_rate(rate);
+        if (rate > 0) {
+            _zero_copy_streamer.set_tick_rate(rate);
+        }
     }
 
     //! Notifies the streamer that an overrun has occured
@@ -362,24 +445,40 @@ private:
 
         if (_buff_samps_remaining == 0) {
             // Current set of buffers has expired, get the next one
-            _buff_samps_remaining = _zero_copy_streamer.get_recv_buffs(
-                _in_buffs, metadata, eov_positions, timeout_ms);
+            _buff_samps_remaining =
+                _get_recv_buffs(metadata, eov_positions, timeout_ms);
             _fragment_offset_in_samps = 0;
+            _packet_time              = metadata.tick_time;
         } else {
             // There are samples still left in the current set of buffers
             metadata = _last_fragment_metadata;
-            metadata.time_spec += time_spec_t::from_ticks(
-                _fragment_offset_in_samps - metadata.fragment_offset, _samp_rate);
+            _set_fragment_time(metadata);
         }
 
         if (_buff_samps_remaining != 0) {
             const size_t num_samps = std::min(nsamps_per_buff, _buff_samps_remaining);
 
             // Convert samples to the streamer's output format
-            for (size_t i = 0; i < get_num_channels(); i++) {
-                char* b = reinterpret_cast<char*>(buffs[i]);
-                const uhd::rx_streamer::buffs_type out_buffs(b + buffer_offset_bytes);
-                _convert_to_out_buff(out_buffs, i, num_samps);
+            if (_convert_pool) {
+                _convert_pool->run(get_num_channels(), [&](const size_t i) {
+                    const auto start =
+                        _telemetry_switch.on() ? telemetry_clock::now()
+                                               : telemetry_clock::time_point();
+                    char* b = reinterpret_cast<char*>(buffs[i]) + buffer_offset_bytes;
+                    _converters[i]->conv(_in_buffs[i], b, num_samps);
+                    if (_telemetry_switch.on()) {
+                        _telemetry[i].convert.add_since(start);
+                    }
+                });
+                for (size_t i = 0; i < get_num_channels(); i++) {
+                    _advance_in_buff(i, num_samps);
+                }
+            } else {
+                for (size_t i = 0; i < get_num_channels(); i++) {
+                    char* b = reinterpret_cast<char*>(buffs[i]);
+                    const uhd::rx_streamer::buffs_type out_buffs(b + buffer_offset_bytes);
+                    _convert_to_out_buff(out_buffs, i, num_samps);
+                }
             }
 
             _buff_samps_remaining -= num_samps;
@@ -399,17 +498,78 @@ private:
         }
     }
 
+    //! Sets the time of the metadata to the time of the current fragment
+    UHD_FORCE_INLINE void _set_fragment_time(rx_metadata_t& metadata)
+    {
+        // Start from the packet time for every fragment, so a rounded time (see
+        // set_rx_metadata_time()) doesn't add up over the fragments
+        set_rx_metadata_time(
+            metadata, _packet_time, _fragment_offset_in_samps, _samp_rate);
+    }
+
+    //! Get the next set of packets from the transports, and record their telemetry
+    UHD_FORCE_INLINE size_t _get_recv_buffs(uhd::rx_metadata_t& metadata,
+        detail::eov_data_wrapper& eov_positions,
+        const int32_t timeout_ms)
+    {
+        if (!_telemetry_switch.on()) {
+            return _zero_copy_streamer.get_recv_buffs(
+                _in_buffs, metadata, eov_positions, timeout_ms);
+        }
+
+        const auto start       = telemetry_clock::now();
+        const size_t num_samps = _zero_copy_streamer.get_recv_buffs(
+            _in_buffs, metadata, eov_positions, timeout_ms);
+        const uint64_t wait_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            telemetry_clock::now() - start)
+                                     .count();
+
+        // The transports are read in lockstep, so all channels see the same
+        // wait time and stream errors
+        for (auto& telemetry : _telemetry) {
+            telemetry.buff_wait.add(wait_ns);
+            if (num_samps != 0) {
+                telemetry.packets.add();
+                telemetry.bytes.add(num_samps * _convert_info.bytes_per_otw_item);
+            }
+            switch (metadata.error_code) {
+                case rx_metadata_t::ERROR_CODE_TIMEOUT:
+                    telemetry.timeouts.add();
+                    break;
+                case rx_metadata_t::ERROR_CODE_OVERFLOW:
+                    if (metadata.out_of_sequence) {
+                        telemetry.seq_errors.add();
+                    } else {
+                        telemetry.overflows.add();
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        return num_samps;
+    }
+
     //! Convert samples for one channel into its buffer
     UHD_FORCE_INLINE void _convert_to_out_buff(
         const uhd::rx_streamer::buffs_type& out_buffs,
         const size_t chan,
         const size_t num_samps)
     {
-        const char* buffer_ptr = reinterpret_cast<const char*>(_in_buffs[chan]);
-
-        _converters[chan]->conv(buffer_ptr, out_buffs, num_samps);
+        if (_telemetry_switch.on()) {
+            const auto start = telemetry_clock::now();
+            _converters[chan]->conv(_in_buffs[chan], out_buffs, num_samps);
+            _telemetry[chan].convert.add_since(start);
+        } else {
+            _converters[chan]->conv(_in_buffs[chan], out_buffs, num_samps);
+        }
+        _advance_in_buff(chan, num_samps);
+    }
 
-        // Advance the pointer for the source buffer
+    //! Advance the source buffer of one channel past converted samples
+    UHD_FORCE_INLINE void _advance_in_buff(const size_t chan, const size_t num_samps)
+    {
+        const char* buffer_ptr = reinterpret_cast<const char*>(_in_buffs[chan]);
         _in_buffs[chan] = buffer_ptr + num_samps * _convert_info.bytes_per_otw_item;
 
         if (_buff_samps_remaining == num_samps) {
@@ -462,14 +622,18 @@ private:
     // Converters
     std::vector<uhd::convert::converter::sptr> _converters;
 
+    // Worker threads for parallel conversion, null if converting on the
+    // calling thread only
+    convert_worker_pool::uptr _convert_pool;
+
     // Implementation of frame buffer management and packet info
     rx_streamer_zero_copy<transport_t, ignore_seq_err> _zero_copy_streamer;
 
     // Container for buffer pointers used in recv method
     std::vector<const void*> _in_buffs;
 
-    // Sample rate used to calculate metadata time_spec_t
-    double _samp_rate = 1.0;
+    // Sample rate used to calculate the metadata time of fragments
+    tick_time_t::rate_t _samp_rate;
 
     // MTU, determined when xport is connected or by an MTU override
     size_t _mtu = std::numeric_limits<std::size_t>::max();
@@ -488,12 +652,16 @@ private:
     // Num samps remaining in buffer currently held by zero copy streamer
     size_t _buff_samps_remaining = 0;
 
+    // Set while the application holds the packets returned by get_recv_buffs()
+    bool _buffs_lent = false;
+
     // Metadata cache for error handling
     detail::rx_metadata_cache _error_metadata_cache;
 
     // Fragment (partially read packet) information
     size_t _fragment_offset_in_samps = 0;
     rx_metadata_t _last_fragment_metadata;
+    tick_time_t _packet_time;
 
     // Store a list of channels that are already connected
     std::vector<bool> _chans_connected;
@@ -504,6 +672,12 @@ private:
 
     // Stream information storage
     std::vector<uhd::device_addr_t> _stream_info;
+
+    // Runtime switch for telemetry
+    const telemetry_switch _telemetry_switch;
+
+    // Telemetry of each channel
+    std::vector<stream_telemetry> _telemetry;
 };
 
 }} // namespace uhd::transport
@@ -12,6 +12,7 @@
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/get_aligned_buffs.hpp>
+#include <uhdlib/transport/rx_metadata_time.hpp>
 #include <atomic>
 #include <vector>
 
@@ -146,13 +147,13 @@ public:
     //! Configures tick rate for conversion of timestamp
     void set_tick_rate(const double rate)
     {
-        _tick_rate = rate;
+        _tick_rate = tick_time_t::rate_t::from_double(rate);
     }
 
     //! Configures sample rate for conversion of timestamp
     void set_samp_rate(const double rate)
     {
-        _samp_rate = rate;
+        _samp_rate = tick_time_t::rate_t::from_double(rate);
     }
 
     //! Configures the size of each sample
@@ -210,8 +211,7 @@ public:
                         break;
 
                     case get_aligned_buffs_t::SEQUENCE_ERROR:
-                        std::tie(metadata.has_time_spec, metadata.time_spec) =
-                            _last_read_time_info.get_next_packet_time(_samp_rate);
+                        _last_read_time_info.set_next_packet_time(metadata, _samp_rate);
                         metadata.out_of_sequence = true;
                         metadata.error_code      = rx_metadata_t::ERROR_CODE_OVERFLOW;
                         break;
@@ -246,8 +246,7 @@ public:
                     // that were buffered prior to the overrun. Call the overrun
                     // handler and return overrun error.
                     _handle_overrun();
-                    std::tie(metadata.has_time_spec, metadata.time_spec) =
-                        _last_read_time_info.get_next_packet_time(_samp_rate);
+                    _last_read_time_info.set_next_packet_time(metadata, _samp_rate);
                     metadata.error_code     = rx_metadata_t::ERROR_CODE_OVERFLOW;
                     _stopped_due_to_overrun = false;
                     return 0;
@@ -281,8 +280,10 @@ public:
         // Set the metadata from the buffer information at index zero
         const auto& info_0 = _infos[0];
 
+        // The tick count is exact, time_spec is only derived from it for the API
         metadata.has_time_spec  = info_0.has_tsf;
-        metadata.time_spec      = time_spec_t::from_ticks(info_0.tsf, _tick_rate);
+        metadata.tick_time      = tick_time_t(int64_t(info_0.tsf), _tick_rate);
+        metadata.time_spec      = metadata.tick_time.to_time_spec();
         metadata.start_of_burst = false;
         metadata.end_of_burst   = eob;
         metadata.error_code     = rx_metadata_t::ERROR_CODE_NONE;
@@ -298,7 +299,7 @@ public:
 
         // Done with these packets, save timestamp info for next call
         _last_read_time_info.has_time_spec = metadata.has_time_spec;
-        _last_read_time_info.time_spec     = metadata.time_spec;
+        _last_read_time_info.tick_time     = metadata.tick_time;
         _last_read_time_info.num_samps     = info_0.payload_bytes / _bytes_per_item;
         eov_positions.update_running_sample_count(_last_read_time_info.num_samps);
 
@@ -353,15 +354,18 @@ private:
     {
         size_t num_samps   = 0;
         bool has_time_spec = false;
-        time_spec_t time_spec;
+        tick_time_t tick_time;
 
-        std::tuple<bool, time_spec_t> get_next_packet_time(double samp_rate)
+        //! Sets the metadata time to the time of the sample after the last packet
+        void set_next_packet_time(
+            rx_metadata_t& metadata, const tick_time_t::rate_t& samp_rate)
         {
+            metadata.has_time_spec = has_time_spec;
             if (has_time_spec) {
-                return std::make_tuple(
-                    true, time_spec + time_spec_t::from_ticks(num_samps, samp_rate));
+                set_rx_metadata_time(metadata, tick_time, num_samps, samp_rate);
             } else {
-                return std::make_tuple(false, time_spec_t());
+                metadata.tick_time = tick_time_t();
+                metadata.time_spec = time_spec_t();
             }
         }
     };
@@ -376,11 +380,11 @@ private:
     // Packet info corresponding to the packets in flight
     std::vector<typename transport_t::packet_info_t> _infos;
 
-    // Rate used in conversion of timestamp to time_spec_t
-    double _tick_rate = 1.0;
+    // Rate of the timestamps
+    tick_time_t::rate_t _tick_rate;
 
-    // Rate used in conversion of timestamp to time_spec_t
-    double _samp_rate = 1.0;
+    // Rate used in computing the time of the sample after a packet
+    tick_time_t::rate_t _samp_rate;
 
     // Size of a sample on the device
     size_t _bytes_per_item = 0;
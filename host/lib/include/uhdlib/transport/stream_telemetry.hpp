@@ -0,0 +1,322 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/utils/cast.hpp>
+#include <uhd/utils/log.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace uhd { namespace transport {
+
+/*! Streaming telemetry
+ *
+ * The streamers, the CHDR data transports and the I/O service clients keep
+ * counters and latency histograms of their hot paths. They are reported with
+ * the `telemetry_` prefix by uhd::rx_streamer::get_stream_info() and
+ * uhd::tx_streamer::get_stream_info().
+ *
+ * Telemetry has two switches:
+ * - At compile time, the ENABLE_STREAM_TELEMETRY CMake option. If it is off,
+ *   telemetry_switch::on() is always false, and the compiler removes all the
+ *   instrumentation.
+ * - At run time, the `telemetry` stream argument, which defaults to the value
+ *   of the UHD_STREAM_TELEMETRY environment variable, or to off. While
+ *   telemetry is off, the only cost on the hot path is a predictable branch.
+ *
+ * All values are written by a single thread (the one that owns the hot path),
+ * and may be read from any thread.
+ */
+
+//! Clock used to measure latencies
+using telemetry_clock = std::chrono::steady_clock;
+
+//! Runtime switch for telemetry, folds to false if telemetry is not compiled in
+class telemetry_switch
+{
+public:
+    telemetry_switch(const bool enabled = false) : _enabled(enabled) {}
+
+    UHD_FORCE_INLINE bool on() const
+    {
+#ifdef UHD_STREAM_TELEMETRY
+        return _enabled;
+#else
+        return false;
+#endif
+    }
+
+private:
+    bool _enabled;
+};
+
+/*! Check the stream or transport args for the runtime telemetry switch
+ *
+ * \param args Stream or transport args. The `telemetry` key takes precedence
+ *             over the UHD_STREAM_TELEMETRY environment variable. Both are
+ *             parsed like any other boolean arg.
+ */
+inline telemetry_switch get_telemetry_switch(const uhd::device_addr_t& args)
+{
+#ifdef UHD_STREAM_TELEMETRY
+    bool env_enabled      = false;
+    const char* env_value = std::getenv("UHD_STREAM_TELEMETRY");
+    if (env_value != nullptr && *env_value != '\0') {
+        try {
+            env_enabled = uhd::cast::from_str<bool>(env_value);
+        } catch (const uhd::runtime_error&) {
+            UHD_LOG_WARNING("STREAM_TELEMETRY",
+                "Ignoring invalid UHD_STREAM_TELEMETRY value `" << env_value << "'");
+        }
+    }
+    return telemetry_switch(args.cast<bool>("telemetry", env_enabled));
+#else
+    (void)args;
+    return telemetry_switch(false);
+#endif
+}
+
+//! Counter with a single writer
+class telemetry_counter
+{
+public:
+    UHD_FORCE_INLINE void add(const uint64_t value = 1)
+    {
+        // There is only one writer, so a plain load and store is enough, and
+        // much cheaper than an atomic read-modify-write.
+        _value.store(
+            _value.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    UHD_FORCE_INLINE void update_max(const uint64_t value)
+    {
+        if (value > _value.load(std::memory_order_relaxed)) {
+            _value.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t get() const
+    {
+        return _value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> _value{0};
+};
+
+/*! Latency histogram with a single writer
+ *
+ * Bucket i counts the latencies in [2^(i-1), 2^i) nanoseconds, bucket 0 those
+ * of zero nanoseconds. The last bucket also holds all larger latencies.
+ * Percentiles are reported as the upper bound of their bucket.
+ */
+class telemetry_histogram
+{
+public:
+    static constexpr size_t NUM_BUCKETS = 40;
+
+    UHD_FORCE_INLINE void add(const uint64_t ns)
+    {
+        const size_t bucket = std::min<size_t>(std::bit_width(ns), NUM_BUCKETS - 1);
+        _buckets[bucket].add();
+        _count.add();
+        _sum_ns.add(ns);
+        _max_ns.update_max(ns);
+    }
+
+    //! Add the time elapsed since \p start
+    UHD_FORCE_INLINE void add_since(const telemetry_clock::time_point start)
+    {
+        add(uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            telemetry_clock::now() - start)
+                         .count()));
+    }
+
+    uint64_t get_count() const
+    {
+        return _count.get();
+    }
+
+    //! Get the upper bound of the latency below which \p fraction of the values lie
+    uint64_t get_percentile_ns(const double fraction) const
+    {
+        const uint64_t count = get_count();
+        if (count == 0) {
+            return 0;
+        }
+        const uint64_t threshold = uint64_t(fraction * count);
+        uint64_t sum             = 0;
+        for (size_t i = 0; i < NUM_BUCKETS - 1; i++) {
+            sum += _buckets[i].get();
+            if (sum > threshold) {
+                return i ? std::min(_max_ns.get(), (uint64_t(1) << i) - 1) : 0;
+            }
+        }
+        return _max_ns.get();
+    }
+
+    /*! Write the histogram summary to \p info
+     *
+     * Adds the keys <name>_count, <name>_avg_ns, <name>_p50_ns, <name>_p99_ns
+     * and <name>_max_ns.
+     */
+    void to_info(uhd::device_addr_t& info, const std::string& name) const
+    {
+        const uint64_t count   = get_count();
+        info[name + "_count"]  = std::to_string(count);
+        info[name + "_avg_ns"] = std::to_string(count ? _sum_ns.get() / count : 0);
+        info[name + "_p50_ns"] = std::to_string(get_percentile_ns(0.5));
+        info[name + "_p99_ns"] = std::to_string(get_percentile_ns(0.99));
+        info[name + "_max_ns"] = std::to_string(_max_ns.get());
+    }
+
+private:
+    std::array<telemetry_counter, NUM_BUCKETS> _buckets;
+    telemetry_counter _count;
+    telemetry_counter _sum_ns;
+    telemetry_counter _max_ns;
+};
+
+//! Telemetry of one streamer channel
+struct stream_telemetry
+{
+    //! Packets received or sent
+    telemetry_counter packets;
+    //! Payload bytes received or sent
+    telemetry_counter bytes;
+    //! Sequence errors (RX only)
+    telemetry_counter seq_errors;
+    //! Overflows (RX only)
+    telemetry_counter overflows;
+    //! Calls that timed out waiting for a buffer
+    telemetry_counter timeouts;
+    //! Time spent converting each packet
+    telemetry_histogram convert;
+    //! Time spent waiting for each packet buffer
+    telemetry_histogram buff_wait;
+
+    void to_info(uhd::device_addr_t& info) const
+    {
+        info["telemetry_packets"]    = std::to_string(packets.get());
+        info["telemetry_bytes"]      = std::to_string(bytes.get());
+        info["telemetry_seq_errors"] = std::to_string(seq_errors.get());
+        info["telemetry_overflows"]  = std::to_string(overflows.get());
+        info["telemetry_timeouts"]   = std::to_string(timeouts.get());
+        convert.to_info(info, "telemetry_convert");
+        buff_wait.to_info(info, "telemetry_buff_wait");
+    }
+};
+
+//! Telemetry of a CHDR data transport
+struct xport_telemetry
+{
+    //! Data packets received or sent
+    telemetry_counter packets;
+    //! Data bytes received or sent, including headers
+    telemetry_counter bytes;
+    //! Sequence errors (RX only)
+    telemetry_counter seq_errors;
+    //! Flow control status packets sent (RX) or received (TX)
+    telemetry_counter fc_packets;
+    //! Flow control resynchronizations
+    telemetry_counter fc_resyncs;
+
+    void to_info(uhd::device_addr_t& info) const
+    {
+        info["telemetry_xport_packets"]    = std::to_string(packets.get());
+        info["telemetry_xport_bytes"]      = std::to_string(bytes.get());
+        info["telemetry_xport_seq_errors"] = std::to_string(seq_errors.get());
+        info["telemetry_xport_fc_packets"] = std::to_string(fc_packets.get());
+        info["telemetry_xport_fc_resyncs"] = std::to_string(fc_resyncs.get());
+    }
+};
+
+//! Telemetry of an I/O service client
+struct io_telemetry
+{
+    //! Buffers handed to the transport
+    telemetry_counter buffs;
+    //! Calls that timed out waiting for a buffer
+    telemetry_counter buff_timeouts;
+    //! Times the client had to wait for flow control credits (TX only)
+    telemetry_counter fc_stalls;
+    //! Time spent waiting for each buffer
+    telemetry_histogram buff_wait;
+    //! Time spent waiting for flow control credits (TX only)
+    telemetry_histogram fc_wait;
+
+    //! Record a buffer request that started at \p start
+    UHD_FORCE_INLINE void add_buff(
+        const bool got_buff, const telemetry_clock::time_point start)
+    {
+        buff_wait.add_since(start);
+        if (got_buff) {
+            buffs.add();
+        } else {
+            buff_timeouts.add();
+        }
+    }
+
+    void to_info(uhd::device_addr_t& info) const
+    {
+        info["telemetry_io_buffs"]         = std::to_string(buffs.get());
+        info["telemetry_io_buff_timeouts"] = std::to_string(buff_timeouts.get());
+        info["telemetry_io_fc_stalls"]     = std::to_string(fc_stalls.get());
+        buff_wait.to_info(info, "telemetry_io_buff_wait");
+        fc_wait.to_info(info, "telemetry_io_fc_wait");
+    }
+};
+
+/*! Writes telemetry to a file at regular intervals
+ *
+ * The file is given by the `telemetry_file` stream argument, or the
+ * UHD_STREAM_TELEMETRY_FILE environment variable. The interval in seconds is
+ * given by `telemetry_interval` or UHD_STREAM_TELEMETRY_INTERVAL, and defaults
+ * to one second. Every interval, one line is appended per registered source:
+ *
+ *     <seconds since epoch> <source name> <key>=<value>,...
+ *
+ * All sources that use the same file share one writer thread.
+ */
+class telemetry_dumper
+{
+public:
+    //! Returns the telemetry of a source, must only read telemetry values
+    using info_fn_t = std::function<uhd::device_addr_t()>;
+
+    //! Registration of a source, unregisters the source when destroyed
+    class registration
+    {
+    public:
+        using uptr = std::unique_ptr<registration>;
+        virtual ~registration() = default;
+    };
+
+    /*! Register a source for periodic dumping
+     *
+     * \param args Stream or transport args
+     * \param name Name of the source in the dump file
+     * \param info_fn Function which returns the telemetry of the source
+     * \returns the registration, or nullptr if no dump file is configured, or
+     *          if telemetry is off
+     */
+    static registration::uptr register_source(
+        const uhd::device_addr_t& args, const std::string& name, info_fn_t info_fn);
+};
+
+}} // namespace uhd::transport
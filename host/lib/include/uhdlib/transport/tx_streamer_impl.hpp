@@ -12,7 +12,10 @@
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/tasks.hpp>
+#include <uhdlib/transport/convert_worker_pool.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
 #include <uhdlib/transport/tx_streamer_zero_copy.hpp>
+#include <uhdlib/utils/binary_log.hpp>
 #include <algorithm>
 #include <atomic>
 #include <limits>
@@ -111,6 +114,8 @@ public:
         , _out_buffs(num_chans)
         , _chans_connected(num_chans, false)
         , _stream_info(num_chans, stream_args.args)
+        , _telemetry_switch(get_telemetry_switch(stream_args.args))
+        , _telemetry(num_chans)
     {
         if ((stream_args.args.cast<std::string>("transmit_policy", "default")
                 == "stop_on_seq_error")
@@ -121,6 +126,7 @@ public:
                 "streams.");
         }
         _setup_converters(num_chans, stream_args);
+        _convert_pool = convert_worker_pool::make(stream_args.args, num_chans);
         _zero_copy_streamer.set_bytes_per_item(_convert_info.bytes_per_otw_item);
 
         if (stream_args.args.has_key("spp")) {
@@ -185,9 +191,26 @@ public:
             // This handles cases where transport doesn't support get_xport_info()
         }
 
+        if (_telemetry_switch.on()) {
+            _telemetry[chan].to_info(stream_info);
+        }
         return stream_info;
     }
 
+    /*! Get the telemetry of a channel
+     *
+     * Unlike get_stream_info(), this may be called from any thread while
+     * streaming. Returns an empty dictionary if telemetry is off.
+     */
+    uhd::device_addr_t get_telemetry_info(const size_t chan) const
+    {
+        uhd::device_addr_t info;
+        if (_telemetry_switch.on()) {
+            _telemetry.at(chan).to_info(info);
+        }
+        return info;
+    }
+
     //! Update stream info
     void update_stream_info(
         const size_t chan, const std::string& key, const std::string& value)
@@ -219,11 +242,11 @@ public:
              * The FPGA will reject any data with sequence error until the
              * init stream command is sent.
              */
-            UHD_LOG_DEBUG(
+            UHD_LOG_BIN_DEBUG(
                 "TX STRM", "Pending sequence error, try to reinitialize stream control.");
             _send_str_init();
             if (_sequence_error.load()) {
-                UHD_LOG_DEBUG(
+                UHD_LOG_BIN_DEBUG(
                     "TX STRM", "Sequence error still pending, not sending data.");
                 return 0;
             }
@@ -316,6 +339,7 @@ public:
                     1, // num samples
                     metadata,
                     false,
+                    true,
                     timeout_ms);
 
                 return 0;
@@ -325,8 +349,13 @@ public:
                 metadata.end_of_burst =
                     (eob_on_last_packet and nsamps_to_send == nsamps_to_send_remaining);
 
-                num_samps_sent = _send_one_packet(
-                    buffs, total_nsamps_sent, nsamps_to_send, metadata, eov, timeout_ms);
+                num_samps_sent = _send_one_packet(buffs,
+                    total_nsamps_sent,
+                    nsamps_to_send,
+                    metadata,
+                    eov,
+                    nsamps_to_send == nsamps_to_send_remaining,
+                    timeout_ms);
 
                 metadata.start_of_burst = false;
             } else {
@@ -339,8 +368,13 @@ public:
                 metadata.end_of_burst = false;
 
                 for (size_t i = 0; i < num_fragments; i++) {
-                    num_samps_sent = _send_one_packet(
-                        buffs, total_nsamps_sent, _spp, metadata, false, timeout_ms);
+                    num_samps_sent = _send_one_packet(buffs,
+                        total_nsamps_sent,
+                        _spp,
+                        metadata,
+                        false,
+                        false,
+                        timeout_ms);
 
                     // Advance sample accumulator and decrement remaining
                     // samples for this segment
@@ -361,8 +395,10 @@ public:
                     metadata.start_of_burst = false;
 
                     if (_sequence_error.load()) {
-                        UHD_LOG_DEBUG(
-                            "TX STRM", "Sequence error detected, stop sending data.");
+                        UHD_LOG_BIN_DEBUG("TX STRM",
+                            "Sequence error detected after {} samples, stop "
+                            "sending data.",
+                            total_nsamps_sent);
                         return total_nsamps_sent;
                     }
                 }
@@ -371,8 +407,13 @@ public:
                 metadata.end_of_burst =
                     (eob_on_last_packet and final_length == nsamps_to_send_remaining);
 
-                num_samps_sent = _send_one_packet(
-                    buffs, total_nsamps_sent, final_length, metadata, eov, timeout_ms);
+                num_samps_sent = _send_one_packet(buffs,
+                    total_nsamps_sent,
+                    final_length,
+                    metadata,
+                    eov,
+                    final_length == nsamps_to_send_remaining,
+                    timeout_ms);
             }
 
             // Advance sample accumulator and decrement remaining samples
@@ -468,33 +509,92 @@ private:
         _zero_copy_streamer.resend_init();
     }
 
-    //! Convert samples for one channel and sends a packet
+    /*!
+     * Convert samples for one channel and sends a packet
+     *
+     * The last packet of a send() call is flagged, so that transports which
+     * batch sends don't hold on to packets once the application stops sending.
+     */
     size_t _send_one_packet(const uhd::tx_streamer::buffs_type& buffs,
         const size_t buffer_offset_in_samps,
         const size_t num_samples,
         const tx_metadata_t& metadata,
         const bool eov,
+        const bool last,
         const int32_t timeout_ms)
     {
         assert(buffs.size() == get_num_channels());
 
-        if (!_zero_copy_streamer.get_send_buffs(
-                _out_buffs, num_samples, metadata, eov, timeout_ms)) {
+        if (!_get_send_buffs(num_samples, metadata, eov, timeout_ms)) {
             return 0;
         }
 
         size_t byte_offset = buffer_offset_in_samps * _convert_info.bytes_per_cpu_item;
 
-        for (size_t i = 0; i < get_num_channels(); i++) {
-            const void* input_ptr = static_cast<const uint8_t*>(buffs[i]) + byte_offset;
-            _converters[i]->conv(input_ptr, _out_buffs[i], num_samples);
+        if (_convert_pool) {
+            _convert_pool->run(get_num_channels(), [&](const size_t i) {
+                _convert_from_in_buff(buffs, i, byte_offset, num_samples);
+            });
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                _zero_copy_streamer.release_send_buff(i, last);
+            }
+        } else {
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                _convert_from_in_buff(buffs, i, byte_offset, num_samples);
 
-            _zero_copy_streamer.release_send_buff(i);
+                _zero_copy_streamer.release_send_buff(i, last);
+            }
         }
 
         return num_samples;
     }
 
+    //! Get buffers for the next set of packets, and record their telemetry
+    UHD_FORCE_INLINE bool _get_send_buffs(const size_t num_samples,
+        const tx_metadata_t& metadata,
+        const bool eov,
+        const int32_t timeout_ms)
+    {
+        if (!_telemetry_switch.on()) {
+            return _zero_copy_streamer.get_send_buffs(
+                _out_buffs, num_samples, metadata, eov, timeout_ms);
+        }
+
+        const auto start = telemetry_clock::now();
+        const bool got_buffs = _zero_copy_streamer.get_send_buffs(
+            _out_buffs, num_samples, metadata, eov, timeout_ms);
+        const uint64_t wait_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            telemetry_clock::now() - start)
+                                     .count();
+
+        for (auto& telemetry : _telemetry) {
+            telemetry.buff_wait.add(wait_ns);
+            if (got_buffs) {
+                telemetry.packets.add();
+                telemetry.bytes.add(num_samples * _convert_info.bytes_per_otw_item);
+            } else {
+                telemetry.timeouts.add();
+            }
+        }
+        return got_buffs;
+    }
+
+    //! Convert samples for one channel into its packet buffer
+    UHD_FORCE_INLINE void _convert_from_in_buff(const uhd::tx_streamer::buffs_type& buffs,
+        const size_t chan,
+        const size_t byte_offset,
+        const size_t num_samples)
+    {
+        const void* input_ptr = static_cast<const uint8_t*>(buffs[chan]) + byte_offset;
+        if (_telemetry_switch.on()) {
+            const auto start = telemetry_clock::now();
+            _converters[chan]->conv(input_ptr, _out_buffs[chan], num_samples);
+            _telemetry[chan].convert.add_since(start);
+        } else {
+            _converters[chan]->conv(input_ptr, _out_buffs[chan], num_samples);
+        }
+    }
+
     //! Create converters and initialize _bytes_per_cpu_item
     void _setup_converters(const size_t num_chans, const uhd::stream_args_t stream_args)
     {
@@ -540,6 +640,10 @@ private:
     // Converters
     std::vector<uhd::convert::converter::sptr> _converters;
 
+    // Worker threads for parallel conversion, null if converting on the
+    // calling thread only
+    convert_worker_pool::uptr _convert_pool;
+
     // Manages frame buffers and packet info
     tx_streamer_zero_copy<transport_t> _zero_copy_streamer;
 
@@ -580,6 +684,12 @@ private:
 
     // Stream information storage
     std::vector<uhd::device_addr_t> _stream_info;
+
+    // Runtime switch for telemetry
+    const telemetry_switch _telemetry_switch;
+
+    // Telemetry of each channel
+    std::vector<stream_telemetry> _telemetry;
 };
 
 }} // namespace uhd::transport
@@ -143,11 +143,14 @@ public:
      * Send the packet for the specified channel
      *
      * \param channel the channel for which to release the packet
+     * \param flush whether the transport must send all queued packets with it
      */
-    UHD_FORCE_INLINE void release_send_buff(const size_t channel)
+    UHD_FORCE_INLINE void release_send_buff(
+        const size_t channel, const bool flush = false)
     {
         _frame_buffs[channel].first->set_packet_size(_frame_buffs[channel].second);
-        _xports[channel]->release_send_buff(std::move(_frame_buffs[channel].first));
+        _xports[channel]->release_send_buff(
+            std::move(_frame_buffs[channel].first), flush);
 
         _frame_buffs[channel].first  = nullptr;
         _frame_buffs[channel].second = 0;
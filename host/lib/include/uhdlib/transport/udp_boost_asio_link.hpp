@@ -26,6 +26,15 @@ public:
     {
         _data = mem;
     }
+
+    /*!
+     * Return a reference to the frame memory pointer. This lets the batched
+     * receive path exchange the memory backing this frame buffer.
+     */
+    void*& mem()
+    {
+        return _data;
+    }
 };
 
 class udp_boost_asio_adapter_info : public adapter_info
@@ -87,6 +96,25 @@ public:
      */
     std::string get_local_addr() const;
 
+    /*! Return the number of datagrams received per system call.
+     *
+     * A value of 1 means that batched receive is disabled.
+     */
+    size_t get_recv_batch_size() const
+    {
+        return _recv_batcher ? _recv_batcher->get_batch_size() : 1;
+    }
+
+    buffer_pool::placement_t get_recv_buff_placement() const override
+    {
+        return _recv_memory_pool->get_placement();
+    }
+
+    buffer_pool::placement_t get_send_buff_placement() const override
+    {
+        return _send_memory_pool->get_placement();
+    }
+
     /*!
      * Get the physical adapter ID used for this link
      */
@@ -120,6 +148,10 @@ private:
     // Methods called by recv_link_base
     UHD_FORCE_INLINE size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
     {
+        if (_recv_batcher) {
+            return _recv_batcher->recv(
+                static_cast<udp_boost_asio_frame_buff&>(buff).mem(), timeout_ms);
+        }
         return recv_udp_packet(_sock_fd, buff.data(), get_recv_frame_size(), timeout_ms);
     }
 
@@ -140,6 +172,18 @@ private:
         send_udp_packet(_sock_fd, buff.data(), buff.packet_size());
     }
 
+#ifdef UHD_PLATFORM_LINUX
+    UHD_FORCE_INLINE void release_send_buffs_derived(
+        frame_buff* const* buffs, size_t num_buffs)
+    {
+        for (size_t i = 0; i < num_buffs; i++) {
+            _send_iovecs[i].iov_base = buffs[i]->data();
+            _send_iovecs[i].iov_len  = buffs[i]->packet_size();
+        }
+        send_udp_packets(_sock_fd, _send_msgs.data(), num_buffs);
+    }
+#endif
+
     buffer_pool::sptr _recv_memory_pool;
     buffer_pool::sptr _send_memory_pool;
 
@@ -150,6 +194,15 @@ private:
     std::shared_ptr<boost::asio::ip::udp::socket> _socket;
     int _sock_fd;
     adapter_id_t _adapter_id;
+
+    //! Batched receiver, only used if a recv_batch_size > 1 was requested
+    std::unique_ptr<udp_recv_batcher> _recv_batcher;
+
+#ifdef UHD_PLATFORM_LINUX
+    //! Message headers for batched sends, one per packet in a batch
+    std::vector<iovec> _send_iovecs;
+    std::vector<mmsghdr> _send_msgs;
+#endif
 };
 
 }} // namespace uhd::transport
@@ -19,6 +19,10 @@
 #include <boost/format.hpp>
 #include <chrono>
 #include <thread>
+#include <vector>
+#ifdef UHD_PLATFORM_LINUX
+#    include <sys/socket.h>
+#endif
 
 namespace uhd { namespace transport {
 
@@ -33,6 +37,18 @@ constexpr size_t UDP_DEFAULT_FRAME_SIZE = 1472;
 // 20ms of data for 1GbE link (in bytes)
 constexpr size_t UDP_DEFAULT_BUFF_SIZE = 2500000;
 
+// By default, receive one datagram per system call
+constexpr size_t UDP_DEFAULT_RECV_BATCH_SIZE = 1;
+
+// Upper limit for the number of datagrams received with a single system call
+constexpr size_t UDP_MAX_RECV_BATCH_SIZE = 1024;
+
+// By default, send one datagram per system call
+constexpr size_t UDP_DEFAULT_SEND_BATCH_SIZE = 1;
+
+// Upper limit for the number of datagrams sent with a single system call
+constexpr size_t UDP_MAX_SEND_BATCH_SIZE = 1024;
+
 
 #if defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
 // MacOS limits socket buffer size to 1 Mib
@@ -147,6 +163,180 @@ UHD_INLINE void send_udp_packet(int sock_fd, void* mem, size_t len)
     }
 }
 
+#ifdef UHD_PLATFORM_LINUX
+/*!
+ * Send multiple packets with as few calls to sendmmsg() as possible.
+ *
+ * \param sock_fd the open socket file descriptor
+ * \param msgs the message headers of the packets to send, in order
+ * \param num_msgs the number of packets to send
+ */
+UHD_INLINE void send_udp_packets(int sock_fd, mmsghdr* msgs, size_t num_msgs)
+{
+    size_t num_sent = 0;
+    while (num_sent < num_msgs) {
+        const int ret = ::sendmmsg(sock_fd,
+            msgs + num_sent,
+            uhd::narrow_cast<unsigned int>(num_msgs - num_sent),
+            0);
+        // Same retry logic as in send_udp_packet()
+        if (ret == -1 and errno == ENOBUFS) {
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+            continue; // try to send again
+        }
+        if (ret == -1) {
+            throw uhd::io_error(
+                str(boost::format("sendmmsg error on socket: %s") % strerror(errno)));
+        }
+        num_sent += ret;
+    }
+}
+#endif
+
+/*!
+ * Batched UDP receiver
+ *
+ * Pulls up to batch-size datagrams out of the socket with a single call to
+ * recvmmsg() and hands them out one at a time. The batcher receives into a
+ * set of staging frames. Every time a packet is handed out, the caller's
+ * (empty) frame is swapped with the staging frame holding the packet, so no
+ * data is copied.
+ *
+ * On platforms without recvmmsg(), every fill results in a single recv() call,
+ * i.e., the behaviour is the same as recv_udp_packet().
+ */
+class udp_recv_batcher
+{
+public:
+    /*!
+     * \param sock_fd the open socket file descriptor
+     * \param frame_size the capacity of each frame in bytes
+     * \param staging_frames The frames the batcher receives into. The number
+     *        of frames is the batch size. The caller owns the memory and must
+     *        keep it allocated for the lifetime of the batcher.
+     */
+    udp_recv_batcher(
+        int sock_fd, size_t frame_size, const std::vector<void*>& staging_frames)
+        : _sock_fd(sock_fd)
+        , _frame_size(frame_size)
+        , _frames(staging_frames)
+        , _lens(staging_frames.size(), 0)
+    {
+        UHD_ASSERT_THROW(!_frames.empty());
+#ifdef UHD_PLATFORM_LINUX
+        _iovecs.resize(_frames.size());
+        _msgs.resize(_frames.size());
+        for (size_t i = 0; i < _frames.size(); i++) {
+            _iovecs[i].iov_base         = nullptr;
+            _iovecs[i].iov_len          = _frame_size;
+            _msgs[i]                    = mmsghdr();
+            _msgs[i].msg_hdr.msg_iov    = &_iovecs[i];
+            _msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+#endif
+    }
+
+    //! Return the maximum number of packets received per system call
+    size_t get_batch_size() const
+    {
+        return _frames.size();
+    }
+
+    //! Return the number of receive-related system calls issued so far
+    size_t get_num_syscalls() const
+    {
+        return _num_syscalls;
+    }
+
+    //! Return the number of packets received so far
+    size_t get_num_packets() const
+    {
+        return _num_packets;
+    }
+
+    /*!
+     * Receive the next packet.
+     *
+     * \param[in,out] mem On input, an empty frame owned by the caller. If a
+     *                packet was received, this is replaced by the frame
+     *                holding the packet, and the input frame is kept by the
+     *                batcher for future receives.
+     * \param timeout_ms the timeout duration in milliseconds
+     * \return the number of bytes received, or 0 on timeout
+     */
+    UHD_INLINE size_t recv(void*& mem, int32_t timeout_ms)
+    {
+        if (_head == _num_ready) {
+            _head      = 0;
+            _num_ready = _fill(timeout_ms);
+            if (_num_ready == 0) {
+                return 0; // timeout
+            }
+        }
+        std::swap(mem, _frames[_head]);
+        return _lens[_head++];
+    }
+
+private:
+    size_t _fill(int32_t timeout_ms)
+    {
+#ifdef UHD_PLATFORM_LINUX
+        for (size_t i = 0; i < _frames.size(); i++) {
+            _iovecs[i].iov_base = _frames[i];
+        }
+        const unsigned int vlen = uhd::narrow_cast<unsigned int>(_msgs.size());
+
+        _num_syscalls++;
+        int ret = ::recvmmsg(_sock_fd, _msgs.data(), vlen, MSG_DONTWAIT, nullptr);
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            _num_syscalls++;
+            if (!wait_for_recv_ready(_sock_fd, timeout_ms)) {
+                return 0; // timeout
+            }
+            _num_syscalls++;
+            ret = ::recvmmsg(_sock_fd, _msgs.data(), vlen, MSG_DONTWAIT, nullptr);
+            if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                return 0; // Spurious wakeup, treat like a timeout
+            }
+        }
+        if (ret < 0) {
+            throw uhd::io_error(
+                str(boost::format("recvmmsg error on socket: %s") % strerror(errno)));
+        }
+        for (int i = 0; i < ret; i++) {
+            if (_msgs[i].msg_len == 0) {
+                throw uhd::io_error("socket closed");
+            }
+            _lens[i] = _msgs[i].msg_len;
+        }
+        _num_packets += ret;
+        return static_cast<size_t>(ret);
+#else
+        _num_syscalls++;
+        _lens[0] = recv_udp_packet(_sock_fd, _frames[0], _frame_size, timeout_ms);
+        if (_lens[0] == 0) {
+            return 0;
+        }
+        _num_packets++;
+        return 1;
+#endif
+    }
+
+    const int _sock_fd;
+    const size_t _frame_size;
+    //! Staging frames. Entries [_head, _num_ready) hold received packets.
+    std::vector<void*> _frames;
+    std::vector<size_t> _lens;
+    size_t _head         = 0;
+    size_t _num_ready    = 0;
+    size_t _num_syscalls = 0;
+    size_t _num_packets  = 0;
+#ifdef UHD_PLATFORM_LINUX
+    std::vector<iovec> _iovecs;
+    std::vector<mmsghdr> _msgs;
+#endif
+};
+
 template <typename Opt>
 size_t get_udp_socket_buffer_size(socket_sptr socket)
 {
@@ -199,6 +389,44 @@ UHD_INLINE size_t resize_udp_socket_buffer_with_warning(
     return actual_size;
 }
 
+/*!
+ * Parse the value of the buff_hugepages argument
+ *
+ * \param value "2M" or "1G" for huge pages, empty or "none" for regular pages
+ * \throws uhd::value_error for other values
+ */
+inline buffer_pool::page_size_t parse_buff_page_size(const std::string& value)
+{
+    if (value.empty() || value == "none") {
+        return buffer_pool::page_size_t::DEFAULT;
+    }
+    if (value == "2M" || value == "2m") {
+        return buffer_pool::page_size_t::HUGE_2M;
+    }
+    if (value == "1G" || value == "1g") {
+        return buffer_pool::page_size_t::HUGE_1G;
+    }
+    throw uhd::value_error("Invalid buff_hugepages value `" + value
+                           + "', must be one of 2M, 1G or none");
+}
+
+/*!
+ * Check the value of the buff_numa_node argument
+ *
+ * \param value a NUMA node, "nic", "thread", or empty
+ * \throws uhd::value_error for other values
+ */
+inline std::string check_buff_numa_node(const std::string& value)
+{
+    if (value.empty() || value == "nic" || value == "thread"
+        || (value.find_first_not_of("0123456789") == std::string::npos
+            && value.size() < 5)) {
+        return value;
+    }
+    throw uhd::value_error("Invalid buff_numa_node value `" + value
+                           + "', must be a NUMA node, nic or thread");
+}
+
 /*!
  * Determines a set of values to use for a UDP CHDR link based on defaults and
  * any overrides that the user may have provided. In cases where both device
@@ -269,6 +497,10 @@ inline link_params_t calculate_udp_link_params(
             link_args.cast<size_t>("num_send_frames", link_params.num_send_frames);
         link_params.send_buff_size =
             link_args.cast<size_t>("send_buff_size", link_params.send_buff_size);
+        // Like batched receive, batched send is only applied to data links
+        link_params.send_batch_size = link_args.cast<size_t>("send_batch_size",
+            device_args.cast<size_t>(
+                "send_batch_size", default_link_params.send_batch_size));
     } else if (link_type == link_type_t::RX_DATA) {
         // Note that the receive frame size will be capped to the Rx MTU.
         link_params.recv_frame_size = std::min(
@@ -278,8 +510,20 @@ inline link_params_t calculate_udp_link_params(
             link_args.cast<size_t>("num_recv_frames", link_params.num_recv_frames);
         link_params.recv_buff_size =
             link_args.cast<size_t>("recv_buff_size", link_params.recv_buff_size);
+        // Batched receive is only applied to data links, control traffic
+        // is too sparse to benefit from it.
+        link_params.recv_batch_size = link_args.cast<size_t>("recv_batch_size",
+            device_args.cast<size_t>(
+                "recv_batch_size", default_link_params.recv_batch_size));
     }
 
+    // The memory placement of the frame buffers applies to all links, and can
+    // be overridden by stream arguments
+    link_params.buff_page_size = parse_buff_page_size(link_args.get("buff_hugepages",
+        device_args.get("buff_hugepages", std::string())));
+    link_params.buff_numa_node = check_buff_numa_node(link_args.get("buff_numa_node",
+        device_args.get("buff_numa_node", default_link_params.buff_numa_node)));
+
     // Finally, we apply any other constraints based on the platform.
 #if defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
     // limit buffer size on OSX to avoid the warning issued by
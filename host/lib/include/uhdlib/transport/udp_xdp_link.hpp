@@ -0,0 +1,273 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/transport/buffer_pool.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/asio.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <linux/if_xdp.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+//! Size of the Ethernet, IPv4 and UDP headers in front of every CHDR packet
+constexpr size_t XDP_UDP_HEADERS_SIZE = 14 + 20 + 8;
+
+class udp_xdp_frame_buff : public frame_buff
+{
+public:
+    //! Point this frame buffer at a UMEM chunk
+    void set_data(void* mem)
+    {
+        _data = mem;
+    }
+
+    //! Offset of the UMEM chunk owned by this buffer, or NO_CHUNK
+    uint64_t chunk = NO_CHUNK;
+
+    static constexpr uint64_t NO_CHUNK = ~uint64_t(0);
+};
+
+class udp_xdp_adapter_info : public adapter_info
+{
+public:
+    udp_xdp_adapter_info(const std::string& ifname, const uint32_t queue_id)
+        : _ifname(ifname), _queue_id(queue_id)
+    {
+    }
+
+    std::string to_string() override
+    {
+        return "Ethernet(AF_XDP):" + _ifname + ":" + std::to_string(_queue_id);
+    }
+
+    bool operator==(const udp_xdp_adapter_info& rhs) const
+    {
+        return _ifname == rhs._ifname && _queue_id == rhs._queue_id;
+    }
+
+private:
+    std::string _ifname;
+    uint32_t _queue_id;
+};
+
+/*! UDP link which bypasses the kernel network stack with an AF_XDP socket
+ *
+ * Received packets are steered to the socket by an XDP program, which is
+ * attached to the network interface while the link exists, and which only
+ * redirects UDP packets for the local port of this link. Packets are received
+ * into and sent from UMEM chunks, which are handed out directly as frame
+ * buffers. The rings shared with the kernel are processed in batches, and
+ * system calls are only made to wait for packets or to kick the transmission.
+ *
+ * A regular UDP socket is kept open to reserve the local port and to resolve
+ * the addresses. The device must be reachable without a router.
+ *
+ * Every link needs its own queue of the network interface, and packets must
+ * arrive on that queue (see ethtool's flow steering). Requires Linux 5.9 or
+ * later, and the CAP_NET_ADMIN and CAP_BPF (or CAP_SYS_ADMIN) capabilities.
+ */
+class udp_xdp_link : public recv_link_base<udp_xdp_link>,
+                     public send_link_base<udp_xdp_link>
+{
+public:
+    using sptr = std::shared_ptr<udp_xdp_link>;
+
+    //! How the XDP program is attached to the interface
+    enum class xdp_mode_t {
+        //! Try NATIVE first, then GENERIC
+        AUTO,
+        //! In the driver, with zero-copy sockets if the driver supports them
+        NATIVE,
+        //! In the kernel network stack, works with all interfaces
+        GENERIC
+    };
+
+    struct xdp_params_t
+    {
+        xdp_mode_t mode = xdp_mode_t::AUTO;
+        //! Queue of the network interface which receives the packets
+        uint32_t queue_id = 0;
+        //! Size of the UMEM chunks, a power of 2 from 2048 to the page size
+        size_t chunk_size = 4096;
+        //! Busy poll time in us, 0 disables busy polling
+        uint32_t busy_poll_us = 0;
+    };
+
+    /*!
+     * Make a new AF_XDP link.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param params Values for frame sizes and num frames. The frame sizes
+     *               must not exceed get_max_frame_size().
+     * \param xdp_params Parameters of the AF_XDP socket
+     * \throws uhd::runtime_error if the socket can't be set up
+     */
+    static sptr make(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const xdp_params_t& xdp_params);
+
+    /*!
+     * Get the XDP parameters from the use_xdp related arguments
+     *
+     * \param device_args device arguments
+     * \param link_args stream arguments, which take precedence
+     * \throws uhd::value_error for invalid values
+     */
+    static xdp_params_t get_xdp_params(
+        const uhd::device_addr_t& device_args, const uhd::device_addr_t& link_args);
+
+    //! Return the largest UDP payload (CHDR packet) which fits into a chunk
+    static size_t get_max_frame_size(const xdp_params_t& xdp_params);
+
+    ~udp_xdp_link();
+
+    //! Return the local port of the UDP connection in host byte order
+    uint16_t get_local_port() const;
+
+    //! Return the local IP address of the UDP connection as a dotted string
+    std::string get_local_addr() const;
+
+    //! Return true if packets are received into UMEM by the driver itself
+    bool is_zero_copy() const
+    {
+        return _zero_copy;
+    }
+
+    buffer_pool::placement_t get_recv_buff_placement() const override
+    {
+        return _umem_pool->get_placement();
+    }
+
+    buffer_pool::placement_t get_send_buff_placement() const override
+    {
+        return _umem_pool->get_placement();
+    }
+
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<udp_xdp_link>;
+    using send_link_base_t = send_link_base<udp_xdp_link>;
+
+    // Friend declarations to allow base classes to call private methods
+    friend recv_link_base_t;
+    friend send_link_base_t;
+
+    //! A ring shared with the kernel
+    template <typename entry_t>
+    struct ring_t
+    {
+        std::atomic<uint32_t>* producer = nullptr;
+        std::atomic<uint32_t>* consumer = nullptr;
+        std::atomic<uint32_t>* flags    = nullptr;
+        entry_t* entries                = nullptr;
+        uint32_t mask                   = 0;
+        void* map                       = nullptr;
+        size_t map_size                 = 0;
+    };
+
+    udp_xdp_link(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const xdp_params_t& xdp_params);
+
+    // Methods called by recv_link_base
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms);
+    void release_recv_buff_derived(frame_buff& buff);
+
+    // Methods called by send_link_base
+    bool get_send_buff_derived(frame_buff& buff, int32_t timeout_ms);
+    void release_send_buff_derived(frame_buff& buff);
+    void release_send_buffs_derived(frame_buff* const* buffs, size_t num_buffs);
+
+    void _setup_socket(const xdp_params_t& xdp_params);
+    template <typename entry_t>
+    void _map_ring(ring_t<entry_t>& ring,
+        const xdp_ring_offset& offsets,
+        uint64_t pgoff,
+        size_t size);
+    template <typename entry_t>
+    void _unmap_ring(ring_t<entry_t>& ring);
+
+    //! Hand the chunks of released receive buffers back to the kernel
+    void _refill();
+    //! Wait for received packets, return false on a timeout
+    bool _wait_for_recv(int32_t timeout_ms);
+    //! Write the headers of a packet and put it into the TX ring
+    void _push_send_buff(udp_xdp_frame_buff& buff);
+    //! Make the kernel send the packets in the TX ring
+    void _kick_send();
+    //! Collect the chunks of sent packets
+    void _reap_completions();
+
+    // The kernel socket reserves the port and resolves addresses
+    boost::asio::io_context _io_context;
+    std::shared_ptr<boost::asio::ip::udp::socket> _socket;
+
+    int _xsk_fd = -1;
+    int _ifindex;
+    uint32_t _queue_id;
+    bool _zero_copy = false;
+    bool _busy_poll = false;
+    std::string _ifname;
+    std::shared_ptr<void> _program;
+
+    // UMEM: receive chunks first, then send chunks
+    buffer_pool::sptr _umem_pool;
+    uint8_t* _umem = nullptr;
+    size_t _chunk_size;
+    size_t _num_recv_chunks;
+
+    ring_t<xdp_desc> _rx_ring;
+    ring_t<uint64_t> _fill_ring;
+    ring_t<xdp_desc> _tx_ring;
+    ring_t<uint64_t> _comp_ring;
+
+    // Cached ring indices, only this link writes the ones it produces
+    uint32_t _rx_cons   = 0;
+    uint32_t _rx_prod   = 0;
+    uint32_t _fill_prod = 0;
+    uint32_t _tx_prod   = 0;
+    uint32_t _comp_cons = 0;
+
+    //! Chunks of released receive buffers, not yet in the fill ring
+    std::vector<uint64_t> _fill_pending;
+    //! Send chunks which are not in use
+    std::vector<uint64_t> _free_send_chunks;
+
+    //! Headers of sent packets, except for the length and checksum fields
+    std::array<uint8_t, XDP_UDP_HEADERS_SIZE> _header_template;
+    uint32_t _remote_ip;
+    uint16_t _remote_port;
+    uint16_t _ip_id = 0;
+
+    std::vector<udp_xdp_frame_buff> _recv_buffs;
+    std::vector<udp_xdp_frame_buff> _send_buffs;
+
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
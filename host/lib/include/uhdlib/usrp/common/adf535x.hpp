@@ -30,6 +30,15 @@ public:
     typedef std::function<void(std::vector<uint32_t>)> write_fn_t;
     typedef std::function<void(uint32_t)> wait_fn_t;
 
+    //! Register values and output frequency of a tuning, see make_tune_plan()
+    struct tune_plan_t
+    {
+        //! The coerced output frequency
+        double freq = 0.0;
+        //! The register cache, indexed by address
+        std::vector<uint32_t> regs;
+    };
+
     static sptr make_adf5355(write_fn_t write, wait_fn_t wait);
     static sptr make_adf5356(write_fn_t write, wait_fn_t wait);
 
@@ -71,6 +80,24 @@ public:
     virtual double set_frequency(
         const double target_freq, const uint32_t mod2 = 2, const bool flush = false) = 0;
 
+    /*! Calculate the settings for a frequency ahead of time
+     *
+     * This does the same calculations as set_frequency(), but leaves the
+     * register cache unchanged. The plan holds all registers, so it is only
+     * valid as long as the other settings (reference and PFD frequency, output
+     * power, charge pump current, ...) don't change.
+     */
+    virtual tune_plan_t make_tune_plan(
+        const double target_freq, const uint32_t mod2 = 2) = 0;
+
+    /*! Load the register values of a tune plan instead of calling set_frequency()
+     *
+     * \param plan A plan made by make_tune_plan()
+     * \param flush Write the frequency update sequence to the device
+     * \returns the coerced output frequency of the plan
+     */
+    virtual double set_tune_plan(const tune_plan_t& plan, const bool flush = false) = 0;
+
     virtual double set_charge_pump_current(
         const double target_current, const bool flush = false) = 0;
 
@@ -232,6 +259,39 @@ public:
         return _set_frequency(target_freq, mod2, flush);
     }
 
+    tune_plan_t make_tune_plan(const double target_freq, const uint32_t mod2 = 2) override
+    {
+        // Do the calculations on the register cache, and restore it afterwards
+        tune_plan_t saved;
+        for (uint8_t addr = 0; addr < _get_num_regs(); addr++) {
+            saved.regs.push_back(_regs.get_reg(addr));
+        }
+        tune_plan_t plan;
+        try {
+            plan.freq = _set_frequency(target_freq, mod2, false);
+        } catch (...) {
+            set_tune_plan(saved);
+            throw;
+        }
+        for (uint8_t addr = 0; addr < _get_num_regs(); addr++) {
+            plan.regs.push_back(_regs.get_reg(addr));
+        }
+        set_tune_plan(saved);
+        return plan;
+    }
+
+    double set_tune_plan(const tune_plan_t& plan, const bool flush = false) override
+    {
+        UHD_ASSERT_THROW(plan.regs.size() == _get_num_regs());
+        for (uint8_t addr = 0; addr < _get_num_regs(); addr++) {
+            _regs.set_reg(addr, plan.regs[addr]);
+        }
+        if (flush) {
+            commit();
+        }
+        return plan.freq;
+    }
+
     double set_charge_pump_current(const double current, const bool flush) override
     {
         const auto cp_range = get_charge_pump_current_range();
@@ -338,6 +398,7 @@ public:
 
 protected:
     uint8_t _set_vco_band_div(double);
+    uint8_t _get_num_regs();
     double _set_frequency(double, uint32_t, bool);
     uhd::meta_range_t _get_charge_pump_current_range();
     void _commit();
@@ -362,6 +423,12 @@ inline uint8_t adf535x_impl<adf5355_regs_t>::_set_vco_band_div(double pfd_freq)
     return static_cast<uint8_t>(ceil(pfd_freq / 2.4e6));
 }
 
+template <>
+inline uint8_t adf535x_impl<adf5355_regs_t>::_get_num_regs()
+{
+    return 13;
+}
+
 template <>
 inline double adf535x_impl<adf5355_regs_t>::_set_frequency(
     double target_freq, uint32_t mod2, bool flush)
@@ -482,18 +549,20 @@ inline void adf535x_impl<adf5355_regs_t>::_commit()
         _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(0)));
         _rewrite_regs = false;
     } else {
-        // Frequency update sequence from data sheet
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(6)));
+        // Frequency update sequence from data sheet, in a single write
+        addr_vtr_t regs;
+        regs.push_back(_regs.get_reg(6));
         _regs.counter_reset = adf5355_regs_t::COUNTER_RESET_ENABLED;
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(4)));
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(2)));
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(1)));
+        regs.push_back(_regs.get_reg(4));
+        regs.push_back(_regs.get_reg(2));
+        regs.push_back(_regs.get_reg(1));
         _regs.autocal_en = adf5355_regs_t::AUTOCAL_EN_DISABLED;
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(0)));
+        regs.push_back(_regs.get_reg(0));
         _regs.counter_reset = adf5355_regs_t::COUNTER_RESET_DISABLED;
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(4)));
+        regs.push_back(_regs.get_reg(4));
         _regs.autocal_en = adf5355_regs_t::AUTOCAL_EN_ENABLED;
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(0)));
+        regs.push_back(_regs.get_reg(0));
+        _write_fn(regs);
     }
 }
 
@@ -504,6 +573,12 @@ inline uint8_t adf535x_impl<adf5356_regs_t>::_set_vco_band_div(double pfd_freq)
     return static_cast<uint8_t>(ceil(pfd_freq / 1.6e6));
 }
 
+template <>
+inline uint8_t adf535x_impl<adf5356_regs_t>::_get_num_regs()
+{
+    return 14;
+}
+
 template <>
 inline double adf535x_impl<adf5356_regs_t>::_set_frequency(
     double target_freq, uint32_t mod2, bool flush)
@@ -629,12 +704,12 @@ inline void adf535x_impl<adf5356_regs_t>::_commit()
         _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(0)));
         _rewrite_regs = false;
     } else {
-        // Frequency update sequence from data sheet
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(13)));
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(10)));
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(6)));
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(2)));
-        _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(1)));
+        // Frequency update sequence from data sheet, batched up to the wait
+        _write_fn({_regs.get_reg(13),
+            _regs.get_reg(10),
+            _regs.get_reg(6),
+            _regs.get_reg(2),
+            _regs.get_reg(1)});
         _wait_fn(_wait_time_us);
         _write_fn(addr_vtr_t(ONE_REG, _regs.get_reg(0)));
     }
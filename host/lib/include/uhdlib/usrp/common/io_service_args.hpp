@@ -28,6 +28,11 @@ namespace uhd { namespace usrp {
  *                           always go to the offload thread containing the fewest
  *                           connections, with lowest numbered thread as a second
  *                           criterion. The default is 1.
+ * poll_offload_rebalance: set to true to service all polling connections from a
+ *                         single I/O service with num_poll_offload_threads
+ *                         threads. Connections are then moved between threads
+ *                         at runtime, based on how many buffers each of them
+ *                         passes. The default is false.
  * recv_offload_thread_<N>_cpu: an integer to specify cpu affinity of the offload
  *                              thread. N indicates the thread instance, starting
  *                              with 0 for each streamer and ending with the number
@@ -62,6 +67,9 @@ struct io_service_args_t
     //! Number of polling threads to use, if wait_mode is set to POLL
     size_t num_poll_offload_threads = 1;
 
+    //! Move connections between polling threads based on their load
+    bool poll_offload_rebalance = false;
+
     //! CPU affinity of offload threads, if wait_mode is set to BLOCK
     std::map<size_t, size_t> recv_offload_thread_cpu;
 
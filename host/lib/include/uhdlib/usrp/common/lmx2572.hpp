@@ -9,6 +9,8 @@
 #include <uhd/types/time_spec.hpp>
 #include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
 //! Control interface for an LMX2572 synthesizer
 class lmx2572_iface
@@ -37,17 +39,34 @@ public:
     //! Sleep functor: sleep for the specified time
     using sleep_fn_t = std::function<void(const uhd::time_spec_t&)>;
 
+    //! Batch write functor: Write address / data pairs in the given order
+    using write_batch_fn_t =
+        std::function<void(const std::vector<std::pair<uint8_t, uint16_t>>&)>;
+
+    //! Register values and output frequency of a tuning, see make_tune_plan()
+    struct tune_plan_t
+    {
+        //! The coerced output frequency
+        double freq = 0.0;
+        //! The register cache, indexed by address
+        std::vector<uint16_t> regs;
+    };
+
     /*! \brief Factory.
      *
      * \param write SPI write function object
      * \param read SPI read function object
      * \param sleep sleep function object
      * \param log_id Log identifier
+     * \param write_batch SPI write function object for all registers written
+     *                    by one commit(). If empty, commit() calls write for
+     *                    every register.
      */
     static sptr make(write_fn_t&& poke16,
         read_fn_t&& peek16,
         sleep_fn_t&& sleep,
-        const std::string& log_id = "");
+        const std::string& log_id       = "",
+        write_batch_fn_t&& poke16_batch = nullptr);
 
     //! Save state to chip
     virtual void commit() = 0;
@@ -110,4 +129,28 @@ public:
      */
     virtual double set_frequency(
         const double target_freq, const double ref_freq, const bool spur_dodging) = 0;
+
+    /*! \brief Calculate the settings for an output frequency ahead of time.
+     *
+     * This does the same calculations as set_frequency(), but leaves the
+     * register cache unchanged and does not access the device. The plan holds
+     * the entire register cache, so it is only valid as long as the settings
+     * other than the frequency (outputs, sync mode, ...) don't change.
+     *
+     * \param target_freq The target frequency
+     * \param ref_freq The input reference frequency
+     * \param spur_dodging Set to true to enable spur dodging
+     */
+    virtual tune_plan_t make_tune_plan(
+        const double target_freq, const double ref_freq, const bool spur_dodging) = 0;
+
+    /*! \brief Load the register values of a tune plan into the register cache.
+     *
+     * This replaces a call to set_frequency(). Like set_frequency(), it does
+     * not write to the device, call commit() to write the registers that
+     * changed.
+     *
+     * \returns the coerced output frequency of the plan
+     */
+    virtual double set_tune_plan(const tune_plan_t& plan) = 0;
 };
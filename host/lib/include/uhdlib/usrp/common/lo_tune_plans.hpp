@@ -0,0 +1,129 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/utils/log.hpp>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace usrp {
+
+/*! Synthesizer tune plans of an LO, by desired LO frequency
+ *
+ * LO controls keep the plans (see e.g. lmx2572_iface::make_tune_plan()) of the
+ * frequencies they hop between, so a retune only loads the stored register
+ * values instead of calculating them. Plans are made either for a given list of
+ * frequencies (set_freqs()), or while recording, for every frequency that is
+ * tuned (lookup()).
+ *
+ * A plan holds the entire register state of the synthesizer, so the LO control
+ * must call update() whenever it changes any other setting which is part of it.
+ *
+ * \tparam plan_t The tune plan type of the synthesizer driver
+ */
+template <typename plan_t>
+class lo_tune_plans
+{
+public:
+    //! Make the plan for a desired LO frequency
+    using make_fn_t = std::function<plan_t(const double)>;
+
+    lo_tune_plans(make_fn_t&& make_plan, const size_t max_num_plans, std::string log_id)
+        : _make_plan(std::move(make_plan))
+        , _max_num_plans(max_num_plans)
+        , _log_id(std::move(log_id))
+    {
+    }
+
+    //! Replace all plans by the plans for the given frequencies
+    void set_freqs(const std::vector<double>& freqs)
+    {
+        UHD_LOG_TRACE(
+            _log_id, "Making tune plans for " << freqs.size() << " frequencies");
+        _plans.clear();
+        _warned_full = false;
+        for (const double freq : freqs) {
+            if (!_plans.count(freq) && !_add(freq)) {
+                return;
+            }
+        }
+    }
+
+    //! Return the frequencies which have a plan, in ascending order
+    std::vector<double> get_freqs() const
+    {
+        std::vector<double> freqs;
+        freqs.reserve(_plans.size());
+        for (const auto& plan : _plans) {
+            freqs.push_back(plan.first);
+        }
+        return freqs;
+    }
+
+    //! Enable or disable making a plan for every frequency passed to lookup()
+    void set_recording(const bool enable)
+    {
+        _recording = enable;
+    }
+
+    bool get_recording() const
+    {
+        return _recording;
+    }
+
+    /*! Return the plan for a frequency
+     *
+     * \returns the stored plan, or a new one if recording is enabled, or
+     *          nullptr if the caller needs to tune without a plan
+     */
+    const plan_t* lookup(const double freq)
+    {
+        auto plan_it = _plans.find(freq);
+        if (plan_it != _plans.end()) {
+            return &plan_it->second;
+        }
+        if (_recording && _add(freq)) {
+            return &_plans.at(freq);
+        }
+        return nullptr;
+    }
+
+    //! Remake all plans, after a setting which is part of them changed
+    void update()
+    {
+        for (auto& plan : _plans) {
+            plan.second = _make_plan(plan.first);
+        }
+    }
+
+private:
+    bool _add(const double freq)
+    {
+        if (_plans.size() >= _max_num_plans) {
+            if (!_warned_full) {
+                UHD_LOG_WARNING(_log_id,
+                    "Cannot store tune plans for more than " << _max_num_plans
+                                                             << " frequencies.");
+                _warned_full = true;
+            }
+            return false;
+        }
+        _plans.emplace(freq, _make_plan(freq));
+        return true;
+    }
+
+    const make_fn_t _make_plan;
+    const size_t _max_num_plans;
+    const std::string _log_id;
+    std::map<double, plan_t> _plans;
+    bool _recording   = false;
+    bool _warned_full = false;
+};
+
+}} // namespace uhd::usrp
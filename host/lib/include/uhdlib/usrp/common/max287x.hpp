@@ -35,6 +35,17 @@ public:
     typedef std::function<void(std::vector<uint32_t>)> write_fn;
     typedef std::map<uint8_t, uhd::range_t> vco_map_t;
 
+    /**
+     * Register values and output frequency of a tuning, see make_tune_plan()
+     */
+    struct tune_plan_t
+    {
+        //! The actual output frequency
+        double freq = 0.0;
+        //! The register cache, indexed by address
+        std::vector<uint32_t> regs;
+    };
+
     /**
      * LD Pin Modes
      */
@@ -163,6 +174,32 @@ public:
         bool is_int_n,
         rf_output_port_t output_port = RF_OUT) = 0;
 
+    /**
+     * Calculate the settings for a frequency ahead of time. This does the same
+     * calculations as set_frequency(), but leaves the register cache unchanged.
+     * The plan holds all registers, so it is only valid as long as the other
+     * settings (output power, sync configuration, ...) don't change.
+     * @param target_freq target frequency
+     * @param ref_freq reference frequency
+     * @param target_pfd_freq target phase detector frequency
+     * @param is_int_n enable integer-N tuning
+     * @param output_port which output port should output the requested frequency
+     * @return the tune plan
+     */
+    virtual tune_plan_t make_tune_plan(double target_freq,
+        double ref_freq,
+        double target_pfd_freq,
+        bool is_int_n,
+        rf_output_port_t output_port = RF_OUT) = 0;
+
+    /**
+     * Load the register values of a tune plan, instead of calling
+     * set_frequency(). Call commit() to write the registers that changed.
+     * @param plan a plan made by make_tune_plan()
+     * @return actual frequency
+     */
+    virtual double set_tune_plan(const tune_plan_t& plan) = 0;
+
     /**
      * Set output power (RFOUTA)
      * @param power output power
@@ -302,6 +339,12 @@ public:
         double target_pfd_freq,
         bool is_int_n,
         rf_output_port_t output_port = RF_OUT) override;
+    tune_plan_t make_tune_plan(double target_freq,
+        double ref_freq,
+        double target_pfd_freq,
+        bool is_int_n,
+        rf_output_port_t output_port = RF_OUT) override;
+    double set_tune_plan(const tune_plan_t& plan) override;
     void set_output_power(output_power_t power) override;
     void set_aux_output_power(aux_output_power_t power) override;
     void set_output_power_enable(bool enable) override;
@@ -933,6 +976,51 @@ double max287x<max287x_regs_t>::set_frequency(double target_freq,
     return actual_freq;
 }
 
+template <typename max287x_regs_t>
+max287x_iface::tune_plan_t max287x<max287x_regs_t>::make_tune_plan(double target_freq,
+    double ref_freq,
+    double target_pfd_freq,
+    bool is_int_n,
+    rf_output_port_t output_port)
+{
+    // Do the calculations on the register cache, and restore it afterwards
+    tune_plan_t saved;
+    for (uint8_t addr = 0; addr <= 5; addr++) {
+        saved.regs.push_back(_regs.get_reg(addr));
+    }
+    const bool write_all_regs = _write_all_regs;
+    tune_plan_t plan;
+    try {
+        plan.freq = set_frequency(
+            target_freq, ref_freq, target_pfd_freq, is_int_n, output_port);
+    } catch (...) {
+        set_tune_plan(saved);
+        _write_all_regs = write_all_regs;
+        throw;
+    }
+    for (uint8_t addr = 0; addr <= 5; addr++) {
+        plan.regs.push_back(_regs.get_reg(addr));
+    }
+    set_tune_plan(saved);
+    _write_all_regs = write_all_regs;
+    return plan;
+}
+
+template <typename max287x_regs_t>
+double max287x<max287x_regs_t>::set_tune_plan(const tune_plan_t& plan)
+{
+    UHD_ASSERT_THROW(plan.regs.size() == 6);
+    // The lowest three bits hold the register address
+    for (uint8_t addr = 0; addr <= 5; addr++) {
+        _regs.set_reg(addr, 0xFFFFFFF8, plan.regs[addr]);
+    }
+    if (_regs.clock_div_mode == max287x_regs_t::CLOCK_DIV_MODE_FAST_LOCK) {
+        // Same as set_frequency(): make sure the charge pump current is written
+        _write_all_regs = true;
+    }
+    return plan.freq;
+}
+
 template <typename max287x_regs_t>
 void max287x<max287x_regs_t>::set_output_power(output_power_t power)
 {
@@ -192,6 +192,8 @@ static constexpr double LMX2572_MAX_FREQ     = 6e9; // Hz
 static constexpr double LMX2572_DEFAULT_FREQ = 1e9; // Hz
 
 static constexpr uint32_t HBX_LO_LOCK_TIMEOUT_MS = 20; // milliseconds
+// Number of LO frequencies for which the LO control keeps tune plans
+static constexpr size_t HBX_LO_MAX_TUNE_PLANS = 1024;
 
 // clang-format off
 static const std::vector<hbx_lo_gain_map_item_t> tx_lo_gain_map = {
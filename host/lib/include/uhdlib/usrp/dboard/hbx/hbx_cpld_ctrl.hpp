@@ -17,6 +17,8 @@
 #include <chrono>
 #include <functional>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace hbx {
 
@@ -47,6 +49,9 @@ public:
         std::function<void(const uint32_t, const uint32_t, const chan_t)>;
     using peek_fn_type  = std::function<uint32_t(const uint32_t)>;
     using sleep_fn_type = std::function<void(const uhd::time_spec_t&)>;
+    //! Write all values to the same address, in one command
+    using burst_poke_fn_type =
+        std::function<void(const uint32_t, const std::vector<uint32_t>&, const chan_t)>;
 
     hbx_cpld_ctrl(poke_fn_type&& poke_fn,
         peek_fn_type&& peek_fn,
@@ -202,12 +207,15 @@ public:
          * \param peek_fn The peek function to read data from the hardware component.
          * \param poke_fn The poke function to write data to the hardware component.
          * \param queue If true, transactions can be queued without waiting for SPI ready
+         * \param burst_poke_fn If given, queued writes of spi_write(writes) are sent
+         * to the SPI setup register in one burst.
          *
          */
         spi_transactor(size_t start_address,
             poke_fn_type&& poke_fn,
             peek_fn_type&& peek_fn,
-            const bool queue = false);
+            const bool queue                   = false,
+            burst_poke_fn_type&& burst_poke_fn = nullptr);
 
         ~spi_transactor(void) = default;
 
@@ -224,6 +232,13 @@ public:
          */
         void spi_write(const uint32_t addr, const uint32_t data);
 
+        /*!
+         * Perform SPI write transactions for a list of (addr, data) pairs, in order.
+         *
+         * If transactions can be queued, all of them are sent in one burst.
+         */
+        void spi_write(const std::vector<std::pair<uint32_t, uint32_t>>& writes);
+
         /*!
          * Perform an SPI read transaction.
          *
@@ -253,6 +268,9 @@ public:
         //! Peeker object
         peek_fn_type _peek32;
 
+        //! Burst poker object, may be empty
+        burst_poke_fn_type _burst_poke32;
+
         // Stores data read from an SPI transaction
         uint32_t _spi_read_data;
 
@@ -288,6 +306,10 @@ public:
         void spi_transact(
             const bool is_read, const uint32_t addr, const uint32_t data = 0);
 
+        // Returns the value of the SPI setup register which starts a transaction
+        uint32_t get_setup_value(
+            const bool is_read, const uint32_t addr, const uint32_t data) const;
+
         // Functions to verify if the SPI engine is ready for a transaction or data is
         // ready to be read back
         void poll_spi_ready(const bool is_read = false);
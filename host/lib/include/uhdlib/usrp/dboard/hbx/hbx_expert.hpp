@@ -23,6 +23,7 @@
 #include <cmath>
 #include <complex>
 #include <memory>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace hbx {
 
@@ -84,9 +85,14 @@ public:
         , _desired_lo_frequency(db, fe_path / "los" / lo / "freq" / "value" / "desired")
         , _lo_export(db, fe_path / "los" / lo / "export")
         , _lo_import(db, fe_path / "los" / lo / "import")
+        , _desired_tune_plan_freqs(
+              db, fe_path / "los" / lo / "tune_plans" / "freqs" / "desired")
+        , _record_tune_plans(db, fe_path / "los" / lo / "tune_plans" / "record")
         , _desired_lo_ext_power(
               db, fe_path / "gains" / HBX_GAIN_STAGE_LO_PWR_EXT / "value" / "desired")
         , _coerced_lo_frequency(db, fe_path / "los" / lo / "freq" / "value" / "coerced")
+        , _coerced_tune_plan_freqs(
+              db, fe_path / "los" / lo / "tune_plans" / "freqs" / "coerced")
         , _trx(trx)
         , _lo_ctrl(hbx_lo_ctrl)
         , _cpld(cpld)
@@ -94,8 +100,11 @@ public:
         bind_accessor(_desired_lo_frequency);
         bind_accessor(_lo_export);
         bind_accessor(_lo_import);
+        bind_accessor(_desired_tune_plan_freqs);
+        bind_accessor(_record_tune_plans);
         bind_accessor(_desired_lo_ext_power);
         bind_accessor(_coerced_lo_frequency);
+        bind_accessor(_coerced_tune_plan_freqs);
     }
 
 
@@ -106,10 +115,15 @@ private:
     uhd::experts::data_reader_t<double> _desired_lo_frequency;
     uhd::experts::data_reader_t<bool> _lo_export;
     uhd::experts::data_reader_t<bool> _lo_import;
+    // Inputs from user/API
+    uhd::experts::data_reader_t<std::vector<double>> _desired_tune_plan_freqs;
+    uhd::experts::data_reader_t<bool> _record_tune_plans;
 
     // Outputs to Frequency BE expert or user/API
     uhd::experts::data_writer_t<double> _desired_lo_ext_power;
     uhd::experts::data_writer_t<double> _coerced_lo_frequency;
+    // Outputs to user/API
+    uhd::experts::data_writer_t<std::vector<double>> _coerced_tune_plan_freqs;
 
     uhd::direction_t _trx;
     std::shared_ptr<hbx_lo_ctrl> _lo_ctrl;
@@ -9,8 +9,10 @@
 #include "hbx_constants.hpp"
 #include <uhd/types/direction.hpp>
 #include <uhdlib/usrp/common/lmx2572.hpp>
+#include <uhdlib/usrp/common/lo_tune_plans.hpp>
 #include <uhdlib/usrp/dboard/hbx/hbx_cpld_ctrl.hpp>
 #include <functional>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace hbx {
 
@@ -19,18 +21,31 @@ class hbx_lo_ctrl final : public hbx_cpld_ctrl::spi_transactor
 public:
     using time_accessor_fn_type = std::function<uhd::time_spec_t()>;
 
-    // Pass in our lo selection and poke/peek functions
+    // Pass in our lo selection and poke/peek functions. burst_poke_fn writes all
+    // registers of one LMX commit in one command.
     hbx_lo_ctrl(direction_t trx,
         const std::string& unique_id,
         size_t start_address,
         hbx_cpld_ctrl::poke_fn_type&& poke_fn,
         hbx_cpld_ctrl::peek_fn_type&& peek_fn,
+        hbx_cpld_ctrl::burst_poke_fn_type&& burst_poke_fn,
         const double db_prc_rate,
         time_accessor_fn_type&& time_accessor);
 
     // Passes in a desired LO frequency to the LMX driver, returns the coerced frequency
+    // If there is a tune plan for the frequency, its settings are loaded instead of
+    // calculated.
     double set_lo_freq(const double freq);
 
+    // Makes tune plans for the given LO frequencies, replacing the existing ones
+    void set_tune_plan_freqs(const std::vector<double>& freqs);
+
+    // Returns the LO frequencies which have a tune plan
+    std::vector<double> get_tune_plan_freqs() const;
+
+    // While enabled, set_lo_freq() makes a tune plan for every new frequency
+    void set_tune_plan_recording(const bool enable);
+
     // Returns cached LO frequency value
     double get_lo_freq();
 
@@ -86,6 +101,9 @@ private:
     // Daughterboard PRC rate, used as the reference frequency
     double _db_prc_rate;
 
+    // LMX settings by desired LO frequency
+    lo_tune_plans<lmx2572_iface::tune_plan_t> _tune_plans;
+
     // Save the last set LO output power
     uint8_t _lo_output_a_power = LO_MAX_PWR;
     uint8_t _lo_output_b_power = LO_MAX_PWR;
@@ -76,6 +76,8 @@ static constexpr double LMX2572_DEFAULT_FREQ     = 4e9; // Hz
 static constexpr uint32_t ZBX_LO_LOCK_TIMEOUT_MS = 50; // milliseconds
 // This is the step size for the LO tuning relative to the PRC rate:
 static constexpr int ZBX_RELATIVE_LO_STEP_SIZE = 6;
+// Number of LO frequencies for which the LO control keeps tune plans
+static constexpr size_t ZBX_LO_MAX_TUNE_PLANS = 1024;
 
 static constexpr double ZBX_MIN_FREQ     = 1e6; // Hz
 static constexpr double ZBX_MAX_FREQ     = 8e9; // Hz
@@ -15,6 +15,8 @@
 #include <array>
 #include <functional>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace zbx {
 
@@ -322,6 +324,19 @@ public:
      */
     void lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint16_t data);
 
+    /*! \brief Write to several registers on an LO.
+     *
+     * This is the same as calling lo_poke16() for every address/data pair, in
+     * order, except that the throttling after the last write is deferred to
+     * the next LO SPI transaction. Pokes to other CPLD registers following the
+     * batch are thus not delayed.
+     *
+     * \param lo Which LO to write to.
+     * \param writes Address/data pairs of the LO registers
+     */
+    void lo_poke16(
+        const zbx_lo_t lo, const std::vector<std::pair<uint8_t, uint16_t>>& writes);
+
     /*! \brief Read back from the LO.
      *
      * Note: The LMX2572 has a MUXout pin, not just an SDO pin. This means the
@@ -477,6 +492,9 @@ private:
     // Address offset (on top of _db_cpld_offset) where the LO SPI register is
     const uint32_t _lo_spi_offset;
 
+    // True if the last LO SPI transaction was not followed by a throttle yet
+    bool _lo_spi_throttle_pending = false;
+
     // infos about the daughtherboard revision
     std::string _db_rev_info;
 
@@ -21,6 +21,7 @@
 #include <uhdlib/usrp/common/x400_rpc_iface.hpp>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace zbx {
 
@@ -258,13 +259,21 @@ public:
         , _desired_lo_frequency(db, fe_path / "los" / lo / "freq" / "value" / "desired")
         , _set_is_enabled(db, fe_path / lo / "enabled")
         , _test_mode_enabled(db, fe_path / lo / "test_mode")
+        , _desired_tune_plan_freqs(
+              db, fe_path / "los" / lo / "tune_plans" / "freqs" / "desired")
+        , _record_tune_plans(db, fe_path / "los" / lo / "tune_plans" / "record")
         , _coerced_lo_frequency(db, fe_path / "los" / lo / "freq" / "value" / "coerced")
+        , _coerced_tune_plan_freqs(
+              db, fe_path / "los" / lo / "tune_plans" / "freqs" / "coerced")
         , _lo_ctrl(zbx_lo_ctrl)
     {
         bind_accessor(_desired_lo_frequency);
         bind_accessor(_test_mode_enabled);
         bind_accessor(_set_is_enabled);
+        bind_accessor(_desired_tune_plan_freqs);
+        bind_accessor(_record_tune_plans);
         bind_accessor(_coerced_lo_frequency);
+        bind_accessor(_coerced_tune_plan_freqs);
     }
 
 private:
@@ -275,9 +284,13 @@ private:
     uhd::experts::data_reader_t<bool> _set_is_enabled;
     // Inputs from user/API
     uhd::experts::data_reader_t<bool> _test_mode_enabled;
+    uhd::experts::data_reader_t<std::vector<double>> _desired_tune_plan_freqs;
+    uhd::experts::data_reader_t<bool> _record_tune_plans;
 
     // Outputs to Frequency BE expert or user/API
     uhd::experts::data_writer_t<double> _coerced_lo_frequency;
+    // Outputs to user/API
+    uhd::experts::data_writer_t<std::vector<double>> _coerced_tune_plan_freqs;
 
     std::shared_ptr<zbx_lo_ctrl> _lo_ctrl;
 };
@@ -9,25 +9,40 @@
 #include "zbx_constants.hpp"
 #include <uhd/types/direction.hpp>
 #include <uhdlib/usrp/common/lmx2572.hpp>
+#include <uhdlib/usrp/common/lo_tune_plans.hpp>
 #include <functional>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace zbx {
 
 class zbx_lo_ctrl final
 {
 public:
-    // Pass in our lo selection and poke/peek functions
+    // Pass in our lo selection and poke/peek functions. poke16_batch writes all
+    // registers of one LMX commit.
     zbx_lo_ctrl(zbx_lo_t lo,
         lmx2572_iface::write_fn_t&& poke16,
         lmx2572_iface::read_fn_t&& peek16,
         lmx2572_iface::sleep_fn_t&& sleep,
+        lmx2572_iface::write_batch_fn_t&& poke16_batch,
         const double default_frequency,
         const double db_prc_rate,
         const bool testing_mode_enabled);
 
     // Passes in a desired LO frequency to the LMX driver, returns the coerced frequency
+    // If there is a tune plan for the frequency, its settings are loaded instead of
+    // calculated.
     double set_lo_freq(const double freq);
 
+    // Makes tune plans for the given LO frequencies, replacing the existing ones
+    void set_tune_plan_freqs(const std::vector<double>& freqs);
+
+    // Returns the LO frequencies which have a tune plan
+    std::vector<double> get_tune_plan_freqs() const;
+
+    // While enabled, set_lo_freq() makes a tune plan for every new frequency
+    void set_tune_plan_recording(const bool enable);
+
     // Returns cached LO frequency value
     double get_lo_freq();
 
@@ -79,6 +94,9 @@ private:
     // Daughterboard PRC rate, used as the reference frequency
     double _db_prc_rate;
 
+    // LMX settings by desired LO frequency
+    lo_tune_plans<lmx2572_iface::tune_plan_t> _tune_plans;
+
     // Set LO output mode, RF output mode is considered normal use case
     // Testing mode is for LMX V&V
     bool _testing_mode_enabled;
@@ -0,0 +1,386 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/log.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+/*! \file binary_log.hpp
+ *
+ * Binary logging for the fast path.
+ *
+ * The regular UHD_LOG_* macros format their message on the calling thread and
+ * then push it into a queue shared by all threads. The UHD_LOG_BIN_* macros
+ * instead write a compact binary record (time stamp, call site ID, and the raw
+ * arguments) into a lock-free ring owned by the calling thread. Every call site
+ * is registered once, and its ID identifies level, component, source location
+ * and format string. Formatting is deferred to the logging thread, or, if
+ * UHD_LOG_BINARY_FILE is set, to the offline decoder (uhd_log_decode.py).
+ *
+ * The format string uses `{}` as a placeholder for the next argument. Arguments
+ * may be integers, floating point values, bools, enums, pointers, and strings.
+ * Strings are copied into the record, and may be truncated. The component must
+ * be the same for every call of a given call site.
+ *
+ * Binary logging is enabled by setting the UHD_LOG_BINARY environment variable.
+ * When it is disabled, the UHD_LOG_BIN_* macros log like their UHD_LOG_*
+ * counterparts.
+ *
+ * Example:
+ * \code{.cpp}
+ * UHD_LOG_BIN_DEBUG("IO_SRV", "Dropped packet on port {} (seq {})", port, seq);
+ * \endcode
+ */
+
+namespace uhd { namespace log { namespace binary {
+
+//! Type tags for the arguments in a binary log record
+enum class arg_type : uint8_t {
+    SIGNED   = 0, //!< int64_t
+    UNSIGNED = 1, //!< uint64_t
+    FLOAT    = 2, //!< double
+    BOOL     = 3, //!< uint8_t
+    POINTER  = 4, //!< uint64_t, formatted as hex
+    STRING   = 5, //!< uint16_t length, followed by the characters
+};
+
+//! Header of every binary log record. The arguments follow the header.
+struct record_header
+{
+    //! Size of the record in bytes, including this header
+    uint32_t size;
+    //! The call site that produced this record, see register_site()
+    uint32_t site_id;
+    //! Time of the log call in nanoseconds since the system clock epoch
+    uint64_t time_ns;
+};
+
+//! Maximum size of a single record. Strings are truncated to fit.
+constexpr size_t MAX_RECORD_SIZE = 256;
+
+//! Default ring size per thread, in bytes
+constexpr size_t DEFAULT_RING_SIZE = 64 * 1024;
+
+//! Static description of a call site
+struct site_info
+{
+    uhd::log::severity_level level;
+    std::string component;
+    std::string file;
+    unsigned int line;
+    std::string format;
+};
+
+//! The thread that produced a record
+struct thread_info
+{
+    //! Index of the thread, counting from zero in the order of their first record
+    uint32_t index;
+    std::thread::id id;
+};
+
+//! A record, as handed to the drain() handler
+struct record
+{
+    const record_header* header;
+    const thread_info* thread;
+
+    //! Pointer to the first argument
+    const uint8_t* args() const
+    {
+        return reinterpret_cast<const uint8_t*>(header) + sizeof(record_header);
+    }
+
+    //! Number of bytes of arguments
+    size_t args_size() const
+    {
+        return header->size - sizeof(record_header);
+    }
+};
+
+//! Format the arguments of a record according to the format string
+UHD_API std::string format_args(const std::string& format, const record& rec);
+
+namespace detail {
+
+//! Serializes the arguments of a log call into a stack buffer
+class record_builder
+{
+public:
+    record_builder(const uint32_t site_id) : _size(sizeof(record_header))
+    {
+        _header().site_id = site_id;
+    }
+
+    template <typename T>
+    void add(const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            _add_scalar(arg_type::BOOL, static_cast<uint8_t>(value));
+        } else if constexpr (std::is_same_v<T, char>) {
+            _add_string(std::string_view(&value, 1));
+        } else if constexpr (std::is_enum_v<T>) {
+            add(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            _add_scalar(arg_type::SIGNED, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<T>) {
+            _add_scalar(arg_type::UNSIGNED, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            _add_scalar(arg_type::FLOAT, static_cast<double>(value));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            if constexpr (std::is_pointer_v<T>) {
+                if (!value) {
+                    _add_string("(null)");
+                    return;
+                }
+            }
+            _add_string(std::string_view(value));
+        } else if constexpr (std::is_pointer_v<T>) {
+            _add_scalar(arg_type::POINTER,
+                static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        } else {
+            static_assert(!sizeof(T),
+                "Binary log arguments must be numbers, enums, pointers, or strings");
+        }
+    }
+
+    //! Fill in size and time stamp, and return the finished record
+    const record_header* finish()
+    {
+        _header().size    = static_cast<uint32_t>(_size);
+        _header().time_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch())
+                .count());
+        return &_header();
+    }
+
+private:
+    record_header& _header()
+    {
+        return *reinterpret_cast<record_header*>(_buf);
+    }
+
+    template <typename T>
+    void _add_scalar(const arg_type type, const T value)
+    {
+        if (_size + 1 + sizeof(T) > MAX_RECORD_SIZE) {
+            return;
+        }
+        _buf[_size++] = static_cast<uint8_t>(type);
+        std::memcpy(_buf + _size, &value, sizeof(T));
+        _size += sizeof(T);
+    }
+
+    void _add_string(std::string_view str)
+    {
+        if (_size + 1 + sizeof(uint16_t) > MAX_RECORD_SIZE) {
+            return;
+        }
+        const uint16_t len = static_cast<uint16_t>(
+            std::min(str.size(), MAX_RECORD_SIZE - _size - 1 - sizeof(uint16_t)));
+        _buf[_size++] = static_cast<uint8_t>(arg_type::STRING);
+        std::memcpy(_buf + _size, &len, sizeof(len));
+        _size += sizeof(len);
+        std::memcpy(_buf + _size, str.data(), len);
+        _size += len;
+    }
+
+    alignas(record_header) uint8_t _buf[MAX_RECORD_SIZE];
+    size_t _size;
+};
+
+//! Copy a finished record into the calling thread's ring. Never blocks.
+UHD_API void push_record(const record_header* header);
+
+/*! Streams a message the way the log thread would format it
+ *
+ * Used when binary logging is disabled, so both paths produce the same text.
+ */
+template <typename... Args>
+class text_message
+{
+public:
+    text_message(const char* format, const Args&... args)
+        : _format(format), _args(args...)
+    {
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const text_message& msg)
+    {
+        record_builder builder(0);
+        std::apply([&builder](const auto&... args) { (builder.add(args), ...); },
+            msg._args);
+        const record_header* header = builder.finish();
+        return os << format_args(msg._format, record{header, nullptr});
+    }
+
+private:
+    const char* _format;
+    std::tuple<const Args&...> _args;
+};
+
+} // namespace detail
+
+//! Returns true if binary logging is enabled
+UHD_API bool is_enabled();
+
+//! Returns true if a message at this level would be logged
+UHD_API bool is_level_enabled(const uhd::log::severity_level level);
+
+/*! Enable binary logging
+ *
+ * \param ring_size Size of the ring buffer of each thread, in bytes. When a ring
+ *                  is full, records are dropped until drain() has caught up.
+ */
+UHD_API void enable(const size_t ring_size = DEFAULT_RING_SIZE);
+
+//! Disable binary logging. Records which were already written can still be drained.
+UHD_API void disable();
+
+//! Set the minimum level for binary log calls
+UHD_API void set_min_level(const uhd::log::severity_level level);
+
+/*! Register a call site, and return its ID
+ *
+ * This is called once per call site by the UHD_LOG_BIN_* macros. The arguments
+ * are only used to determine the call site's type.
+ */
+UHD_API uint32_t register_site(const uhd::log::severity_level level,
+    const char* component,
+    const char* file,
+    const unsigned int line,
+    const char* format);
+
+template <typename... Args>
+uint32_t register_site(const uhd::log::severity_level level,
+    const char* component,
+    const char* file,
+    const unsigned int line,
+    const char* format,
+    const Args&...)
+{
+    return register_site(level, component, file, line, format);
+}
+
+//! Return the description of a call site
+UHD_API site_info get_site(const uint32_t site_id);
+
+//! Return the number of sites registered so far. IDs are 0 ... get_num_sites()-1.
+UHD_API size_t get_num_sites();
+
+//! Write a record into the calling thread's ring
+template <typename... Args>
+void log_record(const uint32_t site_id, const char* /*format*/, const Args&... args)
+{
+    detail::record_builder builder(site_id);
+    (builder.add(args), ...);
+    detail::push_record(builder.finish());
+}
+
+/*! Pop all pending records from all threads, and hand them to \p handler
+ *
+ * Records are handed out in time stamp order. If records were dropped since the
+ * last call, a record of an internal site reports how many. Only one thread
+ * may call drain() at any time.
+ *
+ * \returns the number of records handled
+ */
+UHD_API size_t drain(const std::function<void(const record&)>& handler);
+
+//! Format a record according to its site's format string
+UHD_API std::string format_record(const record& rec);
+
+/*! Writes records into a binary log file
+ *
+ * The file starts with the magic string "UHDBLOG1", followed by entries that
+ * each start with a one-byte tag:
+ * - 'S': Site definition. uint32_t ID, uint8_t level, uint32_t line, followed by
+ *   component, file, and format, each a uint16_t length plus characters.
+ * - 'T': Thread definition. uint32_t index, followed by a thread ID string
+ *   (uint16_t length plus characters).
+ * - 'R': Record. uint32_t thread index, followed by the raw record (header and
+ *   arguments, in host byte order).
+ *
+ * Sites and threads are defined before the first record that references them.
+ */
+class UHD_API file_writer
+{
+public:
+    file_writer(std::ostream& out);
+
+    void write(const record& rec);
+
+private:
+    std::ostream& _out;
+    size_t _num_sites_written = 0;
+    std::set<uint32_t> _threads_written;
+};
+
+}}} // namespace uhd::log::binary
+
+#define _UHD_LOG_BIN_INTERNAL(component, level, ...)                                  \
+    do {                                                                            \
+        if (uhd::log::binary::is_enabled()) {                                       \
+            if (uhd::log::binary::is_level_enabled(level)) {                        \
+                static const uint32_t _uhd_log_bin_site =                           \
+                    uhd::log::binary::register_site(                                \
+                        level, component, __FILE__, __LINE__, __VA_ARGS__);         \
+                uhd::log::binary::log_record(_uhd_log_bin_site, __VA_ARGS__);       \
+            }                                                                       \
+        } else {                                                                    \
+            _UHD_LOG_INTERNAL(component, level)                                     \
+                << uhd::log::binary::detail::text_message(__VA_ARGS__);             \
+        }                                                                           \
+    } while (0)
+
+#if UHD_LOG_MIN_LEVEL < 1
+#    define UHD_LOG_BIN_TRACE(component, ...) \
+        _UHD_LOG_BIN_INTERNAL(component, uhd::log::trace, __VA_ARGS__)
+#else
+#    define UHD_LOG_BIN_TRACE(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 2
+#    define UHD_LOG_BIN_DEBUG(component, ...) \
+        _UHD_LOG_BIN_INTERNAL(component, uhd::log::debug, __VA_ARGS__)
+#else
+#    define UHD_LOG_BIN_DEBUG(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 3
+#    define UHD_LOG_BIN_INFO(component, ...) \
+        _UHD_LOG_BIN_INTERNAL(component, uhd::log::info, __VA_ARGS__)
+#else
+#    define UHD_LOG_BIN_INFO(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 4
+#    define UHD_LOG_BIN_WARNING(component, ...) \
+        _UHD_LOG_BIN_INTERNAL(component, uhd::log::warning, __VA_ARGS__)
+#else
+#    define UHD_LOG_BIN_WARNING(component, ...)
+#endif
+
+#if UHD_LOG_MIN_LEVEL < 5
+#    define UHD_LOG_BIN_ERROR(component, ...) \
+        _UHD_LOG_BIN_INTERNAL(component, uhd::log::error, __VA_ARGS__)
+#else
+#    define UHD_LOG_BIN_ERROR(component, ...)
+#endif
@@ -11,8 +11,11 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/interpolation.hpp>
 #include <uhd/utils/math.hpp>
+#include <algorithm>
 #include <map>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace uhd { namespace math {
 
@@ -258,4 +261,159 @@ typename doublemap_type::mapped_type::mapped_type at_bilin_interp(
     return bilinear_interp(key_x, key_y, x1, y1, x2, y2, z11, z12, z21, z22);
 }
 
+/*! A map compiled into flat arrays, with constant-time lookups
+ *
+ * std::map::lower_bound() walks a tree whose nodes are scattered across the
+ * heap. This class instead stores keys and values in contiguous arrays, and
+ * splits the key range into equally sized buckets. For every bucket, a dense
+ * table holds the index of the first key that falls into it (or into any later
+ * bucket). A lookup computes the bucket from the key, and then only scans the
+ * keys within that bucket, of which there are usually none or one.
+ *
+ * The lookup functions return the same results as their map-based
+ * counterparts in this file. The table does not track changes to the map it was
+ * built from, so it must be rebuilt whenever that map changes.
+ */
+template <typename key_type, typename mapped_type>
+class lookup_table
+{
+public:
+    //! Number of buckets per key. More buckets mean fewer keys to scan.
+    static constexpr size_t BUCKETS_PER_KEY = 4;
+    //! Upper limit for the size of the bucket table
+    static constexpr size_t MAX_BUCKETS = 1 << 16;
+
+    lookup_table() = default;
+
+    lookup_table(const std::map<key_type, mapped_type>& data)
+    {
+        if (data.empty()) {
+            return;
+        }
+        _keys.reserve(data.size());
+        _values.reserve(data.size());
+        for (const auto& entry : data) {
+            _keys.push_back(entry.first);
+            _values.push_back(entry.second);
+        }
+        const size_t num_buckets = std::min(_keys.size() * BUCKETS_PER_KEY, MAX_BUCKETS);
+        const double span        = static_cast<double>(_keys.back() - _keys.front());
+        _scale                   = span > 0 ? (num_buckets - 1) / span : 0.0;
+        _first.resize(num_buckets);
+        // The bucket of a key is a monotonic function of the key, so any key
+        // before _first[bucket] is smaller than all keys falling into bucket.
+        size_t index = 0;
+        for (size_t bucket = 0; bucket < num_buckets; bucket++) {
+            while (index < _keys.size() && _get_bucket(_keys[index]) < bucket) {
+                index++;
+            }
+            _first[bucket] = index;
+        }
+    }
+
+    bool empty() const
+    {
+        return _keys.empty();
+    }
+
+    size_t size() const
+    {
+        return _keys.size();
+    }
+
+    const key_type& key(const size_t index) const
+    {
+        return _keys[index];
+    }
+
+    const mapped_type& value(const size_t index) const
+    {
+        return _values[index];
+    }
+
+    //! Like std::map::lower_bound(), but returns an index (size() if not found)
+    size_t lower_bound(const key_type& key) const
+    {
+        if (_keys.empty() || !(_keys.front() < key)) {
+            return 0;
+        }
+        if (_keys.back() < key) {
+            return _keys.size();
+        }
+        size_t index = _first[_get_bucket(key)];
+        while (_keys[index] < key) {
+            index++;
+        }
+        return index;
+    }
+
+    //! Like std::map::at()
+    const mapped_type& at(const key_type& key) const
+    {
+        const size_t index = lower_bound(key);
+        if (index == _keys.size() || _keys[index] != key) {
+            throw std::out_of_range("lookup_table::at(): Key not found");
+        }
+        return _values[index];
+    }
+
+    //! Like get_bounding_iterators(), but returns indices
+    std::pair<size_t, size_t> get_bounding_indices(const key_type& key) const
+    {
+        const size_t next = lower_bound(key);
+        if (next == _keys.size()) {
+            return {next - 1, next - 1};
+        }
+        return {next == 0 ? 0 : next - 1, next};
+    }
+
+    //! Like at_interpolate_1d()
+    template <typename interp_func_type>
+    mapped_type at_interpolate_1d(
+        const key_type& key, interp_func_type&& interp_func) const
+    {
+        const size_t next = lower_bound(key);
+        if (next == _keys.size()) {
+            return _values.back();
+        }
+        if (next == 0) {
+            return _values.front();
+        }
+        return interp_func(
+            key, _keys[next - 1], _values[next - 1], _keys[next], _values[next]);
+    }
+
+    //! Like at_nearest()
+    mapped_type at_nearest(const key_type& key) const
+    {
+        return at_interpolate_1d(key,
+            [](const key_type x,
+                const key_type x0,
+                const mapped_type& y0,
+                const key_type x1,
+                const mapped_type& y1) { return (x1 - x < x - x0) ? y1 : y0; });
+    }
+
+    //! Like at_lin_interp()
+    mapped_type at_lin_interp(const key_type& key) const
+    {
+        return at_interpolate_1d(key, &uhd::math::linear_interp<mapped_type>);
+    }
+
+private:
+    size_t _get_bucket(const key_type& key) const
+    {
+        const size_t bucket = static_cast<size_t>(
+            static_cast<double>(key - _keys.front()) * _scale);
+        return std::min(bucket, _first.size() - 1);
+    }
+
+    std::vector<key_type> _keys;
+    std::vector<mapped_type> _values;
+    //! Index of the first key in each bucket
+    std::vector<size_t> _first;
+    //! Maps a key offset to its bucket
+    double _scale = 0.0;
+};
+
 }} // namespace uhd::math
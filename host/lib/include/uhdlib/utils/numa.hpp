@@ -0,0 +1,26 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <string>
+
+namespace uhd {
+
+/*!
+ * Get the NUMA node of the CPU the calling thread is currently running on.
+ * \return the NUMA node, or -1 if it can't be determined
+ */
+int get_thread_numa_node();
+
+/*!
+ * Get the NUMA node the network interface with an IPv4 address is attached to.
+ * \param ip_addr the IPv4 address of the interface as a dotted string
+ * \return the NUMA node, or -1 if it can't be determined
+ */
+int get_interface_numa_node(const std::string& ip_addr);
+
+} /* namespace uhd */
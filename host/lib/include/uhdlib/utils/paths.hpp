@@ -50,6 +50,18 @@ std::filesystem::path get_xdg_data_home();
  */
 std::filesystem::path get_xdg_config_home();
 
+/*! \brief Return a path to XDG_CACHE_HOME.
+ *
+ * https://specifications.freedesktop.org/basedir-spec/basedir-spec-latest.html
+ *
+ * Even on non-Linux systems, this should return the place where data can be
+ * stored that is not essential, but speeds up later runs (e.g., the results of
+ * the RFNoC topology discovery).
+ *
+ * If no such path can be found, an empty string is returned.
+ */
+std::filesystem::path get_xdg_cache_home();
+
 /*! \brief Return a path to ~/.uhd
  *
  * If no home directory can be found, an empty string is returned.
@@ -0,0 +1,206 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace uhd {
+
+/*!
+ * Fixed-size lock-free queue for a single producer and a single consumer
+ * thread, with blocking semantics on the consumer side.
+ *
+ * Pushing and popping don't take any locks. A consumer waiting for an item
+ * first polls the queue for a while, and only blocks on a condition variable
+ * if nothing arrives. How long it polls adapts to how long it had to wait in
+ * the past: If items tend to arrive while polling, the consumer keeps polling
+ * for up to MAX_SPIN_TIMEOUT. If they don't, it goes to sleep sooner, down to
+ * MIN_SPIN_TIMEOUT. The producer only touches the mutex if the consumer is
+ * asleep.
+ *
+ * push() must only be called from the producer thread. peek(), pop() and
+ * read_available() must only be called from the consumer thread.
+ */
+template <typename item_t>
+class spsc_queue
+{
+public:
+    static constexpr std::chrono::microseconds MIN_SPIN_TIMEOUT{5};
+    static constexpr std::chrono::microseconds MAX_SPIN_TIMEOUT{100};
+
+    /*!
+     * Create a queue
+     *
+     * \param size Number of items the queue can hold
+     */
+    spsc_queue(const size_t size)
+    {
+        size_t capacity = 1;
+        while (capacity < size) {
+            capacity <<= 1;
+        }
+        _buffer = std::make_unique<item_t[]>(capacity);
+        _mask   = capacity - 1;
+    }
+
+    spsc_queue(const spsc_queue&)            = delete;
+    spsc_queue& operator=(const spsc_queue&) = delete;
+
+    /*!
+     * Push an item to the queue. The caller must make sure the queue is not
+     * full.
+     */
+    UHD_FORCE_INLINE void push(const item_t& item)
+    {
+        const size_t write_index     = _write_index.load(std::memory_order_relaxed);
+        _buffer[write_index & _mask] = item;
+
+        // Publishing the item and checking for a sleeping consumer must be
+        // sequentially consistent to pair with _park()
+        _write_index.store(write_index + 1);
+        if (_consumer_parked.load()) {
+            std::lock_guard<std::mutex> lock(_park_mutex);
+            _park_cv.notify_one();
+        }
+    }
+
+    /*!
+     * Get the item at the front of the queue without removing it
+     *
+     * \return true if there was an item in the queue
+     */
+    UHD_FORCE_INLINE bool peek(item_t& item)
+    {
+        const size_t read_index = _read_index.load(std::memory_order_relaxed);
+        if (!_readable(read_index)) {
+            return false;
+        }
+        item = _buffer[read_index & _mask];
+        return true;
+    }
+
+    /*!
+     * Pop an item from the queue without waiting
+     *
+     * \return true if there was an item in the queue
+     */
+    UHD_FORCE_INLINE bool pop(item_t& item)
+    {
+        const size_t read_index = _read_index.load(std::memory_order_relaxed);
+        if (!_readable(read_index)) {
+            return false;
+        }
+        item = _buffer[read_index & _mask];
+        _read_index.store(read_index + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * Pop an item from the queue, waiting for one to arrive if the queue is
+     * empty
+     *
+     * \param timeout_ms a positive timeout value specifies the maximum number
+     *                   of ms to wait, a negative value specifies to block
+     *                   until successful, and a value of 0 specifies no wait.
+     * \return true if an item was popped, false on timeout
+     */
+    bool pop(item_t& item, const int32_t timeout_ms)
+    {
+        if (pop(item)) {
+            return true;
+        }
+        if (timeout_ms == 0) {
+            return false;
+        }
+
+        const auto now      = std::chrono::steady_clock::now();
+        const auto deadline = timeout_ms < 0
+                                  ? std::chrono::steady_clock::time_point::max()
+                                  : now + std::chrono::milliseconds(timeout_ms);
+        const auto spin_end = std::min(deadline, now + _spin_timeout);
+
+        // Yielding while polling lets the producer run if both threads share
+        // a core
+        while (std::chrono::steady_clock::now() < spin_end) {
+            std::this_thread::yield();
+            if (pop(item)) {
+                _spin_timeout = std::min(_spin_timeout * 2, MAX_SPIN_TIMEOUT);
+                return true;
+            }
+        }
+        _spin_timeout = std::max(_spin_timeout / 2, MIN_SPIN_TIMEOUT);
+
+        return _park(deadline) && pop(item);
+    }
+
+    /*!
+     * Get the number of items in the queue
+     */
+    size_t read_available() const
+    {
+        return _write_index.load(std::memory_order_acquire)
+               - _read_index.load(std::memory_order_relaxed);
+    }
+
+private:
+    UHD_FORCE_INLINE bool _readable(const size_t read_index)
+    {
+        if (read_index != _cached_write_index) {
+            return true;
+        }
+        _cached_write_index = _write_index.load(std::memory_order_acquire);
+        return read_index != _cached_write_index;
+    }
+
+    bool _park(const std::chrono::steady_clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lock(_park_mutex);
+        // Pairs with push(): Either the producer sees the consumer parked and
+        // notifies it, or the consumer sees the item
+        _consumer_parked.store(true);
+        auto readable = [this]() {
+            _cached_write_index = _write_index.load();
+            return _read_index.load(std::memory_order_relaxed) != _cached_write_index;
+        };
+        bool ready;
+        if (deadline == std::chrono::steady_clock::time_point::max()) {
+            _park_cv.wait(lock, readable);
+            ready = true;
+        } else {
+            ready = _park_cv.wait_until(lock, deadline, readable);
+        }
+
+        _consumer_parked.store(false, std::memory_order_relaxed);
+        return ready;
+    }
+
+    std::unique_ptr<item_t[]> _buffer;
+    size_t _mask = 0;
+
+    // Written by the producer
+    alignas(64) std::atomic<size_t> _write_index{0};
+
+    // Written by the consumer, along with the consumer's local state
+    alignas(64) std::atomic<size_t> _read_index{0};
+    size_t _cached_write_index = 0;
+    std::chrono::microseconds _spin_timeout{MAX_SPIN_TIMEOUT};
+
+    // State to put the consumer to sleep
+    alignas(64) std::atomic<bool> _consumer_parked{false};
+    std::mutex _park_mutex;
+    std::condition_variable _park_cv;
+};
+
+} // namespace uhd
@@ -6,19 +6,45 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/property_tree.hpp>
-#include <uhd/types/dict.hpp>
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <string_view>
 
 using namespace uhd;
 
 /***********************************************************************
  * Helper function to iterate through paths
  **********************************************************************/
-#include <boost/tokenizer.hpp>
-#define path_tokenizer(path) \
-    boost::tokenizer<boost::char_separator<char>>(path, boost::char_separator<char>("/"))
+namespace {
+
+/*! Call a function for every name in a path
+ *
+ * Empty names, i.e., leading, trailing or repeated slashes, are skipped. The
+ * iteration stops early if the function returns false.
+ *
+ * \returns false if the iteration was stopped early
+ */
+template <typename name_handler_t>
+bool for_each_name(const std::string& path, name_handler_t&& handler)
+{
+    size_t pos = 0;
+    while (pos < path.size()) {
+        const size_t end = std::min(path.find('/', pos), path.size());
+        if (end > pos
+            and not handler(std::string_view(path.data() + pos, end - pos))) {
+            return false;
+        }
+        pos = end + 1;
+    }
+    return true;
+}
+
+} // namespace
 
 /***********************************************************************
  * Property path implementation wrapper
@@ -68,6 +94,10 @@ fs_path uhd::operator/(const fs_path& lhs, size_t rhs)
 
 /***********************************************************************
  * Property tree implementation
+ *
+ * Accessing properties only requires a shared lock on the tree, so threads
+ * that access different (or the same) properties don't serialize on the tree.
+ * Only changes to the structure of the tree require an exclusive lock.
  **********************************************************************/
 class property_tree_impl : public uhd::property_tree
 {
@@ -80,7 +110,6 @@ public:
     sptr subtree(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
 
         property_tree_impl* subtree = new property_tree_impl(path);
         subtree->_guts              = this->_guts; // copy the guts sptr
@@ -90,67 +119,51 @@ public:
     void remove(const fs_path& path_) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::unique_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
-        node_type* node   = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                throw_path_not_found(path);
-            }
-            parent = node;
-            node   = &(*node)[name];
+        std::string_view name;
+        node_type* node = find_node(path, &parent, &name);
+        if (node == NULL) {
+            throw_path_not_found(path);
         }
         if (parent == NULL) {
             throw uhd::runtime_error("Cannot uproot");
         }
-        parent->pop(fs_path(path.leaf()));
+        parent->remove_child(name);
     }
 
     bool exists(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_mutex> lock(_guts->mutex);
 
-        node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                return false;
-            }
-            node = &(*node)[name];
-        }
-        return true;
+        return find_node(path) != NULL;
     }
 
     std::vector<std::string> list(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_mutex> lock(_guts->mutex);
 
-        node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                throw_path_not_found(path);
-            }
-            node = &(*node)[name];
+        node_type* node = find_node(path);
+        if (node == NULL) {
+            throw_path_not_found(path);
         }
 
-        return node->keys();
+        return node->keys;
     }
 
     std::shared_ptr<property_iface> _pop(const fs_path& path_) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::unique_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* parent = NULL;
-        node_type* node   = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                throw_path_not_found(path);
-            }
-            parent = node;
-            node   = &(*node)[name];
+        std::string_view name;
+        node_type* node = find_node(path, &parent, &name);
+        if (node == NULL) {
+            throw_path_not_found(path);
         }
 
         if (node->prop.get() == NULL) {
@@ -160,7 +173,7 @@ public:
             throw uhd::runtime_error("Cannot pop");
         }
         auto prop = node->prop;
-        parent->pop(fs_path(path.leaf()));
+        parent->remove_child(name);
         return prop;
     }
 
@@ -168,15 +181,14 @@ public:
         const fs_path& path_, const std::shared_ptr<property_iface>& prop) override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::unique_lock<std::shared_mutex> lock(_guts->mutex);
 
         node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                (*node)[name] = node_type();
-            }
-            node = &(*node)[name];
-        }
+        for_each_name(path, [&node](const std::string_view name) {
+            node_type* child = node->find_child(name);
+            node             = child ? child : node->add_child(name);
+            return true;
+        });
         if (node->prop.get() != NULL) {
             throw uhd::runtime_error(
                 "Cannot create! Property already exists at: " + path);
@@ -184,17 +196,14 @@ public:
         node->prop = prop;
     }
 
-    std::shared_ptr<property_iface>& _access(const fs_path& path_) const override
+    std::shared_ptr<property_iface> _access(const fs_path& path_) const override
     {
         const fs_path path = _root / path_;
-        std::lock_guard<std::mutex> lock(_guts->mutex);
+        std::shared_lock<std::shared_mutex> lock(_guts->mutex);
 
-        node_type* node = &_guts->root;
-        for (const std::string& name : path_tokenizer(path)) {
-            if (not node->has_key(name)) {
-                throw_path_not_found(path);
-            }
-            node = &(*node)[name];
+        node_type* node = find_node(path);
+        if (node == NULL) {
+            throw_path_not_found(path);
         }
         if (node->prop.get() == NULL) {
             throw uhd::runtime_error("Cannot access! Property uninitialized at: " + path);
@@ -209,16 +218,69 @@ private:
     }
 
     // basic structural node element
-    struct node_type : uhd::dict<std::string, node_type>
+    struct node_type
     {
         std::shared_ptr<property_iface> prop;
+        // Names of the children, in the order they were added
+        std::vector<std::string> keys;
+        std::map<std::string, std::unique_ptr<node_type>, std::less<>> children;
+
+        node_type* find_child(const std::string_view name) const
+        {
+            auto child = children.find(name);
+            return child == children.end() ? NULL : child->second.get();
+        }
+
+        node_type* add_child(const std::string_view name)
+        {
+            keys.emplace_back(name);
+            return children.emplace(keys.back(), std::make_unique<node_type>())
+                .first->second.get();
+        }
+
+        void remove_child(const std::string_view name)
+        {
+            keys.erase(std::find(keys.begin(), keys.end(), name));
+            children.erase(children.find(name));
+        }
     };
 
+    /*! Find the node at a path. The tree lock must be held.
+     *
+     * \param path The full path of the node
+     * \param parent If not NULL, the parent of the node is stored here. It is
+     *               NULL if the path refers to the root node.
+     * \param leaf If not NULL, the name of the node is stored here
+     * \returns the node, or NULL if the path doesn't exist
+     */
+    node_type* find_node(const fs_path& path,
+        node_type** parent     = NULL,
+        std::string_view* leaf = NULL) const
+    {
+        node_type* node = &_guts->root;
+        const bool found =
+            for_each_name(path, [&node, parent, leaf](const std::string_view name) {
+                node_type* child = node->find_child(name);
+                if (child == NULL) {
+                    return false;
+                }
+                if (parent) {
+                    *parent = node;
+                }
+                if (leaf) {
+                    *leaf = name;
+                }
+                node = child;
+                return true;
+            });
+        return found ? node : NULL;
+    }
+
     // tree guts which may be referenced in a subtree
     struct tree_guts_type
     {
         node_type root;
-        std::mutex mutex;
+        std::shared_mutex mutex;
     };
 
     // members, the tree and root prefix
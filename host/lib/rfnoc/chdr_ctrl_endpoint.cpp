@@ -85,10 +85,12 @@ public:
             chdr_header header;
             header.set_pkt_type(PKT_TYPE_CTRL);
             header.set_num_mdata(0);
-            header.set_seq_num(_send_seqnum++);
             header.set_dst_epid(dst_epid);
-            // Acquire send buffer and send the packet
+            // Acquire send buffer and send the packet. Block controllers may
+            // send from different threads, so the sequence number is also
+            // assigned under the lock.
             std::lock_guard<std::mutex> lock(_send_mutex);
+            header.set_seq_num(_send_seqnum++);
             auto send_buff = _xport->get_send_buff(timeout * 1000);
             _send_pkt->refresh(
                 send_buff->data(), _xport->get_send_frame_size(), header, payload);
@@ -192,7 +194,7 @@ private:
     std::map<ep_map_key_t, ctrlport_endpoint::sptr> _endpoint_map;
     // Mutex that protects all state in this class except for _send_pkt
     std::mutex _mutex;
-    // Mutex that protects _send_pkt and _xport.send
+    // Mutex that protects _send_pkt, _send_seqnum and _xport.send
     std::mutex _send_mutex;
     // A thread that will handle all responses and async message requests
     // Must be declared after the mutexes, the thread starts at construction and
@@ -48,7 +48,9 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
     , _fc_params(fc_params)
     , _xport_args(xport_args)
+    , _recv_buff_placement(recv_link->get_recv_buff_placement())
     , _disconnect(disconnect)
+    , _telemetry_switch(get_telemetry_switch(xport_args))
 {
     UHD_LOG_TRACE("XPORT::RX_DATA_XPORT",
         "Creating rx xport with local epid=" << epids.second
@@ -80,6 +82,15 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
         send_link,
         /* num_send_frames*/ 1,
         fc_cb);
+    _recv_io->set_telemetry_switch(_telemetry_switch);
+    _telemetry_dump = telemetry_dumper::register_source(xport_args,
+        "rx_data_xport:" + std::to_string(_remote_epid) + ">" + std::to_string(_epid),
+        [this]() {
+            uhd::device_addr_t info;
+            _telemetry.to_info(info);
+            _recv_io->get_telemetry().to_info(info);
+            return info;
+        });
 
     UHD_LOG_TRACE("XPORT::RX_DATA_XPORT",
         "Stream endpoint was configured with:"
@@ -92,6 +103,9 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
 
 chdr_rx_data_xport::~chdr_rx_data_xport()
 {
+    // Stop dumping the telemetry before anything it reads is destroyed
+    _telemetry_dump.reset();
+
     // Release recv_io before allowing members needed by callbacks be destroyed
     _recv_io.reset();
 
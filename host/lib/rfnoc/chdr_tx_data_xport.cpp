@@ -34,7 +34,8 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
     const size_t num_send_frames,
     const fc_params_t fc_params,
     const chdr::strc_payload& strc_pyld,
-    disconnect_callback_t disconnect)
+    disconnect_callback_t disconnect,
+    const uhd::device_addr_t& xport_args)
     : _fc_state(fc_params.buff_capacity)
     , _mtu(send_link->get_send_frame_size())
     , _strc_pyld(strc_pyld)
@@ -44,6 +45,9 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
     , _frame_size(send_link->get_send_frame_size())
     , _fc_params(fc_params)
     , _disconnect(disconnect)
+    , _send_link(send_link)
+    , _send_batching(send_link->get_send_batch_size() > 1)
+    , _telemetry_switch(get_telemetry_switch(xport_args))
 {
     UHD_LOG_TRACE("XPORT::TX_DATA_XPORT",
         "Creating tx xport with local epid=" << epids.first
@@ -52,6 +56,7 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
     _send_header.set_dst_epid(epids.second);
     _send_packet = pkt_factory.make_generic();
     _recv_packet = pkt_factory.make_generic();
+    _sent_packet = pkt_factory.make_generic();
     _strc_packet = pkt_factory.make_strc();
 
     // Calculate header length
@@ -79,15 +84,29 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
         /* num_recv_frames */ 1,
         recv_cb,
         fc_cb);
+    _send_io->set_telemetry_switch(_telemetry_switch);
+    _telemetry_dump = telemetry_dumper::register_source(xport_args,
+        "tx_data_xport:" + std::to_string(epids.first) + ">"
+            + std::to_string(epids.second),
+        [this]() {
+            uhd::device_addr_t info;
+            _telemetry.to_info(info);
+            _send_io->get_telemetry().to_info(info);
+            return info;
+        });
 }
 
 chdr_tx_data_xport::~chdr_tx_data_xport()
 {
+    // Stop dumping the telemetry before anything it reads is destroyed
+    _telemetry_dump.reset();
+
     // Release send_io before allowing members needed by callbacks be destroyed
     _send_io.reset();
 
     // Disconnect the transport
     _disconnect();
+    _send_link.reset();
 }
 
 /*
@@ -310,6 +329,16 @@ uhd::device_addr_t chdr_tx_data_xport::get_xport_info() const
     info["dst_epid"]              = std::to_string(_send_header.get_dst_epid());
     info["send_capacity_bytes"]   = std::to_string(_fc_params.buff_capacity.bytes);
     info["send_capacity_packets"] = std::to_string(_fc_params.buff_capacity.packets);
+    info["send_batch_size"]       = std::to_string(_send_link->get_send_batch_size());
+    info["packets_per_send_call"] =
+        std::to_string(_send_link->get_packets_per_send_call());
+    const auto placement = _send_link->get_send_buff_placement();
+    if (placement.page_size) {
+        info["send_buff_page_size"] = std::to_string(placement.page_size);
+        info["send_buff_numa_node"] = placement.numa_node == buffer_pool::NO_NUMA_NODE
+                                          ? "none"
+                                          : std::to_string(placement.numa_node);
+    }
 
     // For TX transport, flow control mode is determined by buffer capacity
     // TX sends strc packets for resync, so if buff_capacity is non-zero, FC is enabled
@@ -328,5 +357,10 @@ uhd::device_addr_t chdr_tx_data_xport::get_xport_info() const
         }
     }
 
+    if (_telemetry_switch.on()) {
+        _telemetry.to_info(info);
+        _send_io->get_telemetry().to_info(info);
+    }
+
     return info;
 }
@@ -53,12 +53,17 @@ client_zero::client_zero(register_iface::sptr reg)
     : uhd::rfnoc::register_iface_holder(reg)
 {
     // The info we need is static, so we can read it all up front, and store the
-    // parsed information.
-    const uint32_t proto_reg_val       = regs().peek32(PROTOVER_ADDR);
-    const uint32_t port_reg_val        = regs().peek32(PORT_CNT_ADDR);
-    const uint32_t edge_reg_val        = regs().peek32(EDGE_CNT_ADDR);
-    const uint32_t device_info_reg_val = regs().peek32(DEVICE_INFO_ADDR);
-    const uint32_t cport_info_reg_val  = regs().peek32(CTRLPORT_CNT_ADDR);
+    // parsed information. All reads are sent before waiting for any of them.
+    auto proto_reg       = regs().peek32_async(PROTOVER_ADDR);
+    auto port_reg        = regs().peek32_async(PORT_CNT_ADDR);
+    auto edge_reg        = regs().peek32_async(EDGE_CNT_ADDR);
+    auto device_info_reg = regs().peek32_async(DEVICE_INFO_ADDR);
+    auto cport_info_reg  = regs().peek32_async(CTRLPORT_CNT_ADDR);
+    const uint32_t proto_reg_val       = proto_reg.get();
+    const uint32_t port_reg_val        = port_reg.get();
+    const uint32_t edge_reg_val        = edge_reg.get();
+    const uint32_t device_info_reg_val = device_info_reg.get();
+    const uint32_t cport_info_reg_val  = cport_info_reg.get();
 
     // Parse the PROTOVER_ADDR register
     _proto_ver = proto_reg_val & 0xFFFF;
@@ -215,11 +220,13 @@ client_zero::block_config_info client_zero::get_block_info(uint16_t portno)
 {
     _check_port_number(portno);
     // Most of the block info comes from the first register
-    const uint32_t config_reg_val =
-        regs().peek32(_get_port_base_addr(portno) + BES_BLOCK_INFO_OFFSET);
+    auto config_reg =
+        regs().peek32_async(_get_port_base_addr(portno) + BES_BLOCK_INFO_OFFSET);
     // MTU info is on a separate register
-    const uint32_t data_reg_val =
-        regs().peek32(_get_port_base_addr(portno) + BES_MTU_INFO_OFFSET);
+    auto data_reg =
+        regs().peek32_async(_get_port_base_addr(portno) + BES_MTU_INFO_OFFSET);
+    const uint32_t config_reg_val = config_reg.get();
+    const uint32_t data_reg_val   = data_reg.get();
     return {
         uhd::narrow_cast<uint8_t>((config_reg_val & 0x0000003F) >> 0),
         uhd::narrow_cast<uint8_t>((config_reg_val & 0x00000FC0) >> 6),
@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <chrono>
 #include <deque>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <numeric>
 #include <optional>
@@ -54,7 +56,8 @@ std::string uhd::rfnoc::register_iface_stats::to_string() const
 
 ctrlport_endpoint::~ctrlport_endpoint() = default;
 
-class ctrlport_endpoint_impl : public ctrlport_endpoint
+class ctrlport_endpoint_impl : public ctrlport_endpoint,
+                               public std::enable_shared_from_this<ctrlport_endpoint_impl>
 {
 public:
     ctrlport_endpoint_impl(const send_fn_t& send_fcn,
@@ -86,15 +89,11 @@ public:
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP,
         bool ack                   = false) override
     {
-        for (auto it = _custom_register_spaces.begin();
-             it != _custom_register_spaces.end() && addr >= it->first;
-             ++it) {
-            if (addr >= it->first && addr < it->second.end_addr) {
-                UHD_LOG_TRACE(_log_prefix,
-                    "Poking custom register space at address 0x" << std::hex << addr);
-                it->second.poke_fn(addr, data);
-                return;
-            }
+        if (const auto* space = find_custom_register_space(addr)) {
+            UHD_LOG_TRACE(_log_prefix,
+                "Poking custom register space at address 0x" << std::hex << addr);
+            space->poke_fn(addr, data);
+            return;
         }
         // Send request and optionally wait for an ACK
         send_request_packet(OP_WRITE, addr, {data}, timestamp, ack);
@@ -110,11 +109,32 @@ public:
                 _log_prefix,
                 "multi_poke32(): addrs and data vectors must be of the same length");
         }
-        for (size_t i = 0; i < data.size(); i++) {
-            poke32(addrs[i],
-                data[i],
-                (i == 0) ? timestamp : uhd::time_spec_t::ASAP,
-                (i == data.size() - 1) ? ack : false);
+        // Combine runs of writes to consecutive addresses into block writes.
+        // Writes to custom register spaces are never combined.
+        for (size_t i = 0; i < data.size();) {
+            size_t run_length = 1;
+            if (!find_custom_register_space(addrs[i])) {
+                while (i + run_length < data.size()
+                       && addrs[i + run_length]
+                              == addrs[i + run_length - 1] + sizeof(uint32_t)
+                       && !find_custom_register_space(addrs[i + run_length])) {
+                    run_length++;
+                }
+            }
+            const uhd::time_spec_t run_timestamp =
+                (i == 0) ? timestamp : uhd::time_spec_t::ASAP;
+            const bool run_ack = (i + run_length == data.size()) ? ack : false;
+            if (run_length == 1) {
+                poke32(addrs[i], data[i], run_timestamp, run_ack);
+            } else {
+                bulk_write32(OP_BLOCK_WRITE,
+                    addrs[i],
+                    std::vector<uint32_t>(
+                        data.begin() + i, data.begin() + i + run_length),
+                    run_timestamp,
+                    run_ack);
+            }
+            i += run_length;
         }
     }
 
@@ -137,14 +157,10 @@ public:
     uint32_t peek32(
         uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
     {
-        for (auto it = _custom_register_spaces.begin();
-             it != _custom_register_spaces.end() && addr >= it->first;
-             ++it) {
-            if (addr >= it->first && addr < it->second.end_addr) {
-                UHD_LOG_TRACE(_log_prefix,
-                    "Peeking custom register space at address 0x" << std::hex << addr);
-                return it->second.peek_fn(addr);
-            }
+        if (const auto* space = find_custom_register_space(addr)) {
+            UHD_LOG_TRACE(_log_prefix,
+                "Peeking custom register space at address 0x" << std::hex << addr);
+            return space->peek_fn(addr);
         }
         // Send request and wait for an ACK
         std::optional<ctrl_payload> response;
@@ -155,6 +171,24 @@ public:
         return response.value().data_vtr[0];
     }
 
+    std::future<uint32_t> peek32_async(
+        uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
+    {
+        if (find_custom_register_space(addr)) {
+            return register_iface::peek32_async(addr, timestamp);
+        }
+        // Send the request now, but only wait for the ACK when the caller asks
+        // for the result
+        const ctrl_payload tx_ctrl =
+            fire_request_packet(OP_READ, addr, {}, timestamp, true, 1).first;
+        auto request = std::make_shared<pending_ack>(weak_from_this(), tx_ctrl);
+        return std::async(std::launch::deferred, [request]() {
+            const ctrl_payload response = request->collect();
+            UHD_ASSERT_THROW(!response.data_vtr.empty());
+            return response.data_vtr[0];
+        });
+    }
+
     std::vector<uint32_t> block_peek32(uint32_t first_addr,
         size_t length,
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
@@ -497,6 +531,62 @@ private:
     //! The software status (different from the transaction status) of the response
     enum response_status_t { RESP_VALID, RESP_DROPPED, RESP_RTERR, RESP_SIZEERR };
 
+    /*! An ACK that a client asked for, but hasn't collected yet
+     *
+     * If the ACK is never collected, it is discarded on destruction, so it
+     * doesn't linger in the response queue.
+     */
+    class pending_ack
+    {
+    public:
+        pending_ack(std::weak_ptr<ctrlport_endpoint_impl> endpoint,
+            const ctrl_payload& request)
+            : _endpoint(std::move(endpoint)), _request(request)
+        {
+        }
+
+        ~pending_ack()
+        {
+            if (_collected) {
+                return;
+            }
+            if (auto endpoint = _endpoint.lock()) {
+                endpoint->discard_ack_response(_request);
+            }
+        }
+
+        //! Wait for the ACK and return it
+        const ctrl_payload collect()
+        {
+            auto endpoint = _endpoint.lock();
+            if (!endpoint) {
+                throw uhd::runtime_error(
+                    "Control endpoint was destroyed before the response to "
+                    + _request.to_string() + " was collected");
+            }
+            _collected = true;
+            return endpoint->collect_ack_response(_request);
+        }
+
+    private:
+        const std::weak_ptr<ctrlport_endpoint_impl> _endpoint;
+        const ctrl_payload _request;
+        bool _collected = false;
+    };
+
+    //! Returns the custom register space that contains addr, or nullptr
+    const custom_register_space* find_custom_register_space(const uint32_t addr) const
+    {
+        for (auto it = _custom_register_spaces.begin();
+             it != _custom_register_spaces.end() && addr >= it->first;
+             ++it) {
+            if (addr < it->second.end_addr) {
+                return &it->second;
+            }
+        }
+        return nullptr;
+    }
+
     //! Returns the length of the control payload in 32-bit words
     inline static size_t get_payload_size(const ctrl_payload& payload)
     {
@@ -632,6 +722,26 @@ private:
         return wait_for_ack(request, lock);
     }
 
+    //! Stops tracking the ACK for a previously fired request, and drops the
+    // ACK if it was already received
+    void discard_ack_response(const ctrl_payload& request)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _wanted_acks.erase(
+            wanted_ack_key{request.seq_num, request.op_code, request.address});
+        const auto response = std::find_if(_resp_queue.begin(),
+            _resp_queue.end(),
+            [&request](const std::tuple<ctrl_payload, response_status_t>& resp) {
+                const ctrl_payload& rx_ctrl = std::get<0>(resp);
+                return rx_ctrl.seq_num == request.seq_num
+                       && rx_ctrl.op_code == request.op_code
+                       && rx_ctrl.address == request.address;
+            });
+        if (response != _resp_queue.end()) {
+            _resp_queue.erase(response);
+        }
+    }
+
     //! Sends a request control packet to a remote device, optionally waiting
     // for an ACK, and returns any response if applicable
     const std::pair<ctrl_payload, std::optional<ctrl_payload>> send_request_packet(
@@ -51,27 +51,6 @@ auto get_dirty_props(graph_t::node_ref_t node_ref)
 
 } // namespace
 
-/*! Graph-filtering predicate to find dirty nodes only
- */
-struct graph_t::impl::DirtyNodePredicate
-{
-    DirtyNodePredicate() {} // Default ctor is required
-    DirtyNodePredicate(graph_t::impl::rfnoc_graph_t& graph) : _graph(&graph) {}
-
-    template <typename Vertex>
-    bool operator()(const Vertex& v) const
-    {
-        return !get_dirty_props(
-            boost::get(graph_t::impl::vertex_property_t(), *_graph, v))
-                    .empty();
-    }
-
-private:
-    // Don't make any attribute const, because default assignment operator
-    // is also required
-    graph_t::impl::rfnoc_graph_t* _graph;
-};
-
 /******************************************************************************
  * Constructor and Destructor for graph_t::impl
  *****************************************************************************/
@@ -202,6 +181,7 @@ void graph_t::impl::connect(
     auto edge_descriptor =
         boost::add_edge(src_vertex_desc, dst_vertex_desc, edge_info, _graph);
     UHD_ASSERT_THROW(edge_descriptor.second);
+    _topo_sorted_nodes_valid = false;
 
     // Now make sure we didn't add an unintended cycle
     try {
@@ -214,6 +194,7 @@ void graph_t::impl::connect(
                            << " without disabling is_forward_edge will lead "
                               "to unresolvable graph!");
         boost::remove_edge(edge_descriptor.first, _graph);
+        _topo_sorted_nodes_valid = false;
         throw uhd::rfnoc_error("Adding edge without disabling is_forward_edge will lead "
                                "to unresolvable graph!");
     }
@@ -249,6 +230,7 @@ void graph_t::impl::disconnect(
                 boost::get(edge_property_t(), this->_graph, edge_desc), false));
         },
         _graph);
+    _topo_sorted_nodes_valid = false;
 
     if (boost::degree(src_vertex_desc, _graph) == 0) {
         _remove_node(src_node);
@@ -293,6 +275,10 @@ void graph_t::impl::commit()
     if (_release_count == 0) {
         _check_topology();
         std::lock_guard<std::recursive_mutex> l(_graph_mutex);
+        // Properties may have been modified in any node while the graph was
+        // released
+        _topo_sorted_nodes_valid = false;
+        _mark_all_nodes_maybe_dirty();
         resolve_all_properties(resolve_context::INIT, *boost::vertices(_graph).first);
     }
 }
@@ -422,6 +408,7 @@ void graph_t::impl::resolve_all_properties(
         return;
     }
 
+    _maybe_dirty_nodes.insert(boost::get(vertex_property_t(), _graph, initial_node));
     UHD_LOG_TRACE(LOG_ID, "Running forward edge property propagation...");
     _resolve_all_properties(context, initial_node, true);
     UHD_LOG_TRACE(LOG_ID, "Running backward edge property propagation...");
@@ -450,7 +437,7 @@ void graph_t::impl::_resolve_all_properties(resolve_context context,
 
     // Now get all nodes in topologically sorted order, and the appropriate
     // iterators.
-    auto topo_sorted_nodes = _get_topo_sorted_nodes();
+    const auto& topo_sorted_nodes = _get_topo_sorted_nodes();
     auto node_it           = topo_sorted_nodes.begin();
     auto begin_it          = topo_sorted_nodes.begin();
     auto end_it            = topo_sorted_nodes.end();
@@ -759,29 +746,46 @@ void graph_t::impl::_process_action(
  *****************************************************************************/
 graph_t::impl::vertex_list_t graph_t::impl::_find_dirty_nodes()
 {
-    // Create a view on the graph that doesn't include the back-edges
-    DirtyNodePredicate vertex_filter(_graph);
-    boost::filtered_graph<rfnoc_graph_t, boost::keep_all, DirtyNodePredicate> fg(
-        _graph, boost::keep_all(), vertex_filter);
+    vertex_list_t dirty_nodes;
+    for (auto node_it = _maybe_dirty_nodes.begin();
+         node_it != _maybe_dirty_nodes.end();) {
+        if (get_dirty_props(*node_it).empty()) {
+            node_it = _maybe_dirty_nodes.erase(node_it);
+        } else {
+            dirty_nodes.push_back(_node_map.at(*node_it));
+            ++node_it;
+        }
+    }
+    return dirty_nodes;
+}
 
-    auto v_iterators = boost::vertices(fg);
-    return vertex_list_t(v_iterators.first, v_iterators.second);
+void graph_t::impl::_mark_all_nodes_maybe_dirty()
+{
+    for (const auto& node : _node_map) {
+        _maybe_dirty_nodes.insert(node.first);
+    }
 }
 
-graph_t::impl::vertex_list_t graph_t::impl::_get_topo_sorted_nodes()
+const graph_t::impl::vertex_list_t& graph_t::impl::_get_topo_sorted_nodes()
 {
+    if (_topo_sorted_nodes_valid) {
+        return _topo_sorted_nodes;
+    }
+
     // Create a view on the graph that doesn't include the back-edges
     ForwardEdgePredicate edge_filter(_graph);
     boost::filtered_graph<rfnoc_graph_t, ForwardEdgePredicate> fg(_graph, edge_filter);
 
-    // Topo-sort and return
+    // Topo-sort and cache the result
     vertex_list_t sorted_nodes;
     try {
         boost::topological_sort(fg, std::front_inserter(sorted_nodes));
     } catch (boost::not_a_dag&) {
         throw uhd::rfnoc_error("Cannot resolve graph because it has at least one cycle!");
     }
-    return sorted_nodes;
+    _topo_sorted_nodes       = std::move(sorted_nodes);
+    _topo_sorted_nodes_valid = true;
+    return _topo_sorted_nodes;
 }
 
 void graph_t::impl::_add_node(node_ref_t new_node)
@@ -791,6 +795,8 @@ void graph_t::impl::_add_node(node_ref_t new_node)
     }
 
     _node_map.emplace(new_node, boost::add_vertex(new_node, _graph));
+    _topo_sorted_nodes_valid = false;
+    _maybe_dirty_nodes.insert(new_node);
 }
 
 void graph_t::impl::_remove_node(node_ref_t node)
@@ -804,6 +810,8 @@ void graph_t::impl::_remove_node(node_ref_t node)
         // Remove the vertex
         boost::remove_vertex(vertex_desc, _graph);
         _node_map.erase(node);
+        _maybe_dirty_nodes.erase(node);
+        _topo_sorted_nodes_valid = false;
 
         // Removing the vertex changes the vertex descriptors,
         // so update the node map
@@ -842,6 +850,7 @@ void graph_t::impl::_forward_edge_props(
                                               : neighbour_node_info.second.dst_port;
             node_accessor.forward_edge_property(
                 neighbour_node_info.first, neighbour_port, prop);
+            _maybe_dirty_nodes.insert(neighbour_node_info.first);
         }
     }
 }
@@ -87,7 +87,8 @@ public:
         _mgmt_portal = mgmt_portal::make(*_ctrl_xport,
             _pkt_factory,
             sep_addr_t(_my_device_id, SEP_INST_MGMT_CTRL),
-            _tgraph);
+            _tgraph,
+            _mb_iface.get_topology_cache_key());
     }
 
     void add_unreachable_transport_adapters() override
@@ -12,12 +12,18 @@
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <uhdlib/utils/paths.hpp>
 #include <boost/format.hpp>
 #include <chrono>
 #include <cmath>
+#include <deque>
+#include <filesystem>
+#include <fstream>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <queue>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -36,6 +42,15 @@ constexpr char LOG_ID[] = "RFNOC::MGMT";
 
 constexpr bool ALLOW_DAISY_CHAINING = true;
 
+//! Maximum number of management transactions in flight during discovery
+constexpr size_t MAX_DISC_XACTS_IN_FLIGHT = 8;
+//! Timeout for a single management transaction during discovery
+constexpr std::chrono::milliseconds DISC_XACT_TIMEOUT{100};
+/*! Number of cached stream endpoints that are discovered anyway to check that
+ * the topology cache is still valid (in addition to the first hop)
+ */
+constexpr size_t NUM_CACHE_VALIDATIONS = 4;
+
 // Unused values are left in as comments for reference.
 constexpr uint16_t REG_EPID_SELF               = 0x00; // RW
 constexpr uint16_t REG_RESET_AND_FLUSH         = 0x04; // W
@@ -84,6 +99,135 @@ constexpr uint32_t STRM_STATUS_FC_ENABLED    = 0x80000000;
 constexpr uint32_t STRM_STATUS_SETUP_ERR     = 0x40000000;
 constexpr uint32_t STRM_STATUS_SETUP_PENDING = 0x20000000;
 
+/*! Results of topology discovery probes
+ *
+ * A probe asks which node is connected to a given port of a known node. The
+ * key is the known node (or "root" for the local endpoint) and the port. The
+ * value is the node that identified itself, or nothing if there was no
+ * response.
+ */
+using probe_key_t     = std::pair<std::string, topo_edge_t::port_t>;
+using probe_results_t = std::map<probe_key_t, std::optional<topo_node_t>>;
+
+std::string node_to_cache_str(const topo_node_t& node)
+{
+    return std::to_string(node.device_id) + "/"
+           + std::to_string(static_cast<int>(node.type)) + "/"
+           + std::to_string(node.inst) + "/" + std::to_string(node.extended_info);
+}
+
+std::optional<topo_node_t> node_from_cache_str(const std::string& node_str)
+{
+    std::istringstream ss(node_str);
+    unsigned device_id, type, inst, ext_info;
+    char sep1, sep2, sep3;
+    ss >> device_id >> sep1 >> type >> sep2 >> inst >> sep3 >> ext_info;
+    if (ss.fail() || sep1 != '/' || sep2 != '/' || sep3 != '/') {
+        throw uhd::value_error("Invalid node in topology cache: " + node_str);
+    }
+    return topo_node_t(uhd::narrow_cast<device_id_t>(device_id),
+        static_cast<topo_node_t::node_type>(type),
+        uhd::narrow_cast<sep_inst_t>(inst),
+        ext_info);
+}
+
+bool same_probe_result(
+    const std::optional<topo_node_t>& lhs, const std::optional<topo_node_t>& rhs)
+{
+    if (!lhs || !rhs) {
+        return !lhs && !rhs;
+    }
+    return lhs->unique_id() == rhs->unique_id()
+           && lhs->extended_info == rhs->extended_info;
+}
+
+std::filesystem::path get_topology_cache_path(const std::string& cache_key)
+{
+    std::string file_name = cache_key;
+    for (auto& c : file_name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-') {
+            c = '_';
+        }
+    }
+    return uhd::get_xdg_cache_home() / "uhd" / "topology" / (file_name + ".txt");
+}
+
+/*! Load the probe results from a topology cache file
+ *
+ * Every line holds one probe: The known node, the port, and either the
+ * responding node or '-'. Returns an empty map if there is no usable cache.
+ */
+probe_results_t load_topology_cache(const std::string& cache_key)
+{
+    probe_results_t probes;
+    const auto cache_path = get_topology_cache_path(cache_key);
+    std::ifstream cache_file(cache_path);
+    if (!cache_file) {
+        UHD_LOG_DEBUG(LOG_ID, "No topology cache found at " << cache_path.string());
+        return probes;
+    }
+    try {
+        std::string line;
+        while (std::getline(cache_file, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream ss(line);
+            std::string src_node, dst_node;
+            topo_edge_t::port_t port;
+            ss >> src_node >> port >> dst_node;
+            if (ss.fail()) {
+                throw uhd::value_error("Invalid line in topology cache: " + line);
+            }
+            probes[{src_node, port}] =
+                dst_node == "-" ? std::nullopt : node_from_cache_str(dst_node);
+        }
+    } catch (const uhd::exception& ex) {
+        UHD_LOG_WARNING(LOG_ID,
+            "Ignoring topology cache " << cache_path.string() << ": " << ex.what());
+        return {};
+    }
+    UHD_LOG_DEBUG(LOG_ID,
+        "Loaded " << probes.size() << " probes from topology cache "
+                  << cache_path.string());
+    return probes;
+}
+
+void store_topology_cache(const std::string& cache_key, const probe_results_t& probes)
+{
+    namespace fs          = std::filesystem;
+    const auto cache_path = get_topology_cache_path(cache_key);
+    const fs::path tmp_path(cache_path.string() + ".tmp");
+    std::error_code ec;
+    fs::create_directories(cache_path.parent_path(), ec);
+    {
+        std::ofstream cache_file(tmp_path);
+        cache_file << "# UHD topology cache for " << cache_key << "\n";
+        for (const auto& probe : probes) {
+            cache_file << probe.first.first << " " << probe.first.second << " "
+                       << (probe.second ? node_to_cache_str(*probe.second) : "-")
+                       << "\n";
+        }
+        if (!cache_file) {
+            UHD_LOG_DEBUG(
+                LOG_ID, "Unable to write topology cache " << cache_path.string());
+            fs::remove(tmp_path, ec);
+            return;
+        }
+    }
+    fs::rename(tmp_path, cache_path, ec);
+    if (ec) {
+        UHD_LOG_DEBUG(LOG_ID,
+            "Unable to write topology cache " << cache_path.string() << ": "
+                                              << ec.message());
+        fs::remove(tmp_path, ec);
+        return;
+    }
+    UHD_LOG_DEBUG(LOG_ID,
+        "Stored " << probes.size() << " probes in topology cache "
+                  << cache_path.string());
+}
+
 } // namespace
 
 
@@ -99,7 +243,8 @@ public:
     mgmt_portal_impl(chdr_ctrl_xport& xport,
         const chdr::chdr_packet_factory& pkt_factory,
         sep_addr_t my_sep_addr,
-        topo_graph_t::sptr topo_graph)
+        topo_graph_t::sptr topo_graph,
+        const std::string& topology_cache_key)
         : _protover(pkt_factory.get_protover())
         , _chdr_w(pkt_factory.get_chdr_w())
         , _endianness(pkt_factory.get_endianness())
@@ -118,7 +263,7 @@ public:
             UHD_LOG_ERROR(LOG_ID, err_msg);
             throw uhd::runtime_error(err_msg);
         }
-        _discover_topology(xport);
+        _discover_topology(xport, topology_cache_key);
         UHD_LOG_DEBUG(LOG_ID,
             "The following endpoints are reachable from " << _my_node_id.to_string());
         for (const auto& ep : get_reachable_endpoints()) {
@@ -627,70 +772,109 @@ public:
 
 
 private: // Functions
+    //! Crossbar return ports (by crossbar) that a transaction programs
+    using return_port_map_t =
+        std::map<topo_node_t::node_hash_type, topo_edge_t::port_t>;
+
+    //! A management transaction used during topology discovery
+    struct disc_xact_t
+    {
+        //! The node and output port this transaction goes to
+        std::pair<topo_node_t, topo_edge_t::port_t> path;
+        /*! If set, this transaction initializes new_node, which is connected
+         * to the path on port dst_port. If not, it asks the node at the end of
+         * the path to identify itself.
+         */
+        bool is_init = false;
+        topo_node_t new_node;
+        topo_edge_t::port_t dst_port = topo_edge_t::ANY_PORT;
+        //! True if this discovery was sent to check the topology cache
+        bool validates_cache = false;
+        mgmt_payload xact;
+        return_port_map_t return_ports;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
     // Discover all nodes that are reachable from this software stream endpoint
-    void _discover_topology(chdr_ctrl_xport& xport)
+    //
+    // This is a breadth-first traversal of the dataflow graph. Every node we
+    // find needs one management transaction to discover it, and one to
+    // initialize it. Up to MAX_DISC_XACTS_IN_FLIGHT of these are in flight at
+    // once, and responses are matched to their transactions by a tag in the
+    // response hop.
+    // If a topology cache for this device exists, most discoveries are
+    // answered from the cache instead. This avoids in particular waiting for
+    // timeouts on ports that have nothing connected. Nodes still need to be
+    // initialized, though, because that's what sets up the return routes.
+    void _discover_topology(chdr_ctrl_xport& xport, const std::string& topology_cache_key)
     {
         using port_t    = topo_edge_t::port_t;
         using node_type = topo_node_t::node_type;
-        // Initialize a queue of pending paths. We will use this for a breadth-first
-        // traversal of the dataflow graph. The queue consists of a previously discovered
-        // node and the next destination to take from that node.
+        using clock     = std::chrono::steady_clock;
+        const auto my_epid    = xport.get_epid();
+        const auto start_time = clock::now();
+
+        // The cache is specific to the local device we discover from
+        const std::string cache_key =
+            topology_cache_key.empty()
+                ? ""
+                : topology_cache_key + "-" + std::to_string(_my_node_id.device_id);
+        probe_results_t cached_probes;
+        if (!cache_key.empty()) {
+            cached_probes = load_topology_cache(cache_key);
+        }
+        // All probe results of this discovery, to update the cache
+        probe_results_t probe_results;
+        bool update_cache           = cached_probes.empty();
+        size_t num_validations_left = NUM_CACHE_VALIDATIONS;
+        // Validations that haven't come back yet
+        size_t num_validations_pending = 0;
+
+        // Counters for the summary at the end
+        size_t num_xacts = 0, num_timeouts = 0, num_cached = 0, max_in_flight = 0;
+
+        // Initialize a queue of pending paths, consisting of a previously
+        // discovered node and the next destination to take from that node.
         std::queue<std::pair<topo_node_t, port_t>> pending_paths;
-        const auto my_epid = xport.get_epid();
+        // Paths the topology cache can answer. They are held back until all
+        // validations are back, so they go over the wire if the cache turns
+        // out not to match.
+        std::queue<std::pair<topo_node_t, port_t>> cached_paths;
+        // Transactions ready to be sent, and the ones that are in flight
+        // (keyed by their tag)
+        std::deque<disc_xact_t> ready_xacts;
+        std::map<uint64_t, disc_xact_t> xacts_in_flight;
+        uint64_t next_tag = 1;
+        // We don't pipeline transactions until we know that the device
+        // returns our tags
+        bool tags_confirmed = false;
 
         // Add ourselves to the the pending queue to kick off the search
         UHD_LOG_DEBUG(
             LOG_ID, "Starting topology discovery from " << _my_node_id.to_string());
         pending_paths.push({_my_node_id, port_t(-1)});
 
-        while (!pending_paths.empty()) {
-            // Pop the next path to discover from the pending queue
-            const auto next_path = pending_paths.front();
-            pending_paths.pop();
-            const auto& next_node = next_path.first;
-
-            // Build a management transaction to first get to our destination so that we
-            // can ask it to identify itself
-            mgmt_payload route_xact;
-            route_xact.set_header(my_epid, _protover, _chdr_w);
-            _traverse_to_node(route_xact, next_node, my_epid, next_path.second);
-
-            // Discover downstream node (we ask the node to identify itself)
-            mgmt_payload disc_req_xact(route_xact);
-            // Push a node discovery hop
-            mgmt_hop_t disc_hop;
-            disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_REQ));
-            disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
-            disc_req_xact.add_hop(disc_hop);
-            UHD_LOG_TRACE(LOG_ID,
-                "Discovering next node upstream from "
-                    << next_node.to_string() << ", output port " << next_path.second
-                    << " using management transaction: " << disc_req_xact.to_string());
-
-            topo_node_t new_node;
-            try {
-                // Send the discovery transaction
-                const mgmt_payload disc_resp_xact =
-                    _send_recv_mgmt_transaction(xport, disc_req_xact);
-                new_node = _pop_node_discovery_hop(disc_resp_xact);
-            } catch (uhd::io_error& io_err) {
-                // We received an IO error. This could happen if we have a legitimate
-                // error or if there is no node to discover downstream. We can't tell for
-                // sure why but we can guess. If the next_path for this node is -1 then we
-                // expect something to be here, in which case we treat this as a
-                // legitimate error. In all other cases we assume that there was nothing
-                // to discover downstream.
-                if (next_path.second < 0) {
-                    UHD_LOG_ERROR(LOG_ID, io_err.what());
-                    throw io_err;
-                } else {
-                    // Move to the next pending path
-                    UHD_LOG_TRACE(LOG_ID,
-                        "Nothing connected on " << next_path.first.to_string() << "->"
-                                                << next_path.second
-                                                << ". Ignoring that path.");
-                    continue;
+        // Handle the response to a discovery (or the lack thereof)
+        auto handle_discovery = [&](const std::pair<topo_node_t, port_t>& path,
+                                    std::optional<topo_node_t> new_node) {
+            probe_results[_get_probe_key(path)] = new_node;
+            if (!new_node) {
+                // This could happen if we have a legitimate error or if there is
+                // no node to discover downstream. We can't tell for sure why but
+                // we can guess. If the path is -1 then we expect something to be
+                // here, in which case we treat this as a legitimate error. In all
+                // other cases we assume that there was nothing to discover
+                // downstream.
+                if (path.second < 0) {
+                    const std::string err_msg =
+                        "Timed out getting recv buff for management transaction";
+                    UHD_LOG_ERROR(LOG_ID, err_msg);
+                    throw uhd::io_error(err_msg);
                 }
+                UHD_LOG_TRACE(LOG_ID,
+                    "Nothing connected on " << path.first.to_string() << "->"
+                                            << path.second << ". Ignoring that path.");
+                return;
             }
 
             // We found a node!
@@ -699,36 +883,52 @@ private: // Functions
             // However, that means we need to manually count the instances of
             // crossbars to uniquely identify them.
             port_t dst_port = topo_edge_t::ANY_PORT;
-            if (new_node.type == node_type::XBAR) {
-                dst_port = new_node.inst;
+            if (new_node->type == node_type::XBAR) {
+                dst_port = new_node->inst;
                 // TODO: For now, we assume one xbar per device, so this is easy.
                 // If we want to allow multiple crossbars, we either need to add
                 // some identification, or we identify crossbars by the things
                 // they're connected to (e.g., only one crossbar can be attached
                 // to next_node on this very port).
-                new_node.inst = 0;
+                new_node->inst = 0;
             }
 
-            topo_edge_t new_edge(next_node, new_node, next_path.second, dst_port);
+            topo_edge_t new_edge(path.first, *new_node, path.second, dst_port);
 
-            // Because next_node was unknown before topo discovery started, we
-            // can safely add a route from next_node to new_node. That doesn't
+            // Because path.first was unknown before topo discovery started, we
+            // can safely add a route from it to new_node. That doesn't
             // preclude that new_node was previously detected, so we check for that.
             // If new_node was already in the graph, we can terminate the discovery
             // on this path.
-            if (!_tgraph->add_biedge(next_node, new_node, new_edge)) {
+            if (!_tgraph->add_biedge(path.first, *new_node, new_edge)) {
                 UHD_LOG_DEBUG(LOG_ID,
-                    "Re-discovered node " << new_node.to_string() << ". Skipping it");
-                continue;
+                    "Re-discovered node " << new_node->to_string() << ". Skipping it");
+                return;
             }
-            UHD_LOG_DEBUG(LOG_ID, "Discovered node " << new_node.to_string());
+            UHD_LOG_DEBUG(LOG_ID, "Discovered node " << new_node->to_string());
 
             // Initialize the node (first time config)
-            mgmt_payload init_req_xact(route_xact);
-            _push_node_init_hop(init_req_xact, new_node, my_epid, new_edge.dst_port);
-            // Send the transaction and receive a response.
-            // We don't care about the contents of the response.
-            _send_recv_mgmt_transaction(xport, init_req_xact);
+            disc_xact_t init_xact;
+            init_xact.path     = path;
+            init_xact.is_init  = true;
+            init_xact.new_node = *new_node;
+            init_xact.dst_port = dst_port;
+            init_xact.xact.set_header(my_epid, _protover, _chdr_w);
+            _traverse_to_node(init_xact.xact,
+                path.first,
+                my_epid,
+                path.second,
+                false,
+                &init_xact.return_ports);
+            _push_node_init_hop(init_xact.xact, *new_node, my_epid, dst_port);
+            if (new_node->type == node_type::XBAR) {
+                init_xact.return_ports[new_node->unique_id()] = dst_port;
+            }
+            ready_xacts.push_back(std::move(init_xact));
+        };
+
+        // Handle the response to a node initialization
+        auto handle_init = [&](const topo_node_t& new_node, const port_t dst_port) {
             UHD_LOG_DEBUG(LOG_ID, "Initialized node " << new_node.to_string());
 
             // If the new node is a stream endpoint then we are done traversing this
@@ -771,8 +971,210 @@ private: // Functions
                     break;
                 }
             }
-            // That's it! Now go check the next path.
+        };
+
+        // Check a discovery that was sent to validate the topology cache. If
+        // the device doesn't match the cache, stop using it.
+        auto check_cache = [&](const disc_xact_t& xact,
+                               const std::optional<topo_node_t>& new_node) {
+            if (!xact.validates_cache) {
+                return;
+            }
+            num_validations_pending--;
+            const auto cached_probe = cached_probes.find(_get_probe_key(xact.path));
+            if (cached_probe != cached_probes.end()
+                && !same_probe_result(cached_probe->second, new_node)) {
+                UHD_LOG_WARNING(LOG_ID,
+                    "The topology cache does not match the device (found "
+                        << (new_node ? new_node->to_string() : "nothing") << " on "
+                        << xact.path.first.to_string() << "->" << xact.path.second
+                        << "). Discovering the topology from scratch.");
+                cached_probes.clear();
+                update_cache = true;
+                while (!cached_paths.empty()) {
+                    pending_paths.push(cached_paths.front());
+                    cached_paths.pop();
+                }
+            }
+        };
+
+        // Returns true if the transaction programs a crossbar return port
+        // differently than any transaction in flight. The responses could get
+        // lost if we sent it now.
+        auto conflicts_with_xacts_in_flight = [&](const disc_xact_t& xact) {
+            for (const auto& xact_in_flight : xacts_in_flight) {
+                for (const auto& return_port : xact.return_ports) {
+                    const auto other_port =
+                        xact_in_flight.second.return_ports.find(return_port.first);
+                    if (other_port != xact_in_flight.second.return_ports.end()
+                        && other_port->second != return_port.second) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        while (!pending_paths.empty() || !cached_paths.empty() || !ready_xacts.empty()
+               || !xacts_in_flight.empty()) {
+            // Turn pending paths into discovery transactions, unless the
+            // topology cache knows what's there
+            while (!pending_paths.empty()) {
+                const auto next_path = pending_paths.front();
+                pending_paths.pop();
+                const auto cached_probe = cached_probes.find(_get_probe_key(next_path));
+                const bool validate =
+                    cached_probe != cached_probes.end()
+                    && (next_path.first == _my_node_id
+                        || (num_validations_left > 0 && cached_probe->second
+                            && cached_probe->second->type == node_type::STRM_EP));
+                if (cached_probe != cached_probes.end() && !validate) {
+                    cached_paths.push(next_path);
+                    continue;
+                }
+                if (validate) {
+                    num_validations_pending++;
+                    if (next_path.first != _my_node_id) {
+                        num_validations_left--;
+                    }
+                }
+
+                disc_xact_t disc_xact;
+                disc_xact.path            = next_path;
+                disc_xact.validates_cache = validate;
+                // Build a management transaction to first get to our destination
+                // so that we can ask it to identify itself
+                disc_xact.xact.set_header(my_epid, _protover, _chdr_w);
+                _traverse_to_node(disc_xact.xact,
+                    next_path.first,
+                    my_epid,
+                    next_path.second,
+                    false,
+                    &disc_xact.return_ports);
+                // Push a node discovery hop
+                mgmt_hop_t disc_hop;
+                disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_REQ));
+                disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
+                disc_xact.xact.add_hop(disc_hop);
+                UHD_LOG_TRACE(LOG_ID,
+                    "Discovering next node upstream from "
+                        << next_path.first.to_string() << ", output port "
+                        << next_path.second << " using management transaction: "
+                        << disc_xact.xact.to_string());
+                ready_xacts.push_back(std::move(disc_xact));
+            }
+
+            // Once the cache is validated, answer the paths it knows
+            if (num_validations_pending == 0) {
+                while (!cached_paths.empty()) {
+                    const auto next_path = cached_paths.front();
+                    cached_paths.pop();
+                    num_cached++;
+                    handle_discovery(
+                        next_path, cached_probes.at(_get_probe_key(next_path)));
+                }
+            }
+
+            // Send as many transactions as we can
+            const size_t max_xacts_in_flight = tags_confirmed ? MAX_DISC_XACTS_IN_FLIGHT
+                                                              : 1;
+            while (!ready_xacts.empty() && xacts_in_flight.size() < max_xacts_in_flight
+                   && !conflicts_with_xacts_in_flight(ready_xacts.front())) {
+                auto xact     = std::move(ready_xacts.front());
+                xact.deadline = clock::now() + DISC_XACT_TIMEOUT;
+                ready_xacts.pop_front();
+                const uint64_t tag = next_tag++;
+                _send_mgmt_request(xport, xact.xact, tag);
+                xacts_in_flight.emplace(tag, std::move(xact));
+                num_xacts++;
+                max_in_flight = std::max(max_in_flight, xacts_in_flight.size());
+            }
+            if (xacts_in_flight.empty()) {
+                // Everything was answered from the cache
+                continue;
+            }
+
+            // Wait for the next response, or until the oldest transaction
+            // times out
+            auto deadline = clock::time_point::max();
+            for (const auto& xact_in_flight : xacts_in_flight) {
+                deadline = std::min(deadline, xact_in_flight.second.deadline);
+            }
+            const auto timeout =
+                std::chrono::ceil<std::chrono::milliseconds>(deadline - clock::now());
+            uint64_t tag;
+            auto response = _recv_mgmt_response(
+                xport, std::max<int32_t>(0, static_cast<int32_t>(timeout.count())), tag);
+            if (!response) {
+                if (clock::now() < deadline) {
+                    continue;
+                }
+                // Everything that's past its deadline has timed out
+                const auto now = clock::now();
+                for (auto it = xacts_in_flight.begin(); it != xacts_in_flight.end();) {
+                    if (it->second.deadline > now) {
+                        ++it;
+                        continue;
+                    }
+                    const auto xact = std::move(it->second);
+                    it              = xacts_in_flight.erase(it);
+                    num_timeouts++;
+                    if (xact.is_init) {
+                        throw uhd::io_error(
+                            "Timed out getting recv buff for management transaction");
+                    }
+                    check_cache(xact, std::nullopt);
+                    handle_discovery(xact.path, std::nullopt);
+                }
+                continue;
+            }
+
+            auto xact_it = xacts_in_flight.find(tag);
+            if (xact_it == xacts_in_flight.end()) {
+                if (tags_confirmed || xacts_in_flight.size() > 1) {
+                    UHD_LOG_TRACE(LOG_ID,
+                        "Dropping management response with unknown tag " << tag);
+                    continue;
+                }
+                // The device doesn't return our tags, so the response belongs
+                // to the only transaction in flight
+                xact_it = xacts_in_flight.begin();
+            } else if (!tags_confirmed) {
+                UHD_LOG_TRACE(LOG_ID, "Pipelining topology discovery transactions.");
+                tags_confirmed = true;
+            }
+            const auto xact = std::move(xact_it->second);
+            xacts_in_flight.erase(xact_it);
+            if (xact.is_init) {
+                // We don't care about the contents of the response
+                handle_init(xact.new_node, xact.dst_port);
+            } else {
+                const auto new_node = _pop_node_discovery_hop(*response);
+                check_cache(xact, new_node);
+                handle_discovery(xact.path, new_node);
+            }
+        }
+
+        if (!cache_key.empty() && update_cache) {
+            store_topology_cache(cache_key, probe_results);
         }
+        const std::chrono::duration<double, std::milli> discovery_time =
+            clock::now() - start_time;
+        UHD_LOG_DEBUG(LOG_ID,
+            "Topology discovery from "
+                << _my_node_id.to_string() << " took " << discovery_time.count()
+                << " ms: " << num_xacts << " transactions (up to " << max_in_flight
+                << " in flight), " << num_timeouts << " timeouts, " << num_cached
+                << " discoveries answered from the topology cache.");
+    }
+
+    //! Return the key of a discovery along \p path in the topology cache
+    probe_key_t _get_probe_key(
+        const std::pair<topo_node_t, topo_edge_t::port_t>& path) const
+    {
+        // The local endpoint ID can change between sessions
+        return {path.first == _my_node_id ? "root" : node_to_cache_str(path.first),
+            path.second};
     }
 
     /*! \brief Add hops to the management transaction to reach the specified node.
@@ -780,12 +1182,15 @@ private: // Functions
      * The typical use case is to add a management transaction that's aimed at
      * the node after \p dst_node. If the intention is to add a management
      * transaction for \p dst_node itself, then set \p dst_is_target to true.
+     * If \p return_ports is given, the return ports this transaction programs
+     * into the crossbars along the way are stored there.
      */
     topo_edge_t _traverse_to_node(mgmt_payload& transaction,
         const topo_node_t& dst_node,
         const sep_id_t my_epid,
         const topo_edge_t::port_t last_port_override = -1,
-        const bool dst_is_target                     = false)
+        const bool dst_is_target                     = false,
+        return_port_map_t* return_ports              = nullptr)
     {
         if (dst_node == _my_node_id) {
             return topo_edge_t();
@@ -815,6 +1220,9 @@ private: // Functions
                     mgmt_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_SEL_DEST,
                         mgmt_op_t::sel_dest_payload(
                             static_cast<uint16_t>(hop.edge.src_port))));
+                    if (return_ports) {
+                        (*return_ports)[hop.node.unique_id()] = last_edge.dst_port;
+                    }
                 } break;
                 default:
                     // For any other node, we only need a NOP to traverse.
@@ -1130,33 +1538,65 @@ private: // Functions
         xport.release_send_buff(std::move(send_buff));
     }
 
-    // Send the specified management transaction to the device and receive a response
-    const mgmt_payload _send_recv_mgmt_transaction(
-        chdr_ctrl_xport& xport, const mgmt_payload& transaction, double timeout = 0.1)
+    /*! Send the specified management transaction to the device, asking for a
+     * response
+     *
+     * The \p tag is stored in the hop that carries the response, so the
+     * response can be matched to its request.
+     */
+    void _send_mgmt_request(
+        chdr_ctrl_xport& xport, const mgmt_payload& transaction, const uint64_t tag = 0)
     {
-        auto my_epid = xport.get_epid();
         mgmt_payload send(transaction);
-        send.set_header(my_epid, _protover, _chdr_w);
+        send.set_header(xport.get_epid(), _protover, _chdr_w);
         // If we are expecting to receive a response then we have to add an additional
         // NO-OP hop for the receive endpoint. All responses will be appended to this hop.
         mgmt_hop_t nop_hop;
-        nop_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_NOP));
+        nop_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_NOP, tag));
         send.add_hop(nop_hop);
         // Send the transaction over the wire
         _send_mgmt_transaction(xport, send);
+    }
 
-        auto mgmt_buff = xport.get_mgmt_buff(static_cast<int32_t>(timeout * 1000));
+    /*! Receive the response to a management transaction
+     *
+     * \param tag The tag of the request that this response belongs to, or 0
+     *            if the device did not return it.
+     * \returns the response, or nothing on timeout
+     */
+    std::optional<mgmt_payload> _recv_mgmt_response(
+        chdr_ctrl_xport& xport, const int32_t timeout_ms, uint64_t& tag)
+    {
+        auto mgmt_buff = xport.get_mgmt_buff(timeout_ms);
         if (not mgmt_buff) {
-            throw uhd::io_error("Timed out getting recv buff for management transaction");
+            return std::nullopt;
         }
         _recv_pkt->refresh(mgmt_buff->data());
         mgmt_payload recv;
-        recv.set_header(my_epid, _protover, _chdr_w);
+        recv.set_header(xport.get_epid(), _protover, _chdr_w);
         _recv_pkt->fill_payload(recv);
         xport.release_mgmt_buff(std::move(mgmt_buff));
+        tag = 0;
+        if (recv.get_num_hops() > 0 && recv.get_hop(0).get_num_ops() > 0) {
+            tag = recv.get_hop(0).get_op(0).get_op_payload();
+        }
         return recv;
     }
 
+    // Send the specified management transaction to the device and receive a response
+    const mgmt_payload _send_recv_mgmt_transaction(
+        chdr_ctrl_xport& xport, const mgmt_payload& transaction, double timeout = 0.1)
+    {
+        _send_mgmt_request(xport, transaction);
+        uint64_t tag;
+        auto recv =
+            _recv_mgmt_response(xport, static_cast<int32_t>(timeout * 1000), tag);
+        if (!recv) {
+            throw uhd::io_error("Timed out getting recv buff for management transaction");
+        }
+        return *recv;
+    }
+
 private: // Members
     // The software RFNoC protocol version
     const uint16_t _protover;
@@ -1184,10 +1624,11 @@ private: // Members
 mgmt_portal::uptr mgmt_portal::make(chdr_ctrl_xport& xport,
     const chdr::chdr_packet_factory& pkt_factory,
     sep_addr_t my_sep_addr,
-    uhd::rfnoc::detail::topo_graph_t::sptr topo_graph)
+    uhd::rfnoc::detail::topo_graph_t::sptr topo_graph,
+    const std::string& topology_cache_key)
 {
     return std::make_unique<mgmt_portal_impl>(
-        xport, pkt_factory, my_sep_addr, topo_graph);
+        xport, pkt_factory, my_sep_addr, topo_graph, topology_cache_key);
 }
 
 }}} // namespace uhd::rfnoc::mgmt
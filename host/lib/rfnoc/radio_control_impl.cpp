@@ -286,32 +286,30 @@ radio_control_impl::radio_control_impl(make_args_ptr make_args)
     RFNOC_LOG_TRACE("Sending async messages to EPID "
                     << regs().get_src_epid() << ", remote port " << regs().get_port_num()
                     << ", xbar port " << xbar_port);
+    // Set up error reporting for every channel: The crossbar port for the async
+    // packet routing, the EPID and port of our regs() object (all async messages
+    // go to the same location), and the async message address. The registers are
+    // consecutive, so every channel only takes a single block write.
     for (size_t tx_chan = 0; tx_chan < get_num_input_ports(); tx_chan++) {
-        // Set the EPID and port of our regs() object (all async messages go to
-        // the same location)
-        _radio_reg_iface.poke32(
-            regmap::REG_TX_ERR_REM_EPID, regs().get_src_epid(), tx_chan);
-        _radio_reg_iface.poke32(
-            regmap::REG_TX_ERR_REM_PORT, regs().get_port_num(), tx_chan);
-        // Set the crossbar port for the async packet routing
-        _radio_reg_iface.poke32(regmap::REG_TX_ERR_PORT, xbar_port, tx_chan);
-        // Set the async message address
-        _radio_reg_iface.poke32(regmap::REG_TX_ERR_ADDR,
-            regmap::SWREG_TX_ERR + regmap::SWREG_CHAN_OFFSET * tx_chan,
+        _radio_reg_iface.multi_poke32({regmap::REG_TX_ERR_PORT,
+                                          regmap::REG_TX_ERR_REM_PORT,
+                                          regmap::REG_TX_ERR_REM_EPID,
+                                          regmap::REG_TX_ERR_ADDR},
+            {xbar_port,
+                regs().get_port_num(),
+                regs().get_src_epid(),
+                regmap::SWREG_TX_ERR + regmap::SWREG_CHAN_OFFSET * uint32_t(tx_chan)},
             tx_chan);
     }
     for (size_t rx_chan = 0; rx_chan < get_num_output_ports(); rx_chan++) {
-        // Set the EPID and port of our regs() object (all async messages go to
-        // the same location)
-        _radio_reg_iface.poke32(
-            regmap::REG_RX_ERR_REM_EPID, regs().get_src_epid(), rx_chan);
-        _radio_reg_iface.poke32(
-            regmap::REG_RX_ERR_REM_PORT, regs().get_port_num(), rx_chan);
-        // Set the crossbar port for the async packet routing
-        _radio_reg_iface.poke32(regmap::REG_RX_ERR_PORT, xbar_port, rx_chan);
-        // Set the async message address
-        _radio_reg_iface.poke32(regmap::REG_RX_ERR_ADDR,
-            regmap::SWREG_RX_ERR + regmap::SWREG_CHAN_OFFSET * rx_chan,
+        _radio_reg_iface.multi_poke32({regmap::REG_RX_ERR_PORT,
+                                          regmap::REG_RX_ERR_REM_PORT,
+                                          regmap::REG_RX_ERR_REM_EPID,
+                                          regmap::REG_RX_ERR_ADDR},
+            {xbar_port,
+                regs().get_port_num(),
+                regs().get_src_epid(),
+                regmap::SWREG_RX_ERR + regmap::SWREG_CHAN_OFFSET * uint32_t(rx_chan)},
             rx_chan);
     }
     // Now register a function to receive the async messages
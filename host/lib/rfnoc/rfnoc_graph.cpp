@@ -11,6 +11,7 @@
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhd/rfnoc/node.hpp>
 #include <uhd/rfnoc_graph.hpp>
+#include <uhd/utils/cast.hpp>
 #include <uhdlib/rfnoc/block_container.hpp>
 #include <uhdlib/rfnoc/factory.hpp>
 #include <uhdlib/rfnoc/graph_stream_manager.hpp>
@@ -20,7 +21,12 @@
 #include <uhdlib/rfnoc/rfnoc_tx_streamer.hpp>
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 using namespace uhd;
@@ -29,6 +35,14 @@ using namespace uhd::rfnoc;
 namespace {
 const std::string LOG_ID("RFNOC::GRAPH");
 
+/*! Default number of threads that construct the block controllers of one
+ * motherboard. Can be overridden with the 'block_init_threads' device arg.
+ *
+ * Block controllers, including out-of-tree ones, may not be safe to construct
+ * concurrently, so this is opt-in.
+ */
+constexpr size_t DEFAULT_BLOCK_INIT_THREADS = 1;
+
 //! Which blocks are actually stored at a given port on the crossbar
 struct block_xbar_info
 {
@@ -725,7 +739,21 @@ private:
         // Make a map to count the number of each block we have
         std::unordered_map<std::string, uint16_t> block_count_map;
 
-        // Iterate through and register each of the blocks in this mboard
+        // First, gather everything the block controllers need. This is done
+        // serially, so block IDs and property tree paths are assigned in port
+        // order, like the blocks are registered below.
+        struct block_init_task_t
+        {
+            size_t portno;
+            noc_id_t noc_id;
+            block_id_t block_id;
+            block_factory_info_t factory_info;
+            noc_block_base::make_args_ptr make_args;
+            noc_block_base::sptr block;
+            std::exception_ptr error;
+        };
+        std::vector<block_init_task_t> tasks;
+        tasks.reserve(num_blocks);
         for (size_t portno = 0; portno < num_blocks; ++portno) {
             const auto noc_id       = mb_cz->get_noc_id(portno + first_block_port);
             const auto device_type  = mb_cz->get_device_type();
@@ -775,19 +803,110 @@ private:
             _tree->create<uint32_t>(block_path / "noc_id").set(noc_id);
             make_args_uptr->tree = _tree->subtree(block_path);
             make_args_uptr->args = dev_addr; // TODO filter the device args
+            tasks.push_back({portno,
+                noc_id,
+                block_id,
+                std::move(block_factory_info),
+                std::move(make_args_uptr),
+                nullptr,
+                nullptr});
+        }
+
+        // Now run the block controller constructors. They spend most of their
+        // time waiting for register peeks and pokes, so we run them
+        // concurrently, using at most block_init_threads threads. Blocks with
+        // motherboard access share the motherboard controller, so they're
+        // constructed one at a time.
+        const bool serialize_init =
+            uhd::cast::from_str<bool>(dev_addr.get("serialize_init", "0"));
+        const size_t num_threads = serialize_init
+                                       ? 1
+                                       : std::max<size_t>(1,
+                                           dev_addr.cast<size_t>("block_init_threads",
+                                               DEFAULT_BLOCK_INIT_THREADS));
+        std::mutex mb_access_mutex;
+        std::atomic<size_t> next_task{0};
+        auto init_worker = [&tasks, &next_task, &mb_access_mutex]() {
+            for (size_t task_idx = next_task++; task_idx < tasks.size();
+                 task_idx        = next_task++) {
+                auto& task       = tasks[task_idx];
+                const auto start = std::chrono::steady_clock::now();
+                try {
+                    std::unique_lock<std::mutex> lock(mb_access_mutex, std::defer_lock);
+                    if (task.factory_info.mb_access) {
+                        lock.lock();
+                    }
+                    task.block = task.factory_info.factory_fn(std::move(task.make_args));
+                } catch (...) {
+                    task.error = std::current_exception();
+                    continue;
+                }
+                const std::chrono::duration<double, std::milli> init_time =
+                    std::chrono::steady_clock::now() - start;
+                UHD_LOG_DEBUG(LOG_ID,
+                    "Initialized block " << task.block_id << " in "
+                                         << init_time.count() << " ms.");
+            }
+        };
+        const auto init_start = std::chrono::steady_clock::now();
+        if (num_threads == 1 || tasks.size() <= 1) {
+            init_worker();
+        } else {
+            // The futures are destroyed (and thus joined) before we look at
+            // the results
+            std::vector<std::future<void>> workers;
+            for (size_t i = 0; i < std::min(num_threads, tasks.size()); ++i) {
+                workers.push_back(std::async(std::launch::async, init_worker));
+            }
+            for (auto& worker : workers) {
+                worker.get();
+            }
+        }
+        const std::chrono::duration<double, std::milli> total_init_time =
+            std::chrono::steady_clock::now() - init_start;
+        UHD_LOG_DEBUG(LOG_ID,
+            "Initialized " << tasks.size() << " blocks on mboard " << mb_idx << " in "
+                           << total_init_time.count() << " ms using "
+                           << std::min(num_threads, std::max<size_t>(1, tasks.size()))
+                           << " thread(s).");
+
+        // Register the blocks in port order. Blocks that were constructed
+        // successfully are registered even if another block failed, so they
+        // get shut down along with the rest of the registry.
+        std::exception_ptr first_error;
+        for (auto& task : tasks) {
+            if (task.error) {
+                try {
+                    std::rethrow_exception(task.error);
+                } catch (const std::exception& ex) {
+                    UHD_LOG_ERROR(LOG_ID,
+                        "Error during initialization of block " << task.block_id
+                                                                << ": " << ex.what());
+                } catch (...) {
+                    UHD_LOG_ERROR(LOG_ID,
+                        "Error during initialization of block " << task.block_id << "!");
+                }
+                if (!first_error) {
+                    first_error = task.error;
+                }
+                continue;
+            }
             try {
-                _block_registry->register_block(
-                    block_factory_info.factory_fn(std::move(make_args_uptr)));
-                block_initializer::post_init(_block_registry->get_block(block_id));
+                _block_registry->register_block(std::move(task.block));
+                block_initializer::post_init(_block_registry->get_block(task.block_id));
             } catch (...) {
-                UHD_LOG_ERROR(
-                    LOG_ID, "Error during initialization of block " << block_id << "!");
+                UHD_LOG_ERROR(LOG_ID,
+                    "Error during initialization of block " << task.block_id << "!");
                 throw;
             }
-            _xbar_block_config[block_id.to_string()] = {
-                portno, noc_id, block_id.get_block_count()};
+            _xbar_block_config[task.block_id.to_string()] = {
+                task.portno, task.noc_id, task.block_id.get_block_count()};
 
-            _port_block_map.insert({{mb_idx, portno + first_block_port}, block_id});
+            _port_block_map.insert(
+                {{mb_idx, task.portno + first_block_port}, task.block_id});
+        }
+        if (first_error) {
+            std::rethrow_exception(first_error);
         }
     }
 
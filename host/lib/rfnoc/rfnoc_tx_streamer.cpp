@@ -93,10 +93,23 @@ rfnoc_tx_streamer::rfnoc_tx_streamer(const size_t num_chans,
 
     node_accessor_t node_accessor;
     node_accessor.init_props(this);
+
+    for (size_t i = 0; i < num_chans; i++) {
+        auto telemetry_dump = transport::telemetry_dumper::register_source(
+            stream_args.args, _unique_id + ":" + std::to_string(i), [this, i]() {
+                return get_telemetry_info(i);
+            });
+        if (telemetry_dump) {
+            _telemetry_dumps.push_back(std::move(telemetry_dump));
+        }
+    }
 }
 
 rfnoc_tx_streamer::~rfnoc_tx_streamer()
 {
+    // Stop dumping the telemetry before the streamer is torn down
+    _telemetry_dumps.clear();
+
     if (_disconnect_cb) {
         _disconnect_cb(_unique_id);
     }
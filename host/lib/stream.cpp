@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/stream.hpp>
 
 using namespace uhd;
@@ -14,6 +15,17 @@ rx_streamer::~rx_streamer(void)
     // empty
 }
 
+size_t rx_streamer::get_recv_buffs(wire_buffs_type&, rx_metadata_t&, const double)
+{
+    throw uhd::not_implemented_error(
+        "get_recv_buffs() is not supported by this streamer, use recv() instead");
+}
+
+void rx_streamer::release_recv_buffs(void)
+{
+    // Nothing can be held if get_recv_buffs() is not supported
+}
+
 tx_streamer::~tx_streamer(void)
 {
     // empty
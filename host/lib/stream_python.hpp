@@ -11,35 +11,45 @@
 #include <uhd/stream.hpp>
 #include <uhd/types/metadata.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <numpy/ndarrayobject.h>
 #include <numpy/ndarraytypes.h>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
-static size_t wrap_recv(uhd::rx_streamer* rx_stream,
-    py::array& array,
-    uhd::rx_metadata_t& metadata,
-    const double timeout = 0.1)
+/*! Get a pointer to the storage of each channel of a NumPy array
+ *
+ * \param array a 1D array for a single channel, or a 2D array with one row per
+ *              channel
+ * \param channels the number of channels of the streamer
+ * \param direction "RX" or "TX", for the error message
+ */
+static std::vector<void*> get_channel_storage(
+    const py::array& array, const size_t channels, const char* direction)
 {
     // Using the pybind11's numpy array wrapper provides easy
     // access instead of using numpy's C API macros and also keeps
     // track of the reference count for the numpy array.
-    if (!array.writeable()) {
-        throw std::runtime_error("Array is not writable");
-    }
-    char* data            = static_cast<char*>(array.mutable_data());
-    const size_t dims     = array.ndim();
-    const size_t channels = rx_stream->get_num_channels();
+    const char* data  = static_cast<const char*>(array.data());
+    const size_t dims = array.ndim();
 
     // Check if numpy array sizes are okay
     if (((channels > 1) && (dims != 2)) or ((size_t)array.shape(0) < channels)) {
         // If we don't have a 2D NumPy array, assume we have a 1D array
         size_t input_channels = (dims != 2) ? 1 : array.shape(0);
         throw uhd::runtime_error(
-            str(boost::format("Number of RX channels (%d) does not match the dimensions "
-                              "of the data array (%d)")
-                % channels % input_channels));
+            str(boost::format("Number of %s channels (%d) does not match the "
+                              "dimensions of the data array (%d)")
+                % direction % channels % input_channels));
     }
 
     // Get a pointer to the storage
@@ -47,9 +57,78 @@ static size_t wrap_recv(uhd::rx_streamer* rx_stream,
     for (size_t i = 0; i < channels; ++i) {
         channel_storage.push_back((void*)(data + i * array.strides(0)));
     }
+    return channel_storage;
+}
+
+//! Get the number of samples per channel of a NumPy array
+static size_t get_nsamps_per_buff(const py::array& array)
+{
+    return (array.ndim() > 1) ? (size_t)array.shape(1) : (size_t)array.size();
+}
+
+/*! Get the size of one item of a NumPy array or dtype in bytes
+ *
+ * This reads the Python attribute, because the layout of the descriptor struct
+ * which pybind11 reads directly changed in NumPy 2.
+ */
+static size_t get_itemsize(const py::handle& obj)
+{
+    return obj.attr("itemsize").cast<size_t>();
+}
+
+/*! Call recv() until \p nsamps_per_buff samples are received
+ *
+ * Must be called without holding the GIL. \p metadata is the metadata of the
+ * first recv() call, i.e., it has the time of the first sample. Receiving stops
+ * early at the end of a burst, or if recv() reports an error. In the latter
+ * case, the error is also reported in \p metadata.
+ *
+ * \returns the number of samples received per channel
+ */
+static size_t recv_bulk(uhd::rx_streamer* rx_stream,
+    std::vector<void*> buffs,
+    const size_t nsamps_per_buff,
+    const size_t bytes_per_samp,
+    uhd::rx_metadata_t& metadata,
+    const double timeout)
+{
+    uhd::rx_metadata_t next_metadata;
+    size_t num_samps = 0;
+    while (num_samps < nsamps_per_buff) {
+        uhd::rx_metadata_t& md = (num_samps == 0) ? metadata : next_metadata;
+        const size_t num_rx_samps =
+            rx_stream->recv(buffs, nsamps_per_buff - num_samps, md, timeout);
+        num_samps += num_rx_samps;
+        for (void*& buff : buffs) {
+            buff = static_cast<char*>(buff) + num_rx_samps * bytes_per_samp;
+        }
+        if (md.error_code != uhd::rx_metadata_t::ERROR_CODE_NONE) {
+            metadata.error_code      = md.error_code;
+            metadata.out_of_sequence = md.out_of_sequence;
+            break;
+        }
+        if (md.end_of_burst) {
+            metadata.end_of_burst = true;
+            break;
+        }
+    }
+    metadata.more_fragments = false;
+    return num_samps;
+}
+
+static size_t wrap_recv(uhd::rx_streamer* rx_stream,
+    py::array& array,
+    uhd::rx_metadata_t& metadata,
+    const double timeout = 0.1)
+{
+    if (!array.writeable()) {
+        throw std::runtime_error("Array is not writable");
+    }
+    const std::vector<void*> channel_storage =
+        get_channel_storage(array, rx_stream->get_num_channels(), "RX");
 
     // determine how many samples we can receive
-    size_t nsamps_per_buff = dims > 1 ? array.shape(1) : array.size();
+    size_t nsamps_per_buff = get_nsamps_per_buff(array);
 
     // Release the GIL only for the recv() call
     const size_t result = [&]() {
@@ -61,36 +140,35 @@ static size_t wrap_recv(uhd::rx_streamer* rx_stream,
     return result;
 }
 
-static size_t wrap_send(uhd::tx_streamer* tx_stream,
+static size_t wrap_recv_bulk(uhd::rx_streamer* rx_stream,
     py::array& array,
-    uhd::tx_metadata_t& metadata,
+    uhd::rx_metadata_t& metadata,
     const double timeout = 0.1)
 {
-    // Using pybind11's numpy array wrapper provides easy
-    // access instead of using numpy's C API macros and also keeps
-    // track of the reference count for the numpy array.
-    const char* data      = static_cast<const char*>(array.data());
-    const size_t dims     = array.ndim();
-    const size_t channels = tx_stream->get_num_channels();
-
-    // Check if numpy array sizes are ok
-    if (((channels > 1) && (dims != 2)) or ((size_t)array.shape(0) < channels)) {
-        // If we don't have a 2D NumPy array, assume we have a 1D array
-        size_t input_channels = (dims != 2) ? 1 : array.shape(0);
-        throw uhd::runtime_error(
-            str(boost::format("Number of TX channels (%d) does not match the dimensions "
-                              "of the data array (%d)")
-                % channels % input_channels));
+    if (!array.writeable()) {
+        throw std::runtime_error("Array is not writable");
     }
+    const std::vector<void*> channel_storage =
+        get_channel_storage(array, rx_stream->get_num_channels(), "RX");
+    const size_t nsamps_per_buff = get_nsamps_per_buff(array);
+    const size_t bytes_per_samp  = get_itemsize(array);
 
-    // Get a pointer to the storage
-    std::vector<void*> channel_storage;
-    for (size_t i = 0; i < channels; ++i) {
-        channel_storage.push_back((void*)(data + i * array.strides(0)));
-    }
+    // Release the GIL for the whole loop, not only for each recv() call
+    py::gil_scoped_release release;
+    return recv_bulk(
+        rx_stream, channel_storage, nsamps_per_buff, bytes_per_samp, metadata, timeout);
+}
+
+static size_t wrap_send(uhd::tx_streamer* tx_stream,
+    py::array& array,
+    uhd::tx_metadata_t& metadata,
+    const double timeout = 0.1)
+{
+    const std::vector<void*> channel_storage =
+        get_channel_storage(array, tx_stream->get_num_channels(), "TX");
 
     // determine how many samples we have to send
-    size_t nsamps_per_buff = (dims > 1) ? (size_t)array.shape(1) : array.size();
+    size_t nsamps_per_buff = get_nsamps_per_buff(array);
 
     // Release the GIL only for the send() call
     const size_t result = [&]() {
@@ -102,6 +180,272 @@ static size_t wrap_send(uhd::tx_streamer* tx_stream,
     return result;
 }
 
+static size_t wrap_send_bulk(uhd::tx_streamer* tx_stream,
+    py::array& array,
+    uhd::tx_metadata_t& metadata,
+    const size_t num_samps = 0,
+    const double timeout   = 0.1)
+{
+    const std::vector<void*> channel_storage =
+        get_channel_storage(array, tx_stream->get_num_channels(), "TX");
+    const size_t nsamps_per_buff = get_nsamps_per_buff(array);
+    const size_t bytes_per_samp  = get_itemsize(array);
+    const size_t total_samps     = (num_samps == 0) ? nsamps_per_buff : num_samps;
+    if (nsamps_per_buff == 0 and total_samps > 0) {
+        throw uhd::value_error("Cannot send samples from an empty array");
+    }
+
+    py::gil_scoped_release release;
+    if (total_samps == 0) {
+        // Nothing to send, but the metadata may still carry an end of burst
+        return tx_stream->send(channel_storage, 0, metadata, timeout);
+    }
+    // The time and the start of burst only apply to the first send() call, the
+    // end of burst only to the last one.
+    uhd::tx_metadata_t md = metadata;
+    std::vector<void*> buffs(channel_storage.size());
+    size_t num_sent = 0;
+    while (num_sent < total_samps) {
+        // Wrap around to the start of the array to repeat the samples
+        const size_t offset = num_sent % nsamps_per_buff;
+        const size_t nsamps = std::min(nsamps_per_buff - offset, total_samps - num_sent);
+        for (size_t i = 0; i < buffs.size(); i++) {
+            buffs[i] = static_cast<char*>(channel_storage[i]) + offset * bytes_per_samp;
+        }
+        md.end_of_burst = metadata.end_of_burst and (num_sent + nsamps == total_samps);
+        const size_t num_tx_samps = tx_stream->send(buffs, nsamps, md, timeout);
+        num_sent += num_tx_samps;
+        if (num_tx_samps < nsamps) {
+            // Timeout
+            break;
+        }
+        md.start_of_burst = false;
+        md.has_time_spec  = false;
+    }
+    return num_sent;
+}
+
+// Only used by the bindings below. Keeping it out of the exported symbols also
+// keeps GCC from warning that it is more visible than its pybind11 members.
+namespace {
+
+/*! Receive into a ring of NumPy blocks from a background thread
+ *
+ * The thread calls recv() with the GIL released and fills one block after the
+ * other, so Python only has to keep up with the average rate, not with every
+ * single packet. If no block is free, because all of them are either received
+ * or still in use by Python, the thread waits for one to be released, which
+ * will eventually show up as an overflow in the metadata.
+ */
+class rx_ring : public std::enable_shared_from_this<rx_ring>
+{
+public:
+    rx_ring(uhd::rx_streamer::sptr rx_stream,
+        const py::object& dtype,
+        const size_t samps_per_block,
+        const size_t num_blocks,
+        const double timeout)
+        : _rx_stream(rx_stream)
+        , _dtype(py::dtype::from_args(dtype))
+        , _itemsize(get_itemsize(_dtype))
+        , _samps_per_block(samps_per_block)
+        , _timeout(timeout)
+    {
+        if (samps_per_block == 0 or num_blocks < 2) {
+            throw uhd::value_error(
+                "rx_ring needs at least two blocks of at least one sample");
+        }
+        const size_t block_size =
+            _rx_stream->get_num_channels() * samps_per_block * _itemsize;
+        for (size_t i = 0; i < num_blocks; i++) {
+            _blocks.push_back(
+                {std::make_shared<std::vector<char>>(block_size), 0, {}});
+            _free.push_back(i);
+        }
+    }
+
+    ~rx_ring()
+    {
+        stop();
+    }
+
+    //! Start the background thread. The stream command must be issued separately.
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_thread.joinable()) {
+            return;
+        }
+        _running = true;
+        _thread  = std::thread([this]() { _recv_loop(); });
+    }
+
+    //! Stop the background thread. Blocks that were already received are kept.
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _running = false;
+        }
+        _cv.notify_all();
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+    }
+
+    /*! Get the oldest received block
+     *
+     * The returned array refers to the memory of the ring, no samples are
+     * copied. The block is leased to the array: it is only refilled once the
+     * array and all views of it are deleted.
+     *
+     * \returns a tuple of the array (one row per channel) and the metadata of
+     *          the block, or None if no block was received within \p timeout
+     */
+    py::object get(const double timeout)
+    {
+        int64_t index = NO_BLOCK;
+        std::exception_ptr error;
+        {
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait_for(lock, std::chrono::duration<double>(timeout), [this]() {
+                return !_full.empty() or _error or !_running;
+            });
+            if (!_full.empty()) {
+                index = _full.front();
+                _full.pop_front();
+            } else {
+                error = _error;
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if (index == NO_BLOCK) {
+            return py::none();
+        }
+
+        const block_t& block = _blocks[index];
+        // The capsule returns the block to the ring when the array is deleted. It
+        // also keeps the memory alive if the ring is deleted first.
+        auto* lease = new block_lease_t{weak_from_this(), size_t(index), block.data};
+        py::capsule base(lease, [](void* p) {
+            auto* lease = static_cast<block_lease_t*>(p);
+            if (auto ring = lease->ring.lock()) {
+                ring->_return_block(lease->index);
+            }
+            delete lease;
+        });
+        const std::vector<py::ssize_t> shape = {
+            py::ssize_t(_rx_stream->get_num_channels()), py::ssize_t(block.num_samps)};
+        const std::vector<py::ssize_t> strides = {
+            py::ssize_t(_samps_per_block * _itemsize), py::ssize_t(_itemsize)};
+        py::array array(_dtype, shape, strides, block.data->data(), base);
+        return py::make_tuple(array, block.metadata);
+    }
+
+    //! Get the number of blocks which are received but not yet consumed
+    size_t get_num_pending() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _full.size();
+    }
+
+private:
+    static constexpr int64_t NO_BLOCK = -1;
+
+    struct block_t
+    {
+        std::shared_ptr<std::vector<char>> data;
+        size_t num_samps;
+        uhd::rx_metadata_t metadata;
+    };
+
+    //! A block which was handed out by get(), owned by the base of its array
+    struct block_lease_t
+    {
+        std::weak_ptr<rx_ring> ring;
+        size_t index;
+        std::shared_ptr<std::vector<char>> data;
+    };
+
+    void _return_block(const size_t index)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _free.push_back(index);
+        _cv.notify_all();
+    }
+
+    void _recv_loop()
+    {
+        const size_t num_chans = _rx_stream->get_num_channels();
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() { return !_free.empty() or !_running; });
+                if (!_running) {
+                    return;
+                }
+                index = _free.front();
+                _free.pop_front();
+            }
+
+            block_t& block = _blocks[index];
+            std::vector<void*> buffs;
+            for (size_t i = 0; i < num_chans; i++) {
+                buffs.push_back(block.data->data() + i * _samps_per_block * _itemsize);
+            }
+            try {
+                block.metadata  = uhd::rx_metadata_t();
+                block.num_samps = recv_bulk(_rx_stream.get(),
+                    buffs,
+                    _samps_per_block,
+                    _itemsize,
+                    block.metadata,
+                    _timeout);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _error   = std::current_exception();
+                _running = false;
+                _cv.notify_all();
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            // Don't hand out empty blocks, unless they report an error
+            if (block.num_samps == 0
+                and block.metadata.error_code
+                        == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+                _free.push_front(index);
+            } else {
+                _full.push_back(index);
+                _cv.notify_all();
+            }
+        }
+    }
+
+    uhd::rx_streamer::sptr _rx_stream;
+    const py::dtype _dtype;
+    const size_t _itemsize;
+    const size_t _samps_per_block;
+    const double _timeout;
+
+    std::vector<block_t> _blocks;
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    //! Indices of the blocks that can be filled
+    std::deque<size_t> _free;
+    //! Indices of the blocks that were received, oldest first
+    std::deque<size_t> _full;
+    bool _running = false;
+    std::exception_ptr _error;
+    std::thread _thread;
+};
+
+} // namespace
+
 static bool wrap_recv_async_msg(uhd::tx_streamer* tx_stream,
     uhd::async_metadata_t& async_metadata,
     double timeout = 0.1)
@@ -132,6 +476,11 @@ void export_stream(py::module& m)
             py::arg("np_array"),
             py::arg("metadata"),
             py::arg("timeout") = 0.1)
+        .def("recv_bulk",
+            &wrap_recv_bulk,
+            py::arg("np_array"),
+            py::arg("metadata"),
+            py::arg("timeout") = 0.1)
         .def("get_num_channels", &uhd::rx_streamer::get_num_channels)
         .def("get_max_num_samps", &uhd::rx_streamer::get_max_num_samps)
         .def("get_stream_info", &uhd::rx_streamer::get_stream_info, py::arg("chan") = 0)
@@ -144,6 +493,12 @@ void export_stream(py::module& m)
             py::arg("np_array"),
             py::arg("metadata"),
             py::arg("timeout") = 0.1)
+        .def("send_bulk",
+            &wrap_send_bulk,
+            py::arg("np_array"),
+            py::arg("metadata"),
+            py::arg("num_samps") = 0,
+            py::arg("timeout")   = 0.1)
         .def("get_num_channels", &tx_streamer::get_num_channels)
         .def("get_max_num_samps", &tx_streamer::get_max_num_samps)
         .def("get_stream_info", &uhd::tx_streamer::get_stream_info, py::arg("chan") = 0)
@@ -161,6 +516,18 @@ void export_stream(py::module& m)
                 return py::cast(nullptr);
             },
             py::arg("timeout") = 0.1);
+
+    py::class_<rx_ring, std::shared_ptr<rx_ring>>(m, "rx_ring")
+        .def(py::init<rx_streamer::sptr, const py::object&, size_t, size_t, double>(),
+            py::arg("rx_streamer"),
+            py::arg("dtype"),
+            py::arg("samps_per_block"),
+            py::arg("num_blocks") = 16,
+            py::arg("timeout")    = 0.1)
+        .def("start", &rx_ring::start)
+        .def("stop", &rx_ring::stop, py::call_guard<py::gil_scoped_release>())
+        .def("get", &rx_ring::get, py::arg("timeout") = 1.0)
+        .def("get_num_pending", &rx_ring::get_num_pending);
 }
 
 #endif /* INCLUDED_UHD_STREAM_PYTHON_HPP */
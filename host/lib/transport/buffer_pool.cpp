@@ -7,8 +7,20 @@
 
 #include <uhd/transport/buffer_pool.hpp>
 #include <uhd/transport/zero_copy.hpp>
+#include <uhd/utils/log.hpp>
+#include <cstring>
 #include <memory>
 #include <vector>
+#ifdef UHD_PLATFORM_LINUX
+#    include <linux/mempolicy.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <cerrno>
+#    ifndef MAP_HUGE_SHIFT
+#        define MAP_HUGE_SHIFT 26
+#    endif
+#endif
 
 using namespace uhd::transport;
 
@@ -18,6 +30,74 @@ static size_t pad_to_boundary(const size_t bytes, const size_t alignment)
     return bytes + (alignment - bytes) % alignment;
 }
 
+namespace {
+
+constexpr char LOG_ID[] = "BUFFER_POOL";
+
+#ifdef UHD_PLATFORM_LINUX
+//! Return the size of the regular pages
+size_t get_default_page_size()
+{
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+//! Map anonymous memory, in huge pages if huge_page_size is non-zero
+void* map_memory(const size_t size, const size_t huge_page_size)
+{
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (huge_page_size != 0) {
+        // The page size is encoded as its log2 (MAP_HUGE_2MB etc. are not
+        // defined by all C libraries)
+        int log2_page_size = 0;
+        while ((size_t(1) << log2_page_size) < huge_page_size) {
+            log2_page_size++;
+        }
+        flags |= MAP_HUGETLB | (log2_page_size << MAP_HUGE_SHIFT);
+    }
+    void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return mem == MAP_FAILED ? nullptr : mem;
+}
+
+//! Bind memory to a NUMA node. glibc has no wrapper for mbind().
+bool bind_memory(void* mem, const size_t size, const int numa_node)
+{
+    constexpr size_t BITS_PER_WORD = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> nodemask(numa_node / BITS_PER_WORD + 1, 0);
+    nodemask[numa_node / BITS_PER_WORD] = 1UL << (numa_node % BITS_PER_WORD);
+    // The kernel only reads maxnode - 1 bits of the mask, so add one like
+    // libnuma does. Otherwise, the last node of the mask is dropped.
+    return syscall(SYS_mbind,
+               mem,
+               size,
+               MPOL_BIND,
+               nodemask.data(),
+               nodemask.size() * BITS_PER_WORD + 1,
+               0)
+           == 0;
+}
+#endif
+
+} // namespace
+
+struct buffer_pool::mem_holder
+{
+    //! The memory, with a deleter matching the way it was allocated
+    std::shared_ptr<void> mem;
+    placement_t placement;
+};
+
+buffer_pool::buffer_pool(std::vector<ptr_type>&& ptrs, std::unique_ptr<mem_holder> mem)
+    : _ptrs(std::move(ptrs)), _mem(std::move(mem))
+{
+}
+
+buffer_pool::~buffer_pool() = default;
+
+buffer_pool::placement_t buffer_pool::get_placement() const
+{
+    return _mem->placement;
+}
+
 /***********************************************************************
  * Buffer pool factory function
  **********************************************************************/
@@ -28,7 +108,8 @@ buffer_pool::sptr buffer_pool::make(
     // 2) pad the overall memory size for room after alignment
     // 3) allocate the memory in one block of sufficient size
     const size_t padded_buff_size = pad_to_boundary(buff_size, alignment);
-    std::unique_ptr<char[]> mem(new char[padded_buff_size * num_buffs + alignment - 1]);
+    std::shared_ptr<char> mem(new char[padded_buff_size * num_buffs + alignment - 1],
+        std::default_delete<char[]>());
 
     // Fill a vector with boundary-aligned points in the memory
     const size_t mem_start = pad_to_boundary(size_t(mem.get()), alignment);
@@ -37,8 +118,94 @@ buffer_pool::sptr buffer_pool::make(
         ptrs[i] = ptr_type(mem_start + padded_buff_size * i);
     }
 
+    auto holder = std::make_unique<mem_holder>();
+    holder->mem = std::move(mem);
+#ifdef UHD_PLATFORM_LINUX
+    holder->placement.page_size = get_default_page_size();
+#endif
+
     // Create a new buffer pool with:
     // - the pre-computed pointers, and
     // - the reference to allocated memory.
-    return sptr(new buffer_pool(std::move(ptrs), std::move(mem)));
+    return sptr(new buffer_pool(std::move(ptrs), std::move(holder)));
+}
+
+buffer_pool::sptr buffer_pool::make(const size_t num_buffs,
+    const size_t buff_size,
+    const size_t alignment,
+    const mem_params_t& mem_params)
+{
+    if (mem_params.page_size == page_size_t::DEFAULT
+        && mem_params.numa_node == NO_NUMA_NODE) {
+        return make(num_buffs, buff_size, alignment);
+    }
+#ifdef UHD_PLATFORM_LINUX
+    // Leave room for alignment, in case it exceeds the page size
+    const size_t padded_buff_size = pad_to_boundary(buff_size, alignment);
+    const size_t data_size        = padded_buff_size * num_buffs + alignment - 1;
+
+    // 1) map the memory in huge pages, falling back to regular pages
+    // 2) bind it to the NUMA node before it's touched, because pages are
+    //    allocated on the first access
+    // 3) touch all pages, so they don't fault while streaming
+    placement_t placement;
+    void* mem       = nullptr;
+    size_t mem_size = 0;
+    if (mem_params.page_size != page_size_t::DEFAULT) {
+        const size_t huge_page_size = mem_params.page_size == page_size_t::HUGE_1G
+                                          ? size_t(1) << 30
+                                          : size_t(1) << 21;
+        mem_size = pad_to_boundary(data_size, huge_page_size);
+        mem      = map_memory(mem_size, huge_page_size);
+        if (mem) {
+            placement.page_size = huge_page_size;
+        } else {
+            const int err = errno;
+            UHD_LOG_WARNING(LOG_ID,
+                "Failed to allocate " << mem_size / huge_page_size << " huge pages of "
+                                      << (huge_page_size >> 20) << " MiB ("
+                                      << std::strerror(err)
+                                      << "), using regular pages instead. Check "
+                                         "/proc/sys/vm/nr_hugepages.");
+        }
+    }
+    if (!mem) {
+        placement.page_size = get_default_page_size();
+        mem_size            = pad_to_boundary(data_size, placement.page_size);
+        mem                 = map_memory(mem_size, 0);
+        if (!mem) {
+            throw std::bad_alloc();
+        }
+    }
+    if (mem_params.numa_node != NO_NUMA_NODE) {
+        if (mem_params.numa_node >= 0
+            && bind_memory(mem, mem_size, mem_params.numa_node)) {
+            placement.numa_node = mem_params.numa_node;
+        } else {
+            UHD_LOG_WARNING(LOG_ID,
+                "Failed to bind buffers to NUMA node " << mem_params.numa_node);
+        }
+    }
+    std::memset(mem, 0, mem_size);
+
+    UHD_LOG_TRACE(LOG_ID,
+        "Allocated " << num_buffs << " buffers of " << buff_size << " bytes in pages of "
+                     << placement.page_size << " bytes on NUMA node "
+                     << placement.numa_node);
+
+    const size_t mem_start = pad_to_boundary(size_t(mem), alignment);
+    std::vector<ptr_type> ptrs(num_buffs);
+    for (size_t i = 0; i < num_buffs; i++) {
+        ptrs[i] = ptr_type(mem_start + padded_buff_size * i);
+    }
+    auto holder = std::make_unique<mem_holder>();
+    holder->mem.reset(mem, [mem_size](void* p) { munmap(p, mem_size); });
+    holder->placement = placement;
+    return sptr(new buffer_pool(std::move(ptrs), std::move(holder)));
+#else
+    UHD_LOG_DEBUG(LOG_ID,
+        "Huge pages and NUMA binding are not supported on this platform, "
+        "using regular memory");
+    return make(num_buffs, buff_size, alignment);
+#endif
 }
@@ -0,0 +1,435 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/asio.hpp>
+#include <uhdlib/transport/chdr_capture.hpp>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <optional>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr char LOG_ID[] = "CHDR_CAPTURE";
+
+// pcap file format, see https://www.tcpdump.org/manpages/pcap-savefile.5.html
+constexpr uint32_t PCAP_MAGIC_US      = 0xA1B2C3D4;
+constexpr uint32_t PCAP_MAGIC_NS      = 0xA1B23C4D;
+constexpr uint32_t PCAPNG_MAGIC       = 0x0A0D0D0A;
+constexpr size_t PCAP_FILE_HDR_SIZE   = 24;
+constexpr size_t PCAP_RECORD_HDR_SIZE = 16;
+constexpr uint32_t PCAP_SNAPLEN       = 65535;
+
+// Link types, see https://www.tcpdump.org/linktypes.html
+constexpr uint32_t LINKTYPE_ETHERNET   = 1;
+constexpr uint32_t LINKTYPE_RAW        = 101;
+constexpr uint32_t LINKTYPE_LINUX_SLL  = 113;
+constexpr uint32_t LINKTYPE_IPV4       = 228;
+constexpr uint32_t LINKTYPE_LINUX_SLL2 = 276;
+
+constexpr uint16_t ETHERTYPE_IPV4    = 0x0800;
+constexpr uint16_t ETHERTYPE_VLAN    = 0x8100;
+constexpr uint16_t ETHERTYPE_QINQ    = 0x88A8;
+constexpr size_t ETH_HDR_SIZE        = 14;
+constexpr size_t VLAN_TAG_SIZE       = 4;
+constexpr size_t LINUX_SLL_HDR_SIZE  = 16;
+constexpr size_t LINUX_SLL2_HDR_SIZE = 20;
+constexpr size_t IPV4_HDR_SIZE       = 20;
+constexpr uint8_t IP_PROTO_UDP       = 17;
+constexpr size_t UDP_HDR_SIZE        = 8;
+constexpr size_t CHDR_HDR_SIZE       = sizeof(uint64_t);
+
+//! Largest CHDR packet that fits into a UDP packet
+constexpr size_t UDP_MAX_PAYLOAD = 65535 - IPV4_HDR_SIZE - UDP_HDR_SIZE;
+
+//! Read a big endian value
+template <typename T>
+T read_be(const uint8_t* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return uhd::ntohx(value);
+}
+
+template <typename T>
+void write_be(uint8_t* data, const T value)
+{
+    const T be_value = uhd::htonx(value);
+    std::memcpy(data, &be_value, sizeof(T));
+}
+
+//! Reads pcap header fields, which are in the byte order of the writer
+class pcap_field_reader
+{
+public:
+    pcap_field_reader(const bool swap) : _swap(swap) {}
+
+    uint32_t operator()(const uint8_t* data) const
+    {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return _swap ? uhd::byteswap(value) : value;
+    }
+
+private:
+    const bool _swap;
+};
+
+//! Return the offset of the IPv4 header in a frame, if it has one
+std::optional<size_t> get_ipv4_offset(
+    const uint32_t link_type, const uint8_t* frame, const size_t size)
+{
+    switch (link_type) {
+        case LINKTYPE_ETHERNET: {
+            size_t offset = ETH_HDR_SIZE - sizeof(uint16_t);
+            while (offset + sizeof(uint16_t) <= size) {
+                const uint16_t ethertype = read_be<uint16_t>(frame + offset);
+                offset += sizeof(uint16_t);
+                if (ethertype == ETHERTYPE_IPV4) {
+                    return offset;
+                }
+                if (ethertype != ETHERTYPE_VLAN && ethertype != ETHERTYPE_QINQ) {
+                    return std::nullopt;
+                }
+                // Skip the rest of the VLAN tag
+                offset += VLAN_TAG_SIZE - sizeof(uint16_t);
+            }
+            return std::nullopt;
+        }
+        case LINKTYPE_LINUX_SLL:
+            if (size < LINUX_SLL_HDR_SIZE
+                || read_be<uint16_t>(frame + LINUX_SLL_HDR_SIZE - sizeof(uint16_t))
+                       != ETHERTYPE_IPV4) {
+                return std::nullopt;
+            }
+            return LINUX_SLL_HDR_SIZE;
+        case LINKTYPE_LINUX_SLL2:
+            if (size < LINUX_SLL2_HDR_SIZE
+                || read_be<uint16_t>(frame) != ETHERTYPE_IPV4) {
+                return std::nullopt;
+            }
+            return LINUX_SLL2_HDR_SIZE;
+        default:
+            // LINKTYPE_RAW and LINKTYPE_IPV4 start with the IP header
+            return 0;
+    }
+}
+
+uint16_t get_ipv4_checksum(const uint8_t* hdr)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < IPV4_HDR_SIZE; i += sizeof(uint16_t)) {
+        sum += read_be<uint16_t>(hdr + i);
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    return static_cast<uint16_t>(~sum);
+}
+
+} // namespace
+
+capture_format uhd::transport::get_capture_format(const std::string& filename)
+{
+    for (const std::string ext : {".pcap", ".cap"}) {
+        if (filename.size() >= ext.size()
+            && filename.compare(filename.size() - ext.size(), ext.size(), ext) == 0) {
+            return capture_format::PCAP;
+        }
+    }
+    return capture_format::RAW;
+}
+
+/******************************************************************************
+ * chdr_capture_reader
+ *****************************************************************************/
+chdr_capture_reader::chdr_capture_reader(const std::string& filename,
+    const capture_format format,
+    const uhd::endianness_t endianness,
+    const filter_t& filter)
+    : _endianness(endianness), _filter(filter)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw uhd::io_error("Cannot open capture file " + filename);
+    }
+    std::vector<uint8_t> file_data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(file_data.data()), file_data.size());
+    if (!file) {
+        throw uhd::io_error("Cannot read capture file " + filename);
+    }
+
+    if (format == capture_format::PCAP) {
+        _read_pcap(file_data);
+    } else {
+        _read_raw(file_data);
+    }
+    if (_num_skipped) {
+        UHD_LOG_WARNING(LOG_ID,
+            "Skipped " << _num_skipped << " packets in " << filename
+                       << " which are truncated, fragmented, or not CHDR packets");
+    }
+    UHD_LOG_DEBUG(LOG_ID, "Read " << _packets.size() << " packets from " << filename);
+}
+
+uint64_t chdr_capture_reader::get_header(const size_t index) const
+{
+    uint64_t header;
+    std::memcpy(&header, data(index), sizeof(header));
+    return _endianness == uhd::ENDIANNESS_BIG ? uhd::ntohx(header)
+                                              : uhd::wtohx(header);
+}
+
+void chdr_capture_reader::_read_pcap(const std::vector<uint8_t>& file_data)
+{
+    if (file_data.size() < PCAP_FILE_HDR_SIZE) {
+        throw uhd::value_error("Capture file is too short to be a pcap file");
+    }
+    uint32_t magic;
+    std::memcpy(&magic, file_data.data(), sizeof(magic));
+    if (magic == PCAPNG_MAGIC) {
+        throw uhd::value_error("pcapng files are not supported. Convert the file to "
+                               "pcap, e.g., with 'editcap -F pcap'.");
+    }
+    const bool swap = magic == uhd::byteswap(PCAP_MAGIC_US)
+                      || magic == uhd::byteswap(PCAP_MAGIC_NS);
+    const pcap_field_reader read_field(swap);
+    magic = read_field(file_data.data());
+    if (magic != PCAP_MAGIC_US && magic != PCAP_MAGIC_NS) {
+        throw uhd::value_error("Capture file is not a pcap file");
+    }
+    const uint64_t ns_per_frac = magic == PCAP_MAGIC_NS ? 1 : 1000;
+    const uint32_t link_type   = read_field(file_data.data() + 20) & 0xFFFF;
+    if (link_type != LINKTYPE_ETHERNET && link_type != LINKTYPE_RAW
+        && link_type != LINKTYPE_LINUX_SLL && link_type != LINKTYPE_IPV4
+        && link_type != LINKTYPE_LINUX_SLL2) {
+        throw uhd::value_error(
+            "Unsupported link type in pcap file: " + std::to_string(link_type));
+    }
+
+    size_t offset = PCAP_FILE_HDR_SIZE;
+    while (offset + PCAP_RECORD_HDR_SIZE <= file_data.size()) {
+        const uint8_t* record = file_data.data() + offset;
+        const uint64_t time_ns = uint64_t(read_field(record)) * 1000000000
+                                 + read_field(record + 4) * ns_per_frac;
+        const size_t incl_len = read_field(record + 8);
+        const size_t orig_len = read_field(record + 12);
+        offset += PCAP_RECORD_HDR_SIZE;
+        if (offset + incl_len > file_data.size()) {
+            UHD_LOG_WARNING(LOG_ID, "pcap file ends within a packet");
+            break;
+        }
+        const uint8_t* frame = file_data.data() + offset;
+        offset += incl_len;
+        if (incl_len < orig_len) {
+            _num_skipped++;
+            continue;
+        }
+
+        const auto ip_offset = get_ipv4_offset(link_type, frame, incl_len);
+        if (!ip_offset || *ip_offset + IPV4_HDR_SIZE > incl_len) {
+            continue;
+        }
+        const uint8_t* ip       = frame + *ip_offset;
+        const size_t ip_hdr_len = (ip[0] & 0x0F) * 4;
+        if ((ip[0] >> 4) != 4 || ip[9] != IP_PROTO_UDP
+            || *ip_offset + ip_hdr_len + UDP_HDR_SIZE > incl_len) {
+            continue;
+        }
+        // More fragments flag or fragment offset
+        if (read_be<uint16_t>(ip + 6) & 0x3FFF) {
+            _num_skipped++;
+            continue;
+        }
+        const uint8_t* udp = ip + ip_hdr_len;
+        if (_filter.udp_src_port != 0
+            && read_be<uint16_t>(udp) != _filter.udp_src_port) {
+            continue;
+        }
+        const size_t udp_len = read_be<uint16_t>(udp + 4);
+        if (udp_len < UDP_HDR_SIZE || *ip_offset + ip_hdr_len + udp_len > incl_len) {
+            _num_skipped++;
+            continue;
+        }
+        _add_packet(udp + UDP_HDR_SIZE, udp_len - UDP_HDR_SIZE, time_ns);
+    }
+}
+
+void chdr_capture_reader::_read_raw(const std::vector<uint8_t>& file_data)
+{
+    size_t offset = 0;
+    while (offset < file_data.size()) {
+        if (offset + CHDR_HDR_SIZE > file_data.size()) {
+            throw uhd::value_error("Raw capture file ends within a CHDR header");
+        }
+        uint64_t header;
+        std::memcpy(&header, file_data.data() + offset, sizeof(header));
+        header = _endianness == uhd::ENDIANNESS_BIG ? uhd::ntohx(header)
+                                                    : uhd::wtohx(header);
+        const size_t length = uhd::rfnoc::chdr::chdr_header(header).get_length();
+        if (length < CHDR_HDR_SIZE || offset + length > file_data.size()) {
+            throw uhd::value_error("Invalid CHDR packet length in raw capture file at "
+                                   "offset "
+                                   + std::to_string(offset));
+        }
+        _add_packet(file_data.data() + offset, length, 0);
+        offset += length;
+    }
+}
+
+void chdr_capture_reader::_add_packet(
+    const uint8_t* data, const size_t size, const uint64_t time_ns)
+{
+    if (size < CHDR_HDR_SIZE) {
+        _num_skipped++;
+        return;
+    }
+    uint64_t flat_header;
+    std::memcpy(&flat_header, data, sizeof(flat_header));
+    const uhd::rfnoc::chdr::chdr_header header(_endianness == uhd::ENDIANNESS_BIG
+                                                   ? uhd::ntohx(flat_header)
+                                                   : uhd::wtohx(flat_header));
+    // UDP payloads may be padded, the CHDR length is the actual packet size
+    if (header.get_length() < CHDR_HDR_SIZE || header.get_length() > size) {
+        _num_skipped++;
+        return;
+    }
+    if (_filter.dst_epid && header.get_dst_epid() != *_filter.dst_epid) {
+        return;
+    }
+
+    const size_t packet_size = header.get_length();
+    if (_packets.empty()) {
+        _first_time_ns = time_ns;
+    }
+    _packets.push_back({_data.size(),
+        packet_size,
+        time_ns > _first_time_ns ? time_ns - _first_time_ns : 0});
+    _data.insert(_data.end(), data, data + packet_size);
+    _max_packet_size = std::max(_max_packet_size, packet_size);
+}
+
+/******************************************************************************
+ * chdr_capture_writer
+ *****************************************************************************/
+chdr_capture_writer::chdr_capture_writer(
+    const std::string& filename, const capture_format format)
+    : _format(format), _file(filename, std::ios::binary | std::ios::trunc)
+{
+    if (!_file) {
+        throw uhd::io_error("Cannot open capture file " + filename);
+    }
+    if (_format == capture_format::PCAP) {
+        const uint32_t magic     = PCAP_MAGIC_NS;
+        const uint16_t version[] = {2, 4};
+        // Time zone, timestamp accuracy, snap length, link type
+        const uint32_t fields[] = {0, 0, PCAP_SNAPLEN, LINKTYPE_ETHERNET};
+        _file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+        _file.write(reinterpret_cast<const char*>(version), sizeof(version));
+        _file.write(reinterpret_cast<const char*>(fields), sizeof(fields));
+    }
+    UHD_LOG_INFO(LOG_ID,
+        "Capturing CHDR packets to " << filename << " ("
+                                     << (_format == capture_format::PCAP ? "pcap" : "raw")
+                                     << " format)");
+}
+
+chdr_capture_writer::~chdr_capture_writer()
+{
+    flush();
+    UHD_LOG_DEBUG(LOG_ID, "Captured " << _num_packets << " packets");
+}
+
+chdr_capture_writer::sptr chdr_capture_writer::get(const std::string& filename)
+{
+    static std::mutex writers_mutex;
+    static std::map<std::string, std::weak_ptr<chdr_capture_writer>> writers;
+
+    std::lock_guard<std::mutex> lock(writers_mutex);
+    auto writer = writers[filename].lock();
+    if (!writer) {
+        writer = std::make_shared<chdr_capture_writer>(
+            filename, get_capture_format(filename));
+        writers[filename] = writer;
+    }
+    return writer;
+}
+
+void chdr_capture_writer::write(
+    const void* data, const size_t size, const endpoint_t& src, const endpoint_t& dst)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_format == capture_format::RAW) {
+        _file.write(static_cast<const char*>(data), size);
+        _num_packets++;
+        return;
+    }
+
+    if (size > UDP_MAX_PAYLOAD) {
+        throw uhd::value_error("CHDR packet is too large for a pcap capture");
+    }
+    const uint64_t time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                                 .count();
+    constexpr size_t HDR_SIZE = ETH_HDR_SIZE + IPV4_HDR_SIZE + UDP_HDR_SIZE;
+    const uint32_t frame_size = static_cast<uint32_t>(HDR_SIZE + size);
+    const uint32_t record[]   = {static_cast<uint32_t>(time_ns / 1000000000),
+        static_cast<uint32_t>(time_ns % 1000000000),
+        frame_size,
+        frame_size};
+    _file.write(reinterpret_cast<const char*>(record), sizeof(record));
+
+    // Ethernet: Both MAC addresses are zero
+    uint8_t hdr[HDR_SIZE] = {};
+    write_be<uint16_t>(hdr + 12, ETHERTYPE_IPV4);
+    uint8_t* ip = hdr + ETH_HDR_SIZE;
+    ip[0]       = 0x45; // IPv4, 20 byte header
+    write_be<uint16_t>(
+        ip + 2, static_cast<uint16_t>(IPV4_HDR_SIZE + UDP_HDR_SIZE + size));
+    write_be<uint16_t>(ip + 4, _ip_id++);
+    write_be<uint16_t>(ip + 6, 0x4000); // Don't fragment
+    ip[8] = 64; // TTL
+    ip[9] = IP_PROTO_UDP;
+    write_be<uint32_t>(ip + 12, src.ip);
+    write_be<uint32_t>(ip + 16, dst.ip);
+    write_be<uint16_t>(ip + 10, get_ipv4_checksum(ip));
+    // UDP: No checksum
+    uint8_t* udp = ip + IPV4_HDR_SIZE;
+    write_be<uint16_t>(udp, src.port);
+    write_be<uint16_t>(udp + 2, dst.port);
+    write_be<uint16_t>(udp + 4, static_cast<uint16_t>(UDP_HDR_SIZE + size));
+
+    _file.write(reinterpret_cast<const char*>(hdr), sizeof(hdr));
+    _file.write(static_cast<const char*>(data), size);
+    _num_packets++;
+}
+
+void chdr_capture_writer::flush()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _file.flush();
+}
+
+size_t chdr_capture_writer::get_num_packets() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _num_packets;
+}
+
+chdr_capture_writer::endpoint_t chdr_capture_writer::make_endpoint(
+    const std::string& ip_addr, const uint16_t port)
+{
+    boost::asio::error_code ec;
+    const auto addr = boost::asio::ip::make_address_v4(ip_addr, ec);
+    return {ec ? 0 : addr.to_uint(), port};
+}
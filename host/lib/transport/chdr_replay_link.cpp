@@ -0,0 +1,232 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/chdr_replay_link.hpp>
+#include <cstring>
+#include <map>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr char LOG_ID[] = "CHDR_REPLAY";
+
+//! Waits shorter than this are done by spinning, longer ones by sleeping
+constexpr std::chrono::microseconds MIN_SLEEP_TIME{200};
+
+class chdr_replay_adapter_info : public adapter_info
+{
+public:
+    chdr_replay_adapter_info() : _index(_next_index++) {}
+
+    std::string to_string() override
+    {
+        return "CHDR replay:" + std::to_string(_index);
+    }
+
+private:
+    static std::atomic<size_t> _next_index;
+    const size_t _index;
+};
+
+std::atomic<size_t> chdr_replay_adapter_info::_next_index{0};
+
+} // namespace
+
+/******************************************************************************
+ * chdr_replay_link
+ *****************************************************************************/
+chdr_replay_link::chdr_replay_link(chdr_capture_reader::sptr capture,
+    const params_t& params,
+    const size_t recv_frame_size)
+    : recv_link_base_t(params.num_recv_frames, recv_frame_size)
+    , send_link_base_t(params.num_send_frames, params.send_frame_size)
+    , _capture(capture)
+    , _params(params)
+    , _recv_memory_pool(buffer_pool::make(
+          params.num_recv_frames, recv_frame_size, 16, params.buff_mem_params))
+    , _send_memory_pool(buffer_pool::make(
+          params.num_send_frames, params.send_frame_size, 16, params.buff_mem_params))
+{
+    for (size_t i = 0; i < params.num_recv_frames; i++) {
+        _recv_buffs.push_back(chdr_replay_frame_buff(_recv_memory_pool->at(i)));
+    }
+    for (size_t i = 0; i < params.num_send_frames; i++) {
+        _send_buffs.push_back(chdr_replay_frame_buff(_send_memory_pool->at(i)));
+    }
+    for (auto& buff : _recv_buffs) {
+        recv_link_base_t::preload_free_buff(&buff);
+    }
+    for (auto& buff : _send_buffs) {
+        send_link_base_t::preload_free_buff(&buff);
+    }
+
+    // Every stream has its own sequence numbers, and must continue after its
+    // last packet on the next repetition
+    std::map<uint16_t, std::pair<uint16_t, uint16_t>> first_last_seq_nums;
+    for (size_t i = 0; i < _capture->size(); i++) {
+        const uhd::rfnoc::chdr::chdr_header header(_capture->get_header(i));
+        const uint16_t seq_num = header.get_seq_num();
+        auto it                = first_last_seq_nums.find(header.get_dst_epid());
+        if (it == first_last_seq_nums.end()) {
+            first_last_seq_nums[header.get_dst_epid()] = {seq_num, seq_num};
+        } else {
+            it->second.second = seq_num;
+        }
+    }
+    _seq_num_steps.resize(_capture->size());
+    for (size_t i = 0; i < _capture->size(); i++) {
+        const uhd::rfnoc::chdr::chdr_header header(_capture->get_header(i));
+        const auto& seq_nums = first_last_seq_nums.at(header.get_dst_epid());
+        _seq_num_steps[i] = static_cast<uint16_t>(seq_nums.second - seq_nums.first + 1);
+    }
+
+    // The gap between repetitions is the average gap between packets
+    if (_capture->size() > 1) {
+        const uint64_t last_time_ns = _capture->time_ns(_capture->size() - 1);
+        const uint64_t avg_gap_ns   = last_time_ns / (_capture->size() - 1);
+        _loop_duration = std::chrono::nanoseconds(last_time_ns + avg_gap_ns);
+    }
+
+    auto info   = chdr_replay_adapter_info();
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+}
+
+chdr_replay_link::sptr chdr_replay_link::make(
+    chdr_capture_reader::sptr capture, const params_t& params)
+{
+    UHD_ASSERT_THROW(capture);
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+    if (capture->size() == 0) {
+        throw uhd::value_error("Cannot replay a capture without CHDR packets");
+    }
+    if (params.pacing == pacing_t::LINK_RATE && params.link_rate <= 0.0) {
+        throw uhd::value_error("Replaying at link rate requires a link rate");
+    }
+    const size_t recv_frame_size =
+        params.recv_frame_size ? params.recv_frame_size : capture->get_max_packet_size();
+    if (recv_frame_size < capture->get_max_packet_size()) {
+        throw uhd::value_error("The capture contains packets of "
+                               + std::to_string(capture->get_max_packet_size())
+                               + " bytes, which don't fit into the receive frames");
+    }
+    UHD_LOG_DEBUG(LOG_ID,
+        "Replaying " << capture->size() << " packets "
+                     << (params.num_loops ? std::to_string(params.num_loops) : "infinite")
+                     << " times");
+
+    return sptr(new chdr_replay_link(capture, params, recv_frame_size));
+}
+
+size_t chdr_replay_link::get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    if (_next_packet == _capture->size()) {
+        if (_params.num_loops != 0 && _loop + 1 >= _params.num_loops) {
+            return 0;
+        }
+        _loop++;
+        _next_packet = 0;
+    }
+    if (!_wait_for_next(timeout_ms)) {
+        return 0;
+    }
+
+    const size_t size = _capture->packet_size(_next_packet);
+    std::memcpy(buff.data(), _capture->data(_next_packet), size);
+    if (_loop > 0) {
+        uhd::rfnoc::chdr::chdr_header header(_capture->get_header(_next_packet));
+        header.set_seq_num(static_cast<uint16_t>(
+            header.get_seq_num() + _loop * _seq_num_steps[_next_packet]));
+        const uint64_t flat_header = _capture->get_endianness() == uhd::ENDIANNESS_BIG
+                                         ? uhd::htonx(header.pack())
+                                         : uhd::htowx(header.pack());
+        std::memcpy(buff.data(), &flat_header, sizeof(flat_header));
+    }
+
+    _next_packet++;
+    _num_bytes += size;
+    _num_replayed.store(
+        _num_replayed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return size;
+}
+
+std::chrono::steady_clock::time_point chdr_replay_link::_get_due_time() const
+{
+    switch (_params.pacing) {
+        case pacing_t::CAPTURE_TIME:
+            return _start_time
+                   + _loop_duration * static_cast<int64_t>(_loop)
+                   + std::chrono::nanoseconds(_capture->time_ns(_next_packet));
+        case pacing_t::LINK_RATE:
+            return _start_time
+                   + std::chrono::nanoseconds(
+                       static_cast<int64_t>(_num_bytes / _params.link_rate * 1e9));
+        default:
+            return _start_time;
+    }
+}
+
+bool chdr_replay_link::_wait_for_next(int32_t timeout_ms)
+{
+    if (!_started) {
+        _start_time = std::chrono::steady_clock::now();
+        _started    = true;
+    }
+    if (_params.pacing == pacing_t::AS_FAST_AS_POSSIBLE) {
+        return true;
+    }
+
+    const auto due_time = _get_due_time();
+    const auto now      = std::chrono::steady_clock::now();
+    if (timeout_ms >= 0 && due_time > now + std::chrono::milliseconds(timeout_ms)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+        return false;
+    }
+    if (due_time - now > MIN_SLEEP_TIME) {
+        std::this_thread::sleep_until(due_time - MIN_SLEEP_TIME);
+    }
+    while (std::chrono::steady_clock::now() < due_time) {
+        // Spin
+    }
+    return true;
+}
+
+/******************************************************************************
+ * chdr_capture_link
+ *****************************************************************************/
+chdr_capture_link::chdr_capture_link(send_link_if::sptr send_link,
+    recv_link_if::sptr recv_link,
+    chdr_capture_writer::sptr writer,
+    const endpoint_t& device,
+    const endpoint_t& host)
+    : _send_link(send_link)
+    , _recv_link(recv_link)
+    , _writer(writer)
+    , _device(device)
+    , _host(host)
+{
+}
+
+chdr_capture_link::sptr chdr_capture_link::make(send_link_if::sptr send_link,
+    recv_link_if::sptr recv_link,
+    chdr_capture_writer::sptr writer,
+    const endpoint_t& device,
+    const endpoint_t& host)
+{
+    UHD_ASSERT_THROW(send_link);
+    UHD_ASSERT_THROW(recv_link);
+    UHD_ASSERT_THROW(writer);
+    return sptr(new chdr_capture_link(send_link, recv_link, writer, device, host));
+}
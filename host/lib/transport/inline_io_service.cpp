@@ -8,6 +8,7 @@
 #include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/utils/binary_log.hpp>
 #include <boost/circular_buffer.hpp>
 #include <cassert>
 
@@ -135,7 +136,7 @@ public:
                     }
                 }
                 if (not rcvr_found) {
-                    UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
+                    UHD_LOG_BIN_DEBUG("IO_SRV", "Dropping packet with no receiver");
                     recv_link->release_recv_buff(std::move(buff));
                 }
             } else { /* Timeout */
@@ -170,7 +171,7 @@ public:
                     }
                 }
                 if (not rcvr_found) {
-                    UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
+                    UHD_LOG_BIN_DEBUG("IO_SRV", "Dropping packet with no receiver");
                     recv_link->release_recv_buff(std::move(buff));
                 }
             } else { /* Timeout */
@@ -217,11 +218,16 @@ public:
 
     frame_buff::uptr get_recv_buff(int32_t timeout_ms) override
     {
+        const auto start = _telemetry_switch.on() ? telemetry_clock::now()
+                                                  : telemetry_clock::time_point();
         auto buff = _io_srv->recv(this, _data_link.get(), timeout_ms);
         if (buff) {
             _num_frames_in_use++;
             assert(_num_frames_in_use <= _num_recv_frames);
         }
+        if (_telemetry_switch.on()) {
+            _telemetry.add_buff(bool(buff), start);
+        }
         return buff;
     }
 
@@ -279,20 +285,41 @@ public:
             return true;
         }
 
+        // Only stalls on flow control are recorded, so the fast path stays
+        // free of clock reads
+        bool stalled = false;
+        telemetry_clock::time_point stall_start;
         while (!_fc_cb(num_bytes)) {
+            if (_telemetry_switch.on() && !stalled) {
+                stalled     = true;
+                stall_start = telemetry_clock::now();
+                _telemetry.fc_stalls.add();
+            }
+
             const bool updated =
                 _io_srv->recv_flow_ctrl(this, _recv_link.get(), timeout_ms);
 
             if (!updated) {
+                if (stalled) {
+                    _telemetry.fc_wait.add_since(stall_start);
+                }
                 return false;
             }
         }
+        if (stalled) {
+            _telemetry.fc_wait.add_since(stall_start);
+        }
         return true;
     }
 
     frame_buff::uptr get_send_buff(int32_t timeout_ms) override
     {
+        const auto start = _telemetry_switch.on() ? telemetry_clock::now()
+                                                  : telemetry_clock::time_point();
         frame_buff::uptr buff = _send_link->get_send_buff(timeout_ms);
+        if (_telemetry_switch.on()) {
+            _telemetry.add_buff(bool(buff), start);
+        }
         if (buff) {
             _num_frames_in_use++;
             assert(_num_frames_in_use <= _num_send_frames);
@@ -483,7 +510,7 @@ frame_buff::uptr inline_io_service::recv(
                 }
                 /* Retry receive if got buffer but it got consumed */
             } else {
-                UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
+                UHD_LOG_BIN_DEBUG("IO_SRV", "Dropping packet with no receiver");
                 recv_link->release_recv_buff(std::move(buff));
             }
         } else { /* Timeout */
@@ -514,7 +541,7 @@ bool inline_io_service::recv_flow_ctrl(
                 assert(!buff);
                 return true;
             } else {
-                UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
+                UHD_LOG_BIN_DEBUG("IO_SRV", "Dropping packet with no receiver");
                 recv_link->release_recv_buff(std::move(buff));
             }
         } else { /* Timeout */
@@ -6,19 +6,24 @@
 
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
 #include <uhd/utils/thread.hpp>
 #include <uhdlib/transport/frame_reservation_mgr.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <uhdlib/transport/offload_io_service_client.hpp>
-#include <uhdlib/utils/semaphore.hpp>
+#include <uhdlib/utils/spsc_queue.hpp>
 #include <condition_variable>
 #include <boost/lockfree/queue.hpp>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <iomanip>
 #include <list>
 #include <memory>
+#include <sstream>
 #include <thread>
+#include <vector>
 
 namespace uhd { namespace transport {
 
@@ -26,74 +31,16 @@ namespace {
 
 constexpr int32_t blocking_timeout_ms = 10;
 
-// Fixed-size queue that supports blocking semantics
-template <typename queue_item_t>
-class offload_thread_queue
-{
-public:
-    offload_thread_queue(size_t size) : _buffer(new queue_item_t[size]), _capacity(size)
-    {
-    }
-
-    ~offload_thread_queue()
-    {
-        delete[] _buffer;
-    }
-
-    void push(const queue_item_t& item)
-    {
-        _buffer[_write_index++] = item;
-        _write_index %= _capacity;
-        _item_sem.notify();
-    }
-
-    bool peek(queue_item_t& item)
-    {
-        if (_item_sem.count()) {
-            item = _buffer[_read_index];
-            return true;
-        } else {
-            return false;
-        }
-    }
+constexpr char LOG_ID[] = "OFFLOAD_IO";
 
-    bool pop(queue_item_t& item)
-    {
-        if (_item_sem.try_wait()) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
-            return false;
-        }
-    }
-
-    bool pop(queue_item_t& item, int32_t timeout_ms)
-    {
-        if (_item_sem.wait_for(timeout_ms)) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
-            return false;
-        }
-    }
-
-    size_t read_available()
-    {
-        return _item_sem.count();
-    }
-
-private:
-    queue_item_t* _buffer;
-    const size_t _capacity;
-
-    size_t _read_index  = 0;
-    size_t _write_index = 0;
-
-    // Semaphore gating number of items available to read
-    semaphore _item_sem;
-};
+// Add to a counter that is written by a single thread and read by others. This
+// avoids the cost of an atomic read-modify-write.
+template <typename value_t>
+void add_to_counter(std::atomic<value_t>& counter, const value_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+        std::memory_order_relaxed);
+}
 
 // Object that implements the communication between client and offload thread
 struct client_port_impl_t
@@ -214,7 +161,7 @@ private:
         frame_buff* buff = nullptr;
     };
 
-    using from_offload_thread_queue_t = offload_thread_queue<from_offload_thread_t>;
+    using from_offload_thread_queue_t = spsc_queue<from_offload_thread_t>;
 
     // Queue for frame buffers and disconnect requests to offload thread. Disconnect
     // requests must be inline with incoming buffers to avoid any race conditions
@@ -225,7 +172,7 @@ private:
         bool disconnect  = false;
     };
 
-    using to_offload_thread_queue_t = offload_thread_queue<to_offload_thread_t>;
+    using to_offload_thread_queue_t = spsc_queue<to_offload_thread_t>;
 
     // Queues to carry frame buffers in both directions
     from_offload_thread_queue_t _from_offload_thread;
@@ -247,6 +194,12 @@ private:
 // Requests to create new clients are handled using a separate mpsc queue. Client
 // requests to disconnect are sent in the same spsc queue as the buffers so that
 // they are processed only after all buffer release requestss have been processed.
+//
+// With more than one offload thread, clients that share a link are put in the
+// same group, and every group is serviced by exactly one thread, so links are
+// never accessed concurrently. Thread 0 coordinates the others: To connect or
+// disconnect clients, or to move groups from busy threads to idle ones, it
+// pauses all other threads, modifies the groups, and resumes them.
 class offload_io_service_impl
     : public offload_io_service,
       public std::enable_shared_from_this<offload_io_service_impl>
@@ -280,6 +233,8 @@ public:
         recv_callback_t recv_cb,
         send_io_if::fc_callback_t fc_cb) override;
 
+    std::vector<thread_stats_t> get_thread_stats() const override;
+
 private:
     offload_io_service_impl(const offload_io_service_impl&) = delete;
 
@@ -301,6 +256,9 @@ private:
         recv_io_if::sptr inline_io;
         size_t num_frames_in_use = 0;
         frame_reservation_t frames_reserved;
+        // Set when the client requested to disconnect, but the request has
+        // not been processed by the coordinating thread yet
+        bool disconnect_pending = false;
     };
     struct send_client_info_t
     {
@@ -308,11 +266,35 @@ private:
         send_io_if::sptr inline_io;
         size_t num_frames_in_use = 0;
         frame_reservation_t frames_reserved;
+        bool disconnect_pending = false;
+    };
+
+    // Clients that share links, and the thread that services them. Only the
+    // servicing thread writes the load counter, while other threads are
+    // running.
+    struct client_group_t
+    {
+        std::list<recv_client_info_t> recv_clients;
+        std::list<send_client_info_t> send_clients;
+        std::vector<const void*> links;
+        size_t thread_index = 0;
+        std::atomic<uint64_t> load{0};
+        uint64_t load_at_rebalance = 0;
+    };
+
+    // Utilization counters of an offload thread, only written by that thread
+    struct alignas(64) thread_counters_t
+    {
+        std::atomic<uint64_t> busy_ns{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> num_buffs{0};
+        std::atomic<uint64_t> num_migrations{0};
+        std::atomic<size_t> num_client_groups{0};
     };
 
     void _queue_client_req(std::function<void()> fn);
-    void _get_recv_buff(recv_client_info_t& info, int32_t timeout_ms);
-    void _get_send_buff(send_client_info_t& info);
+    bool _get_recv_buff(recv_client_info_t& info, int32_t timeout_ms);
+    bool _get_send_buff(send_client_info_t& info);
     void _release_recv_buff(recv_client_info_t& info, frame_buff* buff);
     void _release_send_buff(send_client_info_t& info, frame_buff* buff);
     void _disconnect_recv_client(recv_client_info_t& info);
@@ -324,14 +306,42 @@ private:
     template <bool allow_recv, bool allow_send>
     void _do_work_blocking();
 
+    template <bool allow_recv, bool allow_send>
+    void _do_work_balanced(const size_t thread_index);
+
+    template <bool allow_recv, bool allow_send>
+    size_t _poll_client_group(client_group_t& group);
+
+    bool _coordinate(bool rebalance);
+    void _log_thread_stats();
+    bool _pause_threads();
+    void _resume_threads();
+    void _disconnect_pending_clients();
+    void _group_new_clients();
+    size_t _plan_migrations(std::vector<std::pair<client_group_t*, size_t>>& moves);
+    void _update_thread_groups();
+
     // The I/O service that executes within the offload thread
     io_service::sptr _io_srv;
 
-    // Offload thread, its stop flag, and thread-related parameters
-    std::unique_ptr<std::thread> _offload_thread;
+    // Offload threads, their stop flag, and thread-related parameters
+    std::vector<std::thread> _offload_threads;
     std::atomic<bool> _stop_offload_thread{false};
     offload_io_service::params_t _offload_thread_params;
 
+    // State of the offload threads if there is more than one. The groups are
+    // only modified by thread 0 while all other threads are paused.
+    std::list<client_group_t> _client_groups;
+    std::vector<std::vector<client_group_t*>> _thread_groups;
+    std::unique_ptr<thread_counters_t[]> _thread_counters;
+    std::atomic<bool> _pause_requested{false};
+    std::atomic<size_t> _num_paused{0};
+    std::atomic<size_t> _num_pending_disconnects{0};
+    // Counters at the time of the last utilization log, and when the next one
+    // is due. Only used by thread 0.
+    std::vector<thread_stats_t> _logged_stats;
+    std::chrono::steady_clock::time_point _next_stats_log;
+
     // Lists of clients and their respective queues
     std::list<recv_client_info_t> _recv_clients;
     std::list<send_client_info_t> _send_clients;
@@ -367,6 +377,39 @@ offload_io_service_impl::offload_io_service_impl(
             "send or recv clients to prevent one client type from starving "
             "the other");
     }
+    if (params.num_threads == 0) {
+        throw uhd::value_error("An offload I/O service requires at least one thread");
+    }
+
+    if (params.num_threads > 1) {
+        if (params.wait_mode != POLL) {
+            throw uhd::value_error(
+                "An offload I/O service with multiple threads must be configured "
+                "to poll");
+        }
+
+        std::function<void(size_t)> thread_fn;
+        if (params.client_type == RECV_ONLY) {
+            thread_fn = [this](size_t i) { _do_work_balanced<true, false>(i); };
+        } else if (params.client_type == SEND_ONLY) {
+            thread_fn = [this](size_t i) { _do_work_balanced<false, true>(i); };
+        } else if (params.client_type == BOTH_SEND_AND_RECV) {
+            thread_fn = [this](size_t i) { _do_work_balanced<true, true>(i); };
+        } else {
+            UHD_THROW_INVALID_CODE_PATH();
+        }
+
+        _thread_groups.resize(params.num_threads);
+        _thread_counters = std::make_unique<thread_counters_t[]>(params.num_threads);
+        _logged_stats.resize(params.num_threads);
+        _offload_threads.reserve(params.num_threads);
+        for (size_t i = 0; i < params.num_threads; i++) {
+            _offload_threads.emplace_back(thread_fn, i);
+            uhd::set_thread_name(
+                &_offload_threads.back(), "uhd_offload_" + std::to_string(i));
+        }
+        return;
+    }
 
     std::function<void()> thread_fn;
 
@@ -392,19 +435,20 @@ offload_io_service_impl::offload_io_service_impl(
         UHD_THROW_INVALID_CODE_PATH();
     }
 
-    _offload_thread = std::make_unique<std::thread>(thread_fn);
+    _offload_threads.emplace_back(thread_fn);
 }
 
 offload_io_service_impl::~offload_io_service_impl()
 {
     _stop_offload_thread = true;
 
-    if (_offload_thread) {
-        _offload_thread->join();
+    for (auto& thread : _offload_threads) {
+        thread.join();
     }
 
     assert(_recv_clients.empty());
     assert(_send_clients.empty());
+    assert(_client_groups.empty());
 }
 
 void offload_io_service_impl::attach_recv_link(recv_link_if::sptr link)
@@ -463,7 +507,7 @@ recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr re
     size_t num_send_frames,
     recv_io_if::fc_callback_t fc_cb)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(!_offload_threads.empty());
 
     if (_offload_thread_params.client_type == SEND_ONLY) {
         throw uhd::runtime_error("Recv client not supported by this I/O service");
@@ -513,7 +557,7 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     recv_callback_t recv_cb,
     send_io_if::fc_callback_t fc_cb)
 {
-    UHD_ASSERT_THROW(_offload_thread);
+    UHD_ASSERT_THROW(!_offload_threads.empty());
 
     if (_offload_thread_params.client_type == RECV_ONLY) {
         throw uhd::runtime_error("Send client not supported by this I/O service");
@@ -572,6 +616,27 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
     }
 }
 
+std::vector<offload_io_service::thread_stats_t>
+offload_io_service_impl::get_thread_stats() const
+{
+    std::vector<thread_stats_t> stats;
+    if (!_thread_counters) {
+        return stats;
+    }
+
+    for (size_t i = 0; i < _offload_threads.size(); i++) {
+        const auto& counters = _thread_counters[i];
+        thread_stats_t thread_stats;
+        thread_stats.busy_time         = std::chrono::nanoseconds(counters.busy_ns);
+        thread_stats.total_time        = std::chrono::nanoseconds(counters.total_ns);
+        thread_stats.num_buffs         = counters.num_buffs;
+        thread_stats.num_migrations    = counters.num_migrations;
+        thread_stats.num_client_groups = counters.num_client_groups;
+        stats.push_back(thread_stats);
+    }
+    return stats;
+}
+
 void offload_io_service_impl::_queue_client_req(std::function<void()> fn)
 {
     client_req_t queue_element;
@@ -583,25 +648,29 @@ void offload_io_service_impl::_queue_client_req(std::function<void()> fn)
 }
 
 // Get a single receive buffer if available and update client info
-void offload_io_service_impl::_get_recv_buff(recv_client_info_t& info, int32_t timeout_ms)
+bool offload_io_service_impl::_get_recv_buff(recv_client_info_t& info, int32_t timeout_ms)
 {
     if (info.num_frames_in_use < info.frames_reserved.num_recv_frames) {
         if (frame_buff::uptr buff = info.inline_io->get_recv_buff(timeout_ms)) {
             info.port->offload_thread_push(buff.release());
             info.num_frames_in_use++;
+            return true;
         }
     }
+    return false;
 }
 
 // Get a single send buffer if available and update client info
-void offload_io_service_impl::_get_send_buff(send_client_info_t& info)
+bool offload_io_service_impl::_get_send_buff(send_client_info_t& info)
 {
     if (info.num_frames_in_use < info.frames_reserved.num_send_frames) {
         if (frame_buff::uptr buff = info.inline_io->get_send_buff(0)) {
             info.port->offload_thread_push(buff.release());
             info.num_frames_in_use++;
+            return true;
         }
     }
+    return false;
 }
 
 // Release a single recv buffer and update client info
@@ -794,4 +863,421 @@ void offload_io_service_impl::_do_work_blocking()
     }
 }
 
+// Poll the clients of a group once, in multi-threaded mode. Disconnect requests
+// are left for thread 0 to process. Returns the number of buffers passed
+// between the links and the clients.
+template <bool allow_recv, bool allow_send>
+size_t offload_io_service_impl::_poll_client_group(client_group_t& group)
+{
+    size_t num_buffs = 0;
+
+    if (allow_recv) {
+        for (auto& info : group.recv_clients) {
+            if (info.disconnect_pending) {
+                continue;
+            }
+            num_buffs += _get_recv_buff(info, 0);
+
+            frame_buff* buff;
+            bool disconnect;
+            std::tie(buff, disconnect) = info.port->offload_thread_pop();
+            if (buff) {
+                _release_recv_buff(info, buff);
+                num_buffs++;
+            } else if (disconnect) {
+                info.disconnect_pending = true;
+                _num_pending_disconnects.fetch_add(1, std::memory_order_release);
+            }
+        }
+    }
+
+    if (allow_send) {
+        for (auto& info : group.send_clients) {
+            if (info.disconnect_pending) {
+                continue;
+            }
+            num_buffs += _get_send_buff(info);
+
+            frame_buff* buff;
+            bool disconnect;
+            std::tie(buff, disconnect) = info.port->offload_thread_peek();
+            if (buff) {
+                if (info.inline_io->wait_for_dest_ready(buff->packet_size(), 0)) {
+                    _release_send_buff(info, buff);
+                    info.port->offload_thread_pop();
+                    num_buffs++;
+                }
+            } else if (disconnect) {
+                info.port->offload_thread_pop();
+                info.disconnect_pending = true;
+                _num_pending_disconnects.fetch_add(1, std::memory_order_release);
+            }
+        }
+    }
+
+    return num_buffs;
+}
+
+template <bool allow_recv, bool allow_send>
+void offload_io_service_impl::_do_work_balanced(const size_t thread_index)
+{
+    using namespace std::chrono;
+
+    const auto& cpu_map = _offload_thread_params.thread_cpu_affinity;
+    if (cpu_map.count(thread_index) != 0) {
+        uhd::set_thread_affinity(cpu_map.at(thread_index));
+    }
+
+    thread_counters_t& counters = _thread_counters[thread_index];
+    const auto start_time       = steady_clock::now();
+    auto next_rebalance         = start_time + _offload_thread_params.rebalance_interval;
+    if (thread_index == 0) {
+        _next_stats_log = start_time + _offload_thread_params.stats_log_interval;
+    }
+
+    while (!_stop_offload_thread) {
+        if (thread_index == 0) {
+            const auto now       = steady_clock::now();
+            const bool rebalance = now >= next_rebalance;
+            if (rebalance) {
+                next_rebalance = now + _offload_thread_params.rebalance_interval;
+            }
+            if (!_coordinate(rebalance)) {
+                break;
+            }
+        } else if (_pause_requested.load(std::memory_order_acquire)) {
+            _num_paused.fetch_add(1, std::memory_order_acq_rel);
+            while (_pause_requested.load(std::memory_order_acquire)
+                   && !_stop_offload_thread) {
+                std::this_thread::yield();
+            }
+            _num_paused.fetch_sub(1, std::memory_order_acq_rel);
+            continue;
+        }
+
+        const auto pass_start = steady_clock::now();
+        size_t num_buffs      = 0;
+        for (client_group_t* group : _thread_groups[thread_index]) {
+            const size_t group_buffs = _poll_client_group<allow_recv, allow_send>(*group);
+            if (group_buffs) {
+                add_to_counter<uint64_t>(group->load, group_buffs);
+                num_buffs += group_buffs;
+            }
+        }
+        const auto pass_end = steady_clock::now();
+
+        if (num_buffs) {
+            add_to_counter<uint64_t>(counters.busy_ns,
+                duration_cast<nanoseconds>(pass_end - pass_start).count());
+            add_to_counter<uint64_t>(counters.num_buffs, num_buffs);
+        }
+        counters.total_ns.store(duration_cast<nanoseconds>(pass_end - start_time).count(),
+            std::memory_order_relaxed);
+    }
+}
+
+// Connect and disconnect clients, and move client groups between threads if
+// needed. Runs in thread 0 between polling passes. Returns false if the I/O
+// service is being destroyed.
+bool offload_io_service_impl::_coordinate(const bool rebalance)
+{
+    client_req_t client_req;
+    const bool have_req = _client_connect_queue.pop(client_req);
+
+    if (have_req || _num_pending_disconnects.load(std::memory_order_acquire) != 0) {
+        if (!_pause_threads()) {
+            if (have_req) {
+                delete client_req.req;
+            }
+            return false;
+        }
+
+        _disconnect_pending_clients();
+        if (have_req) {
+            do {
+                (*client_req.req)();
+                delete client_req.req;
+            } while (_client_connect_queue.pop(client_req));
+            _group_new_clients();
+        }
+        _update_thread_groups();
+        _resume_threads();
+        return true;
+    }
+
+    if (!rebalance) {
+        return true;
+    }
+    _log_thread_stats();
+
+    // The loads can be read while the other threads are running, so only
+    // pause them if a group has to move
+    std::vector<std::pair<client_group_t*, size_t>> moves;
+    _plan_migrations(moves);
+    if (moves.empty()) {
+        return true;
+    }
+    if (!_pause_threads()) {
+        return false;
+    }
+    for (const auto& move : moves) {
+        client_group_t* group = move.first;
+        UHD_LOG_DEBUG(LOG_ID,
+            "Moving " << (group->recv_clients.size() + group->send_clients.size())
+                      << " clients from offload thread " << group->thread_index
+                      << " to offload thread " << move.second);
+        group->thread_index = move.second;
+        add_to_counter<uint64_t>(_thread_counters[move.second].num_migrations, 1);
+    }
+    _update_thread_groups();
+    _resume_threads();
+    return true;
+}
+
+// Log the utilization of each thread since the last log, if it's due
+void offload_io_service_impl::_log_thread_stats()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now < _next_stats_log) {
+        return;
+    }
+    _next_stats_log = now + _offload_thread_params.stats_log_interval;
+
+    const auto stats = get_thread_stats();
+    std::ostringstream msg;
+    msg << "Offload thread utilization:";
+    for (size_t i = 0; i < stats.size(); i++) {
+        const auto busy  = stats[i].busy_time - _logged_stats[i].busy_time;
+        const auto total = stats[i].total_time - _logged_stats[i].total_time;
+        const double utilization =
+            total.count() > 0 ? 100.0 * busy.count() / total.count() : 0.0;
+        msg << " [" << i << "] " << std::fixed << std::setprecision(1) << utilization
+            << "% (" << stats[i].num_client_groups << " groups, "
+            << stats[i].num_migrations - _logged_stats[i].num_migrations
+            << " migrations)";
+    }
+    UHD_LOG_DEBUG(LOG_ID, msg.str());
+    _logged_stats = stats;
+}
+
+// Wait for all threads except thread 0 to pause. Returns false if the I/O
+// service is being destroyed.
+bool offload_io_service_impl::_pause_threads()
+{
+    _pause_requested.store(true);
+    while (_num_paused.load(std::memory_order_acquire) != _offload_threads.size() - 1) {
+        if (_stop_offload_thread) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+void offload_io_service_impl::_resume_threads()
+{
+    _pause_requested.store(false, std::memory_order_release);
+
+    // Wait for all threads to resume, so none of them counts as paused twice
+    while (_num_paused.load(std::memory_order_acquire) != 0 && !_stop_offload_thread) {
+        std::this_thread::yield();
+    }
+}
+
+// Disconnect the clients whose requests were seen by the polling threads,
+// and remove groups that have no clients left
+void offload_io_service_impl::_disconnect_pending_clients()
+{
+    size_t num_disconnects = 0;
+    for (auto group = _client_groups.begin(); group != _client_groups.end();) {
+        for (auto it = group->recv_clients.begin(); it != group->recv_clients.end();) {
+            if (it->disconnect_pending) {
+                _disconnect_recv_client(*it);
+                it = group->recv_clients.erase(it);
+                num_disconnects++;
+            } else {
+                ++it;
+            }
+        }
+        for (auto it = group->send_clients.begin(); it != group->send_clients.end();) {
+            if (it->disconnect_pending) {
+                _disconnect_send_client(*it);
+                it = group->send_clients.erase(it);
+                num_disconnects++;
+            } else {
+                ++it;
+            }
+        }
+
+        if (group->recv_clients.empty() && group->send_clients.empty()) {
+            group = _client_groups.erase(group);
+        } else {
+            ++group;
+        }
+    }
+    _num_pending_disconnects.fetch_sub(num_disconnects, std::memory_order_relaxed);
+}
+
+// Move newly connected clients into the group of the clients they share links
+// with. Groups that are joined by a new client are merged. Clients that don't
+// share links with any group start a new one on the least loaded thread.
+void offload_io_service_impl::_group_new_clients()
+{
+    auto get_group = [this](const frame_reservation_t& frames) -> client_group_t& {
+        std::vector<const void*> links;
+        if (frames.recv_link) {
+            links.push_back(frames.recv_link.get());
+        }
+        if (frames.send_link) {
+            links.push_back(frames.send_link.get());
+        }
+        auto shares_link = [&links](const client_group_t& group) {
+            return std::any_of(links.begin(), links.end(), [&group](const void* link) {
+                return std::find(group.links.begin(), group.links.end(), link)
+                       != group.links.end();
+            });
+        };
+
+        client_group_t* target = nullptr;
+        for (auto it = _client_groups.begin(); it != _client_groups.end();) {
+            if (!shares_link(*it)) {
+                ++it;
+            } else if (!target) {
+                target = &*it;
+                ++it;
+            } else {
+                target->recv_clients.splice(target->recv_clients.end(), it->recv_clients);
+                target->send_clients.splice(target->send_clients.end(), it->send_clients);
+                target->links.insert(
+                    target->links.end(), it->links.begin(), it->links.end());
+                target->load.store(target->load + it->load);
+                target->load_at_rebalance += it->load_at_rebalance;
+                it = _client_groups.erase(it);
+            }
+        }
+
+        if (!target) {
+            // Pick the thread with the lowest load, then the fewest groups
+            const size_t num_threads = _offload_threads.size();
+            std::vector<std::pair<uint64_t, size_t>> thread_load(num_threads);
+            for (const auto& group : _client_groups) {
+                thread_load[group.thread_index].first +=
+                    group.load - group.load_at_rebalance;
+                thread_load[group.thread_index].second++;
+            }
+            _client_groups.emplace_back();
+            target               = &_client_groups.back();
+            target->thread_index = std::distance(thread_load.begin(),
+                std::min_element(thread_load.begin(), thread_load.end()));
+        }
+
+        for (const void* link : links) {
+            if (std::find(target->links.begin(), target->links.end(), link)
+                == target->links.end()) {
+                target->links.push_back(link);
+            }
+        }
+        return *target;
+    };
+
+    while (!_recv_clients.empty()) {
+        auto& group = get_group(_recv_clients.front().frames_reserved);
+        group.recv_clients.splice(
+            group.recv_clients.end(), _recv_clients, _recv_clients.begin());
+    }
+    while (!_send_clients.empty()) {
+        auto& group = get_group(_send_clients.front().frames_reserved);
+        group.send_clients.splice(
+            group.send_clients.end(), _send_clients, _send_clients.begin());
+    }
+}
+
+// Plan moving client groups from the busiest threads to the least busy ones,
+// based on the number of buffers each group passed since the last call. Each
+// move has to lower the load of the busiest thread by at least 10%, so groups
+// don't bounce between threads with similar loads. Returns the number of
+// planned moves.
+size_t offload_io_service_impl::_plan_migrations(
+    std::vector<std::pair<client_group_t*, size_t>>& moves)
+{
+    struct group_load_t
+    {
+        client_group_t* group;
+        uint64_t load;
+        size_t thread_index;
+    };
+
+    std::vector<uint64_t> thread_load(_offload_threads.size(), 0);
+    std::vector<group_load_t> group_loads;
+    for (auto& group : _client_groups) {
+        const uint64_t load     = group.load.load(std::memory_order_relaxed);
+        const uint64_t delta    = load - group.load_at_rebalance;
+        group.load_at_rebalance = load;
+        thread_load[group.thread_index] += delta;
+        group_loads.push_back({&group, delta, group.thread_index});
+    }
+
+    for (size_t i = 0; i < group_loads.size(); i++) {
+        const auto minmax = std::minmax_element(thread_load.begin(), thread_load.end());
+        const size_t min_thread = std::distance(thread_load.begin(), minmax.first);
+        const size_t max_thread = std::distance(thread_load.begin(), minmax.second);
+        const uint64_t min_load = *minmax.first;
+        const uint64_t max_load = *minmax.second;
+        const uint64_t diff     = max_load - min_load;
+
+        // The best group to move brings both threads closest to half of the
+        // difference
+        group_load_t* best = nullptr;
+        uint64_t best_distance = 0;
+        for (auto& group_load : group_loads) {
+            if (group_load.thread_index != max_thread || group_load.load == 0
+                || group_load.load >= diff) {
+                continue;
+            }
+            const uint64_t distance = 2 * group_load.load > diff
+                                          ? 2 * group_load.load - diff
+                                          : diff - 2 * group_load.load;
+            if (!best || distance < best_distance) {
+                best          = &group_load;
+                best_distance = distance;
+            }
+        }
+        if (!best) {
+            break;
+        }
+
+        const uint64_t new_max_load =
+            std::max(max_load - best->load, min_load + best->load);
+        if ((max_load - new_max_load) * 10 < max_load) {
+            break;
+        }
+        thread_load[max_thread] -= best->load;
+        thread_load[min_thread] += best->load;
+        best->thread_index = min_thread;
+    }
+
+    for (const auto& group_load : group_loads) {
+        if (group_load.thread_index != group_load.group->thread_index) {
+            moves.emplace_back(group_load.group, group_load.thread_index);
+        }
+    }
+    return moves.size();
+}
+
+// Update the lists of groups each thread services. Must be called while the
+// other threads are paused.
+void offload_io_service_impl::_update_thread_groups()
+{
+    for (auto& groups : _thread_groups) {
+        groups.clear();
+    }
+    for (auto& group : _client_groups) {
+        _thread_groups[group.thread_index].push_back(&group);
+    }
+    for (size_t i = 0; i < _thread_groups.size(); i++) {
+        _thread_counters[i].num_client_groups.store(
+            _thread_groups[i].size(), std::memory_order_relaxed);
+    }
+}
+
 }} // namespace uhd::transport
@@ -0,0 +1,203 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/cast.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/thread.hpp>
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr double DEFAULT_DUMP_INTERVAL = 1.0; // seconds
+constexpr double MIN_DUMP_INTERVAL     = 1e-3; // seconds
+
+//! Get a setting from the args, or from the environment if it's not in the args
+std::string get_setting(
+    const uhd::device_addr_t& args, const std::string& key, const char* env_var)
+{
+    if (args.has_key(key)) {
+        return args[key];
+    }
+    const char* env_value = std::getenv(env_var);
+    return env_value ? env_value : "";
+}
+
+/*! Get the dump interval in seconds from the args or the environment
+ *
+ * Falls back to the default for invalid values, because telemetry must not stop
+ * anyone from streaming. Intervals below the resolution of the writer thread
+ * would make it spin.
+ */
+double get_interval(const uhd::device_addr_t& args)
+{
+    const std::string interval_str =
+        get_setting(args, "telemetry_interval", "UHD_STREAM_TELEMETRY_INTERVAL");
+    if (interval_str.empty()) {
+        return DEFAULT_DUMP_INTERVAL;
+    }
+    double interval = 0.0;
+    try {
+        interval = uhd::cast::from_str<double>(interval_str);
+    } catch (const uhd::runtime_error&) {
+        // Reported below, like any other invalid value
+    }
+    if (!std::isfinite(interval) || interval < MIN_DUMP_INTERVAL) {
+        UHD_LOG_ERROR("STREAM_TELEMETRY",
+            "Invalid telemetry interval `" << interval_str << "', using "
+                                            << DEFAULT_DUMP_INTERVAL << " s");
+        return DEFAULT_DUMP_INTERVAL;
+    }
+    return interval;
+}
+
+/*! A telemetry dump file and its writer thread
+ *
+ * Sources are only called with the mutex held, so once a source is removed,
+ * its info function is never called again.
+ */
+class dump_file
+{
+public:
+    using sptr = std::shared_ptr<dump_file>;
+
+    dump_file(const std::string& path, const double interval)
+        : _interval(std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::duration<double>(interval)))
+        , _out(path, std::ios::app)
+    {
+        if (!_out) {
+            throw uhd::io_error("Cannot open telemetry file " + path);
+        }
+        _thread = std::thread([this]() { _run(); });
+        uhd::set_thread_name(&_thread, "uhd_telemetry");
+    }
+
+    ~dump_file()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cond.notify_one();
+        _thread.join();
+    }
+
+    size_t add_source(const std::string& name, telemetry_dumper::info_fn_t info_fn)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _sources.emplace(_next_id, std::make_pair(name, std::move(info_fn)));
+        return _next_id++;
+    }
+
+    //! Remove a source, after writing its final values
+    void remove_source(const size_t id)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto source = _sources.find(id);
+        if (source != _sources.end()) {
+            _write_line(source->second.first, source->second.second());
+            _out.flush();
+            _sources.erase(source);
+        }
+    }
+
+private:
+    void _run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_stop) {
+            _cond.wait_for(lock, _interval, [this]() { return _stop; });
+            for (const auto& source : _sources) {
+                _write_line(source.second.first, source.second.second());
+            }
+            _out.flush();
+        }
+    }
+
+    void _write_line(const std::string& name, const uhd::device_addr_t& info)
+    {
+        const std::chrono::duration<double> now =
+            std::chrono::system_clock::now().time_since_epoch();
+        _out << std::fixed << std::setprecision(6) << now.count() << " " << name << " "
+             << info.to_string() << "\n";
+    }
+
+    const std::chrono::milliseconds _interval;
+    std::ofstream _out;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _stop      = false;
+    size_t _next_id = 0;
+    std::map<size_t, std::pair<std::string, telemetry_dumper::info_fn_t>> _sources;
+    std::thread _thread;
+};
+
+class registration_impl : public telemetry_dumper::registration
+{
+public:
+    registration_impl(dump_file::sptr file, const size_t id)
+        : _file(std::move(file)), _id(id)
+    {
+    }
+
+    ~registration_impl() override
+    {
+        _file->remove_source(_id);
+    }
+
+private:
+    dump_file::sptr _file;
+    const size_t _id;
+};
+
+//! All open dump files, by path. Sources with the same path share a file.
+std::mutex dump_files_mutex;
+std::map<std::string, std::weak_ptr<dump_file>> dump_files;
+
+} // namespace
+
+telemetry_dumper::registration::uptr telemetry_dumper::register_source(
+    const uhd::device_addr_t& args, const std::string& name, info_fn_t info_fn)
+{
+    if (!get_telemetry_switch(args).on()) {
+        return nullptr;
+    }
+    const std::string path =
+        get_setting(args, "telemetry_file", "UHD_STREAM_TELEMETRY_FILE");
+    if (path.empty()) {
+        return nullptr;
+    }
+    const double interval = get_interval(args);
+
+    std::lock_guard<std::mutex> lock(dump_files_mutex);
+    dump_file::sptr file = dump_files[path].lock();
+    if (!file) {
+        try {
+            file = std::make_shared<dump_file>(path, interval);
+        } catch (const uhd::io_error& ex) {
+            // Telemetry must never stop anyone from streaming
+            UHD_LOG_ERROR("STREAM_TELEMETRY", ex.what());
+            return nullptr;
+        }
+        dump_files[path] = file;
+        UHD_LOG_DEBUG("STREAM_TELEMETRY",
+            "Writing telemetry to " << path << " every " << interval << " s");
+    }
+    const size_t id = file->add_source(name, std::move(info_fn));
+    return std::make_unique<registration_impl>(file, id);
+}
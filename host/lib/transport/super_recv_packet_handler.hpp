@@ -19,6 +19,7 @@
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/tasks.hpp>
+#include <uhdlib/transport/rx_metadata_time.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/format.hpp>
 #include <functional>
@@ -115,13 +116,19 @@ public:
     //! Set the rate of ticks per second
     void set_tick_rate(const double rate)
     {
-        _tick_rate = rate;
+        // Times can only be computed for positive rates, keep the last one
+        // until the rate is known
+        if (rate > 0) {
+            _tick_rate = tick_time_t::rate_t::from_double(rate);
+        }
     }
 
     //! Set the rate of samples per second
     void set_samp_rate(const double rate)
     {
-        _samp_rate = rate;
+        if (rate > 0) {
+            _samp_rate = tick_time_t::rate_t::from_double(rate);
+        }
     }
 
     /*!
@@ -280,7 +287,7 @@ public:
 private:
     vrt_unpacker_type _vrt_unpacker;
     size_t _header_offset_words32;
-    double _tick_rate, _samp_rate;
+    tick_time_t::rate_t _tick_rate, _samp_rate;
     bool _queue_error_for_next_call;
     size_t _alignment_failure_threshold;
     rx_metadata_t _queue_metadata;
@@ -630,8 +637,10 @@ private:
                 case PACKET_INLINE_MESSAGE:
                     std::swap(curr_info, next_info); // save progress from curr -> next
                     curr_info.metadata.has_time_spec = next_info[index].ifpi.has_tsf;
+                    curr_info.metadata.tick_time =
+                        tick_time_t(int64_t(next_info[index].time), _tick_rate);
                     curr_info.metadata.time_spec =
-                        time_spec_t::from_ticks(next_info[index].time, _tick_rate);
+                        curr_info.metadata.tick_time.to_time_spec();
                     curr_info.metadata.error_code =
                         rx_metadata_t::error_code_t(get_context_code(
                             next_info[index].vrt_hdr, next_info[index].ifpi));
@@ -668,12 +677,11 @@ private:
                     alignment_check(index, curr_info);
                     std::swap(curr_info, next_info); // save progress from curr -> next
                     curr_info.metadata.has_time_spec = prev_info.metadata.has_time_spec;
-                    curr_info.metadata.time_spec =
-                        prev_info.metadata.time_spec
-                        + time_spec_t::from_ticks(
-                            prev_info[index].ifpi.num_payload_words32 * sizeof(uint32_t)
-                                / _bytes_per_otw_item,
-                            _samp_rate);
+                    set_rx_metadata_time(curr_info.metadata,
+                        prev_info.metadata.tick_time,
+                        prev_info[index].ifpi.num_payload_words32 * sizeof(uint32_t)
+                            / _bytes_per_otw_item,
+                        _samp_rate);
                     curr_info.metadata.out_of_sequence = true;
                     curr_info.metadata.error_code = rx_metadata_t::ERROR_CODE_OVERFLOW;
                     UHD_LOG_FASTPATH("D");
@@ -698,8 +706,9 @@ private:
 
         // set the metadata from the buffer information at index zero
         curr_info.metadata.has_time_spec = curr_info[0].ifpi.has_tsf;
-        curr_info.metadata.time_spec =
-            time_spec_t::from_ticks(curr_info[0].time, _tick_rate);
+        curr_info.metadata.tick_time =
+            tick_time_t(int64_t(curr_info[0].time), _tick_rate);
+        curr_info.metadata.time_spec = curr_info.metadata.tick_time.to_time_spec();
         curr_info.metadata.more_fragments  = false;
         curr_info.metadata.fragment_offset = 0;
         curr_info.metadata.error_code      = rx_metadata_t::ERROR_CODE_NONE;
@@ -727,8 +736,10 @@ private:
         metadata                = info.metadata;
 
         // interpolate the time spec (useful when this is a fragment)
-        metadata.time_spec +=
-            time_spec_t::from_ticks(info.fragment_offset_in_samps, _samp_rate);
+        if (info.fragment_offset_in_samps != 0) {
+            set_rx_metadata_time(
+                metadata, metadata.tick_time, info.fragment_offset_in_samps, _samp_rate);
+        }
 
         // extract the number of samples available to copy
         const size_t nsamps_available = info.data_bytes_to_copy / _bytes_per_otw_item;
@@ -7,19 +7,81 @@
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/adapter.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <uhdlib/utils/numa.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 
 using namespace uhd::transport;
 
 namespace asio = boost::asio;
 
+namespace {
+
+//! Return the number of staging frames required for a given receive batch size
+size_t get_num_staging_frames(const size_t recv_batch_size)
+{
+#ifdef UHD_PLATFORM_LINUX
+    return recv_batch_size > 1 ? std::min(recv_batch_size, UDP_MAX_RECV_BATCH_SIZE)
+                               : 0;
+#else
+    return 0;
+#endif
+}
+
+//! Return the number of packets to send per system call
+size_t clamp_send_batch_size(const size_t send_batch_size)
+{
+#ifdef UHD_PLATFORM_LINUX
+    return std::max<size_t>(std::min(send_batch_size, UDP_MAX_SEND_BATCH_SIZE), 1);
+#else
+    return 1;
+#endif
+}
+
+//! Return the NUMA node for the frame buffers, see link_params_t::buff_numa_node
+int get_buff_numa_node(const std::string& numa_node, const std::string& local_addr)
+{
+    if (numa_node.empty()) {
+        return buffer_pool::NO_NUMA_NODE;
+    }
+    const int node = numa_node == "nic"      ? uhd::get_interface_numa_node(local_addr)
+                     : numa_node == "thread" ? uhd::get_thread_numa_node()
+                                             : std::stoi(numa_node);
+    if (node < 0) {
+        UHD_LOGGER_WARNING("UDP") << "Could not determine the NUMA node of the "
+                                  << (numa_node == "nic" ? "interface " + local_addr
+                                                         : std::string("thread"))
+                                  << ", not binding the frame buffers to a node";
+        return buffer_pool::NO_NUMA_NODE;
+    }
+    return node;
+}
+
+} // namespace
+
 udp_boost_asio_link::udp_boost_asio_link(
     const std::string& addr, const std::string& port, const link_params_t& params)
     : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
-    , send_link_base_t(params.num_send_frames, params.send_frame_size)
-    , _recv_memory_pool(buffer_pool::make(params.num_recv_frames, params.recv_frame_size))
-    , _send_memory_pool(buffer_pool::make(params.num_send_frames, params.send_frame_size))
+    , send_link_base_t(params.num_send_frames,
+          params.send_frame_size,
+          clamp_send_batch_size(params.send_batch_size))
 {
+    // create, open, and connect the socket
+    _socket  = open_udp_socket(addr, port, _io_context);
+    _sock_fd = _socket->native_handle();
+
+    // The socket is needed to find the NIC's NUMA node
+    buffer_pool::mem_params_t mem_params;
+    mem_params.page_size = params.buff_page_size;
+    mem_params.numa_node = get_buff_numa_node(params.buff_numa_node, get_local_addr());
+    _recv_memory_pool    = buffer_pool::make(
+        params.num_recv_frames + get_num_staging_frames(params.recv_batch_size),
+        params.recv_frame_size,
+        16,
+        mem_params);
+    _send_memory_pool = buffer_pool::make(
+        params.num_send_frames, params.send_frame_size, 16, mem_params);
+
     for (size_t i = 0; i < params.num_recv_frames; i++) {
         _recv_buffs.push_back(udp_boost_asio_frame_buff(_recv_memory_pool->at(i)));
     }
@@ -36,9 +98,34 @@ udp_boost_asio_link::udp_boost_asio_link(
         send_link_base_t::preload_free_buff(&buff);
     }
 
-    // create, open, and connect the socket
-    _socket  = open_udp_socket(addr, port, _io_context);
-    _sock_fd = _socket->native_handle();
+    // The batched receiver gets its own set of frames to receive into. They
+    // are swapped with the link's frame buffers as packets are handed out.
+    const size_t num_staging_frames = get_num_staging_frames(params.recv_batch_size);
+    if (num_staging_frames > 0) {
+        std::vector<void*> staging_frames;
+        for (size_t i = 0; i < num_staging_frames; i++) {
+            staging_frames.push_back(_recv_memory_pool->at(params.num_recv_frames + i));
+        }
+        _recv_batcher = std::make_unique<udp_recv_batcher>(
+            _sock_fd, params.recv_frame_size, staging_frames);
+        UHD_LOGGER_TRACE("UDP") << "Receiving up to " << num_staging_frames
+                                << " packets per system call";
+    }
+
+#ifdef UHD_PLATFORM_LINUX
+    const size_t send_batch_size = clamp_send_batch_size(params.send_batch_size);
+    if (send_batch_size > 1) {
+        _send_iovecs.resize(send_batch_size);
+        _send_msgs.resize(send_batch_size);
+        for (size_t i = 0; i < send_batch_size; i++) {
+            _send_msgs[i]                    = mmsghdr();
+            _send_msgs[i].msg_hdr.msg_iov    = &_send_iovecs[i];
+            _send_msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+        UHD_LOGGER_TRACE("UDP")
+            << "Sending up to " << send_batch_size << " packets per system call";
+    }
+#endif
 
     auto info   = udp_boost_asio_adapter_info(*_socket);
     auto& ctx   = adapter_ctx::get();
@@ -47,6 +134,10 @@ udp_boost_asio_link::udp_boost_asio_link(
     UHD_LOGGER_TRACE("UDP") << boost::format("Created UDP link to %s:%s") % addr % port;
     UHD_LOGGER_TRACE("UDP") << boost::format("Local UDP socket endpoint: %s:%s")
                                    % get_local_addr() % get_local_port();
+    UHD_LOGGER_TRACE("UDP") << boost::format(
+                                   "Frame buffers in pages of %d bytes on NUMA node %d")
+                                   % _recv_memory_pool->get_placement().page_size
+                                   % _recv_memory_pool->get_placement().numa_node;
 }
 
 uint16_t udp_boost_asio_link::get_local_port() const
@@ -83,6 +174,35 @@ udp_boost_asio_link::sptr udp_boost_asio_link::make(const std::string& addr,
     UHD_ASSERT_THROW(params.send_frame_size != 0);
     UHD_ASSERT_THROW(params.recv_buff_size != 0);
     UHD_ASSERT_THROW(params.send_buff_size != 0);
+    UHD_ASSERT_THROW(params.recv_batch_size != 0);
+    UHD_ASSERT_THROW(params.send_batch_size != 0);
+
+#ifndef UHD_PLATFORM_LINUX
+    if (params.recv_batch_size > 1) {
+        UHD_LOG_WARNING("UDP",
+            "Batched receive is not supported on this platform, ignoring "
+            "recv_batch_size="
+                << params.recv_batch_size);
+    }
+    if (params.send_batch_size > 1) {
+        UHD_LOG_WARNING("UDP",
+            "Batched send is not supported on this platform, ignoring "
+            "send_batch_size="
+                << params.send_batch_size);
+    }
+#endif
+    if (params.recv_batch_size > UDP_MAX_RECV_BATCH_SIZE) {
+        UHD_LOG_WARNING("UDP",
+            "Requested recv_batch_size of " << params.recv_batch_size
+                                            << " exceeds the maximum, using "
+                                            << UDP_MAX_RECV_BATCH_SIZE);
+    }
+    if (params.send_batch_size > UDP_MAX_SEND_BATCH_SIZE) {
+        UHD_LOG_WARNING("UDP",
+            "Requested send_batch_size of " << params.send_batch_size
+                                            << " exceeds the maximum, using "
+                                            << UDP_MAX_SEND_BATCH_SIZE);
+    }
 
     udp_boost_asio_link::sptr link(new udp_boost_asio_link(addr, port, params));
 
@@ -0,0 +1,1079 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#include <uhdlib/transport/udp_xdp_link.hpp>
+#include <uhdlib/utils/numa.hpp>
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <boost/format.hpp>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr char LOG_ID[] = "XDP";
+
+#ifndef SO_BUSY_POLL
+#    define SO_BUSY_POLL 46
+#endif
+#ifndef SO_PREFER_BUSY_POLL
+#    define SO_PREFER_BUSY_POLL 69
+#endif
+#ifndef SO_BUSY_POLL_BUDGET
+#    define SO_BUSY_POLL_BUDGET 70
+#endif
+
+//! Smallest number of chunks per ring
+constexpr size_t MIN_RING_SIZE = 64;
+//! Number of released receive chunks which are handed back to the kernel at once
+constexpr size_t FILL_BATCH_SIZE = 32;
+//! Number of packets the kernel processes per busy poll
+constexpr int BUSY_POLL_BUDGET = 64;
+//! Number of entries in the map of AF_XDP sockets, i.e., the highest queue ID + 1
+constexpr uint32_t MAX_NUM_QUEUES = 256;
+//! How long to wait for the queue of a previously closed socket to be released
+constexpr std::chrono::milliseconds BIND_RETRY_TIME{1000};
+
+// Offsets in the Ethernet, IPv4 and UDP headers
+constexpr size_t ETH_DST_OFFSET      = 0;
+constexpr size_t ETH_SRC_OFFSET      = 6;
+constexpr size_t ETH_TYPE_OFFSET     = 12;
+constexpr size_t IP_OFFSET           = 14;
+constexpr size_t IP_LEN_OFFSET       = IP_OFFSET + 2;
+constexpr size_t IP_ID_OFFSET        = IP_OFFSET + 4;
+constexpr size_t IP_FRAG_OFFSET      = IP_OFFSET + 6;
+constexpr size_t IP_PROTO_OFFSET     = IP_OFFSET + 9;
+constexpr size_t IP_CHECKSUM_OFFSET  = IP_OFFSET + 10;
+constexpr size_t IP_SRC_OFFSET       = IP_OFFSET + 12;
+constexpr size_t IP_DST_OFFSET       = IP_OFFSET + 16;
+constexpr size_t UDP_OFFSET          = IP_OFFSET + 20;
+constexpr size_t UDP_SRC_PORT_OFFSET = UDP_OFFSET;
+constexpr size_t UDP_DST_PORT_OFFSET = UDP_OFFSET + 2;
+constexpr size_t UDP_LEN_OFFSET      = UDP_OFFSET + 4;
+constexpr size_t UDP_HEADER_SIZE     = 8;
+constexpr size_t IP_HEADER_SIZE      = 20;
+
+uint16_t load_be16(const uint8_t* p)
+{
+    return static_cast<uint16_t>((p[0] << 8) | p[1]);
+}
+
+void store_be16(uint8_t* p, const uint16_t value)
+{
+    p[0] = static_cast<uint8_t>(value >> 8);
+    p[1] = static_cast<uint8_t>(value);
+}
+
+//! Return the IPv4 header checksum
+uint16_t ip_checksum(const uint8_t* header)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < IP_HEADER_SIZE; i += 2) {
+        sum += load_be16(header + i);
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    return static_cast<uint16_t>(~sum);
+}
+
+size_t next_pow2(const size_t value)
+{
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+std::string errno_string()
+{
+    return std::string(std::strerror(errno));
+}
+
+/******************************************************************************
+ * XDP program
+ *****************************************************************************/
+long sys_bpf(const int cmd, bpf_attr& attr)
+{
+    return ::syscall(SYS_bpf, cmd, &attr, sizeof(attr));
+}
+
+bpf_insn make_insn(const uint8_t code,
+    const uint8_t dst,
+    const uint8_t src,
+    const int16_t off,
+    const int32_t imm)
+{
+    bpf_insn insn = {};
+    insn.code     = code;
+    insn.dst_reg  = dst;
+    insn.src_reg  = src;
+    insn.off      = off;
+    insn.imm      = imm;
+    return insn;
+}
+
+/*! Steers UDP packets for the ports of the AF_XDP links to their sockets
+ *
+ * There is one program per network interface, which is shared by all links on
+ * that interface. The program looks up the destination port of IPv4/UDP
+ * packets in a map of ports, and redirects the packet to the AF_XDP socket of
+ * the receiving queue if the queue matches the one stored for the port. All
+ * other packets are passed on to the network stack.
+ *
+ * The program is detached when the last link on the interface is destroyed or
+ * the process exits.
+ */
+class xdp_program
+{
+public:
+    using sptr = std::shared_ptr<xdp_program>;
+
+    xdp_program(const int ifindex, const udp_xdp_link::xdp_mode_t mode)
+    {
+        try {
+            _ports_fd = _create_map(BPF_MAP_TYPE_HASH, MAX_NUM_QUEUES);
+            _xsks_fd  = _create_map(BPF_MAP_TYPE_XSKMAP, MAX_NUM_QUEUES);
+            _load();
+            _attach(ifindex, mode);
+        } catch (...) {
+            _close();
+            throw;
+        }
+    }
+
+    ~xdp_program()
+    {
+        _close();
+    }
+
+    //! Return the program for an interface, attach a new one if needed
+    static sptr get(const int ifindex, const udp_xdp_link::xdp_mode_t mode)
+    {
+        static std::mutex registry_mutex;
+        static std::map<int, std::weak_ptr<xdp_program>> registry;
+
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        sptr program = registry[ifindex].lock();
+        if (!program) {
+            program           = std::make_shared<xdp_program>(ifindex, mode);
+            registry[ifindex] = program;
+        } else if (mode != udp_xdp_link::xdp_mode_t::AUTO
+                   && (mode == udp_xdp_link::xdp_mode_t::GENERIC)
+                          != program->is_generic()) {
+            throw uhd::runtime_error(
+                "The XDP program is already attached in a different mode");
+        }
+        return program;
+    }
+
+    bool is_generic() const
+    {
+        return _generic;
+    }
+
+    //! Steer packets for a port (host byte order) received on a queue to a socket
+    void add(const uint16_t port, const uint32_t queue_id, const int xsk_fd)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (queue_id >= MAX_NUM_QUEUES) {
+            throw uhd::value_error(
+                "XDP queue " + std::to_string(queue_id) + " is out of range");
+        }
+        if (_queues.count(queue_id)) {
+            throw uhd::runtime_error("XDP queue " + std::to_string(queue_id)
+                                     + " is already used by another link");
+        }
+        uint32_t xsk_value = static_cast<uint32_t>(xsk_fd);
+        _update(_xsks_fd, queue_id, &xsk_value);
+        try {
+            uint32_t queue_value = queue_id;
+            _update(_ports_fd, htons(port), &queue_value);
+        } catch (...) {
+            _delete(_xsks_fd, queue_id);
+            throw;
+        }
+        _queues.insert(queue_id);
+    }
+
+    void remove(const uint16_t port, const uint32_t queue_id)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _delete(_ports_fd, htons(port));
+        _delete(_xsks_fd, queue_id);
+        _queues.erase(queue_id);
+    }
+
+private:
+    static int _create_map(const uint32_t type, const uint32_t max_entries)
+    {
+        bpf_attr attr    = {};
+        attr.map_type    = type;
+        attr.key_size    = sizeof(uint32_t);
+        attr.value_size  = sizeof(uint32_t);
+        attr.max_entries = max_entries;
+        const int fd     = static_cast<int>(sys_bpf(BPF_MAP_CREATE, attr));
+        if (fd < 0) {
+            throw uhd::runtime_error("Could not create a BPF map: " + errno_string());
+        }
+        return fd;
+    }
+
+    static void _update(const int map_fd, const uint32_t key, const uint32_t* value)
+    {
+        bpf_attr attr = {};
+        attr.map_fd   = map_fd;
+        attr.key      = reinterpret_cast<uint64_t>(&key);
+        attr.value    = reinterpret_cast<uint64_t>(value);
+        attr.flags    = BPF_ANY;
+        if (sys_bpf(BPF_MAP_UPDATE_ELEM, attr) < 0) {
+            throw uhd::runtime_error("Could not update a BPF map: " + errno_string());
+        }
+    }
+
+    static void _delete(const int map_fd, const uint32_t key)
+    {
+        bpf_attr attr = {};
+        attr.map_fd   = map_fd;
+        attr.key      = reinterpret_cast<uint64_t>(&key);
+        sys_bpf(BPF_MAP_DELETE_ELEM, attr);
+    }
+
+    void _load()
+    {
+        constexpr uint8_t R0 = BPF_REG_0, R1 = BPF_REG_1, R2 = BPF_REG_2,
+                          R3 = BPF_REG_3, R4 = BPF_REG_4, R6 = BPF_REG_6,
+                          R10 = BPF_REG_10;
+        // Jumps to the final "return XDP_PASS" are patched below
+        constexpr int16_t PASS = 0x7FFF;
+        const int32_t ipv4     = htons(0x0800);
+        const int32_t frag     = htons(0x3FFF);
+
+        std::vector<bpf_insn> insns = {
+            make_insn(BPF_ALU64 | BPF_MOV | BPF_X, R6, R1, 0, 0),
+            // Check that the packet contains all headers
+            make_insn(BPF_LDX | BPF_MEM | BPF_W, R2, R6, offsetof(xdp_md, data), 0),
+            make_insn(BPF_LDX | BPF_MEM | BPF_W, R3, R6, offsetof(xdp_md, data_end), 0),
+            make_insn(BPF_ALU64 | BPF_MOV | BPF_X, R4, R2, 0, 0),
+            make_insn(BPF_ALU64 | BPF_ADD | BPF_K, R4, 0, 0, XDP_UDP_HEADERS_SIZE),
+            make_insn(BPF_JMP | BPF_JGT | BPF_X, R4, R3, PASS, 0),
+            // IPv4 without options and fragments, UDP
+            make_insn(BPF_LDX | BPF_MEM | BPF_H, R4, R2, ETH_TYPE_OFFSET, 0),
+            make_insn(BPF_JMP | BPF_JNE | BPF_K, R4, 0, PASS, ipv4),
+            make_insn(BPF_LDX | BPF_MEM | BPF_B, R4, R2, IP_OFFSET, 0),
+            make_insn(BPF_JMP | BPF_JNE | BPF_K, R4, 0, PASS, 0x45),
+            make_insn(BPF_LDX | BPF_MEM | BPF_B, R4, R2, IP_PROTO_OFFSET, 0),
+            make_insn(BPF_JMP | BPF_JNE | BPF_K, R4, 0, PASS, IPPROTO_UDP),
+            make_insn(BPF_LDX | BPF_MEM | BPF_H, R4, R2, IP_FRAG_OFFSET, 0),
+            make_insn(BPF_ALU64 | BPF_AND | BPF_K, R4, 0, 0, frag),
+            make_insn(BPF_JMP | BPF_JNE | BPF_K, R4, 0, PASS, 0),
+            // Look up the queue for the destination port
+            make_insn(BPF_LDX | BPF_MEM | BPF_H, R4, R2, UDP_DST_PORT_OFFSET, 0),
+            make_insn(BPF_STX | BPF_MEM | BPF_W, R10, R4, -4, 0),
+            make_insn(BPF_LD | BPF_DW | BPF_IMM, R1, BPF_PSEUDO_MAP_FD, 0, _ports_fd),
+            make_insn(0, 0, 0, 0, 0),
+            make_insn(BPF_ALU64 | BPF_MOV | BPF_X, R2, R10, 0, 0),
+            make_insn(BPF_ALU64 | BPF_ADD | BPF_K, R2, 0, 0, -4),
+            make_insn(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_map_lookup_elem),
+            make_insn(BPF_JMP | BPF_JEQ | BPF_K, R0, 0, PASS, 0),
+            make_insn(BPF_LDX | BPF_MEM | BPF_W, R2, R0, 0, 0),
+            make_insn(
+                BPF_LDX | BPF_MEM | BPF_W, R3, R6, offsetof(xdp_md, rx_queue_index), 0),
+            make_insn(BPF_JMP | BPF_JNE | BPF_X, R2, R3, PASS, 0),
+            // Redirect to the socket, or pass if there is none
+            make_insn(BPF_LD | BPF_DW | BPF_IMM, R1, BPF_PSEUDO_MAP_FD, 0, _xsks_fd),
+            make_insn(0, 0, 0, 0, 0),
+            make_insn(BPF_ALU64 | BPF_MOV | BPF_K, R3, 0, 0, XDP_PASS),
+            make_insn(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),
+            make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+            make_insn(BPF_ALU64 | BPF_MOV | BPF_K, R0, 0, 0, XDP_PASS),
+            make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+        };
+        const int16_t pass_index = static_cast<int16_t>(insns.size() - 2);
+        for (int16_t i = 0; i < static_cast<int16_t>(insns.size()); i++) {
+            if (BPF_CLASS(insns[i].code) == BPF_JMP && insns[i].off == PASS) {
+                insns[i].off = static_cast<int16_t>(pass_index - i - 1);
+            }
+        }
+
+        std::vector<char> log(65536);
+        const char license[] = "GPL";
+        bpf_attr attr        = {};
+        attr.prog_type       = BPF_PROG_TYPE_XDP;
+        attr.insns           = reinterpret_cast<uint64_t>(insns.data());
+        attr.insn_cnt        = static_cast<uint32_t>(insns.size());
+        attr.license         = reinterpret_cast<uint64_t>(license);
+        attr.log_buf         = reinterpret_cast<uint64_t>(log.data());
+        attr.log_size        = static_cast<uint32_t>(log.size());
+        attr.log_level       = 1;
+        _prog_fd             = static_cast<int>(sys_bpf(BPF_PROG_LOAD, attr));
+        if (_prog_fd < 0) {
+            const std::string error = errno_string();
+            UHD_LOG_DEBUG(LOG_ID, "BPF verifier log:\n" << log.data());
+            throw uhd::runtime_error("Could not load the XDP program: " + error);
+        }
+    }
+
+    void _attach(const int ifindex, const udp_xdp_link::xdp_mode_t mode)
+    {
+        std::string error;
+        for (const bool generic : {false, true}) {
+            if ((generic && mode == udp_xdp_link::xdp_mode_t::NATIVE)
+                || (!generic && mode == udp_xdp_link::xdp_mode_t::GENERIC)) {
+                continue;
+            }
+            bpf_attr attr                = {};
+            attr.link_create.prog_fd     = static_cast<uint32_t>(_prog_fd);
+            attr.link_create.target_ifindex = static_cast<uint32_t>(ifindex);
+            attr.link_create.attach_type = BPF_XDP;
+            attr.link_create.flags = generic ? XDP_FLAGS_SKB_MODE : XDP_FLAGS_DRV_MODE;
+            _link_fd = static_cast<int>(sys_bpf(BPF_LINK_CREATE, attr));
+            if (_link_fd >= 0) {
+                _generic = generic;
+                UHD_LOG_DEBUG(LOG_ID,
+                    "Attached the XDP program in " << (generic ? "generic" : "native")
+                                                   << " mode");
+                return;
+            }
+            error = errno_string();
+            UHD_LOG_DEBUG(LOG_ID,
+                "Could not attach the XDP program in "
+                    << (generic ? "generic" : "native") << " mode: " << error);
+        }
+        throw uhd::runtime_error("Could not attach the XDP program: " + error);
+    }
+
+    void _close()
+    {
+        for (int* fd : {&_link_fd, &_prog_fd, &_xsks_fd, &_ports_fd}) {
+            if (*fd >= 0) {
+                ::close(*fd);
+                *fd = -1;
+            }
+        }
+    }
+
+    std::mutex _mutex;
+    std::set<uint32_t> _queues;
+    int _ports_fd = -1;
+    int _xsks_fd  = -1;
+    int _prog_fd  = -1;
+    int _link_fd  = -1;
+    bool _generic = false;
+};
+
+//! Steers a link's packets to its socket until destroyed
+class xdp_program_user
+{
+public:
+    xdp_program_user(xdp_program::sptr program,
+        const uint16_t port,
+        const uint32_t queue_id,
+        const int xsk_fd)
+        : _program(program), _port(port), _queue_id(queue_id)
+    {
+        _program->add(_port, _queue_id, xsk_fd);
+    }
+
+    ~xdp_program_user()
+    {
+        _program->remove(_port, _queue_id);
+    }
+
+private:
+    xdp_program::sptr _program;
+    const uint16_t _port;
+    const uint32_t _queue_id;
+};
+
+/******************************************************************************
+ * Interface and address lookup
+ *****************************************************************************/
+struct interface_info_t
+{
+    std::string name;
+    int index;
+    bool loopback;
+    bool noarp;
+};
+
+//! Return the interface which has a local IPv4 address
+interface_info_t find_interface(const uint32_t local_ip)
+{
+    ifaddrs* ifaddr = nullptr;
+    if (getifaddrs(&ifaddr) != 0) {
+        throw uhd::runtime_error("Could not list the network interfaces: "
+                                 + errno_string());
+    }
+    interface_info_t info{"", 0, false, false};
+    for (ifaddrs* ifa = ifaddr; ifa; ifa = ifa->ifa_next) {
+        if (ifa->ifa_addr && ifa->ifa_addr->sa_family == AF_INET
+            && reinterpret_cast<sockaddr_in*>(ifa->ifa_addr)->sin_addr.s_addr
+                   == local_ip) {
+            info.name     = ifa->ifa_name;
+            info.loopback = ifa->ifa_flags & IFF_LOOPBACK;
+            info.noarp    = ifa->ifa_flags & IFF_NOARP;
+            break;
+        }
+    }
+    freeifaddrs(ifaddr);
+    if (info.name.empty()) {
+        throw uhd::runtime_error("Could not find the network interface for the link");
+    }
+    info.index = static_cast<int>(if_nametoindex(info.name.c_str()));
+    return info;
+}
+
+//! Return the MAC address of an interface
+std::array<uint8_t, 6> get_interface_mac(const std::string& ifname)
+{
+    std::array<uint8_t, 6> mac = {};
+    const int fd               = ::socket(AF_INET, SOCK_DGRAM, 0);
+    ifreq ifr                  = {};
+    std::strncpy(ifr.ifr_name, ifname.c_str(), IFNAMSIZ - 1);
+    if (fd < 0 || ::ioctl(fd, SIOCGIFHWADDR, &ifr) != 0) {
+        const std::string error = errno_string();
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        throw uhd::runtime_error("Could not get the MAC address of " + ifname + ": "
+                                 + error);
+    }
+    ::close(fd);
+    std::memcpy(mac.data(), ifr.ifr_hwaddr.sa_data, mac.size());
+    return mac;
+}
+
+//! Look up the MAC address for an IPv4 address in the kernel's ARP table
+bool find_arp_entry(
+    const std::string& ip_addr, const std::string& ifname, std::array<uint8_t, 6>& mac)
+{
+    std::ifstream arp_table("/proc/net/arp");
+    std::string line;
+    std::getline(arp_table, line); // Column names
+    while (std::getline(arp_table, line)) {
+        std::istringstream fields(line);
+        std::string ip, hw_type, flags, hw_addr, mask, device;
+        fields >> ip >> hw_type >> flags >> hw_addr >> mask >> device;
+        // Flag 0x2 marks completed entries
+        if (ip != ip_addr || device != ifname
+            || !(std::stoul(flags, nullptr, 16) & 0x2)) {
+            continue;
+        }
+        unsigned int bytes[6];
+        if (std::sscanf(hw_addr.c_str(),
+                "%x:%x:%x:%x:%x:%x",
+                &bytes[0],
+                &bytes[1],
+                &bytes[2],
+                &bytes[3],
+                &bytes[4],
+                &bytes[5])
+            != 6) {
+            continue;
+        }
+        for (size_t i = 0; i < mac.size(); i++) {
+            mac[i] = static_cast<uint8_t>(bytes[i]);
+        }
+        return true;
+    }
+    return false;
+}
+
+/*! Return the MAC address of the device
+ *
+ * If the kernel doesn't know the address yet, a packet is sent to the discard
+ * port of the device to make the kernel resolve it.
+ */
+std::array<uint8_t, 6> resolve_remote_mac(
+    const std::string& remote_ip, const interface_info_t& interface)
+{
+    std::array<uint8_t, 6> mac = {};
+    if (interface.loopback || interface.noarp) {
+        return mac;
+    }
+    if (find_arp_entry(remote_ip, interface.name, mac)) {
+        return mac;
+    }
+
+    sockaddr_in discard = {};
+    discard.sin_family  = AF_INET;
+    discard.sin_port    = htons(9);
+    inet_pton(AF_INET, remote_ip.c_str(), &discard.sin_addr);
+    const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd >= 0) {
+        ::sendto(
+            fd, nullptr, 0, 0, reinterpret_cast<sockaddr*>(&discard), sizeof(discard));
+        ::close(fd);
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (find_arp_entry(remote_ip, interface.name, mac)) {
+            return mac;
+        }
+    }
+    throw uhd::runtime_error("Could not resolve the MAC address of " + remote_ip);
+}
+
+} // namespace
+
+/******************************************************************************
+ * udp_xdp_link
+ *****************************************************************************/
+udp_xdp_link::udp_xdp_link(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const xdp_params_t& xdp_params)
+    : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
+    , send_link_base_t(
+          params.num_send_frames, params.send_frame_size, params.send_batch_size)
+    , _queue_id(xdp_params.queue_id)
+    , _chunk_size(xdp_params.chunk_size)
+{
+    // The kernel socket reserves the local port and picks the interface
+    _socket = open_udp_socket(addr, port, _io_context);
+    const auto local  = _socket->local_endpoint();
+    const auto remote = _socket->remote_endpoint();
+    const interface_info_t interface =
+        find_interface(htonl(local.address().to_v4().to_uint()));
+    _ifname      = interface.name;
+    _ifindex     = interface.index;
+    _remote_ip   = htonl(remote.address().to_v4().to_uint());
+    _remote_port = htons(remote.port());
+
+    // Ethernet, IPv4 and UDP headers of sent packets
+    const auto src_mac = interface.loopback ? std::array<uint8_t, 6>{}
+                                            : get_interface_mac(_ifname);
+    const auto dst_mac = resolve_remote_mac(remote.address().to_string(), interface);
+    const uint32_t local_ip = htonl(local.address().to_v4().to_uint());
+    _header_template.fill(0);
+    uint8_t* header = _header_template.data();
+    std::memcpy(header + ETH_DST_OFFSET, dst_mac.data(), dst_mac.size());
+    std::memcpy(header + ETH_SRC_OFFSET, src_mac.data(), src_mac.size());
+    store_be16(header + ETH_TYPE_OFFSET, 0x0800);
+    header[IP_OFFSET]       = 0x45;
+    header[IP_OFFSET + 8]   = 64; // TTL
+    header[IP_PROTO_OFFSET] = IPPROTO_UDP;
+    store_be16(header + IP_FRAG_OFFSET, 0x4000); // Don't fragment
+    std::memcpy(header + IP_SRC_OFFSET, &local_ip, sizeof(local_ip));
+    std::memcpy(header + IP_DST_OFFSET, &_remote_ip, sizeof(_remote_ip));
+    store_be16(header + UDP_SRC_PORT_OFFSET, local.port());
+    store_be16(header + UDP_DST_PORT_OFFSET, remote.port());
+
+    // UMEM: every chunk holds one packet. There are more chunks than frame
+    // buffers, so the kernel can receive while the frame buffers are in use.
+    _num_recv_chunks =
+        std::max(next_pow2(params.num_recv_frames + FILL_BATCH_SIZE), MIN_RING_SIZE);
+    const size_t num_send_chunks =
+        std::max(next_pow2(2 * params.num_send_frames), MIN_RING_SIZE);
+    buffer_pool::mem_params_t mem_params;
+    mem_params.page_size = params.buff_page_size;
+    if (params.buff_numa_node == "nic") {
+        mem_params.numa_node = uhd::get_interface_numa_node(get_local_addr());
+    } else if (params.buff_numa_node == "thread") {
+        mem_params.numa_node = uhd::get_thread_numa_node();
+    } else if (!params.buff_numa_node.empty()) {
+        mem_params.numa_node = std::stoi(params.buff_numa_node);
+    }
+    _umem_pool = buffer_pool::make(1,
+        (_num_recv_chunks + num_send_chunks) * _chunk_size,
+        static_cast<size_t>(::sysconf(_SC_PAGESIZE)),
+        mem_params);
+    _umem = static_cast<uint8_t*>(_umem_pool->at(0));
+
+    _recv_buffs.resize(params.num_recv_frames);
+    _send_buffs.resize(params.num_send_frames);
+    for (auto& buff : _recv_buffs) {
+        recv_link_base_t::preload_free_buff(&buff);
+    }
+    for (auto& buff : _send_buffs) {
+        send_link_base_t::preload_free_buff(&buff);
+    }
+    _free_send_chunks.reserve(num_send_chunks);
+    for (size_t i = 0; i < num_send_chunks; i++) {
+        _free_send_chunks.push_back((_num_recv_chunks + i) * _chunk_size);
+    }
+    _fill_pending.reserve(_num_recv_chunks);
+
+    try {
+        _setup_socket(xdp_params);
+    } catch (...) {
+        _program.reset();
+        _unmap_ring(_rx_ring);
+        _unmap_ring(_fill_ring);
+        _unmap_ring(_tx_ring);
+        _unmap_ring(_comp_ring);
+        if (_xsk_fd >= 0) {
+            ::close(_xsk_fd);
+        }
+        throw;
+    }
+
+    auto info   = udp_xdp_adapter_info(_ifname, _queue_id);
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE(LOG_ID) << boost::format("Created AF_XDP link to %s:%s") % addr
+                                    % port;
+    UHD_LOGGER_TRACE(LOG_ID) << boost::format("Local endpoint: %s:%s on %s queue %d")
+                                    % get_local_addr() % get_local_port() % _ifname
+                                    % _queue_id;
+}
+
+void udp_xdp_link::_setup_socket(const xdp_params_t& xdp_params)
+{
+    _xsk_fd = ::socket(AF_XDP, SOCK_RAW, 0);
+    if (_xsk_fd < 0) {
+        throw uhd::runtime_error("Could not open an AF_XDP socket: " + errno_string());
+    }
+
+    const uint32_t num_recv_chunks = static_cast<uint32_t>(_num_recv_chunks);
+    const uint32_t num_send_chunks = static_cast<uint32_t>(_free_send_chunks.size());
+    xdp_umem_reg umem_reg          = {};
+    umem_reg.addr                  = reinterpret_cast<uint64_t>(_umem);
+    umem_reg.len        = (_num_recv_chunks + num_send_chunks) * _chunk_size;
+    umem_reg.chunk_size = static_cast<uint32_t>(_chunk_size);
+    auto set_option     = [this](const int level, const int name, const void* value,
+                              const socklen_t size, const std::string& what) {
+        if (::setsockopt(_xsk_fd, level, name, value, size) != 0) {
+            throw uhd::runtime_error(
+                "Could not set up the AF_XDP " + what + ": " + errno_string());
+        }
+    };
+    set_option(SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg), "UMEM");
+    set_option(SOL_XDP,
+        XDP_UMEM_FILL_RING,
+        &num_recv_chunks,
+        sizeof(num_recv_chunks),
+        "fill ring");
+    set_option(SOL_XDP,
+        XDP_UMEM_COMPLETION_RING,
+        &num_send_chunks,
+        sizeof(num_send_chunks),
+        "completion ring");
+    set_option(
+        SOL_XDP, XDP_RX_RING, &num_recv_chunks, sizeof(num_recv_chunks), "RX ring");
+    set_option(
+        SOL_XDP, XDP_TX_RING, &num_send_chunks, sizeof(num_send_chunks), "TX ring");
+
+    xdp_mmap_offsets offsets = {};
+    socklen_t offsets_size   = sizeof(offsets);
+    if (::getsockopt(_xsk_fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_size) != 0) {
+        throw uhd::runtime_error("Could not get the AF_XDP ring offsets: "
+                                 + errno_string());
+    }
+    _map_ring(_rx_ring, offsets.rx, XDP_PGOFF_RX_RING, num_recv_chunks);
+    _map_ring(_fill_ring, offsets.fr, XDP_UMEM_PGOFF_FILL_RING, num_recv_chunks);
+    _map_ring(_tx_ring, offsets.tx, XDP_PGOFF_TX_RING, num_send_chunks);
+    _map_ring(_comp_ring, offsets.cr, XDP_UMEM_PGOFF_COMPLETION_RING, num_send_chunks);
+
+    // Hand all receive chunks to the kernel
+    for (size_t i = 0; i < _num_recv_chunks; i++) {
+        _fill_pending.push_back(i * _chunk_size);
+    }
+    _refill();
+
+    // Zero-copy sockets need the program to run in the driver
+    auto program = xdp_program::get(_ifindex, xdp_params.mode);
+
+    sockaddr_xdp sxdp  = {};
+    sxdp.sxdp_family   = AF_XDP;
+    sxdp.sxdp_ifindex  = static_cast<uint32_t>(_ifindex);
+    sxdp.sxdp_queue_id = _queue_id;
+
+    auto bind_socket = [&](const uint16_t flags) {
+        // The kernel releases the queue of a closed socket asynchronously
+        sxdp.sxdp_flags     = flags;
+        const auto deadline = std::chrono::steady_clock::now() + BIND_RETRY_TIME;
+        while (::bind(_xsk_fd, reinterpret_cast<sockaddr*>(&sxdp), sizeof(sxdp)) != 0) {
+            if (errno != EBUSY || std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return true;
+    };
+    bool bound = false;
+    if (!program->is_generic()) {
+        bound      = bind_socket(XDP_USE_NEED_WAKEUP | XDP_ZEROCOPY);
+        _zero_copy = bound;
+    }
+    if (!bound) {
+        bound = bind_socket(XDP_USE_NEED_WAKEUP | XDP_COPY);
+    }
+    if (!bound) {
+        throw uhd::runtime_error("Could not bind the AF_XDP socket to " + _ifname
+                                 + " queue " + std::to_string(_queue_id) + ": "
+                                 + errno_string());
+    }
+    UHD_LOG_DEBUG(LOG_ID,
+        "Bound the AF_XDP socket to " << _ifname << " queue " << _queue_id << " in "
+                                      << (_zero_copy ? "zero-copy" : "copy") << " mode");
+
+    _program = std::make_shared<xdp_program_user>(
+        program, get_local_port(), _queue_id, _xsk_fd);
+
+    if (xdp_params.busy_poll_us > 0) {
+        const int prefer = 1;
+        const int usecs  = static_cast<int>(xdp_params.busy_poll_us);
+        const int budget = BUSY_POLL_BUDGET;
+        set_option(SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer), "busy poll");
+        set_option(SOL_SOCKET, SO_BUSY_POLL, &usecs, sizeof(usecs), "busy poll");
+        set_option(
+            SOL_SOCKET, SO_BUSY_POLL_BUDGET, &budget, sizeof(budget), "busy poll");
+        _busy_poll = true;
+    }
+}
+
+template <typename entry_t>
+void udp_xdp_link::_map_ring(
+    ring_t<entry_t>& ring, const xdp_ring_offset& offsets, uint64_t pgoff, size_t size)
+{
+    ring.map_size = offsets.desc + size * sizeof(entry_t);
+    ring.map      = ::mmap(nullptr,
+        ring.map_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        _xsk_fd,
+        static_cast<off_t>(pgoff));
+    if (ring.map == MAP_FAILED) {
+        ring.map = nullptr;
+        throw uhd::runtime_error("Could not map an AF_XDP ring: " + errno_string());
+    }
+    uint8_t* base = static_cast<uint8_t*>(ring.map);
+    ring.producer = reinterpret_cast<std::atomic<uint32_t>*>(base + offsets.producer);
+    ring.consumer = reinterpret_cast<std::atomic<uint32_t>*>(base + offsets.consumer);
+    ring.flags    = reinterpret_cast<std::atomic<uint32_t>*>(base + offsets.flags);
+    ring.entries  = reinterpret_cast<entry_t*>(base + offsets.desc);
+    ring.mask     = static_cast<uint32_t>(size - 1);
+}
+
+template <typename entry_t>
+void udp_xdp_link::_unmap_ring(ring_t<entry_t>& ring)
+{
+    if (ring.map) {
+        ::munmap(ring.map, ring.map_size);
+        ring.map = nullptr;
+    }
+}
+
+udp_xdp_link::~udp_xdp_link()
+{
+    _program.reset();
+    xdp_statistics stats = {};
+    socklen_t stats_size = sizeof(stats);
+    if (::getsockopt(_xsk_fd, SOL_XDP, XDP_STATISTICS, &stats, &stats_size) == 0) {
+        UHD_LOG_DEBUG(LOG_ID,
+            "Dropped packets on " << _ifname << " queue " << _queue_id << ": "
+                                  << stats.rx_dropped << " (RX ring full: "
+                                  << stats.rx_ring_full << ", fill ring empty: "
+                                  << stats.rx_fill_ring_empty_descs << ")");
+    }
+    _unmap_ring(_rx_ring);
+    _unmap_ring(_fill_ring);
+    _unmap_ring(_tx_ring);
+    _unmap_ring(_comp_ring);
+    ::close(_xsk_fd);
+}
+
+udp_xdp_link::sptr udp_xdp_link::make(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const xdp_params_t& xdp_params)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+    if (params.recv_frame_size > get_max_frame_size(xdp_params)
+        || params.send_frame_size > get_max_frame_size(xdp_params)) {
+        throw uhd::value_error("AF_XDP frame sizes are limited to "
+                               + std::to_string(get_max_frame_size(xdp_params))
+                               + " bytes");
+    }
+    if (params.recv_batch_size > 1) {
+        UHD_LOG_DEBUG(LOG_ID,
+            "Ignoring recv_batch_size, AF_XDP links always receive in batches");
+    }
+    return sptr(new udp_xdp_link(addr, port, params, xdp_params));
+}
+
+udp_xdp_link::xdp_params_t udp_xdp_link::get_xdp_params(
+    const uhd::device_addr_t& device_args, const uhd::device_addr_t& link_args)
+{
+    auto get_arg = [&](const std::string& key) -> std::string {
+        return link_args.has_key(key) ? link_args[key] : device_args.get(key, "");
+    };
+    auto get_number = [&](const std::string& key, const size_t default_value) {
+        const std::string value = get_arg(key);
+        if (value.empty()) {
+            return default_value;
+        }
+        try {
+            return static_cast<size_t>(std::stoul(value));
+        } catch (const std::exception&) {
+            throw uhd::value_error("Invalid value for " + key + ": " + value);
+        }
+    };
+
+    xdp_params_t xdp_params;
+    const std::string mode = get_arg("xdp_mode");
+    if (mode == "native") {
+        xdp_params.mode = xdp_mode_t::NATIVE;
+    } else if (mode == "generic") {
+        xdp_params.mode = xdp_mode_t::GENERIC;
+    } else if (!mode.empty() && mode != "auto") {
+        throw uhd::value_error("Invalid value for xdp_mode: " + mode
+                               + " (must be auto, native or generic)");
+    }
+    xdp_params.queue_id = static_cast<uint32_t>(get_number("xdp_queue", 0));
+    if (xdp_params.queue_id >= MAX_NUM_QUEUES) {
+        throw uhd::value_error("xdp_queue must be less than "
+                               + std::to_string(MAX_NUM_QUEUES));
+    }
+    xdp_params.chunk_size = get_number("xdp_chunk_size", xdp_params.chunk_size);
+    const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    if (xdp_params.chunk_size < 2048 || xdp_params.chunk_size > page_size
+        || (xdp_params.chunk_size & (xdp_params.chunk_size - 1))) {
+        throw uhd::value_error("xdp_chunk_size must be a power of 2 from 2048 to "
+                               + std::to_string(page_size));
+    }
+    xdp_params.busy_poll_us = static_cast<uint32_t>(get_number("xdp_busy_poll", 0));
+    return xdp_params;
+}
+
+size_t udp_xdp_link::get_max_frame_size(const xdp_params_t& xdp_params)
+{
+    return xdp_params.chunk_size - XDP_PACKET_HEADROOM - XDP_UDP_HEADERS_SIZE;
+}
+
+uint16_t udp_xdp_link::get_local_port() const
+{
+    return _socket->local_endpoint().port();
+}
+
+std::string udp_xdp_link::get_local_addr() const
+{
+    return _socket->local_endpoint().address().to_string();
+}
+
+/******************************************************************************
+ * Receive path
+ *****************************************************************************/
+size_t udp_xdp_link::get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    while (true) {
+        if (_rx_cons == _rx_prod) {
+            // Publish the consumed entries and check for new ones together
+            _rx_ring.consumer->store(_rx_cons, std::memory_order_release);
+            _rx_prod = _rx_ring.producer->load(std::memory_order_acquire);
+            if (_rx_cons == _rx_prod) {
+                _refill();
+                if (!_wait_for_recv(timeout_ms)) {
+                    return 0;
+                }
+                continue;
+            }
+        }
+
+        const xdp_desc& desc = _rx_ring.entries[_rx_cons & _rx_ring.mask];
+        _rx_cons++;
+        const uint64_t chunk  = desc.addr & ~static_cast<uint64_t>(_chunk_size - 1);
+        const uint8_t* packet = _umem + desc.addr;
+
+        // The XDP program only checked the destination, so packets for this
+        // port from other senders end up here, too
+        uint32_t src_ip   = 0;
+        uint16_t src_port = 0;
+        size_t udp_len    = 0;
+        if (desc.len >= XDP_UDP_HEADERS_SIZE) {
+            std::memcpy(&src_ip, packet + IP_SRC_OFFSET, sizeof(src_ip));
+            std::memcpy(&src_port, packet + UDP_SRC_PORT_OFFSET, sizeof(src_port));
+            udp_len = load_be16(packet + UDP_LEN_OFFSET);
+        }
+        if (src_ip != _remote_ip || src_port != _remote_port
+            || udp_len <= UDP_HEADER_SIZE || UDP_OFFSET + udp_len > desc.len) {
+            _fill_pending.push_back(chunk);
+            continue;
+        }
+
+        auto& xdp_buff = static_cast<udp_xdp_frame_buff&>(buff);
+        xdp_buff.chunk = chunk;
+        xdp_buff.set_data(_umem + desc.addr + XDP_UDP_HEADERS_SIZE);
+        return udp_len - UDP_HEADER_SIZE;
+    }
+}
+
+void udp_xdp_link::release_recv_buff_derived(frame_buff& buff)
+{
+    auto& xdp_buff = static_cast<udp_xdp_frame_buff&>(buff);
+    _fill_pending.push_back(xdp_buff.chunk);
+    xdp_buff.chunk = udp_xdp_frame_buff::NO_CHUNK;
+    if (_fill_pending.size() >= FILL_BATCH_SIZE) {
+        _refill();
+    }
+}
+
+void udp_xdp_link::_refill()
+{
+    if (_fill_pending.empty()) {
+        return;
+    }
+    // There are as many entries as receive chunks, so the ring can't overflow
+    for (const uint64_t chunk : _fill_pending) {
+        _fill_ring.entries[_fill_prod & _fill_ring.mask] = chunk;
+        _fill_prod++;
+    }
+    _fill_ring.producer->store(_fill_prod, std::memory_order_release);
+    _fill_pending.clear();
+}
+
+bool udp_xdp_link::_wait_for_recv(int32_t timeout_ms)
+{
+    if (!_busy_poll) {
+        pollfd pfd = {};
+        pfd.fd     = _xsk_fd;
+        pfd.events = POLLIN;
+        return ::poll(&pfd, 1, timeout_ms) > 0;
+    }
+
+    // Let the kernel poll the driver in this thread until packets arrive
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (true) {
+        ::recvfrom(_xsk_fd, nullptr, 0, MSG_DONTWAIT, nullptr, nullptr);
+        if (_rx_ring.producer->load(std::memory_order_acquire) != _rx_cons) {
+            return true;
+        }
+        if (timeout_ms >= 0 && std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+    }
+}
+
+/******************************************************************************
+ * Send path
+ *****************************************************************************/
+bool udp_xdp_link::get_send_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    auto& xdp_buff = static_cast<udp_xdp_frame_buff&>(buff);
+    // Buffers which were released without a packet still own their chunk
+    if (xdp_buff.chunk == udp_xdp_frame_buff::NO_CHUNK) {
+        if (_free_send_chunks.empty()) {
+            _reap_completions();
+        }
+        if (_free_send_chunks.empty()) {
+            // Wait for the kernel to finish sending
+            const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+            do {
+                if (timeout_ms >= 0 && std::chrono::steady_clock::now() >= deadline) {
+                    return false;
+                }
+                _kick_send();
+            } while (_free_send_chunks.empty());
+        }
+        xdp_buff.chunk = _free_send_chunks.back();
+        _free_send_chunks.pop_back();
+    }
+    xdp_buff.set_data(_umem + xdp_buff.chunk + XDP_UDP_HEADERS_SIZE);
+    return true;
+}
+
+void udp_xdp_link::release_send_buff_derived(frame_buff& buff)
+{
+    _push_send_buff(static_cast<udp_xdp_frame_buff&>(buff));
+    _tx_ring.producer->store(_tx_prod, std::memory_order_release);
+    _kick_send();
+}
+
+void udp_xdp_link::release_send_buffs_derived(
+    frame_buff* const* buffs, size_t num_buffs)
+{
+    for (size_t i = 0; i < num_buffs; i++) {
+        _push_send_buff(static_cast<udp_xdp_frame_buff&>(*buffs[i]));
+    }
+    _tx_ring.producer->store(_tx_prod, std::memory_order_release);
+    _kick_send();
+}
+
+void udp_xdp_link::_push_send_buff(udp_xdp_frame_buff& buff)
+{
+    const size_t udp_len = UDP_HEADER_SIZE + buff.packet_size();
+    uint8_t* packet      = _umem + buff.chunk;
+    std::memcpy(packet, _header_template.data(), _header_template.size());
+    store_be16(packet + IP_LEN_OFFSET, static_cast<uint16_t>(IP_HEADER_SIZE + udp_len));
+    store_be16(packet + IP_ID_OFFSET, _ip_id++);
+    store_be16(packet + IP_CHECKSUM_OFFSET, ip_checksum(packet + IP_OFFSET));
+    store_be16(packet + UDP_LEN_OFFSET, static_cast<uint16_t>(udp_len));
+
+    // There are as many entries as send chunks, so the ring can't overflow
+    xdp_desc& desc = _tx_ring.entries[_tx_prod & _tx_ring.mask];
+    desc.addr      = buff.chunk;
+    desc.len       = static_cast<uint32_t>(UDP_OFFSET + udp_len);
+    desc.options   = 0;
+    _tx_prod++;
+    // The chunk belongs to the kernel until the packet is sent
+    buff.chunk = udp_xdp_frame_buff::NO_CHUNK;
+}
+
+void udp_xdp_link::_kick_send()
+{
+    if (_zero_copy) {
+        // The driver only needs a wakeup if it went to sleep
+        if (_tx_ring.flags->load(std::memory_order_relaxed) & XDP_RING_NEED_WAKEUP) {
+            ::sendto(_xsk_fd, nullptr, 0, MSG_DONTWAIT, nullptr, 0);
+        }
+    } else {
+        // In copy mode, the kernel sends a limited number of packets per call
+        while (_tx_ring.consumer->load(std::memory_order_acquire) != _tx_prod) {
+            if (::sendto(_xsk_fd, nullptr, 0, MSG_DONTWAIT, nullptr, 0) < 0
+                && errno != EAGAIN && errno != EBUSY && errno != ENOBUFS) {
+                UHD_LOG_DEBUG(LOG_ID, "AF_XDP send failed: " << errno_string());
+                break;
+            }
+        }
+    }
+    _reap_completions();
+}
+
+void udp_xdp_link::_reap_completions()
+{
+    const uint32_t comp_prod = _comp_ring.producer->load(std::memory_order_acquire);
+    if (comp_prod == _comp_cons) {
+        return;
+    }
+    for (; _comp_cons != comp_prod; _comp_cons++) {
+        _free_send_chunks.push_back(_comp_ring.entries[_comp_cons & _comp_ring.mask]);
+    }
+    _comp_ring.consumer->store(_comp_cons, std::memory_order_release);
+}
@@ -60,8 +60,15 @@ static void check_registry_for_fast_send_threshold(const size_t mtu)
 class udp_zero_copy_asio_mrb : public managed_recv_buffer
 {
 public:
-    udp_zero_copy_asio_mrb(void* mem, int sock_fd, const size_t frame_size)
-        : _mem(mem), _sock_fd(sock_fd), _frame_size(frame_size), _len(0)
+    udp_zero_copy_asio_mrb(void* mem,
+        int sock_fd,
+        const size_t frame_size,
+        udp_recv_batcher* batcher = nullptr)
+        : _mem(mem)
+        , _sock_fd(sock_fd)
+        , _frame_size(frame_size)
+        , _len(0)
+        , _batcher(batcher)
     { /*NOP*/
     }
 
@@ -76,7 +83,8 @@ public:
             return sptr();
 
         const int32_t timeout_ms = static_cast<int32_t>(timeout * 1000);
-        _len = recv_udp_packet(_sock_fd, _mem, _frame_size, timeout_ms);
+        _len = _batcher ? _batcher->recv(_mem, timeout_ms)
+                        : recv_udp_packet(_sock_fd, _mem, _frame_size, timeout_ms);
 
         if (_len > 0) {
             index++;
@@ -92,6 +100,7 @@ private:
     int _sock_fd;
     size_t _frame_size;
     ssize_t _len;
+    udp_recv_batcher* _batcher;
     simple_claimer _claimer;
 };
 
@@ -142,13 +151,15 @@ public:
 
     udp_zero_copy_asio_impl(const std::string& addr,
         const std::string& port,
-        const zero_copy_xport_params& xport_params)
+        const zero_copy_xport_params& xport_params,
+        const size_t recv_batch_size)
         : _recv_frame_size(xport_params.recv_frame_size)
         , _num_recv_frames(xport_params.num_recv_frames)
         , _send_frame_size(xport_params.send_frame_size)
         , _num_send_frames(xport_params.num_send_frames)
         , _recv_buffer_pool(buffer_pool::make(
-              xport_params.num_recv_frames, xport_params.recv_frame_size))
+              xport_params.num_recv_frames + (recv_batch_size > 1 ? recv_batch_size : 0),
+              xport_params.recv_frame_size))
         , _send_buffer_pool(buffer_pool::make(
               xport_params.num_send_frames, xport_params.send_frame_size))
         , _next_recv_buff_index(0)
@@ -167,10 +178,24 @@ public:
         UHD_LOGGER_TRACE("UDP") << boost::format("Local UDP socket endpoint: %s:%s")
                                        % get_local_addr() % get_local_port();
 
+        // set up the batched receiver on the frames following the managed
+        // receive buffers
+        if (recv_batch_size > 1) {
+            std::vector<void*> staging_frames;
+            for (size_t i = 0; i < recv_batch_size; i++) {
+                staging_frames.push_back(_recv_buffer_pool->at(_num_recv_frames + i));
+            }
+            _recv_batcher = std::make_unique<udp_recv_batcher>(
+                _sock_fd, get_recv_frame_size(), staging_frames);
+        }
+
         // allocate re-usable managed receive buffers
         for (size_t i = 0; i < get_num_recv_frames(); i++) {
             _mrb_pool.push_back(std::make_shared<udp_zero_copy_asio_mrb>(
-                _recv_buffer_pool->at(i), _sock_fd, get_recv_frame_size()));
+                _recv_buffer_pool->at(i),
+                _sock_fd,
+                get_recv_frame_size(),
+                _recv_batcher.get()));
         }
 
         // allocate re-usable managed send buffers
@@ -250,6 +275,7 @@ private:
     std::vector<std::shared_ptr<udp_zero_copy_asio_msb>> _msb_pool;
     std::vector<std::shared_ptr<udp_zero_copy_asio_mrb>> _mrb_pool;
     size_t _next_recv_buff_index, _next_send_buff_index;
+    std::unique_ptr<udp_recv_batcher> _recv_batcher;
 
     // asio guts -> socket and service
     asio::io_context _io_context;
@@ -332,8 +358,29 @@ udp_zero_copy::sptr udp_zero_copy::make(const std::string& addr,
     }
 #endif
 
+    size_t recv_batch_size =
+        hints.cast<size_t>("recv_batch_size", UDP_DEFAULT_RECV_BATCH_SIZE);
+#ifdef UHD_PLATFORM_LINUX
+    if (recv_batch_size > UDP_MAX_RECV_BATCH_SIZE) {
+        UHD_LOG_WARNING("UDP",
+            "Requested recv_batch_size of " << recv_batch_size
+                                            << " exceeds the maximum, using "
+                                            << UDP_MAX_RECV_BATCH_SIZE);
+        recv_batch_size = UDP_MAX_RECV_BATCH_SIZE;
+    }
+#else
+    if (recv_batch_size > 1) {
+        UHD_LOG_WARNING("UDP",
+            "Batched receive is not supported on this platform, ignoring "
+            "recv_batch_size="
+                << recv_batch_size);
+        recv_batch_size = 1;
+    }
+#endif
+    UHD_LOG_TRACE("UDP", "recv_batch_size: " << recv_batch_size);
+
     udp_zero_copy_asio_impl::sptr udp_trans(
-        new udp_zero_copy_asio_impl(addr, port, xport_params));
+        new udp_zero_copy_asio_impl(addr, port, xport_params, recv_batch_size));
 
     // call the helper to resize send and recv buffers
     buff_params_out.recv_buff_size = resize_udp_socket_buffer_with_warning(
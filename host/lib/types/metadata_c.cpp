@@ -37,6 +37,18 @@ uhd_error uhd_rx_metadata_time_spec(
         *frac_secs_out = time_spec_cpp.get_frac_secs();)
 }
 
+uhd_error uhd_rx_metadata_tick_time(uhd_rx_metadata_handle h,
+    int64_t* ticks_out,
+    uint64_t* rate_num_out,
+    uint64_t* rate_den_out)
+{
+    UHD_SAFE_C_SAVE_ERROR(
+        h, const uhd::tick_time_t& tick_time_cpp = h->rx_metadata_cpp.tick_time;
+        *ticks_out    = tick_time_cpp.get_ticks();
+        *rate_num_out = tick_time_cpp.get_rate().get_num();
+        *rate_den_out = tick_time_cpp.get_rate().get_den();)
+}
+
 uhd_error uhd_rx_metadata_more_fragments(uhd_rx_metadata_handle h, bool* result_out)
 {
     UHD_SAFE_C_SAVE_ERROR(h, *result_out = h->rx_metadata_cpp.more_fragments;)
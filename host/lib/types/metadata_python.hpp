@@ -70,7 +70,8 @@ void export_metadata(py::module& m)
         .def_readonly("start_of_burst", &rx_metadata_t::start_of_burst)
         .def_readonly("end_of_burst", &rx_metadata_t::end_of_burst)
         .def_readonly("error_code", &rx_metadata_t::error_code)
-        .def_readonly("out_of_sequence", &rx_metadata_t::out_of_sequence);
+        .def_readonly("out_of_sequence", &rx_metadata_t::out_of_sequence)
+        .def_readonly("tick_time", &rx_metadata_t::tick_time);
 
     py::class_<tx_metadata_t>(m, "tx_metadata")
         .def(py::init<>())
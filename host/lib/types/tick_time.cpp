@@ -0,0 +1,209 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/types/tick_time.hpp>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+using namespace uhd;
+
+namespace {
+//! Largest denominator of a rate approximated from a real-valued rate
+constexpr uint64_t MAX_RATE_DEN = uint64_t(1) << 20;
+
+//! Multiply two rate factors, return false if the product doesn't fit
+bool checked_mul(const uint64_t lhs, const uint64_t rhs, uint64_t& result)
+{
+    if (lhs > std::numeric_limits<uint64_t>::max() / rhs) {
+        return false;
+    }
+    result = lhs * rhs;
+    return true;
+}
+
+//! Scale a tick count to a finer rate, return false if the result doesn't fit
+bool checked_scale(const int64_t ticks, const uint64_t factor, int64_t& result)
+{
+    constexpr int64_t max_ticks = std::numeric_limits<int64_t>::max();
+    constexpr int64_t min_ticks = std::numeric_limits<int64_t>::min();
+    if (factor > uint64_t(max_ticks) || ticks > max_ticks / int64_t(factor)
+        || ticks < min_ticks / int64_t(factor)) {
+        return false;
+    }
+    result = ticks * int64_t(factor);
+    return true;
+}
+
+void throw_out_of_range()
+{
+    throw uhd::overflow_error("tick_time_t: time is out of range at the common tick "
+                              "rate");
+}
+} // namespace
+
+/***********************************************************************
+ * Tick rate
+ **********************************************************************/
+tick_time_t::rate_t::rate_t(uint64_t num, uint64_t den)
+{
+    if (num == 0 or den == 0) {
+        throw uhd::value_error("tick rate numerator and denominator must not be zero");
+    }
+    const uint64_t divisor = std::gcd(num, den);
+    _num                   = num / divisor;
+    _den                   = den / divisor;
+}
+
+tick_time_t::rate_t tick_time_t::rate_t::from_double(double rate)
+{
+    if (not(rate > 0) or not std::isfinite(rate)) {
+        throw uhd::value_error("tick rate must be positive");
+    }
+    // Continued fraction expansion, which ends as soon as the fraction is as
+    // close to the rate as double precision can tell
+    const double tolerance = rate * 4 * std::numeric_limits<double>::epsilon();
+    uint64_t num_prev = 0;
+    uint64_t den_prev = 1;
+    uint64_t num      = 1;
+    uint64_t den      = 0;
+    double x          = rate;
+    while (true) {
+        const double a          = std::floor(x);
+        const uint64_t num_next = uint64_t(a) * num + num_prev;
+        const uint64_t den_next = uint64_t(a) * den + den_prev;
+        if (den_next > MAX_RATE_DEN) {
+            break;
+        }
+        num_prev = num;
+        den_prev = den;
+        num      = num_next;
+        den      = den_next;
+        if (std::abs(double(num) / double(den) - rate) <= tolerance or x == a) {
+            break;
+        }
+        x = 1.0 / (x - a);
+    }
+    return rate_t(num, den);
+}
+
+double tick_time_t::rate_t::to_double(void) const
+{
+    return double(_num) / double(_den);
+}
+
+bool uhd::operator==(const tick_time_t::rate_t& lhs, const tick_time_t::rate_t& rhs)
+{
+    return lhs.get_num() == rhs.get_num() and lhs.get_den() == rhs.get_den();
+}
+
+/***********************************************************************
+ * Tick time
+ **********************************************************************/
+tick_time_t::tick_time_t(int64_t ticks, const rate_t& rate) : _ticks(ticks), _rate(rate)
+{
+}
+
+time_spec_t tick_time_t::to_time_spec(void) const
+{
+    // seconds = ticks * den / num, split into whole ticks per second first so
+    // the products can't overflow for any tick count
+    const int64_t num = int64_t(_rate.get_num());
+    const int64_t den = int64_t(_rate.get_den());
+    int64_t whole     = _ticks / num;
+    int64_t rest      = _ticks % num;
+    if (rest < 0) {
+        whole -= 1;
+        rest += num;
+    }
+    const int64_t rest_scaled = rest * den;
+    return time_spec_t(
+        whole * den + rest_scaled / num, double(rest_scaled % num) / double(num));
+}
+
+bool tick_time_t::_to_common_rate(tick_time_t& rhs)
+{
+    // The least common multiple of two reduced fractions is the least common
+    // multiple of their numerators over the greatest common divisor of their
+    // denominators, and each rate divides it an integer number of times
+    const uint64_t num_gcd = std::gcd(_rate.get_num(), rhs._rate.get_num());
+    const uint64_t den_gcd = std::gcd(_rate.get_den(), rhs._rate.get_den());
+    // Compute everything before assigning, so an overflow leaves both unchanged
+    uint64_t rate_num, factor, rhs_factor;
+    int64_t ticks, rhs_ticks;
+    if (!checked_mul(_rate.get_num() / num_gcd, rhs._rate.get_num(), rate_num)
+        || !checked_mul(
+            rhs._rate.get_num() / num_gcd, _rate.get_den() / den_gcd, factor)
+        || !checked_mul(
+            _rate.get_num() / num_gcd, rhs._rate.get_den() / den_gcd, rhs_factor)
+        || !checked_scale(_ticks, factor, ticks)
+        || !checked_scale(rhs._ticks, rhs_factor, rhs_ticks)) {
+        return false;
+    }
+    const rate_t rate(rate_num, den_gcd);
+    _ticks     = ticks;
+    _rate      = rate;
+    rhs._ticks = rhs_ticks;
+    rhs._rate  = rate;
+    return true;
+}
+
+tick_time_t& tick_time_t::operator+=(const tick_time_t& rhs)
+{
+    if (_rate == rhs._rate) {
+        _ticks += rhs._ticks;
+    } else {
+        tick_time_t common_rhs = rhs;
+        if (!_to_common_rate(common_rhs)) {
+            throw_out_of_range();
+        }
+        _ticks += common_rhs._ticks;
+    }
+    return *this;
+}
+
+tick_time_t& tick_time_t::operator-=(const tick_time_t& rhs)
+{
+    if (_rate == rhs._rate) {
+        _ticks -= rhs._ticks;
+    } else {
+        tick_time_t common_rhs = rhs;
+        if (!_to_common_rate(common_rhs)) {
+            throw_out_of_range();
+        }
+        _ticks -= common_rhs._ticks;
+    }
+    return *this;
+}
+
+bool tick_time_t::add_rounded(const tick_time_t& rhs)
+{
+    if (_rate == rhs._rate) {
+        _ticks += rhs._ticks;
+        return true;
+    }
+    tick_time_t common_rhs = rhs;
+    if (_to_common_rate(common_rhs)) {
+        _ticks += common_rhs._ticks;
+        return true;
+    }
+    // rhs * (num / den) / (rhs_num / rhs_den), in floating point. rhs is
+    // usually a short sample offset, so this is exact to well below one tick.
+    _ticks += std::llround(
+        double(rhs._ticks) * _rate.to_double() / rhs._rate.to_double());
+    return false;
+}
+
+bool uhd::operator==(const tick_time_t& lhs, const tick_time_t& rhs)
+{
+    if (lhs.get_rate() == rhs.get_rate()) {
+        return lhs.get_ticks() == rhs.get_ticks();
+    }
+    tick_time_t common_lhs = lhs;
+    common_lhs -= rhs;
+    return common_lhs.get_ticks() == 0;
+}
@@ -8,6 +8,7 @@
 #ifndef INCLUDED_UHD_TIME_SPEC_PYTHON_HPP
 #define INCLUDED_UHD_TIME_SPEC_PYTHON_HPP
 
+#include <uhd/types/tick_time.hpp>
 #include <uhd/types/time_spec.hpp>
 #include <pybind11/operators.h>
 
@@ -45,6 +46,41 @@ void export_time_spec(py::module& m)
         .def(py::self -= double())
         .def(py::self + double())
         .def(py::self - double());
+
+    using tick_time_t = uhd::tick_time_t;
+
+    py::class_<tick_time_t> tick_time(m, "tick_time");
+
+    py::class_<tick_time_t::rate_t>(tick_time, "rate")
+        .def(py::init<uint64_t, uint64_t>(), py::arg("num") = 1, py::arg("den") = 1)
+
+        // Methods
+        .def_static("from_double", &tick_time_t::rate_t::from_double)
+
+        .def("get_num", &tick_time_t::rate_t::get_num)
+        .def("get_den", &tick_time_t::rate_t::get_den)
+        .def("to_double", &tick_time_t::rate_t::to_double)
+
+        .def(py::self == py::self)
+        .def(py::self != py::self);
+
+    tick_time
+        .def(py::init<int64_t, const tick_time_t::rate_t&>(),
+            py::arg("ticks")     = 0,
+            py::arg("tick_rate") = tick_time_t::rate_t())
+
+        // Methods
+        .def("get_ticks", &tick_time_t::get_ticks)
+        .def("get_rate", &tick_time_t::get_rate)
+        .def("to_time_spec", &tick_time_t::to_time_spec)
+
+        .def(py::self == py::self)
+        .def(py::self != py::self)
+
+        .def(py::self += tick_time_t())
+        .def(py::self -= tick_time_t())
+        .def(py::self + tick_time_t())
+        .def(py::self - tick_time_t());
 }
 
 #endif /* INCLUDED_UHD_TIME_SPEC_PYTHON_HPP */
@@ -294,7 +294,8 @@ chdr_tx_data_xport::uptr b300_mb_iface::make_tx_data_transport(
         send_link->get_num_send_frames(),
         fc_params,
         strc_pyld,
-        disconnect_cb);
+        disconnect_cb,
+        xport_args);
 }
 
 std::map<std::string, uhd::device_addr_t> b300_mb_iface::get_chdr_xport_adapters()
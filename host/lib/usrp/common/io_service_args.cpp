@@ -18,6 +18,7 @@ static const char* send_offload_str             = "send_offload";
 static const char* recv_offload_wait_mode_str   = "recv_offload_wait_mode";
 static const char* send_offload_wait_mode_str   = "send_offload_wait_mode";
 static const char* num_poll_offload_threads_str = "num_poll_offload_threads";
+static const char* poll_offload_rebalance_str   = "poll_offload_rebalance";
 
 static const std::regex recv_offload_thread_cpu_expr("^recv_offload_thread_(\\d+)_cpu");
 static const std::regex send_offload_thread_cpu_expr("^send_offload_thread_(\\d+)_cpu");
@@ -77,6 +78,9 @@ io_service_args_t read_io_service_args(
         io_srv_args.num_poll_offload_threads = 1;
     }
 
+    io_srv_args.poll_offload_rebalance = get_bool_arg(
+        args, poll_offload_rebalance_str, defaults.poll_offload_rebalance);
+
     auto read_thread_args = [&args](
                                 const std::regex& expr, std::map<size_t, size_t>& dest) {
         auto keys = args.keys();
@@ -119,6 +123,7 @@ device_addr_t merge_io_service_dev_args(
     merge_args(dev_args, args, recv_offload_wait_mode_str);
     merge_args(dev_args, args, send_offload_wait_mode_str);
     merge_args(dev_args, args, num_poll_offload_threads_str);
+    merge_args(dev_args, args, poll_offload_rebalance_str);
 
     auto merge_thread_args = [&merge_args](const device_addr_t& dev_args,
                                  device_addr_t& stream_args,
@@ -279,6 +279,10 @@ io_service::sptr blocking_io_service_mgr::_create_new_io_service(
  * number of I/O services specified by the user in stream_args, and distributes
  * links among them. New connections always go to the offload thread containing
  * the fewest connections, with lowest numbered thread as a second criterion.
+ *
+ * If rebalancing is requested, a single I/O service with the requested number
+ * of threads services all connections instead, and moves them between its
+ * threads based on their load.
  */
 class polling_io_service_mgr
 {
@@ -303,12 +307,19 @@ private:
     io_service::sptr _create_new_io_service(
         const io_service_args_t& args, const size_t thread_index);
 
+    io_service::sptr _create_balanced_io_service(const io_service_args_t& args);
+
     // Map of links to I/O service
     using link_pair_t = std::pair<recv_link_if::sptr, send_link_if::sptr>;
     std::map<link_pair_t, link_info_t> _link_info_map;
 
     // For each I/O service, keep track of the number of connections
     std::map<io_service::sptr, io_srv_info_t> _io_srv_info_map;
+
+    // I/O service shared by all connections if rebalancing is requested, and
+    // the number of link pairs attached to it
+    io_service::sptr _balanced_io_srv;
+    size_t _balanced_link_count = 0;
 };
 
 io_service::sptr polling_io_service_mgr::connect_links(recv_link_if::sptr recv_link,
@@ -321,7 +332,9 @@ io_service::sptr polling_io_service_mgr::connect_links(recv_link_if::sptr recv_l
     if (it != _link_info_map.end()) {
         // Muxing links, add to mux ref count and connection count
         it->second.mux_ref_count++;
-        _io_srv_info_map[it->second.io_srv].connection_count++;
+        if (it->second.io_srv != _balanced_io_srv) {
+            _io_srv_info_map[it->second.io_srv].connection_count++;
+        }
         return it->second.io_srv;
     }
 
@@ -329,7 +342,16 @@ io_service::sptr polling_io_service_mgr::connect_links(recv_link_if::sptr recv_l
     // the args, create a new service and add the links to it. Otherwise, add it
     // to the service that has the fewest connections.
     io_service::sptr io_srv;
-    if (_io_srv_info_map.size() < args.num_poll_offload_threads) {
+    if (args.poll_offload_rebalance && args.num_poll_offload_threads > 1) {
+        // All links share one I/O service, which balances them across its
+        // threads
+        if (!_balanced_io_srv) {
+            _balanced_io_srv = _create_balanced_io_service(args);
+        }
+        io_srv                = _balanced_io_srv;
+        _link_info_map[links] = {io_srv, 1 /*mux_ref_count*/};
+        _balanced_link_count++;
+    } else if (_io_srv_info_map.size() < args.num_poll_offload_threads) {
         const size_t thread_index = _io_srv_info_map.size();
         io_srv                    = _create_new_io_service(args, thread_index);
         _link_info_map[links]     = {io_srv, 1 /*mux_ref_count*/};
@@ -374,7 +396,11 @@ void polling_io_service_mgr::disconnect_links(
         }
 
         _link_info_map.erase(it);
-        _io_srv_info_map.erase(io_srv);
+        if (io_srv != _balanced_io_srv) {
+            _io_srv_info_map.erase(io_srv);
+        } else if (--_balanced_link_count == 0) {
+            _balanced_io_srv.reset();
+        }
     }
 }
 
@@ -401,6 +427,25 @@ io_service::sptr polling_io_service_mgr::_create_new_io_service(
     return offload_io_service::make(inline_io_service::make(), params);
 }
 
+io_service::sptr polling_io_service_mgr::_create_balanced_io_service(
+    const io_service_args_t& args)
+{
+    offload_io_service::params_t params;
+    params.client_type = offload_io_service::BOTH_SEND_AND_RECV;
+    params.wait_mode   = offload_io_service::POLL;
+    params.num_threads = args.num_poll_offload_threads;
+
+    for (const auto& thread_cpu : args.poll_offload_thread_cpu) {
+        params.thread_cpu_affinity[thread_cpu.first] = {thread_cpu.second};
+    }
+
+    UHD_LOG_INFO(LOG_ID,
+        "Creating new polling I/O service with " << params.num_threads
+                                                 << " load-balanced threads");
+
+    return offload_io_service::make(inline_io_service::make(), params);
+}
+
 /* Main I/O service manager implementation class
  *
  * Composite I/O service manager that dispatches requests to other managers,
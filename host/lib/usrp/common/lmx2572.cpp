@@ -52,10 +52,12 @@ public:
     explicit lmx2572_impl(write_fn_t&& poke_fn,
         read_fn_t&& peek_fn,
         sleep_fn_t&& sleep_fn,
-        const std::string& unique_id = "")
+        const std::string& unique_id = "",
+        write_batch_fn_t&& poke_batch_fn = nullptr)
         : _poke16(std::move(poke_fn))
         , _peek16(std::move(peek_fn))
         , _sleep(std::move(sleep_fn))
+        , _poke16_batch(std::move(poke_batch_fn))
         , _regs()
         , _log_id(unique_id.empty() ? LOG_ID : unique_id + "::" + LOG_ID)
     {
@@ -66,14 +68,23 @@ public:
     {
         UHD_LOG_TRACE(_log_id, "Storing register cache to LMX2572...");
         const auto changed_addrs = _regs.get_changed_addrs<uint8_t>();
+        std::vector<std::pair<uint8_t, uint16_t>> writes;
+        writes.reserve(changed_addrs.size() + 1);
         for (const auto addr : changed_addrs) {
             // We write R0 last, for double-buffering
             if (addr == 0) {
                 continue;
             }
-            _poke16(addr, _regs.get_reg(addr));
+            writes.emplace_back(addr, _regs.get_reg(addr));
+        }
+        writes.emplace_back(0, _regs.get_reg(0));
+        if (_poke16_batch) {
+            _poke16_batch(writes);
+        } else {
+            for (const auto& write : writes) {
+                _poke16(write.first, write.second);
+            }
         }
-        _poke16(0, _regs.get_reg(0));
         _regs.save_state();
         UHD_LOG_TRACE(_log_id,
             "Storing cache complete: Updated " << changed_addrs.size() << " registers.");
@@ -371,6 +382,30 @@ public:
         return actual_freq;
     }
 
+    tune_plan_t make_tune_plan(
+        const double target_freq, const double fOSC, const bool spur_dodging) override
+    {
+        // Do the calculations on the register cache, and restore it afterwards
+        const std::vector<uint16_t> saved_regs = _get_regs();
+        tune_plan_t plan;
+        try {
+            plan.freq = set_frequency(target_freq, fOSC, spur_dodging);
+        } catch (...) {
+            _set_regs(saved_regs);
+            throw;
+        }
+        plan.regs = _get_regs();
+        _set_regs(saved_regs);
+        return plan;
+    }
+
+    double set_tune_plan(const tune_plan_t& plan) override
+    {
+        UHD_ASSERT_THROW(plan.regs.size() == size_t(_regs.get_num_regs()));
+        _set_regs(plan.regs);
+        return plan.freq;
+    }
+
 private:
     /**************************************************************************
      * Attributes
@@ -378,6 +413,7 @@ private:
     write_fn_t _poke16;
     read_fn_t _peek16;
     sleep_fn_t _sleep;
+    write_batch_fn_t _poke16_batch;
     lmx2572_regs_t _regs = lmx2572_regs_t();
     const std::string _log_id;
     bool _sync_mode = false;
@@ -449,6 +485,29 @@ private:
         return CAT1A;
     }
 
+    //! Returns the register cache, indexed by address
+    std::vector<uint16_t> _get_regs()
+    {
+        std::vector<uint16_t> regs(_regs.get_num_regs());
+        for (size_t addr = 0; addr < regs.size(); addr++) {
+            regs[addr] = _regs.get_reg(int(addr));
+        }
+        return regs;
+    }
+
+    //! Loads the register cache from values indexed by address, except RO registers
+    void _set_regs(const std::vector<uint16_t>& regs)
+    {
+        const auto ro_regs = _regs.get_ro_regs();
+        for (size_t addr = 0; addr < regs.size(); addr++) {
+            // Only touch registers which differ: R6 has overlapping fields, so
+            // loading its value would mark it as changed even if it's the same
+            if (!ro_regs.count(uint8_t(addr)) && _regs.get_reg(int(addr)) != regs[addr]) {
+                _regs.set_reg(int(addr), regs[addr]);
+            }
+        }
+    }
+
     /*! \brief Enable/disable register readback mode enabled.
      *
      * SPI MISO is multiplexed to lock detect and register readback. Reading
@@ -997,8 +1056,12 @@ private:
 lmx2572_iface::sptr lmx2572_iface::make(lmx2572_iface::write_fn_t&& poke_fn,
     lmx2572_iface::read_fn_t&& peek_fn,
     lmx2572_iface::sleep_fn_t&& sleep_fn,
-    const std::string& log_id)
+    const std::string& log_id,
+    lmx2572_iface::write_batch_fn_t&& poke_batch_fn)
 {
-    return std::make_shared<lmx2572_impl>(
-        std::move(poke_fn), std::move(peek_fn), std::move(sleep_fn), log_id);
+    return std::make_shared<lmx2572_impl>(std::move(poke_fn),
+        std::move(peek_fn),
+        std::move(sleep_fn),
+        log_id,
+        std::move(poke_batch_fn));
 }
@@ -153,6 +153,23 @@ public:
             (get_rx_id() == twinrx::TWINRX_REV_C_ID) ? 0.9e-6 : 0.9375e-6,
             AUTO_RESOLVE_ON_READ_WRITE);
 
+        // LO1 Tune Plans, for the LO1 synthesizer of this channel. The frequencies are
+        // synthesizer frequencies, as in los/LO1/freq/value.
+        const auto synth_ch = (_ch_name == "0") ? twinrx_ctrl::CH1 : twinrx_ctrl::CH2;
+        get_rx_subtree()
+            ->create<std::vector<double>>("los/LO1/tune_plans/freqs")
+            .add_coerced_subscriber([this, synth_ch](const std::vector<double>& freqs) {
+                _ctrl->set_lo1_tune_plan_freqs(synth_ch, freqs);
+            })
+            .set_publisher(
+                [this, synth_ch]() { return _ctrl->get_lo1_tune_plan_freqs(synth_ch); });
+        get_rx_subtree()
+            ->create<bool>("los/LO1/tune_plans/record")
+            .add_coerced_subscriber([this, synth_ch](const bool enable) {
+                _ctrl->set_lo1_tune_plan_recording(synth_ch, enable);
+            })
+            .set(false);
+
         // LO2 Charge Pump
         get_rx_subtree()
             ->create<meta_range_t>("los/LO2/charge_pump/range")
@@ -807,10 +807,12 @@ void hbx_cpld_ctrl::set_internal_sync_clk(const bool enable)
 hbx_cpld_ctrl::spi_transactor::spi_transactor(size_t start_address,
     poke_fn_type&& poke_fn,
     peek_fn_type&& peek_fn,
-    const bool queue)
+    const bool queue,
+    burst_poke_fn_type&& burst_poke_fn)
     : _start_address(start_address)
     , _poke32(std::move(poke_fn))
     , _peek32(std::move(peek_fn))
+    , _burst_poke32(std::move(burst_poke_fn))
     , _queue(queue)
 {
     std::stringstream ss;
@@ -869,15 +871,9 @@ void hbx_cpld_ctrl::spi_transactor::spi_transact(
         poll_spi_ready();
     }
     // As SPI is ready, setup the SPI transaction by writing into the SPI_SETUP
-    // register. The first _data_width number of bits is the data and the next
-    // _address_width number of bits is the address.
-    // Bit 30 indicates the type of transaction i.e READ=1 or WRITE=0.
-    // Bit 31 being set indicates start of transaction.
-    uint32_t setup_value = (1 << 31) | ((is_read ? 1 : 0) << 30)
-                           | ((addr & ((1 << _address_width) - 1)) << _data_width)
-                           | (data & ((1 << _data_width) - 1));
-
-    _poke32(_start_address + SPI_SETUP_OFFSET, setup_value, CHAN0);
+    // register.
+    _poke32(
+        _start_address + SPI_SETUP_OFFSET, get_setup_value(is_read, addr, data), CHAN0);
     // In the write case we are done at this point
 
     if (is_read) {
@@ -891,11 +887,42 @@ void hbx_cpld_ctrl::spi_transactor::spi_transact(
     }
 }
 
+uint32_t hbx_cpld_ctrl::spi_transactor::get_setup_value(
+    const bool is_read, const uint32_t addr, const uint32_t data) const
+{
+    // The first _data_width number of bits is the data and the next
+    // _address_width number of bits is the address.
+    // Bit 30 indicates the type of transaction i.e READ=1 or WRITE=0.
+    // Bit 31 being set indicates start of transaction.
+    return (1 << 31) | ((is_read ? 1 : 0) << 30)
+           | ((addr & ((1 << _address_width) - 1)) << _data_width)
+           | (data & ((1 << _data_width) - 1));
+}
+
 void hbx_cpld_ctrl::spi_transactor::spi_write(const uint32_t addr, const uint32_t data)
 {
     spi_transact(false, addr, data);
 }
 
+void hbx_cpld_ctrl::spi_transactor::spi_write(
+    const std::vector<std::pair<uint32_t, uint32_t>>& writes)
+{
+    if (!_queue || !_burst_poke32) {
+        for (const auto& [addr, data] : writes) {
+            spi_write(addr, data);
+        }
+        return;
+    }
+    // The SPI engine queues the transactions, so they can all go to the setup
+    // register in one command
+    std::vector<uint32_t> setup_values;
+    setup_values.reserve(writes.size());
+    for (const auto& [addr, data] : writes) {
+        setup_values.push_back(get_setup_value(false, addr, data));
+    }
+    _burst_poke32(_start_address + SPI_SETUP_OFFSET, setup_values, CHAN0);
+}
+
 uint32_t hbx_cpld_ctrl::spi_transactor::spi_read(const uint32_t addr)
 {
     spi_transact(true, addr);
@@ -103,6 +103,13 @@ std::shared_ptr<hbx_lo_ctrl> hbx_dboard_impl::_init_lo_ctrl(const uhd::direction
             // We don't do timed peeks, so no chan parameter here.
             return _reg_iface.peek32(_reg_base_address + addr);
         },
+        [this](const uint32_t addr,
+            const std::vector<uint32_t>& data,
+            const hbx_cpld_ctrl::chan_t chan) {
+            const auto time_spec = (chan == hbx_cpld_ctrl::NO_CHAN) ? time_spec_t::ASAP
+                                                                    : _time_accessor(0);
+            _reg_iface.burst_poke32(_reg_base_address + addr, data, time_spec);
+        },
         _prc_rate,
         [this] { return _time_accessor(0); });
     return lo_ctrl;
@@ -574,6 +581,18 @@ void hbx_dboard_impl::_init_lo_prop_tree(uhd::property_tree::sptr subtree,
         fe_path / "los" / HBX_LO / "freq" / "value",
         LMX2572_DEFAULT_FREQ,
         AUTO_RESOLVE_ON_WRITE);
+    // Tune plans: the desired value is the list of LO frequencies to make plans for,
+    // the coerced value the list of frequencies which have a plan.
+    expert_factory::add_dual_prop_node<std::vector<double>>(expert,
+        subtree,
+        fe_path / "los" / HBX_LO / "tune_plans" / "freqs",
+        {},
+        AUTO_RESOLVE_ON_WRITE);
+    expert_factory::add_prop_node<bool>(expert,
+        subtree,
+        fe_path / "los" / HBX_LO / "tune_plans" / "record",
+        false,
+        AUTO_RESOLVE_ON_WRITE);
 
 
     subtree->create<meta_range_t>(fe_path / "los" / HBX_LO / "freq/range")
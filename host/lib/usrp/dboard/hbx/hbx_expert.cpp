@@ -115,12 +115,30 @@ void hbx_lo_expert::resolve()
         _cpld->set_lo_switches_and_leds(_lo_export, _lo_import, _trx);
     }
 
+    if (_record_tune_plans.is_dirty()) {
+        _lo_ctrl->set_tune_plan_recording(_record_tune_plans);
+    }
+
+    // Plans are looked up by the clipped frequency that set_lo_freq() gets
+    if (_desired_tune_plan_freqs.is_dirty()) {
+        std::vector<double> clipped_freqs;
+        for (const double freq : _desired_tune_plan_freqs.get()) {
+            clipped_freqs.push_back(
+                std::max(LMX2572_MIN_FREQ, std::min(freq, LMX2572_MAX_FREQ)));
+        }
+        _lo_ctrl->set_tune_plan_freqs(clipped_freqs);
+    }
+
     // When ports have been set, we need to (re-)set the frequency to make sure the output
     // power is set properly (which LMX2572's set_frequency() does at the very end).
     const double clipped_lo_freq = std::max(
         LMX2572_MIN_FREQ, std::min(_desired_lo_frequency.get(), LMX2572_MAX_FREQ));
     _coerced_lo_frequency = _lo_ctrl->set_lo_freq(clipped_lo_freq);
     _desired_lo_ext_power = _get_external_lo_pwr(_coerced_lo_frequency, _lo_export);
+
+    if (_desired_tune_plan_freqs.is_dirty() || _record_tune_plans) {
+        _coerced_tune_plan_freqs = _lo_ctrl->get_tune_plan_freqs();
+    }
 }
 
 void hbx_tx_gain_programming_expert::resolve()
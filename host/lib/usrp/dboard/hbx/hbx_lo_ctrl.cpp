@@ -17,15 +17,25 @@ hbx_lo_ctrl::hbx_lo_ctrl(direction_t trx,
     size_t start_address,
     hbx_cpld_ctrl::poke_fn_type&& poke_fn,
     hbx_cpld_ctrl::peek_fn_type&& peek_fn,
+    hbx_cpld_ctrl::burst_poke_fn_type&& burst_poke_fn,
     const double db_prc_rate,
     time_accessor_fn_type&& time_accessor)
-    : hbx_cpld_ctrl::spi_transactor(
-        start_address, std::move(poke_fn), std::move(peek_fn), true)
+    : hbx_cpld_ctrl::spi_transactor(start_address,
+        std::move(poke_fn),
+        std::move(peek_fn),
+        true,
+        std::move(burst_poke_fn))
     , _time_accessor(std::move(time_accessor))
     , _log_id(unique_id + "::" + (trx == RX_DIRECTION ? "RX_LO" : "TX_LO"))
     , _lmx()
     , _freq(LMX2572_DEFAULT_FREQ)
     , _db_prc_rate(db_prc_rate)
+    , _tune_plans(
+          [this](const double freq) {
+              return _lmx->make_tune_plan(freq, _db_prc_rate, false);
+          },
+          HBX_LO_MAX_TUNE_PLANS,
+          _log_id)
 {
     _lmx = lmx2572_iface::make(
         [this](uint8_t addr, uint16_t data) { this->spi_write(addr, data); },
@@ -34,7 +44,11 @@ hbx_lo_ctrl::hbx_lo_ctrl(direction_t trx,
             std::this_thread::sleep_for(
                 std::chrono::milliseconds(static_cast<int>(ts.get_real_secs() * 1000)));
         },
-        unique_id + "::" + (trx == RX_DIRECTION ? "RX" : "TX"));
+        unique_id + "::" + (trx == RX_DIRECTION ? "RX" : "TX"),
+        [this](const std::vector<std::pair<uint8_t, uint16_t>>& writes) {
+            this->spi_write(
+                std::vector<std::pair<uint32_t, uint32_t>>(writes.begin(), writes.end()));
+        });
     UHD_ASSERT_THROW(_lmx);
     UHD_LOG_TRACE(_log_id, "LO initialized...");
     _lmx->reset();
@@ -57,7 +71,12 @@ double hbx_lo_ctrl::set_lo_freq(const double freq)
     UHD_ASSERT_THROW(_lmx);
     UHD_LOG_TRACE(_log_id, "Setting LO frequency " << freq / 1e6 << " MHz");
 
-    _freq = _lmx->set_frequency(freq, _db_prc_rate, false);
+    if (const auto* plan = _tune_plans.lookup(freq)) {
+        _freq = _lmx->set_tune_plan(*plan);
+    } else {
+        _freq = _lmx->set_frequency(freq, _db_prc_rate, false);
+    }
+    // The powers are set after loading a plan, so the plans don't depend on them
     _lmx->set_output_power(lmx2572_iface::output_t::RF_OUTPUT_A, _lo_output_a_power);
     _lmx->set_output_power(lmx2572_iface::output_t::RF_OUTPUT_B, _lo_output_b_power);
     _lmx->commit();
@@ -79,6 +98,21 @@ double hbx_lo_ctrl::set_lo_freq(const double freq)
     return _freq;
 }
 
+void hbx_lo_ctrl::set_tune_plan_freqs(const std::vector<double>& freqs)
+{
+    _tune_plans.set_freqs(freqs);
+}
+
+std::vector<double> hbx_lo_ctrl::get_tune_plan_freqs() const
+{
+    return _tune_plans.get_freqs();
+}
+
+void hbx_lo_ctrl::set_tune_plan_recording(const bool enable)
+{
+    _tune_plans.set_recording(enable);
+}
+
 double hbx_lo_ctrl::get_lo_freq()
 {
     return _freq;
@@ -109,12 +143,15 @@ void hbx_lo_ctrl::set_lo_port(lmx2572_iface::output_t port, bool enable)
 
     _lmx->set_output_enable(port, enable);
     _lmx->commit();
+    // The plans hold the output settings as well
+    _tune_plans.update();
 }
 
 void hbx_lo_ctrl::set_lo_enabled(bool enable)
 {
     UHD_LOG_TRACE(_log_id, "Setting LO enabled state to " << enable);
     _lmx->set_enabled(enable);
+    _tune_plans.update();
 }
 
 bool hbx_lo_ctrl::get_lo_enabled()
@@ -128,6 +165,7 @@ void hbx_lo_ctrl::set_lo_ports(const bool lo_export, const bool lo_import)
     _lmx->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, !lo_import);
     _lmx->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_B, lo_export);
     _lmx->commit();
+    _tune_plans.update();
 }
 
 uint8_t hbx_lo_ctrl::set_lo_output_power(uint8_t power)
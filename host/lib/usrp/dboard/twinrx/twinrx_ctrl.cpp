@@ -11,6 +11,7 @@
 #include <uhd/utils/safe_call.hpp>
 #include <uhdlib/usrp/common/adf435x.hpp>
 #include <uhdlib/usrp/common/adf535x.hpp>
+#include <uhdlib/usrp/common/lo_tune_plans.hpp>
 #include <uhdlib/utils/narrow.hpp>
 #include <boost/format.hpp>
 #include <chrono>
@@ -35,6 +36,8 @@ const double TWINRX_REV_AB_PFD_FREQ = 6.25e6;
 const double TWINRX_REV_C_PFD_FREQ  = 12.5e6;
 const double TWINRX_SPI_CLOCK_FREQ  = 3e6;
 const uint32_t TWINRX_LO1_MOD2      = 2;
+// Number of LO1 frequencies per channel for which tune plans are kept
+const size_t TWINRX_LO1_MAX_TUNE_PLANS = 1024;
 } // namespace
 
 class twinrx_ctrl_impl : public twinrx_ctrl
@@ -143,6 +146,12 @@ public:
                 _db_iface->get_clock_rate(dboard_iface::UNIT_TX));
             _lo1_iface[i]->set_muxout_mode(adf535x_iface::MUXOUT_DLD);
             _lo1_iface[i]->set_frequency(3e9, TWINRX_LO1_MOD2);
+            _lo1_tune_plans.emplace_back(
+                [this, i](const double freq) {
+                    return _lo1_iface[i]->make_tune_plan(freq, TWINRX_LO1_MOD2);
+                },
+                TWINRX_LO1_MAX_TUNE_PLANS,
+                "TWINRX");
 
             // LO2
             _lo2_iface[i] =
@@ -573,13 +582,11 @@ public:
 
         double coerced_freq = 0.0;
         if (ch == CH1 or ch == BOTH) {
-            coerced_freq =
-                _lo1_iface[size_t(CH1)]->set_frequency(freq, TWINRX_LO1_MOD2, false);
+            coerced_freq           = _set_lo1_freq(CH1, freq);
             _lo1_freq[size_t(CH1)] = tune_freq_t(freq);
         }
         if (ch == CH2 or ch == BOTH) {
-            coerced_freq =
-                _lo1_iface[size_t(CH2)]->set_frequency(freq, TWINRX_LO1_MOD2, false);
+            coerced_freq           = _set_lo1_freq(CH2, freq);
             _lo1_freq[size_t(CH2)] = tune_freq_t(freq);
         }
 
@@ -607,17 +614,49 @@ public:
         return coerced_freq;
     }
 
+    void set_lo1_tune_plan_freqs(channel_t ch, const std::vector<double>& freqs) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (ch == CH1 or ch == BOTH) {
+            _lo1_tune_plans[size_t(CH1)].set_freqs(freqs);
+        }
+        if (ch == CH2 or ch == BOTH) {
+            _lo1_tune_plans[size_t(CH2)].set_freqs(freqs);
+        }
+    }
+
+    std::vector<double> get_lo1_tune_plan_freqs(channel_t ch) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // For BOTH, assume that both channels have the same plans
+        return _lo1_tune_plans[size_t(ch == CH2 ? CH2 : CH1)].get_freqs();
+    }
+
+    void set_lo1_tune_plan_recording(channel_t ch, bool enable) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (ch == CH1 or ch == BOTH) {
+            _lo1_tune_plans[size_t(CH1)].set_recording(enable);
+        }
+        if (ch == CH2 or ch == BOTH) {
+            _lo1_tune_plans[size_t(CH2)].set_recording(enable);
+        }
+    }
+
     double set_lo1_charge_pump(channel_t ch, double current, bool commit = true) override
     {
         std::lock_guard<std::mutex> lock(_mutex);
         double coerced_current = 0.0;
+        // The plans hold the charge pump current as well
         if (ch == CH1 or ch == BOTH) {
             coerced_current =
                 _lo1_iface[size_t(CH1)]->set_charge_pump_current(current, false);
+            _lo1_tune_plans[size_t(CH1)].update();
         }
         if (ch == CH2 or ch == BOTH) {
             coerced_current =
                 _lo1_iface[size_t(CH2)]->set_charge_pump_current(current, false);
+            _lo1_tune_plans[size_t(CH2)].update();
         }
 
         if (commit) {
@@ -731,6 +770,16 @@ private: // Functions
         _cpld_regs->if0_reg2.flush();
     }
 
+    // Load the tune plan of the frequency if there is one, else calculate the settings.
+    // _commit() sets the output enable afterwards, so the plans don't depend on it.
+    double _set_lo1_freq(channel_t ch, double freq)
+    {
+        if (const auto* plan = _lo1_tune_plans[size_t(ch)].lookup(freq)) {
+            return _lo1_iface[size_t(ch)]->set_tune_plan(*plan, false);
+        }
+        return _lo1_iface[size_t(ch)]->set_frequency(freq, TWINRX_LO1_MOD2, false);
+    }
+
     void _write_lo_spi(dboard_iface::unit_t unit, const std::vector<uint32_t>& regs)
     {
         for (uint32_t reg : regs) {
@@ -861,6 +910,7 @@ private: // Members
     spi_config_t _spi_config;
     double _lo1_pfd_freq;
     adf535x_iface::sptr _lo1_iface[NUM_CHANS];
+    std::vector<lo_tune_plans<adf535x_iface::tune_plan_t>> _lo1_tune_plans;
     adf435x_iface::sptr _lo2_iface[NUM_CHANS];
     lo_source_t _lo1_src[NUM_CHANS];
     lo_source_t _lo2_src[NUM_CHANS];
@@ -12,6 +12,7 @@
 #include <uhd/types/ranges.hpp>
 #include <uhd/types/wb_iface.hpp>
 #include <uhd/utils/noncopyable.hpp>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace dboard { namespace twinrx {
 
@@ -91,6 +92,20 @@ public:
 
     virtual double set_lo2_synth_freq(channel_t ch, double freq, bool commit = true) = 0;
 
+    /*! Make LO1 tune plans for the given frequencies, replacing the existing ones
+     *
+     * set_lo1_synth_freq() loads the settings of a planned frequency instead
+     * of calculating them.
+     */
+    virtual void set_lo1_tune_plan_freqs(
+        channel_t ch, const std::vector<double>& freqs) = 0;
+
+    //! Return the LO1 frequencies which have a tune plan
+    virtual std::vector<double> get_lo1_tune_plan_freqs(channel_t ch) = 0;
+
+    //! While enabled, set_lo1_synth_freq() makes a tune plan for every new frequency
+    virtual void set_lo1_tune_plan_recording(channel_t ch, bool enable) = 0;
+
     virtual double set_lo1_charge_pump(
         channel_t ch, double current, bool commit = true) = 0;
 
@@ -655,6 +655,16 @@ void zbx_cpld_ctrl::lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint1
     // to throttle.
 }
 
+void zbx_cpld_ctrl::lo_poke16(
+    const zbx_lo_t lo, const std::vector<std::pair<uint8_t, uint16_t>>& writes)
+{
+    for (size_t i = 0; i < writes.size(); i++) {
+        const bool last = (i + 1 == writes.size());
+        _lo_spi_transact(lo, writes[i].first, writes[i].second, spi_xact_t::WRITE, !last);
+    }
+    _lo_spi_throttle_pending = !writes.empty();
+}
+
 uint16_t zbx_cpld_ctrl::lo_peek16(const zbx_lo_t lo, const uint8_t addr)
 {
     _lo_spi_transact(lo, addr, 0, spi_xact_t::READ, true);
@@ -858,6 +868,11 @@ void zbx_cpld_ctrl::_lo_spi_transact(const zbx_lo_t lo,
                             || lo == zbx_lo_t::RX0_LO1 || lo == zbx_lo_t::RX0_LO2)
                             ? CHAN0
                             : CHAN1;
+    // The previous transaction might not have been throttled yet
+    if (_lo_spi_throttle_pending) {
+        _sleep(SPI_THROTTLE_TIME);
+        _lo_spi_throttle_pending = false;
+    }
     // Note: For SPI transactions, we can't also be lugging around other
     // registers. This means that we assume that the state of _regs is clean.
     _regs.ADDRESS   = addr;
@@ -361,6 +361,9 @@ void zbx_dboard_impl::_init_experts(uhd::property_tree::sptr subtree,
                 },
                 [this, lo](const uint32_t addr) { return _cpld->lo_peek16(lo, addr); },
                 [this](const uhd::time_spec_t& sleep_time) { _regs.sleep(sleep_time); },
+                [this, lo](const std::vector<std::pair<uint8_t, uint16_t>>& writes) {
+                    _cpld->lo_poke16(lo, writes);
+                },
                 LMX2572_DEFAULT_FREQ,
                 _prc_rate,
                 false);
@@ -593,6 +596,18 @@ void zbx_dboard_impl::_init_lo_prop_tree(uhd::property_tree::sptr subtree,
             fe_path / "los" / lo / "freq" / "value",
             LMX2572_DEFAULT_FREQ,
             AUTO_RESOLVE_ON_WRITE);
+        // Tune plans: the desired value is the list of LO frequencies to make plans
+        // for, the coerced value the list of frequencies which have a plan.
+        expert_factory::add_dual_prop_node<std::vector<double>>(expert,
+            subtree,
+            fe_path / "los" / lo / "tune_plans" / "freqs",
+            {},
+            AUTO_RESOLVE_ON_WRITE);
+        expert_factory::add_prop_node<bool>(expert,
+            subtree,
+            fe_path / "los" / lo / "tune_plans" / "record",
+            false,
+            AUTO_RESOLVE_ON_WRITE);
 
         subtree->create<meta_range_t>(fe_path / "los" / lo / "freq/range")
             .set_publisher(
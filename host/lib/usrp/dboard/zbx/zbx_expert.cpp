@@ -247,11 +247,29 @@ void zbx_lo_expert::resolve()
         _lo_ctrl->set_lo_port_enabled(_set_is_enabled);
     }
 
+    if (_record_tune_plans.is_dirty()) {
+        _lo_ctrl->set_tune_plan_recording(_record_tune_plans);
+    }
+
+    // Plans are looked up by the clipped frequency that set_lo_freq() gets
+    if (_desired_tune_plan_freqs.is_dirty()) {
+        std::vector<double> clipped_freqs;
+        for (const double freq : _desired_tune_plan_freqs.get()) {
+            clipped_freqs.push_back(
+                std::max(LMX2572_MIN_FREQ, std::min(freq, LMX2572_MAX_FREQ)));
+        }
+        _lo_ctrl->set_tune_plan_freqs(clipped_freqs);
+    }
+
     if (_set_is_enabled && _desired_lo_frequency.is_dirty()) {
         const double clipped_lo_freq = std::max(
             LMX2572_MIN_FREQ, std::min(_desired_lo_frequency.get(), LMX2572_MAX_FREQ));
         _coerced_lo_frequency = _lo_ctrl->set_lo_freq(clipped_lo_freq);
     }
+
+    if (_desired_tune_plan_freqs.is_dirty() || _record_tune_plans) {
+        _coerced_tune_plan_freqs = _lo_ctrl->get_tune_plan_freqs();
+    }
 }
 
 void zbx_gain_coercer_expert::resolve()
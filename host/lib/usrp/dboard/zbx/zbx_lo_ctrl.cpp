@@ -18,15 +18,27 @@ zbx_lo_ctrl::zbx_lo_ctrl(zbx_lo_t lo,
     lmx2572_iface::write_fn_t&& poke16,
     lmx2572_iface::read_fn_t&& peek16,
     lmx2572_iface::sleep_fn_t&& sleep,
+    lmx2572_iface::write_batch_fn_t&& poke16_batch,
     const double default_frequency,
     const double db_prc_rate,
     const bool testing_mode_enabled)
     : _log_id(ZBX_LO_LOG_ID.at(lo))
     , _freq(default_frequency)
     , _db_prc_rate(db_prc_rate)
+    , _tune_plans(
+          [this](const double freq) {
+              return _lmx->make_tune_plan(
+                  freq, _db_prc_rate, false /*TODO: get_spur_dodging()*/);
+          },
+          ZBX_LO_MAX_TUNE_PLANS,
+          _log_id)
     , _testing_mode_enabled(testing_mode_enabled)
 {
-    _lmx = lmx2572_iface::make(std::move(poke16), std::move(peek16), std::move(sleep));
+    _lmx = lmx2572_iface::make(std::move(poke16),
+        std::move(peek16),
+        std::move(sleep),
+        "",
+        std::move(poke16_batch));
     UHD_ASSERT_THROW(_lmx);
     UHD_LOG_TRACE(_log_id, "LO initialized...");
     _lmx->reset();
@@ -44,7 +56,13 @@ double zbx_lo_ctrl::set_lo_freq(const double freq)
     UHD_ASSERT_THROW(_lmx);
     UHD_LOG_TRACE(_log_id, "Setting LO frequency " << freq / 1e6 << " MHz");
 
-    _freq = _lmx->set_frequency(freq, _db_prc_rate, false /*TODO: get_spur_dodging()*/);
+    if (const auto* plan = _tune_plans.lookup(freq)) {
+        _freq = _lmx->set_tune_plan(*plan);
+    } else {
+        _freq =
+            _lmx->set_frequency(freq, _db_prc_rate, false /*TODO: get_spur_dodging()*/);
+    }
+    // The power is set after loading a plan, so the plans don't depend on it
     const uint8_t power = _find_lo_power(_freq);
     if (_lmx->get_output_enabled(lmx2572_iface::output_t::RF_OUTPUT_A)) {
         _lmx->set_output_power(lmx2572_iface::output_t::RF_OUTPUT_A, power);
@@ -56,6 +74,21 @@ double zbx_lo_ctrl::set_lo_freq(const double freq)
     return _freq;
 }
 
+void zbx_lo_ctrl::set_tune_plan_freqs(const std::vector<double>& freqs)
+{
+    _tune_plans.set_freqs(freqs);
+}
+
+std::vector<double> zbx_lo_ctrl::get_tune_plan_freqs() const
+{
+    return _tune_plans.get_freqs();
+}
+
+void zbx_lo_ctrl::set_tune_plan_recording(const bool enable)
+{
+    _tune_plans.set_recording(enable);
+}
+
 double zbx_lo_ctrl::get_lo_freq()
 {
     return _freq;
@@ -100,6 +133,8 @@ void zbx_lo_ctrl::set_lo_port_enabled(bool enable)
 
     _lmx->set_enabled(enable);
     _lmx->commit();
+    // The plans hold the output settings as well
+    _tune_plans.update();
 }
 
 bool zbx_lo_ctrl::get_lo_port_enabled()
@@ -14,6 +14,7 @@
 #include <uhd/transport/udp_simple.hpp>
 #include <uhd/utils/cast.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
+#include <uhdlib/transport/chdr_replay_link.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <uhdlib/transport/udp_common.hpp>
 #include <uhdlib/utils/narrow.hpp>
@@ -22,6 +23,9 @@
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_XDP
+#    include <uhdlib/transport/udp_xdp_link.hpp>
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -430,6 +434,24 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
             default_link_params.recv_buff_size / default_link_params.recv_frame_size;
     }
 #endif
+    // AF_XDP sockets are only used for data, every link needs its own NIC queue
+    const bool use_xdp = _mb_args.has_key("use_xdp") && !use_dpdk
+                         && (link_type == link_type_t::RX_DATA
+                             || link_type == link_type_t::TX_DATA);
+#ifdef HAVE_XDP
+    udp_xdp_link::xdp_params_t xdp_params;
+    size_t xdp_max_frame_size = 0;
+    if (use_xdp) {
+        xdp_params         = udp_xdp_link::get_xdp_params(_mb_args, link_args);
+        xdp_max_frame_size = udp_xdp_link::get_max_frame_size(xdp_params);
+        default_link_params.send_frame_size =
+            std::min(default_link_params.send_frame_size, xdp_max_frame_size);
+        default_link_params.recv_frame_size =
+            std::min(default_link_params.recv_frame_size, xdp_max_frame_size);
+        default_link_params.num_recv_frames =
+            default_link_params.recv_buff_size / default_link_params.recv_frame_size;
+    }
+#endif
 
     link_params_t link_params = calculate_udp_link_params(link_type,
         get_mtu(uhd::TX_DIRECTION),
@@ -456,6 +478,30 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
             enable_fc);
 #else
         UHD_LOG_WARNING(LOG_ID, "Cannot create DPDK transport, falling back to UDP");
+#endif
+    }
+    if (use_xdp) {
+#ifdef HAVE_XDP
+        link_params.send_frame_size =
+            std::min(link_params.send_frame_size, xdp_max_frame_size);
+        link_params.recv_frame_size =
+            std::min(link_params.recv_frame_size, xdp_max_frame_size);
+        try {
+            auto link = udp_xdp_link::make(ip_addr, udp_port, link_params, xdp_params);
+            return std::make_tuple(link,
+                link_params.send_buff_size,
+                link,
+                link_params.recv_buff_size,
+                lossy_xport,
+                true,
+                enable_fc);
+        } catch (const uhd::runtime_error& ex) {
+            UHD_LOG_WARNING(LOG_ID,
+                "Cannot create AF_XDP transport (" << ex.what()
+                                                   << "), falling back to UDP");
+        }
+#else
+        UHD_LOG_WARNING(LOG_ID, "Cannot create AF_XDP transport, falling back to UDP");
 #endif
     }
     auto link = uhd::transport::udp_boost_asio_link::make(ip_addr,
@@ -463,6 +509,22 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
         link_params,
         link_params.recv_buff_size,
         link_params.send_buff_size);
+    if (_mb_args.has_key("capture_file")) {
+        auto capture_link = chdr_capture_link::make(link,
+            link,
+            chdr_capture_writer::get(_mb_args.get("capture_file")),
+            chdr_capture_writer::make_endpoint(
+                ip_addr, static_cast<uint16_t>(std::stoul(udp_port))),
+            chdr_capture_writer::make_endpoint(
+                link->get_local_addr(), link->get_local_port()));
+        return std::make_tuple(capture_link,
+            link_params.send_buff_size,
+            capture_link,
+            link_params.recv_buff_size,
+            lossy_xport,
+            false,
+            enable_fc);
+    }
     return std::make_tuple(link,
         link_params.send_buff_size,
         link,
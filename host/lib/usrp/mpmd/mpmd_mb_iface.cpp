@@ -9,6 +9,7 @@
 #include "mpmd_link_if_mgr.hpp"
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/defaults.hpp>
+#include <uhd/utils/cast.hpp>
 #include <uhd/utils/compat_check.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/device_id.hpp>
@@ -32,8 +33,10 @@ static uhd::usrp::io_service_args_t get_default_io_srv_args()
     return args;
 }
 
-mpmd_mboard_impl::mpmd_mb_iface::mpmd_mb_iface(
-    const uhd::device_addr_t& mb_args, uhd::rpc_client::sptr rpc, const size_t mb_idx)
+mpmd_mboard_impl::mpmd_mb_iface::mpmd_mb_iface(const uhd::device_addr_t& mb_args,
+    const uhd::device_addr_t& device_info,
+    uhd::rpc_client::sptr rpc,
+    const size_t mb_idx)
     : _mb_index(mb_idx)
     , _log_id(std::to_string(mb_idx) + "/MPMD::MB_IFACE")
     , _mb_args(mb_args)
@@ -44,6 +47,15 @@ mpmd_mboard_impl::mpmd_mb_iface::mpmd_mb_iface(
     UHD_LOG_TRACE(_log_id, "Assigning device_id " << _remote_device_id);
     _rpc->set_device_id(_remote_device_id);
 
+    // The topology only depends on the FPGA image, and the device IDs we
+    // assign
+    if (uhd::cast::from_str<bool>(mb_args.get("topology_cache", "0"))
+        && device_info.has_key("serial") && device_info.has_key("fpga_version_hash")) {
+        _topology_cache_key = device_info.get("serial") + "-"
+                              + device_info.get("fpga_version_hash") + "-"
+                              + std::to_string(_remote_device_id);
+    }
+
     // Check for remote streaming capabilities
     auto compat_num = rpc->get_mpm_compat_number();
     _has_remote_xport_capability =
@@ -156,6 +168,11 @@ void mpmd_mboard_impl::mpmd_mb_iface::reset_network()
     // FIXME
 }
 
+std::string mpmd_mboard_impl::mpmd_mb_iface::get_topology_cache_key()
+{
+    return _topology_cache_key;
+}
+
 uhd::rfnoc::clock_iface::sptr mpmd_mboard_impl::mpmd_mb_iface::get_clock_iface(
     const std::string& clock_name, const uint8_t clock_idx)
 {
@@ -422,7 +439,8 @@ mpmd_mboard_impl::mpmd_mb_iface::make_tx_data_transport(
         strc_pyld,
         [io_srv_mgr, recv_link, send_link]() {
             io_srv_mgr->disconnect_links(recv_link, send_link);
-        });
+        },
+        xport_args);
 
     return tx_xport;
 }
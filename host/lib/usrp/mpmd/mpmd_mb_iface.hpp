@@ -23,6 +23,7 @@ public:
     using uptr               = std::unique_ptr<mpmd_mb_iface>;
     using clock_iface_list_t = std::vector<std::map<std::string, std::string>>;
     mpmd_mb_iface(const uhd::device_addr_t& mb_args,
+        const uhd::device_addr_t& device_info,
         uhd::rpc_client::sptr rpc,
         const size_t mb_idx);
     ~mpmd_mb_iface() override = default;
@@ -41,6 +42,7 @@ public:
     uhd::transport::adapter_id_t get_adapter_id(
         const uhd::rfnoc::device_id_t local_device_id) override;
     void reset_network() override;
+    std::string get_topology_cache_key() override;
     uhd::rfnoc::clock_iface::sptr get_clock_iface(
         const std::string& clock_name, const uint8_t clock_idx) override;
     uhd::rfnoc::chdr_ctrl_xport::sptr make_ctrl_transport(
@@ -73,6 +75,8 @@ private:
 
     uhd::device_addr_t _mb_args;
     uhd::rpc_client::sptr _rpc;
+    //! Identifies the device and its FPGA image, empty if unknown
+    std::string _topology_cache_key;
     xport::mpmd_link_if_mgr::uptr _link_if_mgr;
     uhd::rfnoc::device_id_t _remote_device_id;
     std::map<uhd::rfnoc::device_id_t, size_t> _local_device_id_map;
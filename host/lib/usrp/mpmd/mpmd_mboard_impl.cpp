@@ -322,7 +322,7 @@ mpmd_mboard_impl::mpmd_mboard_impl(const device_addr_t& mb_args_,
 
     if (!mb_args.has_key("skip_init")) {
         // Initialize mb_iface and mb_controller
-        mb_iface = std::make_unique<mpmd_mb_iface>(mb_args, rpc, mb_idx);
+        mb_iface = std::make_unique<mpmd_mb_iface>(mb_args, device_info, rpc, mb_idx);
         mb_ctrl  = std::make_shared<rfnoc::mpmd_mb_controller>(rpc, device_info, mb_idx);
     } // Note -- when skip_init is used, these are not initialized, and trying
       // to use them will result in a null pointer dereference exception!
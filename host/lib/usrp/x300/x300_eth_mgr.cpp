@@ -22,6 +22,7 @@
 #include <uhd/utils/cast.hpp>
 #include <uhdlib/rfnoc/device_id.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
+#include <uhdlib/transport/chdr_replay_link.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
 #include <uhdlib/transport/udp_common.hpp>
 #include <uhdlib/usrp/cores/i2c_core_100_wb32.hpp>
@@ -29,6 +30,9 @@
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_XDP
+#    include <uhdlib/transport/udp_xdp_link.hpp>
+#endif
 #include <uhdlib/asio.hpp>
 #include <string>
 
@@ -257,6 +261,25 @@ both_links_t eth_manager::get_links(link_type_t link_type,
             default_link_params.recv_buff_size / default_link_params.recv_frame_size;
     }
 #endif
+    // AF_XDP sockets are only used for data, every link needs its own NIC queue
+    const bool use_xdp = _args.get_orig_args().has_key("use_xdp")
+                         && !_args.get_use_dpdk()
+                         && (link_type == link_type_t::RX_DATA
+                             || link_type == link_type_t::TX_DATA);
+#ifdef HAVE_XDP
+    udp_xdp_link::xdp_params_t xdp_params;
+    size_t xdp_max_frame_size = 0;
+    if (use_xdp) {
+        xdp_params = udp_xdp_link::get_xdp_params(_args.get_orig_args(), link_args);
+        xdp_max_frame_size = udp_xdp_link::get_max_frame_size(xdp_params);
+        default_link_params.send_frame_size =
+            std::min(default_link_params.send_frame_size, xdp_max_frame_size);
+        default_link_params.recv_frame_size =
+            std::min(default_link_params.recv_frame_size, xdp_max_frame_size);
+        default_link_params.num_recv_frames =
+            default_link_params.recv_buff_size / default_link_params.recv_frame_size;
+    }
+#endif
 
     link_params_t link_params = calculate_udp_link_params(link_type,
         get_mtu(uhd::TX_DIRECTION),
@@ -284,6 +307,33 @@ both_links_t eth_manager::get_links(link_type_t link_type,
             enable_fc);
 #else
         UHD_LOG_WARNING("X300", "Cannot create DPDK transport, falling back to UDP");
+#endif
+    }
+    if (use_xdp) {
+#ifdef HAVE_XDP
+        link_params.send_frame_size =
+            std::min(link_params.send_frame_size, xdp_max_frame_size);
+        link_params.recv_frame_size =
+            std::min(link_params.recv_frame_size, xdp_max_frame_size);
+        try {
+            auto link = udp_xdp_link::make(conn.addr,
+                BOOST_STRINGIZE(X300_VITA_UDP_PORT),
+                link_params,
+                xdp_params);
+            return std::make_tuple(link,
+                link_params.send_buff_size,
+                link,
+                link_params.recv_buff_size,
+                lossy_xport,
+                true,
+                enable_fc);
+        } catch (const uhd::runtime_error& ex) {
+            UHD_LOG_WARNING("X300",
+                "Cannot create AF_XDP transport (" << ex.what()
+                                                  << "), falling back to UDP");
+        }
+#else
+        UHD_LOG_WARNING("X300", "Cannot create AF_XDP transport, falling back to UDP");
 #endif
     }
     auto link = uhd::transport::udp_boost_asio_link::make(conn.addr,
@@ -291,6 +341,21 @@ both_links_t eth_manager::get_links(link_type_t link_type,
         link_params,
         link_params.recv_buff_size,
         link_params.send_buff_size);
+    if (_args.get_orig_args().has_key("capture_file")) {
+        auto capture_link = chdr_capture_link::make(link,
+            link,
+            chdr_capture_writer::get(_args.get_orig_args().get("capture_file")),
+            chdr_capture_writer::make_endpoint(conn.addr, X300_VITA_UDP_PORT),
+            chdr_capture_writer::make_endpoint(
+                link->get_local_addr(), link->get_local_port()));
+        return std::make_tuple(capture_link,
+            link_params.send_buff_size,
+            capture_link,
+            link_params.recv_buff_size,
+            lossy_xport,
+            false,
+            enable_fc);
+    }
     return std::make_tuple(link,
         link_params.send_buff_size,
         link,
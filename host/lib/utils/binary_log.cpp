@@ -0,0 +1,419 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/binary_log.hpp>
+#include <atomic>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using namespace uhd::log::binary;
+
+namespace {
+
+//! Set by enable()
+std::atomic<bool> enabled{false};
+//! Global log level, mirrors uhd::log::set_log_level()
+std::atomic<int> min_level{uhd::log::off};
+
+/*! Ring buffer of records, written by a single thread
+ *
+ * The owning thread pushes records, the thread calling drain() pops them. Both
+ * sides are lock-free. Records are stored back to back, and may wrap around the
+ * end of the buffer.
+ */
+class record_ring
+{
+public:
+    record_ring(const size_t size, const thread_info& info) : _thread(info)
+    {
+        size_t capacity = MAX_RECORD_SIZE;
+        while (capacity < size) {
+            capacity <<= 1;
+        }
+        _buf  = std::make_unique<uint8_t[]>(capacity);
+        _mask = capacity - 1;
+    }
+
+    //! Copy a record into the ring, or count it as dropped if there is no space
+    void push(const record_header* header)
+    {
+        const size_t size  = header->size;
+        const size_t write = _write.load(std::memory_order_relaxed);
+        if (write - _cached_read + size > _mask + 1) {
+            _cached_read = _read.load(std::memory_order_acquire);
+            if (write - _cached_read + size > _mask + 1) {
+                _dropped.store(_dropped.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+                return;
+            }
+        }
+        _copy_in(write, reinterpret_cast<const uint8_t*>(header), size);
+        _write.store(write + size, std::memory_order_release);
+    }
+
+    //! Append the next record to \p out, at an offset aligned for record_header
+    bool pop(std::vector<uint8_t>& out)
+    {
+        const size_t read = _read.load(std::memory_order_relaxed);
+        if (read == _write.load(std::memory_order_acquire)) {
+            return false;
+        }
+        uint32_t size;
+        _copy_out(read, reinterpret_cast<uint8_t*>(&size), sizeof(size));
+        const size_t offset = align(out.size());
+        out.resize(offset + size);
+        _copy_out(read, out.data() + offset, size);
+        _read.store(read + size, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const
+    {
+        return _read.load(std::memory_order_relaxed)
+               == _write.load(std::memory_order_acquire);
+    }
+
+    uint64_t get_dropped() const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    static size_t align(const size_t offset)
+    {
+        constexpr size_t ALIGNMENT = alignof(record_header);
+        return (offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    const thread_info& get_thread() const
+    {
+        return _thread;
+    }
+
+    //! Set when the owning thread exits. The ring is removed once it's empty.
+    std::atomic<bool> retired{false};
+    //! Only accessed by drain()
+    uint64_t reported_dropped = 0;
+
+private:
+    void _copy_in(const size_t pos, const uint8_t* data, const size_t size)
+    {
+        const size_t offset = pos & _mask;
+        const size_t first  = std::min(size, _mask + 1 - offset);
+        std::memcpy(_buf.get() + offset, data, first);
+        std::memcpy(_buf.get(), data + first, size - first);
+    }
+
+    void _copy_out(const size_t pos, uint8_t* data, const size_t size) const
+    {
+        const size_t offset = pos & _mask;
+        const size_t first  = std::min(size, _mask + 1 - offset);
+        std::memcpy(data, _buf.get() + offset, first);
+        std::memcpy(data + first, _buf.get(), size - first);
+    }
+
+    const thread_info _thread;
+    std::unique_ptr<uint8_t[]> _buf;
+    size_t _mask;
+    alignas(64) std::atomic<size_t> _write{0};
+    size_t _cached_read = 0;
+    std::atomic<uint64_t> _dropped{0};
+    alignas(64) std::atomic<size_t> _read{0};
+};
+
+//! Global state: call sites and the rings of all threads
+struct registry
+{
+    std::mutex mutex;
+    std::vector<site_info> sites;
+    std::vector<std::shared_ptr<record_ring>> rings;
+    size_t ring_size      = DEFAULT_RING_SIZE;
+    uint32_t num_threads  = 0;
+    uint32_t dropped_site = 0;
+    bool has_dropped_site = false;
+};
+
+registry& get_registry()
+{
+    static registry reg;
+    return reg;
+}
+
+//! Owns the calling thread's ring, and retires it when the thread exits
+struct ring_holder
+{
+    ~ring_holder()
+    {
+        if (ring) {
+            ring->retired = true;
+        }
+    }
+
+    std::shared_ptr<record_ring> ring;
+};
+
+thread_local ring_holder local_ring;
+
+std::shared_ptr<record_ring> make_ring()
+{
+    registry& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto ring = std::make_shared<record_ring>(
+        reg.ring_size, thread_info{reg.num_threads++, std::this_thread::get_id()});
+    reg.rings.push_back(ring);
+    return ring;
+}
+
+template <typename T>
+T read_scalar(const uint8_t*& pos)
+{
+    T value;
+    std::memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+//! Format the next argument, and advance \p pos past it
+void format_arg(std::ostream& out, const uint8_t*& pos)
+{
+    switch (static_cast<arg_type>(*pos++)) {
+        case arg_type::SIGNED:
+            out << read_scalar<int64_t>(pos);
+            break;
+        case arg_type::UNSIGNED:
+            out << read_scalar<uint64_t>(pos);
+            break;
+        case arg_type::FLOAT:
+            out << read_scalar<double>(pos);
+            break;
+        case arg_type::BOOL:
+            out << (read_scalar<uint8_t>(pos) ? "true" : "false");
+            break;
+        case arg_type::POINTER:
+            out << "0x" << std::hex << read_scalar<uint64_t>(pos) << std::dec;
+            break;
+        case arg_type::STRING: {
+            const uint16_t len = read_scalar<uint16_t>(pos);
+            out.write(reinterpret_cast<const char*>(pos), len);
+            pos += len;
+            break;
+        }
+    }
+}
+
+void write_string(std::ostream& out, const std::string& str)
+{
+    const uint16_t len = static_cast<uint16_t>(std::min<size_t>(str.size(), 0xFFFF));
+    out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+    out.write(str.data(), len);
+}
+
+template <typename T>
+void write_scalar(std::ostream& out, const T value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // namespace
+
+void uhd::log::binary::detail::push_record(const record_header* header)
+{
+    if (!local_ring.ring) {
+        local_ring.ring = make_ring();
+    }
+    local_ring.ring->push(header);
+}
+
+bool uhd::log::binary::is_enabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+bool uhd::log::binary::is_level_enabled(const uhd::log::severity_level level)
+{
+    return level >= min_level.load(std::memory_order_relaxed);
+}
+
+void uhd::log::binary::enable(const size_t ring_size)
+{
+    registry& reg = get_registry();
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.ring_size = ring_size;
+    }
+    if (!reg.has_dropped_site) {
+        reg.dropped_site     = register_site(uhd::log::warning,
+            "LOGGING",
+            __FILE__,
+            __LINE__,
+            "Binary log ring of thread {} is full, dropped {} records");
+        reg.has_dropped_site = true;
+    }
+    enabled = true;
+}
+
+void uhd::log::binary::disable()
+{
+    enabled = false;
+}
+
+void uhd::log::binary::set_min_level(const uhd::log::severity_level level)
+{
+    min_level = level;
+}
+
+uint32_t uhd::log::binary::register_site(const uhd::log::severity_level level,
+    const char* component,
+    const char* file,
+    const unsigned int line,
+    const char* format)
+{
+    registry& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.sites.push_back(site_info{level, component, file, line, format});
+    return static_cast<uint32_t>(reg.sites.size() - 1);
+}
+
+site_info uhd::log::binary::get_site(const uint32_t site_id)
+{
+    registry& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return reg.sites.at(site_id);
+}
+
+size_t uhd::log::binary::get_num_sites()
+{
+    registry& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return reg.sites.size();
+}
+
+size_t uhd::log::binary::drain(const std::function<void(const record&)>& handler)
+{
+    registry& reg = get_registry();
+    std::vector<std::shared_ptr<record_ring>> rings;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        // A retired ring won't receive any more records, so once it's empty,
+        // it can go
+        reg.rings.erase(std::remove_if(reg.rings.begin(),
+                            reg.rings.end(),
+                            [](const std::shared_ptr<record_ring>& ring) {
+                                return ring->retired && ring->empty();
+                            }),
+            reg.rings.end());
+        rings = reg.rings;
+    }
+
+    // Collect records from all rings, then sort them by time. Only pop what's
+    // there now, so a busy thread can't keep us here forever.
+    struct entry
+    {
+        uint64_t time_ns;
+        size_t offset;
+        const thread_info* thread;
+    };
+    std::vector<uint8_t> buf;
+    std::vector<entry> entries;
+    auto add_entry = [&](const record_ring& ring, const size_t offset) {
+        entries.push_back(entry{
+            reinterpret_cast<const record_header*>(buf.data() + offset)->time_ns,
+            offset,
+            &ring.get_thread()});
+    };
+    for (auto& ring : rings) {
+        const uint64_t dropped = ring->get_dropped();
+        if (dropped != ring->reported_dropped) {
+            detail::record_builder builder(reg.dropped_site);
+            builder.add(ring->get_thread().index);
+            builder.add(dropped - ring->reported_dropped);
+            const record_header* header = builder.finish();
+            const size_t offset         = record_ring::align(buf.size());
+            buf.resize(offset + header->size);
+            std::memcpy(buf.data() + offset, header, header->size);
+            add_entry(*ring, offset);
+            ring->reported_dropped = dropped;
+        }
+        size_t offset = record_ring::align(buf.size());
+        while (ring->pop(buf)) {
+            add_entry(*ring, offset);
+            offset = record_ring::align(buf.size());
+        }
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const entry& a, const entry& b) {
+        return a.time_ns < b.time_ns;
+    });
+
+    for (const auto& e : entries) {
+        handler(record{
+            reinterpret_cast<const record_header*>(buf.data() + e.offset), e.thread});
+    }
+    return entries.size();
+}
+
+std::string uhd::log::binary::format_args(const std::string& format, const record& rec)
+{
+    std::ostringstream out;
+    const uint8_t* pos       = rec.args();
+    const uint8_t* const end = pos + rec.args_size();
+    size_t format_pos        = 0;
+    while (true) {
+        const size_t placeholder = format.find("{}", format_pos);
+        if (placeholder == std::string::npos || pos >= end) {
+            break;
+        }
+        out.write(format.data() + format_pos, placeholder - format_pos);
+        format_arg(out, pos);
+        format_pos = placeholder + 2;
+    }
+    out << format.substr(format_pos);
+    // Arguments without a placeholder are appended
+    while (pos < end) {
+        out << " ";
+        format_arg(out, pos);
+    }
+    return out.str();
+}
+
+std::string uhd::log::binary::format_record(const record& rec)
+{
+    return format_args(get_site(rec.header->site_id).format, rec);
+}
+
+file_writer::file_writer(std::ostream& out) : _out(out)
+{
+    _out.write("UHDBLOG1", 8);
+}
+
+void file_writer::write(const record& rec)
+{
+    // Define all sites we haven't written yet. Sites are only ever added, so
+    // this also covers the site of this record.
+    const size_t num_sites = get_num_sites();
+    for (; _num_sites_written < num_sites; _num_sites_written++) {
+        const site_info site = get_site(static_cast<uint32_t>(_num_sites_written));
+        _out.put('S');
+        write_scalar(_out, static_cast<uint32_t>(_num_sites_written));
+        write_scalar(_out, static_cast<uint8_t>(site.level));
+        write_scalar(_out, static_cast<uint32_t>(site.line));
+        write_string(_out, site.component);
+        write_string(_out, site.file);
+        write_string(_out, site.format);
+    }
+    if (!_threads_written.count(rec.thread->index)) {
+        std::ostringstream thread_id;
+        thread_id << "0x" << rec.thread->id;
+        _out.put('T');
+        write_scalar(_out, rec.thread->index);
+        write_string(_out, thread_id.str());
+        _threads_written.insert(rec.thread->index);
+    }
+    _out.put('R');
+    write_scalar(_out, rec.thread->index);
+    _out.write(reinterpret_cast<const char*>(rec.header), rec.header->size);
+}
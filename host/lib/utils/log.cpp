@@ -14,6 +14,7 @@
 #include <uhd/utils/static.hpp>
 #include <uhd/utils/thread.hpp>
 #include <uhd/version.hpp>
+#include <uhdlib/utils/binary_log.hpp>
 #include <uhdlib/utils/isatty.hpp>
 #include <atomic>
 #include <cctype>
@@ -25,6 +26,7 @@
 #include <mutex>
 #include <sstream>
 #include <thread>
+#include <vector>
 #ifdef HAVE_DPDK
 #    include <uhdlib/transport/dpdk/common.hpp>
 #endif
@@ -52,6 +54,10 @@ constexpr double READ_TIMEOUT = 0.5; // Waiting time to read from the queue
 constexpr char LOG_THREAD_NAME[]          = "uhd_log";
 constexpr char LOG_THREAD_NAME_FP[]       = "uhd_log_fastpath";
 constexpr char LOG_THREAD_NAME_FP_DUMMY[] = "uhd_log_fp_dummy";
+constexpr char LOG_THREAD_NAME_BINARY[]   = "uhd_log_binary";
+
+// How long the binary log thread sleeps when there was nothing to drain
+constexpr auto BINARY_DRAIN_INTERVAL = std::chrono::milliseconds(5);
 
 std::string verbosity_color(const uhd::log::severity_level& level)
 {
@@ -291,6 +297,7 @@ public:
             return true;
         }();
 
+        _fastpath_enabled = enable_fastpath;
         if (enable_fastpath) {
             _pop_fastpath_task = std::make_shared<std::thread>(
                 std::thread([this]() { this->pop_fastpath_task(); }));
@@ -306,10 +313,15 @@ public:
             _publish_log_msg("Fastpath logging disabled at compile time.");
         }
 #endif
+
+        _setup_binary_logging();
     }
 
     ~log_resource(void)
     {
+        // Stop taking binary records. Whatever is in the rings is drained by
+        // the binary log thread before it exits.
+        uhd::log::binary::disable();
         _exit = true;
 
 #ifndef UHD_MSVC // push a final message is required, since the pop_with_wait() function
@@ -327,11 +339,15 @@ public:
         final_message.message = "";
         push(final_message);
 #    ifndef UHD_LOG_FASTPATH_DISABLE
-        push_fastpath("");
+        _fastpath_queue.push_with_haste("");
 #    endif
 #endif // UHD_MSVC
 
         _pop_task->join();
+        if (_pop_binary_task) {
+            _pop_binary_task->join();
+            _pop_binary_task.reset();
+        }
         {
             std::lock_guard<std::mutex> l(_logmap_mutex);
             _loggers.clear();
@@ -352,6 +368,10 @@ public:
 #ifndef UHD_LOG_FASTPATH_DISABLE
     void push_fastpath(const std::string& message)
     {
+        if (_binary_fastpath) {
+            uhd::log::binary::log_record(_fastpath_site, "{}", message);
+            return;
+        }
         // Never wait. If the buffer is full, we just don't see the message.
         // Too bad.
         _fastpath_queue.push_with_haste(message);
@@ -444,6 +464,18 @@ public:
 #endif
     }
 
+    void pop_binary_task()
+    {
+        while (!_exit) {
+            if (_drain_binary() == 0) {
+                std::this_thread::sleep_for(BINARY_DRAIN_INTERVAL);
+            }
+        }
+
+        // Exit procedure: Clear the rings
+        _drain_binary();
+    }
+
     void add_logger(const std::string& key, uhd::log::log_fn_t logger_fn)
     {
         std::lock_guard<std::mutex> l(_logmap_mutex);
@@ -511,6 +543,94 @@ private:
         }
     }
 
+    void _setup_binary_logging()
+    {
+        const char* log_binary_env      = std::getenv("UHD_LOG_BINARY");
+        const char* log_binary_file_env = std::getenv("UHD_LOG_BINARY_FILE");
+        const bool has_binary_file =
+            log_binary_file_env != NULL && log_binary_file_env[0] != '\0';
+        const bool enable_binary =
+            has_binary_file
+            || (log_binary_env != NULL && log_binary_env[0] != '\0'
+                && std::string(log_binary_env) != "0");
+        if (!enable_binary) {
+            return;
+        }
+
+        size_t ring_size              = uhd::log::binary::DEFAULT_RING_SIZE;
+        const char* log_ring_size_env = std::getenv("UHD_LOG_BINARY_RING_SIZE");
+        if (log_ring_size_env != NULL && log_ring_size_env[0] != '\0') {
+            try {
+                ring_size = std::stoul(log_ring_size_env);
+            } catch (const std::exception&) {
+                std::cerr << "[LOG] Invalid binary log ring size: " << log_ring_size_env
+                          << std::endl;
+            }
+        }
+        if (has_binary_file) {
+            _binary_file.open(log_binary_file_env,
+                std::fstream::out | std::fstream::trunc | std::fstream::binary);
+            if (!_binary_file.is_open()) {
+                std::cerr << "Error opening binary log file: " << log_binary_file_env
+                          << std::endl;
+                return;
+            }
+            _binary_writer =
+                std::make_unique<uhd::log::binary::file_writer>(_binary_file);
+        }
+
+        _fastpath_site = uhd::log::binary::register_site(
+            uhd::log::info, "FASTPATH", __FILE__, __LINE__, "{}");
+        uhd::log::binary::set_min_level(global_level);
+        uhd::log::binary::enable(ring_size);
+        _binary_fastpath = _fastpath_enabled;
+        _pop_binary_task = std::make_shared<std::thread>(
+            std::thread([this]() { this->pop_binary_task(); }));
+        uhd::set_thread_name(_pop_binary_task.get(), LOG_THREAD_NAME_BINARY);
+        if (has_binary_file) {
+            _publish_log_msg(
+                "Binary logging to " + std::string(log_binary_file_env) + ".");
+        } else {
+            _publish_log_msg("Binary logging enabled.");
+        }
+    }
+
+    //! Hand all pending binary records to the backends, or to the binary file
+    size_t _drain_binary()
+    {
+        const size_t num_records =
+            uhd::log::binary::drain([this](const uhd::log::binary::record& rec) {
+                if (_binary_writer) {
+                    _binary_writer->write(rec);
+                    return;
+                }
+                if (rec.header->site_id == _fastpath_site) {
+                    std::cerr << uhd::log::binary::format_args("{}", rec) << std::flush;
+                    return;
+                }
+                while (rec.header->site_id >= _binary_sites.size()) {
+                    _binary_sites.push_back(uhd::log::binary::get_site(
+                        static_cast<uint32_t>(_binary_sites.size())));
+                }
+                const auto& site = _binary_sites[rec.header->site_id];
+                auto log_info    = uhd::log::detail::logging_info(
+                    std::chrono::system_clock::time_point(
+                        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                            std::chrono::nanoseconds(rec.header->time_ns))),
+                    site.level,
+                    site.file,
+                    site.line,
+                    site.component,
+                    rec.thread->id);
+                log_info.message = uhd::log::binary::format_args(site.format, rec);
+                _handle_log_info(log_info);
+            });
+        if (_binary_writer && num_records) {
+            _binary_file.flush();
+        }
+        return num_records;
+    }
+
     void _publish_log_msg(const std::string& msg,
         const uhd::log::severity_level level = uhd::log::info,
         const std::string& component         = "LOGGING")
@@ -536,6 +656,16 @@ private:
     uhd::transport::bounded_buffer<std::string> _fastpath_queue;
 #endif
     uhd::transport::bounded_buffer<uhd::log::detail::logging_info> _log_queue;
+
+    // Binary logging
+    bool _fastpath_enabled  = false;
+    bool _binary_fastpath   = false;
+    uint32_t _fastpath_site = 0;
+    std::shared_ptr<std::thread> _pop_binary_task;
+    std::ofstream _binary_file;
+    std::unique_ptr<uhd::log::binary::file_writer> _binary_writer;
+    //! Local copy of the call sites, only used by the binary log thread
+    std::vector<uhd::log::binary::site_info> _binary_sites;
 };
 
 UHD_SINGLETON_FCN(log_resource, log_rs);
@@ -594,6 +724,7 @@ void uhd::log::add_logger(const std::string& key, log_fn_t logger_fn)
 void uhd::log::set_log_level(uhd::log::severity_level level)
 {
     log_rs().global_level = level;
+    uhd::log::binary::set_min_level(level);
 }
 
 void uhd::log::set_logger_level(const std::string& key, uhd::log::severity_level level)
@@ -0,0 +1,71 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/config.hpp>
+#include <uhdlib/utils/numa.hpp>
+#ifdef UHD_PLATFORM_LINUX
+#    include <arpa/inet.h>
+#    include <ifaddrs.h>
+#    include <netinet/in.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <fstream>
+#endif
+
+#ifdef UHD_PLATFORM_LINUX
+int uhd::get_thread_numa_node()
+{
+    // glibc only has a wrapper for getcpu() from version 2.29 on
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return -1;
+    }
+    return static_cast<int>(node);
+}
+
+int uhd::get_interface_numa_node(const std::string& ip_addr)
+{
+    in_addr addr;
+    if (inet_pton(AF_INET, ip_addr.c_str(), &addr) != 1) {
+        return -1;
+    }
+    ifaddrs* ifaddr = nullptr;
+    if (getifaddrs(&ifaddr) != 0) {
+        return -1;
+    }
+    std::string ifname;
+    for (ifaddrs* ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next) {
+        if (ifa->ifa_addr != nullptr && ifa->ifa_addr->sa_family == AF_INET
+            && reinterpret_cast<sockaddr_in*>(ifa->ifa_addr)->sin_addr.s_addr
+                   == addr.s_addr) {
+            ifname = ifa->ifa_name;
+            break;
+        }
+    }
+    freeifaddrs(ifaddr);
+    if (ifname.empty()) {
+        return -1;
+    }
+
+    // Virtual interfaces have no device, and single node systems report -1
+    std::ifstream numa_node_file("/sys/class/net/" + ifname + "/device/numa_node");
+    int numa_node = -1;
+    if (!(numa_node_file >> numa_node)) {
+        return -1;
+    }
+    return numa_node;
+}
+#else
+int uhd::get_thread_numa_node()
+{
+    return -1;
+}
+
+int uhd::get_interface_numa_node(const std::string&)
+{
+    return -1;
+}
+#endif
@@ -177,6 +177,29 @@ fs::path uhd::get_xdg_config_home()
     return fs::path(home) / ".config";
 }
 
+fs::path uhd::get_xdg_cache_home()
+{
+    std::string xdg_cache_home_str = get_env_var("XDG_CACHE_HOME", "");
+    if (!xdg_cache_home_str.empty()) {
+        return fs::path(xdg_cache_home_str);
+    }
+#ifdef UHD_PLATFORM_WIN32
+    const std::string localappdata = get_env_var("LOCALAPPDATA", "");
+    if (!localappdata.empty()) {
+        return fs::path(localappdata);
+    }
+    const std::string appdata = get_env_var("APPDATA", "");
+    if (!appdata.empty()) {
+        return fs::path(appdata);
+    }
+#endif
+    const std::string home = get_env_var("HOME", "");
+    if (home.empty()) {
+        return fs::path("");
+    }
+    return fs::path(home) / ".cache";
+}
+
 fs::path uhd::get_legacy_config_home()
 {
 #ifdef UHD_PLATFORM_WIN32
@@ -0,0 +1,500 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_call.hpp>
+#include <uhd/utils/sample_recorder.hpp>
+#include <uhd/utils/thread.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <thread>
+#ifndef UHD_PLATFORM_WIN32
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    include <cerrno>
+#endif
+
+using namespace uhd;
+
+namespace {
+
+//! Alignment of buffers, sizes and offsets for direct I/O
+constexpr size_t IO_ALIGNMENT       = 4096;
+constexpr size_t DEFAULT_BLOCK_SIZE = 4 * 1024 * 1024;
+constexpr size_t DEFAULT_NUM_BLOCKS = 16;
+
+size_t align_up(const size_t value)
+{
+    return (value + IO_ALIGNMENT - 1) / IO_ALIGNMENT * IO_ALIGNMENT;
+}
+
+//! Deleter for blocks allocated with IO_ALIGNMENT
+struct aligned_block_deleter
+{
+    void operator()(uint8_t* block) const
+    {
+        ::operator delete[](block, std::align_val_t(IO_ALIGNMENT));
+    }
+};
+
+using block_ptr = std::unique_ptr<uint8_t[], aligned_block_deleter>;
+
+block_ptr make_block(const size_t size)
+{
+    return block_ptr(
+        static_cast<uint8_t*>(::operator new[](size, std::align_val_t(IO_ALIGNMENT))));
+}
+
+std::string json_escape(const std::string& str)
+{
+    std::ostringstream out;
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << int(c) << std::dec;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    return out.str();
+}
+
+/*! Output file that can be written at arbitrary offsets from several threads
+ *
+ * Uses positional writes where available, which don't need any locking.
+ */
+class output_file
+{
+public:
+    output_file(const std::string& filename, bool direct_io) : _filename(filename)
+    {
+#ifdef UHD_PLATFORM_WIN32
+        direct_io = false;
+        _file.open(filename, std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!_file.is_open()) {
+            throw uhd::io_error("Cannot open " + filename);
+        }
+#else
+        int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#    ifdef O_DIRECT
+        if (direct_io) {
+            _fd = ::open(filename.c_str(), flags | O_DIRECT, 0644);
+            if (_fd < 0 && errno == EINVAL) {
+                UHD_LOG_INFO("RECORDER",
+                    "File system does not support direct I/O, using regular writes for "
+                        << filename);
+            }
+        }
+#    else
+        direct_io = false;
+#    endif
+        if (_fd < 0) {
+            direct_io = false;
+            _fd       = ::open(filename.c_str(), flags, 0644);
+        }
+        if (_fd < 0) {
+            throw uhd::io_error(
+                "Cannot open " + filename + ": " + std::string(std::strerror(errno)));
+        }
+#endif
+        _direct_io = direct_io;
+    }
+
+    ~output_file()
+    {
+#ifndef UHD_PLATFORM_WIN32
+        ::close(_fd);
+#endif
+    }
+
+    //! Check if writes must be aligned to IO_ALIGNMENT
+    bool is_direct() const
+    {
+        return _direct_io;
+    }
+
+    //! Write \p size bytes at \p offset
+    void write_at(const uint8_t* data, size_t size, uint64_t offset)
+    {
+#ifdef UHD_PLATFORM_WIN32
+        std::lock_guard<std::mutex> lock(_mutex);
+        _file.seekp(offset);
+        _file.write(reinterpret_cast<const char*>(data), size);
+        if (!_file) {
+            throw uhd::io_error("Error writing to " + _filename);
+        }
+#else
+        while (size > 0) {
+            const ssize_t written = ::pwrite(_fd, data, size, offset);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw uhd::io_error("Error writing to " + _filename + ": "
+                                    + std::string(std::strerror(errno)));
+            }
+            data += written;
+            size -= written;
+            offset += written;
+        }
+#endif
+    }
+
+    //! Cut the file to \p size bytes, to remove the padding of direct writes
+    void truncate(const uint64_t size)
+    {
+#ifndef UHD_PLATFORM_WIN32
+        if (::ftruncate(_fd, size) != 0) {
+            throw uhd::io_error("Error truncating " + _filename + ": "
+                                + std::string(std::strerror(errno)));
+        }
+#else
+        (void)size;
+#endif
+    }
+
+private:
+    const std::string _filename;
+    bool _direct_io = false;
+#ifdef UHD_PLATFORM_WIN32
+    std::mutex _mutex;
+    std::ofstream _file;
+#else
+    int _fd = -1;
+#endif
+};
+
+} // namespace
+
+sample_recorder::~sample_recorder(void)
+{
+    /* NOP */
+}
+
+class sample_recorder_impl : public sample_recorder
+{
+public:
+    sample_recorder_impl(
+        const std::vector<std::string>& filenames, const device_addr_t& args)
+        : _block_size(align_up(args.cast<size_t>("block_size", DEFAULT_BLOCK_SIZE)))
+    {
+        const size_t num_blocks  = args.cast<size_t>("num_blocks", DEFAULT_NUM_BLOCKS);
+        const size_t num_threads = args.cast<size_t>("num_threads", filenames.size());
+        const bool direct_io     = args.cast<bool>("direct_io", true);
+        if (filenames.empty()) {
+            throw uhd::value_error("sample_recorder: No files specified");
+        }
+        if (_block_size == 0 || num_blocks == 0 || num_threads == 0) {
+            throw uhd::value_error("sample_recorder: block_size, num_blocks and "
+                                   "num_threads must be greater than zero");
+        }
+
+        for (const auto& filename : filenames) {
+            auto chan      = std::make_unique<channel_t>();
+            chan->filename = filename;
+            chan->file     = std::make_unique<output_file>(filename, direct_io);
+            for (size_t i = 0; i < num_blocks; i++) {
+                chan->blocks.push_back(make_block(_block_size));
+                chan->free_blocks.push_back(chan->blocks.back().get());
+            }
+            _channels.push_back(std::move(chan));
+        }
+
+        for (size_t i = 0; i < num_threads; i++) {
+            _writers.emplace_back([this]() { _writer_loop(); });
+            uhd::set_thread_name(&_writers.back(), "uhd_recorder");
+        }
+    }
+
+    ~sample_recorder_impl() override
+    {
+        UHD_SAFE_CALL(close();)
+    }
+
+    void write(const size_t chan, const void* data, const size_t num_bytes) override
+    {
+        auto& channel     = *_channels.at(chan);
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        size_t remaining  = num_bytes;
+        while (remaining > 0) {
+            if (!channel.current) {
+                _acquire_block(channel);
+            }
+            const size_t to_copy = std::min(remaining, _block_size - channel.fill);
+            std::memcpy(channel.current + channel.fill, bytes, to_copy);
+            channel.fill += to_copy;
+            bytes += to_copy;
+            remaining -= to_copy;
+            if (channel.fill == _block_size) {
+                _submit_block(chan);
+            }
+        }
+    }
+
+    void write(const buffs_type& buffs, const size_t num_bytes) override
+    {
+        if (buffs.size() != _channels.size()) {
+            throw uhd::value_error("sample_recorder: Number of buffers does not match "
+                                   "the number of channels");
+        }
+        for (size_t chan = 0; chan < buffs.size(); chan++) {
+            write(chan, buffs[chan], num_bytes);
+        }
+    }
+
+    void write_sigmf_meta(const sigmf_meta_t& meta) override
+    {
+        if (meta.frequencies.size() > 1 && meta.frequencies.size() != _channels.size()) {
+            throw uhd::value_error("sample_recorder: Number of frequencies does not "
+                                   "match the number of channels");
+        }
+        for (size_t chan = 0; chan < _channels.size(); chan++) {
+            const std::string& data_file = _channels[chan]->filename;
+            const size_t ext_pos         = data_file.find_last_of('.');
+            const size_t dir_pos         = data_file.find_last_of("/\\");
+            const bool has_ext =
+                ext_pos != std::string::npos
+                && (dir_pos == std::string::npos || ext_pos > dir_pos);
+            const std::string base_name =
+                has_ext ? data_file.substr(0, ext_pos) : data_file;
+            const std::string extension = has_ext ? data_file.substr(ext_pos) : "";
+
+            std::ostringstream json;
+            json << std::setprecision(17);
+            json << "{\n  \"global\": {\n";
+            json << "    \"core:datatype\": \"" << json_escape(meta.datatype) << "\",\n";
+            json << "    \"core:sample_rate\": " << meta.sample_rate << ",\n";
+            json << "    \"core:version\": \"1.0.0\",\n";
+            json << "    \"core:recorder\": \"UHD\"";
+            if (!meta.description.empty()) {
+                json << ",\n    \"core:description\": \""
+                     << json_escape(meta.description) << "\"";
+            }
+            if (!meta.hw.empty()) {
+                json << ",\n    \"core:hw\": \"" << json_escape(meta.hw) << "\"";
+            }
+            if (extension != ".sigmf-data") {
+                const std::string file_name = dir_pos == std::string::npos
+                                                  ? data_file
+                                                  : data_file.substr(dir_pos + 1);
+                json << ",\n    \"core:dataset\": \"" << json_escape(file_name) << "\"";
+            }
+            json << "\n  },\n  \"captures\": [\n    {\n";
+            json << "      \"core:sample_start\": 0";
+            if (!meta.frequencies.empty()) {
+                json << ",\n      \"core:frequency\": "
+                     << meta.frequencies[std::min(chan, meta.frequencies.size() - 1)];
+            }
+            if (!meta.datetime.empty()) {
+                json << ",\n      \"core:datetime\": \"" << json_escape(meta.datetime)
+                     << "\"";
+            }
+            json << "\n    }\n  ],\n  \"annotations\": []\n}\n";
+
+            const std::string meta_file = base_name + ".sigmf-meta";
+            std::ofstream out(meta_file);
+            out << json.str();
+            if (!out) {
+                throw uhd::io_error("Error writing " + meta_file);
+            }
+        }
+    }
+
+    void close(void) override
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_closed) {
+            return;
+        }
+        _closed = true;
+        lock.unlock();
+
+        // Queue the partially filled blocks, then let the writers drain the
+        // queue and exit
+        for (size_t chan = 0; chan < _channels.size(); chan++) {
+            if (_channels[chan]->current && _channels[chan]->fill > 0) {
+                _submit_block(chan);
+            }
+        }
+        lock.lock();
+        _stopping = true;
+        _work_cv.notify_all();
+        lock.unlock();
+        for (auto& writer : _writers) {
+            writer.join();
+        }
+
+        // Direct writes are padded to the I/O alignment, cut off the padding
+        for (auto& channel : _channels) {
+            if (channel->file->is_direct() && !_error) {
+                try {
+                    channel->file->truncate(channel->file_offset);
+                } catch (...) {
+                    _error = std::current_exception();
+                }
+            }
+            channel->file.reset();
+        }
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+
+    stats_t get_stats(void) const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stats;
+    }
+
+    size_t get_num_channels(void) const override
+    {
+        return _channels.size();
+    }
+
+private:
+    struct channel_t
+    {
+        std::string filename;
+        std::unique_ptr<output_file> file;
+        std::vector<block_ptr> blocks;
+        // Blocks ready to be filled, protected by _mutex
+        std::deque<uint8_t*> free_blocks;
+        // Block being filled by the caller of write(), and how much of it is
+        // filled already
+        uint8_t* current = nullptr;
+        size_t fill      = 0;
+        // File offset of the next block
+        uint64_t file_offset = 0;
+    };
+
+    struct job_t
+    {
+        size_t chan;
+        uint8_t* block;
+        // Number of bytes of samples in the block, and number of bytes to
+        // write, which includes the padding for direct I/O
+        size_t size;
+        size_t write_size;
+        uint64_t offset;
+    };
+
+    void _acquire_block(channel_t& channel)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_closed) {
+            throw uhd::runtime_error("sample_recorder: Writing to a closed recorder");
+        }
+        if (channel.free_blocks.empty() && !_error) {
+            const auto start = std::chrono::steady_clock::now();
+            _free_cv.wait(lock, [&]() { return !channel.free_blocks.empty() || _error; });
+            _stats.num_stalls++;
+            _stats.stall_time +=
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                    .count();
+        }
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+        channel.current = channel.free_blocks.front();
+        channel.free_blocks.pop_front();
+        channel.fill = 0;
+    }
+
+    void _submit_block(const size_t chan)
+    {
+        auto& channel = *_channels[chan];
+        const size_t write_size =
+            channel.file->is_direct() ? align_up(channel.fill) : channel.fill;
+        const job_t job{
+            chan, channel.current, channel.fill, write_size, channel.file_offset};
+        channel.file_offset += channel.fill;
+        channel.current = nullptr;
+        channel.fill    = 0;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(job);
+        _stats.max_pending_blocks = std::max(_stats.max_pending_blocks, _jobs.size());
+        _work_cv.notify_one();
+    }
+
+    void _writer_loop()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _work_cv.wait(lock, [this]() { return !_jobs.empty() || _stopping; });
+            if (_jobs.empty()) {
+                return;
+            }
+            const job_t job = _jobs.front();
+            _jobs.pop_front();
+            lock.unlock();
+
+            auto& channel = *_channels[job.chan];
+            std::exception_ptr error;
+            try {
+                channel.file->write_at(job.block, job.write_size, job.offset);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            if (error && !_error) {
+                _error = error;
+            }
+            if (!error) {
+                _stats.bytes_written += job.size;
+            }
+            channel.free_blocks.push_back(job.block);
+            _free_cv.notify_all();
+        }
+    }
+
+    const size_t _block_size;
+    std::vector<std::unique_ptr<channel_t>> _channels;
+    std::vector<std::thread> _writers;
+
+    // Shared state of the writers, protected by _mutex
+    mutable std::mutex _mutex;
+    std::condition_variable _work_cv;
+    std::condition_variable _free_cv;
+    std::deque<job_t> _jobs;
+    std::exception_ptr _error;
+    stats_t _stats;
+    bool _stopping = false;
+    bool _closed   = false;
+};
+
+sample_recorder::sptr sample_recorder::make(
+    const std::vector<std::string>& filenames, const device_addr_t& args)
+{
+    return std::make_shared<sample_recorder_impl>(filenames, args);
+}
@@ -26,4 +26,5 @@ FEConnection = lib.usrp.fe_connection
 StreamArgs = lib.usrp.stream_args
 RXStreamer = lib.usrp.rx_streamer
 TXStreamer = lib.usrp.tx_streamer
+RXRing = lib.usrp.rx_ring
 # pylint: enable=invalid-name
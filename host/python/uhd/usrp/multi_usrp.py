@@ -119,11 +119,11 @@ class MultiUSRP(lib.usrp.multi_usrp):
         # Configure streamer
         streamer = _config_streamer(streamer)
         metadata = lib.types.rx_metadata()
-        # Set up buffers and counters
+        # Set up buffers and counters. The samples are received straight into
+        # the result, the small buffer is only used to flush the streamer.
         result = np.empty((len(channels), num_samps), dtype=np.complex64)
         recv_buffer = np.zeros((len(channels), streamer.get_max_num_samps()), dtype=np.complex64)
         recv_samps = 0
-        samps = 0
         # Now stream
         _start_stream(streamer)
         timeout = 0.1
@@ -136,14 +136,12 @@ class MultiUSRP(lib.usrp.multi_usrp):
             if diff > 0:
                 timeout += diff
         while recv_samps < num_samps:
-            samps = streamer.recv(recv_buffer, metadata, timeout)
+            # recv_bulk() keeps receiving without returning to Python until the
+            # result is full, or until an error occurs
+            recv_samps += streamer.recv_bulk(result[:, recv_samps:], metadata, timeout)
             timeout = 0.1
             if metadata.error_code != lib.types.rx_metadata_error_code.none:
                 print(metadata.strerror())
-            if samps:
-                real_samps = min(num_samps - recv_samps, samps)
-                result[:, recv_samps : recv_samps + real_samps] = recv_buffer[:, 0:real_samps]
-                recv_samps += real_samps
         # Stop and clean up
         _stop_stream(streamer)
         # Help the garbage collection
@@ -210,15 +208,6 @@ class MultiUSRP(lib.usrp.multi_usrp):
 
         # Configure streamer
         streamer = _config_streamer(streamer)
-        # Set up buffers and counters
-        buffer_samps = streamer.get_max_num_samps()
-        proto_len = waveform_proto.shape[-1]
-        if proto_len < buffer_samps:
-            waveform_proto = np.tile(
-                waveform_proto, (1, int(np.ceil(float(buffer_samps) / proto_len)))
-            )
-            proto_len = waveform_proto.shape[-1]
-        send_samps = 0
         max_samps = int(np.floor(duration * rate))
         if len(waveform_proto.shape) == 1:
             waveform_proto = waveform_proto.reshape(1, waveform_proto.size)
@@ -226,19 +215,26 @@ class MultiUSRP(lib.usrp.multi_usrp):
             waveform_proto = np.tile(waveform_proto[0], (len(channels), 1))
         # Now stream
         metadata = lib.types.tx_metadata()
+        timeout = 0.1
         if start_time is not None:
             metadata.time_spec = start_time
             metadata.has_time_spec = True
-        while send_samps < max_samps:
-            real_samps = min(proto_len, max_samps - send_samps)
-            if real_samps < proto_len:
-                samples = streamer.send(waveform_proto[:, :real_samps], metadata)
-            else:
-                samples = streamer.send(waveform_proto, metadata)
-            send_samps += samples
-        # Send EOB to terminate Tx
+            # The first samples are only consumed at start_time
+            diff = (start_time - super(MultiUSRP, self).get_time_now()).get_real_secs()
+            timeout += max(0, diff)
+        # send_bulk() repeats the waveform until max_samps samples are sent, and
+        # ends the burst with the last one. It returns early on a timeout, in
+        # which case we keep sending from where it stopped.
         metadata.end_of_burst = True
-        streamer.send(np.zeros((len(channels), 1), dtype=np.complex64), metadata)
+        proto_len = waveform_proto.shape[-1]
+        send_samps = 0
+        while send_samps < max_samps:
+            offset = send_samps % proto_len
+            samples = waveform_proto if offset == 0 else np.roll(waveform_proto, -offset, 1)
+            send_samps += streamer.send_bulk(samples, metadata, max_samps - send_samps, timeout)
+            timeout = 0.1
+            metadata.start_of_burst = False
+            metadata.has_time_spec = False
         # Help the garbage collection
         streamer = None
         return send_samps
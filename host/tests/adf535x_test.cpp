@@ -96,3 +96,45 @@ BOOST_AUTO_TEST_CASE(adf5356_test_freqs)
         lo->set_frequency(f, 2, false);
     }
 }
+
+BOOST_AUTO_TEST_CASE(adf5356_tune_plan_test)
+{
+    std::vector<uint32_t> writes;
+    auto lo = adf535x_iface::make_adf5356(
+        [&](const std::vector<uint32_t> regs) {
+            writes.insert(writes.end(), regs.begin(), regs.end());
+        },
+        [](const uint32_t) {});
+    std::vector<uint32_t> ref_writes;
+    auto ref_lo = adf535x_iface::make_adf5356(
+        [&](const std::vector<uint32_t> regs) {
+            ref_writes.insert(ref_writes.end(), regs.begin(), regs.end());
+        },
+        [](const uint32_t) {});
+    for (auto& dev : {lo, ref_lo}) {
+        dev->set_pfd_freq(12.5e6);
+        dev->set_output_power(adf535x_iface::OUTPUT_POWER_5DBM);
+        dev->set_reference_freq(100e6);
+        dev->set_muxout_mode(adf535x_iface::MUXOUT_DLD);
+        dev->commit();
+    }
+
+    // Making plans must not write to the device
+    const std::vector<double> freqs = {2.4e9, 3.1e9, 5.85e9, 6.5e9};
+    std::vector<adf535x_iface::tune_plan_t> plans;
+    writes.clear();
+    for (const double freq : freqs) {
+        plans.push_back(lo->make_tune_plan(freq));
+    }
+    BOOST_CHECK(writes.empty());
+
+    for (size_t i = 0; i < 2 * freqs.size(); i++) {
+        const size_t idx = i % freqs.size();
+        writes.clear();
+        ref_writes.clear();
+        BOOST_CHECK_EQUAL(lo->set_tune_plan(plans[idx], true),
+            ref_lo->set_frequency(freqs[idx], 2, true));
+        BOOST_CHECK(!writes.empty());
+        BOOST_CHECK(writes == ref_writes);
+    }
+}
@@ -0,0 +1,196 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/binary_log.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace uhd::log::binary;
+
+namespace {
+
+enum class test_enum { A = 3 };
+
+std::vector<std::string> drain_messages()
+{
+    std::vector<std::string> messages;
+    drain([&messages](const record& rec) { messages.push_back(format_record(rec)); });
+    return messages;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_binary_log_format)
+{
+    const int* ptr = reinterpret_cast<const int*>(0x1234);
+    std::ostringstream out;
+    out << detail::text_message("i={} u={} f={} b={} e={} c={} s={} p={}",
+        -5,
+        uint16_t(7),
+        0.5,
+        true,
+        test_enum::A,
+        'x',
+        std::string("str"),
+        ptr);
+    BOOST_CHECK_EQUAL(out.str(), "i=-5 u=7 f=0.5 b=true e=3 c=x s=str p=0x1234");
+
+    // Missing arguments leave the placeholder, extra arguments are appended
+    out.str("");
+    out << detail::text_message("{} and {}", 1);
+    BOOST_CHECK_EQUAL(out.str(), "1 and {}");
+    out.str("");
+    out << detail::text_message("only", 1, "two");
+    BOOST_CHECK_EQUAL(out.str(), "only 1 two");
+
+    // Null strings don't crash, long strings get truncated
+    out.str("");
+    out << detail::text_message("{}", static_cast<const char*>(nullptr));
+    BOOST_CHECK_EQUAL(out.str(), "(null)");
+    out.str("");
+    out << detail::text_message("{}", std::string(1000, 'a'));
+    BOOST_CHECK_LT(out.str().size(), MAX_RECORD_SIZE);
+    BOOST_CHECK_GT(out.str().size(), MAX_RECORD_SIZE / 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_binary_log_records)
+{
+    set_min_level(uhd::log::debug);
+    enable();
+    drain_messages();
+
+    for (int i = 0; i < 3; i++) {
+        UHD_LOG_BIN_DEBUG("TEST", "Record {} of {}", i, 3);
+    }
+    // Below the minimum level
+    UHD_LOG_BIN_TRACE("TEST", "Not logged");
+
+    std::vector<uint32_t> site_ids;
+    drain([&site_ids](const record& rec) {
+        site_ids.push_back(rec.header->site_id);
+        BOOST_CHECK(rec.thread->id == std::this_thread::get_id());
+    });
+    BOOST_REQUIRE_EQUAL(site_ids.size(), 3);
+    BOOST_CHECK_EQUAL(site_ids[0], site_ids[2]);
+    const site_info site = get_site(site_ids[0]);
+    BOOST_CHECK_EQUAL(site.level, uhd::log::debug);
+    BOOST_CHECK_EQUAL(site.component, "TEST");
+    BOOST_CHECK_EQUAL(site.format, "Record {} of {}");
+
+    UHD_LOG_BIN_INFO("TEST", "Hello {}", "world");
+    const auto messages = drain_messages();
+    BOOST_REQUIRE_EQUAL(messages.size(), 1);
+    BOOST_CHECK_EQUAL(messages[0], "Hello world");
+    BOOST_CHECK(drain_messages().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_binary_log_threads)
+{
+    set_min_level(uhd::log::debug);
+    enable();
+    drain_messages();
+
+    // Records from all threads come out in time order
+    constexpr int NUM_RECORDS = 100;
+
+    auto log_fn = [](const int thread) {
+        for (int i = 0; i < NUM_RECORDS; i++) {
+            UHD_LOG_BIN_INFO("TEST", "{}", thread);
+        }
+    };
+    std::thread t0(log_fn, 0);
+    std::thread t1(log_fn, 1);
+    t0.join();
+    t1.join();
+
+    uint64_t last_time = 0;
+    std::vector<int> counts(2, 0);
+    drain([&](const record& rec) {
+        BOOST_CHECK_GE(rec.header->time_ns, last_time);
+        last_time = rec.header->time_ns;
+        counts.at(std::stoi(format_record(rec)))++;
+    });
+    BOOST_CHECK_EQUAL(counts[0], NUM_RECORDS);
+    BOOST_CHECK_EQUAL(counts[1], NUM_RECORDS);
+}
+
+BOOST_AUTO_TEST_CASE(test_binary_log_overflow)
+{
+    set_min_level(uhd::log::debug);
+    enable(1024);
+    drain_messages();
+
+    // New thread, so it gets a small ring
+    std::thread writer([]() {
+        for (int i = 0; i < 1000; i++) {
+            UHD_LOG_BIN_INFO("TEST", "Filling the ring with record number {}", i);
+        }
+    });
+    writer.join();
+
+    const auto messages = drain_messages();
+    BOOST_REQUIRE_GT(messages.size(), 1);
+    BOOST_CHECK_LT(messages.size(), 1000);
+    // The oldest records are kept, the report about the dropped ones comes last
+    BOOST_CHECK_EQUAL(messages[0], "Filling the ring with record number 0");
+    BOOST_CHECK(messages.back().find("is full, dropped") != std::string::npos);
+    enable();
+}
+
+BOOST_AUTO_TEST_CASE(test_binary_log_file)
+{
+    set_min_level(uhd::log::debug);
+    enable();
+    drain_messages();
+
+    std::ostringstream out;
+    file_writer writer(out);
+    UHD_LOG_BIN_WARNING("TEST", "Value {}", 42);
+    UHD_LOG_BIN_WARNING("TEST", "Value {}", 43);
+    BOOST_CHECK_EQUAL(
+        drain([&writer](const record& rec) { writer.write(rec); }), 2);
+
+    const std::string data = out.str();
+    BOOST_REQUIRE_GT(data.size(), 8);
+    BOOST_CHECK_EQUAL(data.substr(0, 8), "UHDBLOG1");
+    // All sites so far, one thread, two records
+    BOOST_CHECK(data.find("Value {}") != std::string::npos);
+    BOOST_CHECK_EQUAL(data[8], 'S');
+    size_t num_threads = 0, num_records = 0;
+    size_t pos = 8;
+    while (pos < data.size()) {
+        const char tag = data[pos++];
+        uint32_t index;
+        std::memcpy(&index, data.data() + pos, sizeof(index));
+        pos += sizeof(index);
+        if (tag == 'S') {
+            pos += 1 + 4;
+            for (int i = 0; i < 3; i++) {
+                uint16_t len;
+                std::memcpy(&len, data.data() + pos, sizeof(len));
+                pos += sizeof(len) + len;
+            }
+        } else if (tag == 'T') {
+            uint16_t len;
+            std::memcpy(&len, data.data() + pos, sizeof(len));
+            pos += sizeof(len) + len;
+            num_threads++;
+        } else {
+            BOOST_REQUIRE_EQUAL(tag, 'R');
+            record_header header;
+            std::memcpy(&header, data.data() + pos, sizeof(header));
+            pos += header.size;
+            num_records++;
+        }
+    }
+    BOOST_CHECK_EQUAL(pos, data.size());
+    BOOST_CHECK_EQUAL(num_threads, 1);
+    BOOST_CHECK_EQUAL(num_records, 2);
+}
@@ -6,7 +6,10 @@
 //
 
 #include <uhd/transport/bounded_buffer.hpp>
+#include <uhd/transport/buffer_pool.hpp>
 #include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <cstring>
 
 using namespace uhd::transport;
 
@@ -66,3 +69,33 @@ BOOST_AUTO_TEST_CASE(test_bounded_buffer_pop_all)
     BOOST_CHECK_EQUAL(vals[0], 23);
     BOOST_CHECK_EQUAL(vals[1], 42);
 }
+
+BOOST_AUTO_TEST_CASE(test_buffer_pool)
+{
+    const size_t num_buffs = 10;
+    const size_t buff_size = 1000;
+    const size_t alignment = 64;
+
+    buffer_pool::mem_params_t huge_2m;
+    huge_2m.page_size = buffer_pool::page_size_t::HUGE_2M;
+    buffer_pool::mem_params_t numa_node;
+    numa_node.numa_node = 0;
+
+    for (const auto& pool : {buffer_pool::make(num_buffs, buff_size, alignment),
+             buffer_pool::make(num_buffs, buff_size, alignment, huge_2m),
+             buffer_pool::make(num_buffs, buff_size, alignment, numa_node)}) {
+        BOOST_REQUIRE_EQUAL(pool->size(), num_buffs);
+        for (size_t i = 0; i < num_buffs; i++) {
+            BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(pool->at(i)) % alignment, 0);
+            std::memset(pool->at(i), int(i), buff_size);
+        }
+        for (size_t i = 0; i < num_buffs; i++) {
+            BOOST_CHECK_EQUAL(static_cast<uint8_t*>(pool->at(i))[buff_size - 1], i);
+        }
+        // Huge pages or NUMA nodes may not be available, in which case the
+        // pool falls back to regular, unbound memory
+        const auto placement = pool->get_placement();
+        BOOST_CHECK(placement.numa_node == buffer_pool::NO_NUMA_NODE
+                    || placement.numa_node == 0);
+    }
+}
@@ -41,6 +41,10 @@ BOOST_AUTO_TEST_CASE(test_pwr_cal_api)
     BOOST_CHECK_EQUAL(gain_power_data->get_power(47.2, 23e6), -20.0);
     // Now interpolate
     BOOST_CHECK_CLOSE(gain_power_data->get_power(5.0, 1.5e9), -30.0, 1e-6);
+    // Replacing a table after a lookup must be picked up by the next one
+    gain_power_data->add_power_table({{0.0, -50.0}, {10.0, -40.0}}, -50.0, -10.0, 2e9);
+    BOOST_CHECK_CLOSE(gain_power_data->get_power(5.0, 1.5e9), -35.0, 1e-6);
+    BOOST_CHECK_EQUAL(gain_power_data->get_power_limits(2e9).start(), -50.0);
 
     // Some ref gain checks
     BOOST_CHECK_EQUAL(gain_power_data->get_ref_gain(), 0.0);
@@ -44,6 +44,11 @@ BOOST_AUTO_TEST_CASE(test_iq_cal_api)
     mid_coeff = iq_cal_data->get_cal_coeff(1.75);
     BOOST_CHECK_EQUAL(mid_coeff, std::complex<double>(2.0, 2.0));
 
+    // Coefficients added after a lookup must be picked up by the next one
+    iq_cal_data->set_cal_coeff(3.0, {3.0, 3.0});
+    hi_coeff = iq_cal_data->get_cal_coeff(3.5);
+    BOOST_CHECK_EQUAL(hi_coeff, std::complex<double>(3.0, 3.0));
+
     iq_cal_data->clear();
     BOOST_REQUIRE_THROW(iq_cal_data->get_cal_coeff(0.0), uhd::assertion_error);
 }
@@ -0,0 +1,289 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "common/mock_link.hpp"
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/transport/chdr_replay_link.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace uhd::transport;
+using uhd::rfnoc::chdr::chdr_header;
+namespace fs = std::filesystem;
+
+namespace {
+
+//! Temporary directory that is removed with all its contents at the end of a test
+struct temp_dir_fixture
+{
+    temp_dir_fixture()
+        : path(fs::temp_directory_path()
+               / ("uhd_chdr_replay_link_test_" + std::to_string(std::rand())))
+    {
+        fs::create_directories(path);
+    }
+
+    ~temp_dir_fixture()
+    {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+
+    std::string file(const std::string& name) const
+    {
+        return (path / name).string();
+    }
+
+    fs::path path;
+};
+
+//! Make a little endian CHDR data packet with a payload of \p num_words words
+std::vector<uint8_t> make_packet(
+    const uint16_t dst_epid, const uint16_t seq_num, const size_t num_words)
+{
+    std::vector<uint8_t> packet((num_words + 1) * sizeof(uint64_t));
+    chdr_header header;
+    header.set_pkt_type(uhd::rfnoc::chdr::PKT_TYPE_DATA_NO_TS);
+    header.set_dst_epid(dst_epid);
+    header.set_seq_num(seq_num);
+    header.set_length(static_cast<uint16_t>(packet.size()));
+    const uint64_t flat_header = uhd::htowx(header.pack());
+    std::memcpy(packet.data(), &flat_header, sizeof(flat_header));
+    for (size_t i = sizeof(uint64_t); i < packet.size(); i++) {
+        packet[i] = static_cast<uint8_t>(i + seq_num);
+    }
+    return packet;
+}
+
+chdr_header get_header(const void* data)
+{
+    uint64_t flat_header;
+    std::memcpy(&flat_header, data, sizeof(flat_header));
+    return chdr_header(uhd::wtohx(flat_header));
+}
+
+//! Write packets {epid 1, seq 10..12} and {epid 2, seq 0..1}, interleaved
+std::vector<std::vector<uint8_t>> write_capture(const std::string& filename)
+{
+    const std::vector<std::vector<uint8_t>> packets = {make_packet(1, 10, 4),
+        make_packet(2, 0, 2),
+        make_packet(1, 11, 4),
+        make_packet(2, 1, 2),
+        make_packet(1, 12, 3)};
+    const auto device = chdr_capture_writer::make_endpoint("192.168.10.2", 49153);
+    const auto host   = chdr_capture_writer::make_endpoint("192.168.10.1", 30000);
+
+    chdr_capture_writer writer(filename, get_capture_format(filename));
+    for (const auto& packet : packets) {
+        writer.write(packet.data(), packet.size(), device, host);
+        // Packets in the other direction must not be read by default
+        writer.write(packet.data(), packet.size(), host, device);
+    }
+    BOOST_CHECK_EQUAL(writer.get_num_packets(), 2 * packets.size());
+    return packets;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_capture_format)
+{
+    BOOST_CHECK(get_capture_format("rx.pcap") == capture_format::PCAP);
+    BOOST_CHECK(get_capture_format("rx.cap") == capture_format::PCAP);
+    BOOST_CHECK(get_capture_format("rx.dat") == capture_format::RAW);
+    BOOST_CHECK(get_capture_format("pcap") == capture_format::RAW);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_write_read_pcap, temp_dir_fixture)
+{
+    const std::string filename = file("test.pcap");
+    const auto packets         = write_capture(filename);
+
+    chdr_capture_reader reader(filename, capture_format::PCAP);
+    BOOST_REQUIRE_EQUAL(reader.size(), packets.size());
+    BOOST_CHECK_EQUAL(reader.get_num_skipped(), 0);
+    BOOST_CHECK_EQUAL(reader.get_max_packet_size(), packets[0].size());
+    for (size_t i = 0; i < packets.size(); i++) {
+        BOOST_REQUIRE_EQUAL(reader.packet_size(i), packets[i].size());
+        BOOST_CHECK(
+            std::memcmp(reader.data(i), packets[i].data(), packets[i].size()) == 0);
+        BOOST_CHECK_EQUAL(reader.get_header(i), get_header(packets[i].data()).pack());
+    }
+    BOOST_CHECK_EQUAL(reader.time_ns(0), 0);
+
+    // Filters
+    chdr_capture_reader::filter_t filter;
+    filter.udp_src_port = 0;
+    chdr_capture_reader all_reader(
+        filename, capture_format::PCAP, uhd::ENDIANNESS_LITTLE, filter);
+    BOOST_CHECK_EQUAL(all_reader.size(), 2 * packets.size());
+    filter.udp_src_port = CHDR_CAPTURE_DEVICE_PORT;
+    filter.dst_epid     = 2;
+    chdr_capture_reader epid_reader(
+        filename, capture_format::PCAP, uhd::ENDIANNESS_LITTLE, filter);
+    BOOST_REQUIRE_EQUAL(epid_reader.size(), 2);
+    BOOST_CHECK_EQUAL(chdr_header(epid_reader.get_header(1)).get_seq_num(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_write_read_raw, temp_dir_fixture)
+{
+    const std::string filename = file("test.dat");
+    const auto packets         = write_capture(filename);
+
+    // Raw files don't know the direction, so all packets are read
+    chdr_capture_reader reader(filename, capture_format::RAW);
+    BOOST_REQUIRE_EQUAL(reader.size(), 2 * packets.size());
+    for (size_t i = 0; i < packets.size(); i++) {
+        BOOST_REQUIRE_EQUAL(reader.packet_size(2 * i), packets[i].size());
+        BOOST_CHECK(
+            std::memcmp(reader.data(2 * i), packets[i].data(), packets[i].size()) == 0);
+        BOOST_CHECK_EQUAL(reader.time_ns(2 * i), 0);
+    }
+
+    // A truncated file is corrupt
+    fs::resize_file(filename, fs::file_size(filename) - 1);
+    BOOST_CHECK_THROW(
+        chdr_capture_reader(filename, capture_format::RAW), uhd::value_error);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_read_invalid, temp_dir_fixture)
+{
+    BOOST_CHECK_THROW(
+        chdr_capture_reader(file("missing.pcap"), capture_format::PCAP), uhd::io_error);
+
+    const std::string filename = file("invalid.pcap");
+    std::ofstream(filename) << "This is not a pcap file";
+    BOOST_CHECK_THROW(
+        chdr_capture_reader(filename, capture_format::PCAP), uhd::value_error);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_replay, temp_dir_fixture)
+{
+    const std::string filename = file("test.pcap");
+    const auto packets         = write_capture(filename);
+    auto capture =
+        std::make_shared<chdr_capture_reader>(filename, capture_format::PCAP);
+
+    chdr_replay_link::params_t params;
+    params.num_loops = 2;
+    auto link        = chdr_replay_link::make(capture, params);
+    BOOST_CHECK_EQUAL(link->get_recv_frame_size(), capture->get_max_packet_size());
+
+    for (size_t loop = 0; loop < params.num_loops; loop++) {
+        for (size_t i = 0; i < packets.size(); i++) {
+            auto buff = link->get_recv_buff(0);
+            BOOST_REQUIRE(buff);
+            BOOST_REQUIRE_EQUAL(buff->packet_size(), packets[i].size());
+            // The payload is unchanged
+            BOOST_CHECK(std::memcmp(static_cast<uint8_t*>(buff->data()) + 8,
+                            packets[i].data() + 8,
+                            packets[i].size() - 8)
+                        == 0);
+            // Sequence numbers continue on every repetition, for every stream
+            const auto expected = get_header(packets[i].data());
+            const auto header   = get_header(buff->data());
+            BOOST_CHECK_EQUAL(header.get_dst_epid(), expected.get_dst_epid());
+            BOOST_CHECK_EQUAL(header.get_seq_num(),
+                expected.get_seq_num()
+                    + loop * (expected.get_dst_epid() == 1 ? 3 : 2));
+            link->release_recv_buff(std::move(buff));
+        }
+    }
+    BOOST_CHECK(!link->get_recv_buff(0));
+    BOOST_CHECK_EQUAL(link->get_num_replayed(), params.num_loops * packets.size());
+
+    // Sent packets are dropped
+    for (size_t i = 0; i < 3; i++) {
+        auto buff = link->get_send_buff(0);
+        BOOST_REQUIRE(buff);
+        buff->set_packet_size(16);
+        link->release_send_buff(std::move(buff));
+    }
+    BOOST_CHECK_EQUAL(link->get_num_sent(), 3);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_replay_invalid, temp_dir_fixture)
+{
+    const std::string filename = file("test.pcap");
+    write_capture(filename);
+    auto capture =
+        std::make_shared<chdr_capture_reader>(filename, capture_format::PCAP);
+
+    chdr_replay_link::params_t params;
+    params.recv_frame_size = capture->get_max_packet_size() - 8;
+    BOOST_CHECK_THROW(chdr_replay_link::make(capture, params), uhd::value_error);
+    params.recv_frame_size = 0;
+    params.pacing          = chdr_replay_link::pacing_t::LINK_RATE;
+    BOOST_CHECK_THROW(chdr_replay_link::make(capture, params), uhd::value_error);
+
+    chdr_capture_reader::filter_t filter;
+    filter.dst_epid = 3;
+    BOOST_CHECK_THROW(chdr_replay_link::make(std::make_shared<chdr_capture_reader>(
+                                                 filename,
+                                                 capture_format::PCAP,
+                                                 uhd::ENDIANNESS_LITTLE,
+                                                 filter),
+                          params),
+        uhd::value_error);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_capture_link, temp_dir_fixture)
+{
+    const std::string filename = file("capture.pcap");
+    const size_t frame_size    = 64;
+
+    auto recv_link = std::make_shared<mock_recv_link>(
+        mock_recv_link::link_params{frame_size, 2});
+    auto send_link = std::make_shared<mock_send_link>(
+        mock_send_link::link_params{frame_size, 2});
+
+    const auto rx_packet = make_packet(1, 5, 3);
+    boost::shared_array<uint8_t> rx_frame(new uint8_t[rx_packet.size()]);
+    std::memcpy(rx_frame.get(), rx_packet.data(), rx_packet.size());
+    recv_link->push_back_recv_packet(rx_frame, rx_packet.size());
+
+    {
+        auto writer = chdr_capture_writer::get(filename);
+        BOOST_CHECK(writer == chdr_capture_writer::get(filename));
+        auto link = chdr_capture_link::make(send_link,
+            recv_link,
+            writer,
+            chdr_capture_writer::make_endpoint("192.168.10.2", 49153),
+            chdr_capture_writer::make_endpoint("192.168.10.1", 30000));
+
+        auto buff = link->get_recv_buff(0);
+        BOOST_REQUIRE(buff);
+        link->release_recv_buff(std::move(buff));
+
+        const auto tx_packet = make_packet(7, 0, 1);
+        buff                 = link->get_send_buff(0);
+        BOOST_REQUIRE(buff);
+        std::memcpy(buff->data(), tx_packet.data(), tx_packet.size());
+        buff->set_packet_size(tx_packet.size());
+        link->release_send_buff(std::move(buff));
+        BOOST_CHECK_EQUAL(send_link->get_num_packets(), 1);
+
+        BOOST_CHECK_EQUAL(writer->get_num_packets(), 2);
+    }
+
+    // Only the received packet came from the device
+    chdr_capture_reader reader(filename, capture_format::PCAP);
+    BOOST_REQUIRE_EQUAL(reader.size(), 1);
+    BOOST_REQUIRE_EQUAL(reader.packet_size(0), rx_packet.size());
+    BOOST_CHECK(std::memcmp(reader.data(0), rx_packet.data(), rx_packet.size()) == 0);
+
+    chdr_capture_reader::filter_t filter;
+    filter.udp_src_port = 30000;
+    chdr_capture_reader host_reader(
+        filename, capture_format::PCAP, uhd::ENDIANNESS_LITTLE, filter);
+    BOOST_CHECK_EQUAL(host_reader.size(), 1);
+}
@@ -57,6 +57,7 @@ public:
     {
         size_t frame_size;
         size_t num_frames;
+        size_t send_batch_size = 1;
     };
 
     /*!
@@ -72,7 +73,7 @@ public:
      *                          memory region for all frame buffers.
      */
     mock_send_link(const link_params& params, const bool reuse_send_memory = false)
-        : base_t(params.num_frames, params.frame_size)
+        : base_t(params.num_frames, params.frame_size, params.send_batch_size)
         , _reuse_send_memory(reuse_send_memory)
     {
         _buffs.resize(params.num_frames);
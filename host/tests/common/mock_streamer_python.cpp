@@ -0,0 +1,217 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Python module with streamers that need no hardware, for testing the
+// streaming calls of the Python API. The streamers are derived from the
+// rx_streamer and tx_streamer types of the uhd module, so they can be passed
+// to everything that takes a streamer.
+
+#include <uhd/stream.hpp>
+#include <uhd/types/metadata.hpp>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <algorithm>
+#include <complex>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace {
+
+//! Tick rate of the time stamps of the mock streamers
+constexpr double MOCK_TICK_RATE = 1e6;
+
+/*! RX streamer which receives a ramp in fc32 format
+ *
+ * Sample n of channel c has the value (n, c), where n counts from the start of
+ * the stream. Each recv() call returns at most max_num_samps samples, like a
+ * packet. If burst_len is not zero, the last sample of the burst has the end of
+ * burst flag set, and all following recv() calls time out.
+ */
+class mock_rx_streamer : public uhd::rx_streamer
+{
+public:
+    mock_rx_streamer(
+        const size_t num_chans, const size_t max_num_samps, const size_t burst_len)
+        : _num_chans(num_chans), _max_num_samps(max_num_samps), _burst_len(burst_len)
+    {
+    }
+
+    size_t get_num_channels(void) const override
+    {
+        return _num_chans;
+    }
+
+    size_t get_max_num_samps(void) const override
+    {
+        return _max_num_samps;
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        uhd::rx_metadata_t& metadata,
+        const double,
+        const bool) override
+    {
+        metadata.reset();
+        if (_burst_len != 0 and _num_recvd == _burst_len) {
+            metadata.error_code = uhd::rx_metadata_t::ERROR_CODE_TIMEOUT;
+            return 0;
+        }
+        size_t nsamps = std::min(nsamps_per_buff, _max_num_samps);
+        if (_burst_len != 0) {
+            nsamps = std::min(nsamps, _burst_len - _num_recvd);
+        }
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            auto* buff = static_cast<std::complex<float>*>(buffs[chan]);
+            for (size_t i = 0; i < nsamps; i++) {
+                buff[i] = std::complex<float>(float(_num_recvd + i), float(chan));
+            }
+        }
+        metadata.has_time_spec = true;
+        metadata.time_spec =
+            uhd::time_spec_t::from_ticks(int64_t(_num_recvd), MOCK_TICK_RATE);
+        _num_recvd += nsamps;
+        metadata.end_of_burst = (_burst_len != 0 and _num_recvd == _burst_len);
+        return nsamps;
+    }
+
+    void issue_stream_cmd(const uhd::stream_cmd_t&) override {}
+
+    void post_input_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+
+    uhd::device_addr_t get_stream_info(const size_t) const override
+    {
+        return uhd::device_addr_t();
+    }
+
+private:
+    const size_t _num_chans;
+    const size_t _max_num_samps;
+    const size_t _burst_len;
+    size_t _num_recvd = 0;
+};
+
+/*! TX streamer which records the fc32 samples and flags it was sent
+ *
+ * Each send() call accepts at most max_num_samps samples, so returning fewer
+ * samples than requested simulates a timeout. send() is called without the GIL, so it must not touch
+ * any Python objects.
+ */
+class mock_tx_streamer : public uhd::tx_streamer
+{
+public:
+    mock_tx_streamer(const size_t num_chans, const size_t max_num_samps)
+        : _num_chans(num_chans), _max_num_samps(max_num_samps), _samps(num_chans)
+    {
+    }
+
+    size_t get_num_channels(void) const override
+    {
+        return _num_chans;
+    }
+
+    size_t get_max_num_samps(void) const override
+    {
+        return _max_num_samps;
+    }
+
+    size_t send(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        const uhd::tx_metadata_t& metadata,
+        const double) override
+    {
+        const size_t nsamps = std::min(nsamps_per_buff, _max_num_samps);
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            const auto* buff = static_cast<const std::complex<float>*>(buffs[chan]);
+            _samps[chan].insert(_samps[chan].end(), buff, buff + nsamps);
+        }
+        _calls.push_back({nsamps, metadata});
+        return nsamps;
+    }
+
+    bool recv_async_msg(uhd::async_metadata_t&, double) override
+    {
+        return false;
+    }
+
+    void post_output_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+
+    uhd::device_addr_t get_stream_info(const size_t) const override
+    {
+        return uhd::device_addr_t();
+    }
+
+    //! Get all samples sent so far, one row per channel
+    py::array_t<std::complex<float>> get_samples() const
+    {
+        const size_t nsamps = _samps[0].size();
+        py::array_t<std::complex<float>> result(
+            {py::ssize_t(_num_chans), py::ssize_t(nsamps)});
+        auto view = result.mutable_unchecked<2>();
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            for (size_t i = 0; i < nsamps; i++) {
+                view(chan, i) = _samps[chan][i];
+            }
+        }
+        return result;
+    }
+
+    /*! Get the number of samples, start of burst, end of burst, and time (or
+     * None) of every send() call
+     */
+    py::list get_calls() const
+    {
+        py::list result;
+        for (const auto& [nsamps, md] : _calls) {
+            result.append(py::make_tuple(nsamps,
+                md.start_of_burst,
+                md.end_of_burst,
+                md.has_time_spec ? py::object(py::float_(md.time_spec.get_real_secs()))
+                                 : py::object(py::none())));
+        }
+        return result;
+    }
+
+private:
+    const size_t _num_chans;
+    const size_t _max_num_samps;
+    std::vector<std::vector<std::complex<float>>> _samps;
+    std::vector<std::pair<size_t, uhd::tx_metadata_t>> _calls;
+};
+
+} // namespace
+
+PYBIND11_MODULE(mock_streamer, m)
+{
+    // Registers the rx_streamer and tx_streamer base classes
+    py::module_::import("uhd");
+
+    m.attr("TICK_RATE") = MOCK_TICK_RATE;
+
+    py::class_<mock_rx_streamer, uhd::rx_streamer, std::shared_ptr<mock_rx_streamer>>(
+        m, "MockRXStreamer")
+        .def(py::init<size_t, size_t, size_t>(),
+            py::arg("num_chans")     = 1,
+            py::arg("max_num_samps") = 1000,
+            py::arg("burst_len")     = 0);
+
+    py::class_<mock_tx_streamer, uhd::tx_streamer, std::shared_ptr<mock_tx_streamer>>(
+        m, "MockTXStreamer")
+        .def(py::init<size_t, size_t>(),
+            py::arg("num_chans")     = 1,
+            py::arg("max_num_samps") = 1000)
+        .def("get_samples", &mock_tx_streamer::get_samples)
+        .def("get_calls", &mock_tx_streamer::get_calls);
+}
@@ -43,7 +43,7 @@ struct benchmark_result
 
 // List of priority types. This must be manually kept in sync with whatever is
 // defined in convert_common.hpp
-const std::array<uhd::convert::priority_type, 5> CONV_PRIO_TYPES{-1, 0, 1, 2, 3};
+const std::array<uhd::convert::priority_type, 8> CONV_PRIO_TYPES{-1, 0, 1, 2, 3, 4, 5, 6};
 
 // Use this to create a converter with fixed prio in a test case. If prio does
 // not exist, we simply exit the test case. That's normal.
@@ -1095,6 +1095,122 @@ MULTI_CONVERTER_TEST_CASE(benchmark_convert_types_sc16_and_sc8)
         });
 }
 
+/***********************************************************************
+ * Test the SIMD converters
+ *
+ * The tests above use short buffers, which mostly exercise the scalar
+ * head and tail handling of the SIMD converters. These run buffers that span
+ * several SIMD iterations through every priority, checked against the
+ * generic converters.
+ **********************************************************************/
+static const std::vector<size_t> SIMD_TEST_NSAMPS{
+    16, 17, 31, 32, 33, 47, 63, 64, 65, 100, 255, 256};
+
+template <typename data_type>
+static void test_convert_types_for_floats_simd(const convert::id_type& id,
+    const uhd::convert::priority_type prio,
+    const double extra_scale = 1.0,
+    const double tolerance   = 1. / (1 << 14))
+{
+    typedef typename data_type::value_type value_type;
+
+    convert::id_type in_id  = id;
+    convert::id_type out_id = reverse_converter(id);
+
+    for (const size_t nsamps : SIMD_TEST_NSAMPS) {
+        std::vector<data_type> input(nsamps), output(nsamps);
+        for (data_type& in : input) {
+            in = data_type(
+                ((std::rand() / (value_type(RAND_MAX) / 2)) - 1) * float(extra_scale),
+                ((std::rand() / (value_type(RAND_MAX) / 2)) - 1) * float(extra_scale));
+        }
+
+        // Pair the converter under test with the generic one in both
+        // directions, so that errors can't cancel each other out
+        for (const auto& prios : {std::make_pair(prio, 0), std::make_pair(0, prio)}) {
+            try {
+                loopback(nsamps, in_id, out_id, input, output, prios.first, prios.second);
+            } catch (uhd::key_error&) {
+                continue;
+            }
+            for (size_t i = 0; i < nsamps; i++) {
+                MY_CHECK_CLOSE(input[i].real(), output[i].real(), value_type(tolerance));
+                MY_CHECK_CLOSE(input[i].imag(), output[i].imag(), value_type(tolerance));
+            }
+        }
+    }
+}
+
+MULTI_CONVERTER_TEST_CASE(test_convert_types_simd_fc32)
+{
+    convert::id_type id;
+    id.input_format = "fc32";
+    id.num_inputs   = 1;
+    id.num_outputs  = 1;
+
+    for (const char* otw_format : {"sc16_item32_le", "sc16_item32_be", "sc16_chdr"}) {
+        id.output_format = otw_format;
+        test_convert_types_for_floats_simd<fc32_t>(id, conv_prio_type);
+    }
+    for (const char* otw_format : {"sc8_item32_le", "sc8_item32_be"}) {
+        id.output_format = otw_format;
+        test_convert_types_for_floats_simd<fc32_t>(id, conv_prio_type, 1. / 256);
+    }
+}
+
+MULTI_CONVERTER_TEST_CASE(test_convert_types_simd_fc64)
+{
+    convert::id_type id;
+    id.input_format = "fc64";
+    id.num_inputs   = 1;
+    id.num_outputs  = 1;
+
+    for (const char* otw_format : {"sc16_item32_le", "sc16_item32_be", "sc16_chdr"}) {
+        id.output_format = otw_format;
+        test_convert_types_for_floats_simd<fc64_t>(id, conv_prio_type);
+    }
+    for (const char* otw_format : {"sc8_item32_le", "sc8_item32_be"}) {
+        id.output_format = otw_format;
+        test_convert_types_for_floats_simd<fc64_t>(id, conv_prio_type, 1. / 256);
+    }
+}
+
+MULTI_CONVERTER_TEST_CASE(test_convert_types_simd_sc16)
+{
+    convert::id_type id;
+    id.input_format = "sc16";
+    id.num_inputs   = 1;
+    id.num_outputs  = 1;
+
+    for (const char* otw_format : {"sc16_item32_le", "sc16_item32_be"}) {
+        id.output_format = otw_format;
+        for (const size_t nsamps : SIMD_TEST_NSAMPS) {
+            test_convert_types_sc16(nsamps, id, conv_prio_type);
+        }
+    }
+}
+
+MULTI_CONVERTER_TEST_CASE(test_convert_types_simd_sc12_chdr)
+{
+    convert::id_type id;
+    id.num_inputs    = 1;
+    id.num_outputs   = 1;
+    id.output_format = "sc12_chdr";
+
+    // sc12_chdr keeps the upper 12 bits of an sc16 sample, so the loopback
+    // is off by up to 16 LSBs of sc16
+    id.input_format = "fc32";
+    test_convert_types_for_floats_simd<fc32_t>(id, conv_prio_type, 1.0, 1. / (1 << 10));
+
+    id.input_format = "sc16";
+    for (size_t nsamps = 1; nsamps < 16; nsamps++) {
+        test_convert_types_sc16(nsamps, id, conv_prio_type, 1, 0xfff0);
+    }
+    for (const size_t nsamps : SIMD_TEST_NSAMPS) {
+        test_convert_types_sc16(nsamps, id, conv_prio_type, 1, 0xfff0);
+    }
+}
+
 /***********************************************************************
  * Test u8 conversion
  **********************************************************************/
@@ -15,6 +15,7 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -430,6 +431,127 @@ BOOST_FIXTURE_TEST_CASE(test_multi_poke32_mismatched_sizes, ctrlport_endpoint_fi
     BOOST_CHECK_THROW(endpoint->multi_poke32(test_addrs, test_data), uhd::value_error);
 }
 
+BOOST_FIXTURE_TEST_CASE(test_multi_poke32_consecutive, ctrlport_endpoint_fixture)
+{
+    // Runs of consecutive addresses are combined into block writes, a lone
+    // write stays a regular write
+    const std::vector<uint32_t> test_addrs = {
+        0x1000, 0x1004, 0x1008, 0x2000, 0x3000, 0x3004};
+    const std::vector<uint32_t> test_data  = {1, 2, 3, 4, 5, 6};
+    const uhd::time_spec_t test_time(1.0);
+
+    endpoint->multi_poke32(test_addrs, test_data, test_time);
+
+    BOOST_REQUIRE_EQUAL(get_sent_packet_count(), 3);
+    std::lock_guard<std::mutex> lock(sent_packets_mutex);
+    BOOST_CHECK_EQUAL(sent_packets[0].op_code, OP_BLOCK_WRITE);
+    BOOST_CHECK_EQUAL(sent_packets[0].address, 0x1000);
+    BOOST_CHECK(sent_packets[0].data_vtr == std::vector<uint32_t>({1, 2, 3}));
+    BOOST_CHECK(sent_packets[0].has_timestamp());
+    BOOST_CHECK_EQUAL(sent_packets[1].op_code, OP_WRITE);
+    BOOST_CHECK_EQUAL(sent_packets[1].address, 0x2000);
+    BOOST_CHECK(sent_packets[1].data_vtr == std::vector<uint32_t>({4}));
+    // Only the first packet is timed, the others execute right after it
+    BOOST_CHECK(!sent_packets[1].has_timestamp());
+    BOOST_CHECK_EQUAL(sent_packets[2].op_code, OP_BLOCK_WRITE);
+    BOOST_CHECK_EQUAL(sent_packets[2].address, 0x3000);
+    BOOST_CHECK(sent_packets[2].data_vtr == std::vector<uint32_t>({5, 6}));
+    BOOST_CHECK(!sent_packets[2].has_timestamp());
+}
+
+BOOST_FIXTURE_TEST_CASE(test_multi_poke32_custom_space, ctrlport_endpoint_fixture)
+{
+    std::vector<std::pair<uint32_t, uint32_t>> custom_pokes;
+    endpoint->define_custom_register_space(
+        0x1004,
+        4,
+        [&](uint32_t addr, uint32_t data) { custom_pokes.emplace_back(addr, data); },
+        [](uint32_t) { return 0u; });
+
+    // Writes to a custom register space must not be merged into block writes
+    endpoint->multi_poke32({0x1000, 0x1004, 0x1008}, {1, 2, 3});
+
+    BOOST_REQUIRE_EQUAL(custom_pokes.size(), 1);
+    BOOST_CHECK_EQUAL(custom_pokes[0].first, 0x1004);
+    BOOST_CHECK_EQUAL(custom_pokes[0].second, 2);
+    BOOST_REQUIRE_EQUAL(get_sent_packet_count(), 2);
+    std::lock_guard<std::mutex> lock(sent_packets_mutex);
+    BOOST_CHECK_EQUAL(sent_packets[0].op_code, OP_WRITE);
+    BOOST_CHECK_EQUAL(sent_packets[0].address, 0x1000);
+    BOOST_CHECK_EQUAL(sent_packets[1].op_code, OP_WRITE);
+    BOOST_CHECK_EQUAL(sent_packets[1].address, 0x1008);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_peek32_async, ctrlport_endpoint_fixture)
+{
+    const std::vector<uint32_t> test_addrs = {0x5000, 0x5010, 0x6000, 0x7000};
+
+    std::vector<std::future<uint32_t>> results;
+    for (const uint32_t addr : test_addrs) {
+        results.push_back(endpoint->peek32_async(addr));
+    }
+
+    // All requests go out before any response is collected
+    BOOST_CHECK_EQUAL(get_sent_packet_count(), test_addrs.size());
+
+    // Collect the responses in reverse order
+    for (size_t i = test_addrs.size(); i-- > 0;) {
+        BOOST_CHECK_EQUAL(results[i].get(), test_addrs[i] + 0xDEADBEEF);
+    }
+    BOOST_CHECK_EQUAL(endpoint->get_stats().ack_packets_received, test_addrs.size());
+}
+
+BOOST_FIXTURE_TEST_CASE(test_peek32_async_discarded, ctrlport_endpoint_fixture)
+{
+    const uint32_t test_addr = 0x5000;
+
+    // Drop a future whose response has already arrived, and one whose response
+    // may still be in flight. Neither may affect the reads that follow.
+    {
+        auto result = endpoint->peek32_async(test_addr);
+        wait_for_all_responses();
+    }
+    { auto result = endpoint->peek32_async(test_addr + 4); }
+
+    BOOST_CHECK_EQUAL(endpoint->peek32(test_addr + 8), test_addr + 8 + 0xDEADBEEF);
+    BOOST_CHECK_EQUAL(
+        endpoint->peek32_async(test_addr + 12).get(), test_addr + 12 + 0xDEADBEEF);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_peek32_async_custom_space, ctrlport_endpoint_fixture)
+{
+    endpoint->define_custom_register_space(
+        0x4000, 0x100, [](uint32_t, uint32_t) {}, [](uint32_t addr) { return addr * 2; });
+
+    auto result = endpoint->peek32_async(0x4010);
+    BOOST_CHECK_EQUAL(result.get(), 0x8020);
+    BOOST_CHECK_EQUAL(get_sent_packet_count(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_register_write_batch, ctrlport_endpoint_fixture)
+{
+    register_write_batch batch(*endpoint);
+    batch.poke32(0x100, 1);
+    batch.poke64(0x104, 0x0000000300000002);
+    batch.poke32(0x200, 4);
+    BOOST_CHECK_EQUAL(batch.size(), 4);
+
+    // Nothing is sent before the batch is committed
+    BOOST_CHECK_EQUAL(get_sent_packet_count(), 0);
+
+    batch.commit();
+    BOOST_CHECK_EQUAL(batch.size(), 0);
+
+    BOOST_REQUIRE_EQUAL(get_sent_packet_count(), 2);
+    std::lock_guard<std::mutex> lock(sent_packets_mutex);
+    BOOST_CHECK_EQUAL(sent_packets[0].op_code, OP_BLOCK_WRITE);
+    BOOST_CHECK_EQUAL(sent_packets[0].address, 0x100);
+    BOOST_CHECK(sent_packets[0].data_vtr == std::vector<uint32_t>({1, 2, 3}));
+    BOOST_CHECK_EQUAL(sent_packets[1].op_code, OP_WRITE);
+    BOOST_CHECK_EQUAL(sent_packets[1].address, 0x200);
+    BOOST_CHECK(sent_packets[1].data_vtr == std::vector<uint32_t>({4}));
+}
+
 BOOST_FIXTURE_TEST_CASE(test_block_poke32, ctrlport_endpoint_fixture)
 {
     const uint32_t base_addr              = 0x8000;
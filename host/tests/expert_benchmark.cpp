@@ -0,0 +1,172 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/experts/expert_container.hpp>
+#include <uhd/experts/expert_factory.hpp>
+#include <uhd/property_tree.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd::experts;
+using namespace std::chrono;
+
+//! Worker that writes the sum of its inputs to its output
+class sum_worker_t : public worker_node_t
+{
+public:
+    sum_worker_t(const node_retriever_t& db,
+        const std::string& name,
+        const std::vector<std::string>& inputs,
+        const std::string& output)
+        : worker_node_t(name), _output(db, output)
+    {
+        for (const std::string& input : inputs) {
+            _readers.push_back(std::make_unique<data_reader_t<int>>(db, input));
+            bind_accessor(*_readers.back());
+        }
+        bind_accessor(_output);
+    }
+
+private:
+    void resolve() override
+    {
+        int sum = 0;
+        for (const auto& reader : _readers) {
+            sum += reader->get();
+        }
+        _output = sum;
+    }
+
+    std::vector<std::unique_ptr<data_reader_t<int>>> _readers;
+    data_writer_t<int> _output;
+};
+
+std::string prop_name(const size_t fe, const size_t stage)
+{
+    return str(boost::format("fe%d/prop%d") % fe % stage);
+}
+
+std::string stage_name(const size_t fe, const size_t stage)
+{
+    return str(boost::format("fe%d/stage%d") % fe % stage);
+}
+
+/*!
+ * Build an expert graph of independent frontends. Every frontend is a chain of
+ * workers that each read a property and the output of the previous worker, and
+ * a final worker that reads all of their outputs.
+ */
+void make_graph(expert_container::sptr container,
+    uhd::property_tree::sptr tree,
+    const size_t num_frontends,
+    const size_t num_stages)
+{
+    for (size_t fe = 0; fe < num_frontends; fe++) {
+        std::vector<std::string> stages;
+        for (size_t stage = 0; stage < num_stages; stage++) {
+            expert_factory::add_prop_node<int>(container,
+                tree,
+                prop_name(fe, stage),
+                0,
+                uhd::experts::AUTO_RESOLVE_ON_WRITE);
+            expert_factory::add_data_node<int>(container, stage_name(fe, stage), 0);
+            std::vector<std::string> inputs{prop_name(fe, stage)};
+            if (stage > 0) {
+                inputs.push_back(stage_name(fe, stage - 1));
+            }
+            expert_factory::add_worker_node<sum_worker_t>(container,
+                container->node_retriever(),
+                stage_name(fe, stage) + "_worker",
+                inputs,
+                stage_name(fe, stage));
+            stages.push_back(stage_name(fe, stage));
+        }
+        const std::string regs_name = str(boost::format("fe%d/regs") % fe);
+        expert_factory::add_prop_node<int>(
+            container, tree, regs_name, 0, uhd::experts::AUTO_RESOLVE_ON_READ);
+        expert_factory::add_worker_node<sum_worker_t>(container,
+            container->node_retriever(),
+            regs_name + "_worker",
+            stages,
+            regs_name);
+    }
+    container->resolve_all();
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    double run_time;
+    size_t num_frontends;
+    size_t num_stages;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("duration", po::value<double>(&run_time)->default_value(1.0), "duration of each run in seconds")
+        ("frontends", po::value<size_t>(&num_frontends)->default_value(4), "number of independent frontends")
+        ("stages", po::value<size_t>(&num_stages)->default_value(24), "number of workers per frontend")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Expert Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of full and incremental expert graph resolves.\n"
+                     "    The defaults are roughly the size of the expert graph of a\n"
+                     "    ZBX daughterboard (two channels, RX and TX).\n"
+                     "    No hardware is needed to run this benchmark.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    expert_container::sptr container = expert_factory::create_container("benchmark");
+    make_graph(container, uhd::property_tree::make(), num_frontends, num_stages);
+
+    // Once initialized, getting modify access to graph nodes is possible (by design) but
+    // extremely red-flaggy! But we do it here to change nodes without resolving
+    data_node_t<int>& fe0_prop0 = *(const_cast<data_node_t<int>*>(
+        dynamic_cast<const data_node_t<int>*>(
+            &container->node_retriever().lookup(prop_name(0, 0)))));
+
+    // Changing the first property of a frontend makes every worker of that
+    // frontend run, which is the worst case for an incremental resolve
+    auto run_benchmark = [&](const std::string& name, const bool incremental) {
+        const auto start = steady_clock::now();
+        const auto end   = start + duration<double>(run_time);
+        int value        = 0;
+        size_t resolves  = 0;
+        for (; steady_clock::now() < end; resolves++) {
+            fe0_prop0.set(++value);
+            if (incremental) {
+                container->resolve_from(fe0_prop0.get_name());
+            } else {
+                container->resolve_all();
+            }
+        }
+        const duration<double> elapsed = steady_clock::now() - start;
+        std::cout << boost::format("%-16s %10.0f resolves/s") % name
+                         % (resolves / elapsed.count())
+                  << std::endl;
+    };
+    std::cout << "Expert graph with " << num_frontends * (3 * num_stages + 2)
+              << " nodes:" << std::endl;
+    run_benchmark("resolve_all()", false);
+    run_benchmark("resolve_from()", true);
+
+    return EXIT_SUCCESS;
+}
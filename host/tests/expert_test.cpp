@@ -12,6 +12,8 @@
 #include <boost/test/unit_test.hpp>
 #include <fstream>
 #include <memory>
+#include <string>
+#include <vector>
 
 using namespace uhd::experts;
 
@@ -142,6 +144,38 @@ private:
 
 //=============================================================================
 
+class sum_worker_t : public worker_node_t
+{
+public:
+    sum_worker_t(const node_retriever_t& db,
+        const std::string& name,
+        const std::vector<std::string>& inputs,
+        const std::string& output)
+        : worker_node_t(name), _output(db, output)
+    {
+        for (const std::string& input : inputs) {
+            _readers.push_back(std::make_unique<data_reader_t<int>>(db, input));
+            bind_accessor(*_readers.back());
+        }
+        bind_accessor(_output);
+    }
+
+private:
+    void resolve() override
+    {
+        int sum = 0;
+        for (const auto& reader : _readers) {
+            sum += reader->get();
+        }
+        _output = sum;
+    }
+
+    std::vector<std::unique_ptr<data_reader_t<int>>> _readers;
+    data_writer_t<int> _output;
+};
+
+//=============================================================================
+
 #define DUMP_VARS                                                                     \
     BOOST_TEST_MESSAGE(str(                                                           \
         boost::format(                                                                \
@@ -274,3 +308,98 @@ BOOST_AUTO_TEST_CASE(test_experts)
     nodeA.mark_clean();
     BOOST_CHECK(!nodeA.is_dirty());
 }
+
+BOOST_AUTO_TEST_CASE(test_experts_incremental_resolve)
+{
+    // Roughly the size of the expert graph of a ZBX daughterboard: Four
+    // frontends (two channels, RX and TX), which don't share any nodes. Every
+    // frontend is a chain of workers that each read a property and the
+    // output of the previous worker, and a final worker that reads all of
+    // their outputs.
+    constexpr size_t NUM_FRONTENDS = 4;
+    constexpr size_t NUM_STAGES    = 24;
+
+    auto prop_name = [](const size_t fe, const size_t stage) {
+        return str(boost::format("fe%d/prop%d") % fe % stage);
+    };
+    auto stage_name = [](const size_t fe, const size_t stage) {
+        return str(boost::format("fe%d/stage%d") % fe % stage);
+    };
+    auto regs_name = [](const size_t fe) { return str(boost::format("fe%d/regs") % fe); };
+    auto make_graph = [&](expert_container::sptr container,
+                          uhd::property_tree::sptr tree) {
+        for (size_t fe = 0; fe < NUM_FRONTENDS; fe++) {
+            std::vector<std::string> stages;
+            for (size_t stage = 0; stage < NUM_STAGES; stage++) {
+                expert_factory::add_prop_node<int>(container,
+                    tree,
+                    prop_name(fe, stage),
+                    0,
+                    uhd::experts::AUTO_RESOLVE_ON_WRITE);
+                expert_factory::add_data_node<int>(container, stage_name(fe, stage), 0);
+                std::vector<std::string> inputs{prop_name(fe, stage)};
+                if (stage > 0) {
+                    inputs.push_back(stage_name(fe, stage - 1));
+                }
+                expert_factory::add_worker_node<sum_worker_t>(container,
+                    container->node_retriever(),
+                    stage_name(fe, stage) + "_worker",
+                    inputs,
+                    stage_name(fe, stage));
+                stages.push_back(stage_name(fe, stage));
+            }
+            expert_factory::add_prop_node<int>(
+                container, tree, regs_name(fe), 0, uhd::experts::AUTO_RESOLVE_ON_READ);
+            expert_factory::add_worker_node<sum_worker_t>(container,
+                container->node_retriever(),
+                regs_name(fe) + "_worker",
+                stages,
+                regs_name(fe));
+        }
+        container->resolve_all();
+    };
+
+    // Once initialized, getting modify access to graph nodes is possible (by design) but
+    // extremely red-flaggy! But we do it here to change nodes without resolving
+    auto get_node = [](expert_container::sptr container,
+                        const std::string& name) -> data_node_t<int>& {
+        return *(const_cast<data_node_t<int>*>(dynamic_cast<const data_node_t<int>*>(
+            &container->node_retriever().lookup(name))));
+    };
+
+    expert_container::sptr container = expert_factory::create_container("incremental");
+    uhd::property_tree::sptr tree    = uhd::property_tree::make();
+    make_graph(container, tree);
+    data_node_t<int>& fe1_prop0 = get_node(container, prop_name(1, 0));
+
+    // Resolving from a node must leave unrelated dirty nodes alone
+    fe1_prop0.set(1);
+    tree->access<int>(prop_name(0, 0)).set(1);
+    BOOST_CHECK_EQUAL(tree->access<int>(regs_name(0)).get(), int(NUM_STAGES));
+    BOOST_CHECK(fe1_prop0.is_dirty());
+    container->resolve_to(regs_name(1));
+    BOOST_CHECK(!fe1_prop0.is_dirty());
+    BOOST_CHECK_EQUAL(tree->access<int>(regs_name(1)).get(), int(NUM_STAGES));
+
+    // Incremental resolves must give the same results as full ones. Apply the
+    // same changes to a second graph which is always fully resolved.
+    expert_container::sptr full_container = expert_factory::create_container("full");
+    make_graph(full_container, uhd::property_tree::make());
+    get_node(full_container, prop_name(0, 0)).set(1);
+    get_node(full_container, prop_name(1, 0)).set(1);
+    full_container->resolve_all();
+    int value = 1;
+    for (size_t fe = 0; fe < NUM_FRONTENDS; fe++) {
+        for (const size_t stage : {size_t(0), NUM_STAGES / 2, NUM_STAGES - 1}) {
+            value++;
+            get_node(container, prop_name(fe, stage)).set(value);
+            container->resolve_from(prop_name(fe, stage));
+            get_node(full_container, prop_name(fe, stage)).set(value);
+            full_container->resolve_all();
+            for (size_t i = 0; i < NUM_FRONTENDS; i++) {
+                BOOST_CHECK_EQUAL(get_node(container, regs_name(i)).get(),
+                    get_node(full_container, regs_name(i)).get());
+            }
+        }
+    }
+}
@@ -0,0 +1,194 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/types/time_spec.hpp>
+#include <uhdlib/usrp/dboard/hbx/hbx_lo_ctrl.hpp>
+#include <boost/test/unit_test.hpp>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace uhd::usrp::hbx;
+
+namespace {
+
+constexpr uint32_t SPI_START_ADDR  = 0x100;
+constexpr uint32_t SPI_SETUP_ADDR  = SPI_START_ADDR + 0x4;
+constexpr uint32_t SPI_STATUS_ADDR = SPI_START_ADDR + 0x8;
+constexpr double PRC_RATE          = 64e6;
+constexpr uint32_t SPI_READY       = 1u << 31;
+constexpr uint32_t SPI_READ_READY  = 1u << 30;
+constexpr uint32_t SPI_START_XACT  = 1u << 31;
+constexpr uint32_t SPI_READ_XACT   = 1u << 30;
+
+/*! Mock of the SPI engine of the HBX LO, with an LMX2572 behind it
+ *
+ * The engine has 8 bit addresses, 16 bit data, and a command FIFO. Setup
+ * register writes are applied to the LMX register memory right away. Bursts to
+ * the setup register are recorded along with their command time.
+ */
+struct mock_spi_engine
+{
+    struct burst_t
+    {
+        uint32_t addr;
+        std::vector<uint32_t> data;
+        uhd::time_spec_t time;
+    };
+
+    void poke32(const uint32_t addr, const uint32_t data, const hbx_cpld_ctrl::chan_t)
+    {
+        BOOST_REQUIRE_EQUAL(addr, SPI_SETUP_ADDR);
+        num_pokes++;
+        _transact(data);
+    }
+
+    uint32_t peek32(const uint32_t addr)
+    {
+        if (addr == SPI_START_ADDR) {
+            // FIFO depth, address width, data width
+            return (16 << 16) | (8 << 8) | 16;
+        }
+        BOOST_REQUIRE_EQUAL(addr, SPI_STATUS_ADDR);
+        num_peeks++;
+        uint16_t value = 0;
+        if (_read_addr == 125) {
+            value = 0x2288; // LMX2572 magic number
+        } else if (_read_addr == 0) {
+            value = 0xFFFF; // Locked
+        } else if (lmx_regs.count(_read_addr)) {
+            value = lmx_regs.at(_read_addr);
+        }
+        return SPI_READY | SPI_READ_READY | (_read_addr << 16) | value;
+    }
+
+    void burst_poke32(const uint32_t addr,
+        const std::vector<uint32_t>& data,
+        const hbx_cpld_ctrl::chan_t chan)
+    {
+        const auto time =
+            (chan == hbx_cpld_ctrl::NO_CHAN) ? uhd::time_spec_t::ASAP : cmd_time;
+        bursts.push_back({addr, data, time});
+        for (const uint32_t value : data) {
+            _transact(value);
+        }
+    }
+
+    std::shared_ptr<hbx_lo_ctrl> make_lo()
+    {
+        return std::make_shared<hbx_lo_ctrl>(uhd::RX_DIRECTION,
+            "TEST",
+            SPI_START_ADDR,
+            [this](const uint32_t addr,
+                const uint32_t data,
+                const hbx_cpld_ctrl::chan_t chan) { poke32(addr, data, chan); },
+            [this](const uint32_t addr) { return peek32(addr); },
+            [this](const uint32_t addr,
+                const std::vector<uint32_t>& data,
+                const hbx_cpld_ctrl::chan_t chan) { burst_poke32(addr, data, chan); },
+            PRC_RATE,
+            [this]() { return cmd_time; });
+    }
+
+    void clear_log()
+    {
+        num_pokes = 0;
+        num_peeks = 0;
+        bursts.clear();
+    }
+
+    uhd::time_spec_t cmd_time = uhd::time_spec_t::ASAP;
+    std::map<uint8_t, uint16_t> lmx_regs;
+    size_t num_pokes = 0;
+    size_t num_peeks = 0;
+    std::vector<burst_t> bursts;
+
+private:
+    void _transact(const uint32_t setup_value)
+    {
+        BOOST_REQUIRE(setup_value & SPI_START_XACT);
+        const uint8_t addr = (setup_value >> 16) & 0xFF;
+        if (setup_value & SPI_READ_XACT) {
+            _read_addr = addr;
+        } else {
+            lmx_regs[addr] = setup_value & 0xFFFF;
+        }
+    }
+
+    uint8_t _read_addr = 0;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(hbx_lo_tune_plan_test)
+{
+    mock_spi_engine spi;
+    auto lo = spi.make_lo();
+    // Reference LO which tunes without plans
+    mock_spi_engine ref_spi;
+    auto ref_lo = ref_spi.make_lo();
+
+    // Making plans doesn't touch the hardware
+    spi.clear_log();
+    lo->set_tune_plan_freqs({3.1e9, 2.4e9, 3.1e9});
+    BOOST_CHECK_EQUAL(spi.num_pokes, 0);
+    BOOST_CHECK_EQUAL(spi.num_peeks, 0);
+    BOOST_CHECK(spi.bursts.empty());
+    BOOST_CHECK(lo->get_tune_plan_freqs() == std::vector<double>({2.4e9, 3.1e9}));
+
+    // A timed retune to a planned frequency is one burst at the command time, and
+    // doesn't wait for the lock
+    spi.cmd_time     = uhd::time_spec_t(1.5);
+    ref_spi.cmd_time = uhd::time_spec_t(1.5);
+    const double freq = lo->set_lo_freq(3.1e9);
+    BOOST_CHECK_EQUAL(spi.num_pokes, 0);
+    BOOST_CHECK_EQUAL(spi.num_peeks, 0);
+    BOOST_REQUIRE_EQUAL(spi.bursts.size(), 1);
+    BOOST_CHECK_EQUAL(spi.bursts[0].addr, SPI_SETUP_ADDR);
+    BOOST_CHECK(spi.bursts[0].time == uhd::time_spec_t(1.5));
+    // R0 is written last
+    BOOST_REQUIRE(!spi.bursts[0].data.empty());
+    BOOST_CHECK_EQUAL((spi.bursts[0].data.back() >> 16) & 0xFF, 0);
+
+    // The plan has the same settings as tuning without one
+    BOOST_CHECK_EQUAL(freq, ref_lo->set_lo_freq(3.1e9));
+    BOOST_CHECK(spi.lmx_regs == ref_spi.lmx_regs);
+    BOOST_CHECK_EQUAL(lo->set_lo_freq(2.4e9), ref_lo->set_lo_freq(2.4e9));
+    BOOST_CHECK(spi.lmx_regs == ref_spi.lmx_regs);
+
+    // Recording adds a plan for every new frequency
+    lo->set_tune_plan_recording(true);
+    BOOST_CHECK_EQUAL(lo->set_lo_freq(2.0e9), ref_lo->set_lo_freq(2.0e9));
+    BOOST_CHECK(spi.lmx_regs == ref_spi.lmx_regs);
+    lo->set_tune_plan_recording(false);
+    lo->set_lo_freq(2.2e9);
+    BOOST_CHECK(
+        lo->get_tune_plan_freqs() == std::vector<double>({2.0e9, 2.4e9, 3.1e9}));
+
+    // Plans follow changes of the output ports
+    lo->set_lo_ports(true, false);
+    ref_lo->set_lo_ports(true, false);
+    BOOST_CHECK_EQUAL(lo->set_lo_freq(3.1e9), ref_lo->set_lo_freq(3.1e9));
+    BOOST_CHECK(spi.lmx_regs == ref_spi.lmx_regs);
+
+    // Setting new frequencies replaces the plans
+    lo->set_tune_plan_freqs({});
+    BOOST_CHECK(lo->get_tune_plan_freqs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(hbx_lo_untimed_tune_test)
+{
+    mock_spi_engine spi;
+    auto lo = spi.make_lo();
+    lo->set_tune_plan_freqs({2.4e9});
+
+    // Without a command time, the LO still waits for the lock after loading a plan
+    spi.clear_log();
+    lo->set_lo_freq(2.4e9);
+    BOOST_CHECK_EQUAL(spi.bursts.size(), 1);
+    BOOST_CHECK(spi.bursts[0].time == uhd::time_spec_t::ASAP);
+    BOOST_CHECK_GT(spi.num_peeks, 0);
+}
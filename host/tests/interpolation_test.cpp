@@ -6,6 +6,8 @@
 
 #include <uhdlib/utils/interpolation.hpp>
 #include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <random>
 #include <string>
 
 BOOST_AUTO_TEST_CASE(test_get_bounding_iterators)
@@ -100,3 +102,55 @@ BOOST_AUTO_TEST_CASE(test_map_bilinear_interp)
     BOOST_CHECK_EQUAL(at_bilin_interp(test_data, 1.0, 1.5), 0.5);
     BOOST_CHECK_EQUAL(at_bilin_interp(test_data, 1.5, 2.0), 1.5);
 }
+
+BOOST_AUTO_TEST_CASE(test_lookup_table)
+{
+    using namespace uhd::math;
+    const std::map<double, double> test_data{{1.0, 1.0}, {2.0, 2.0}, {3.0, 3.0}};
+    const lookup_table<double, double> lut(test_data);
+
+    BOOST_CHECK_EQUAL(lut.size(), 3);
+    BOOST_CHECK_EQUAL(lut.at_nearest(1.1), 1.0);
+    BOOST_CHECK_EQUAL(lut.at_nearest(1.9), 2.0);
+    BOOST_CHECK_EQUAL(lut.at_nearest(2.1), 2.0);
+    BOOST_CHECK_EQUAL(lut.at_nearest(1e9), 3.0);
+    BOOST_CHECK_CLOSE(lut.at_lin_interp(1.5), 1.5, 1e-6);
+    BOOST_CHECK_EQUAL(lut.at_lin_interp(0.1), 1.0);
+    BOOST_CHECK_EQUAL(lut.at_lin_interp(2.0), 2.0);
+    BOOST_CHECK_EQUAL(lut.at_lin_interp(137.0), 3.0);
+    BOOST_CHECK_EQUAL(lut.at(2.0), 2.0);
+    BOOST_CHECK_THROW(lut.at(2.5), std::out_of_range);
+
+    const lookup_table<double, double> single(std::map<double, double>{{5.0, 1.0}});
+    BOOST_CHECK_EQUAL(single.at_lin_interp(-1.0), 1.0);
+    BOOST_CHECK_EQUAL(single.at_lin_interp(5.0), 1.0);
+    BOOST_CHECK_EQUAL(single.at_lin_interp(7.0), 1.0);
+    BOOST_CHECK((lookup_table<double, double>().empty()));
+}
+
+BOOST_AUTO_TEST_CASE(test_lookup_table_vs_map)
+{
+    using namespace uhd::math;
+    std::mt19937 rng(42);
+    // Clustered keys, so some buckets hold many keys and others none
+    std::map<uint64_t, int> data;
+    std::uniform_int_distribution<uint64_t> cluster_dist(0, 9);
+    std::uniform_int_distribution<uint64_t> offset_dist(0, 100000);
+    for (int i = 0; i < 500; i++) {
+        data[cluster_dist(rng) * 1000000000 + offset_dist(rng)] = i;
+    }
+    const lookup_table<uint64_t, int> lut(data);
+
+    std::uniform_int_distribution<uint64_t> key_dist(0, 11000000000);
+    for (int i = 0; i < 10000; i++) {
+        // Check both exact matches and keys in between
+        const uint64_t key =
+            (i % 2) ? key_dist(rng) : std::next(data.begin(), i % data.size())->first;
+        const auto map_iters   = get_bounding_iterators(data, key);
+        const auto lut_indices = lut.get_bounding_indices(key);
+        BOOST_REQUIRE_EQUAL(map_iters.first->first, lut.key(lut_indices.first));
+        BOOST_REQUIRE_EQUAL(map_iters.second->first, lut.key(lut_indices.second));
+        BOOST_REQUIRE_EQUAL(map_iters.second->second, lut.value(lut_indices.second));
+        BOOST_REQUIRE_EQUAL(at_nearest(data, key), lut.at_nearest(key));
+    }
+}
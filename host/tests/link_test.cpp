@@ -82,6 +82,81 @@ BOOST_AUTO_TEST_CASE(test_send_timeout)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_deferred)
+{
+    // Check that deferred packets are held back until the batch is full or
+    // the link is flushed, and that packets are sent in order.
+    const size_t num_frames  = 8;
+    const size_t batch_size  = 4;
+    const int32_t timeout_ms = 1;
+
+    const mock_send_link::link_params params = {1000, num_frames, batch_size};
+
+    auto xport = std::make_shared<mock_send_link>(params);
+    BOOST_CHECK_EQUAL(xport->get_send_batch_size(), batch_size);
+
+    auto send_packet = [&](const uint8_t value, const bool deferred) {
+        auto buff = xport->get_send_buff(timeout_ms);
+        BOOST_REQUIRE(buff);
+        static_cast<uint8_t*>(buff->data())[0] = value;
+        buff->set_packet_size(sizeof(uint8_t));
+        if (deferred) {
+            xport->release_send_buff_deferred(std::move(buff));
+        } else {
+            xport->release_send_buff(std::move(buff));
+        }
+    };
+
+    // Batch fills up
+    for (size_t i = 0; i < batch_size - 1; i++) {
+        send_packet(i, true);
+    }
+    BOOST_CHECK_EQUAL(xport->get_num_packets(), 0);
+    send_packet(batch_size - 1, true);
+    BOOST_CHECK_EQUAL(xport->get_num_packets(), batch_size);
+
+    // Regular release also sends anything queued before it
+    send_packet(10, true);
+    send_packet(11, false);
+    BOOST_CHECK_EQUAL(xport->get_num_packets(), batch_size + 2);
+
+    // Explicit flush
+    send_packet(12, true);
+    BOOST_CHECK_EQUAL(xport->get_num_packets(), batch_size + 2);
+    xport->flush_send_buffs();
+    BOOST_CHECK_EQUAL(xport->get_num_packets(), batch_size + 3);
+
+    const uint8_t expected[] = {0, 1, 2, 3, 10, 11, 12};
+    for (const uint8_t value : expected) {
+        auto packet = xport->pop_send_packet();
+        BOOST_CHECK_EQUAL(packet.first[0], value);
+    }
+
+    // 7 packets were sent in 3 batches
+    BOOST_CHECK_CLOSE(xport->get_packets_per_send_call(), 7.0 / 3.0, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(test_send_deferred_no_free_buffs)
+{
+    // Check that the link flushes deferred packets when it runs out of free
+    // buffers, rather than running dry.
+    const size_t num_frames  = 2;
+    const int32_t timeout_ms = 1;
+
+    const mock_send_link::link_params params = {1000, num_frames, 16};
+
+    auto xport = std::make_shared<mock_send_link>(params);
+
+    for (size_t i = 0; i < 3 * num_frames; i++) {
+        auto buff = xport->get_send_buff(timeout_ms);
+        BOOST_REQUIRE(buff);
+        buff->set_packet_size(1);
+        xport->release_send_buff_deferred(std::move(buff));
+    }
+    xport->flush_send_buffs();
+    BOOST_CHECK_EQUAL(xport->get_num_packets(), 3 * num_frames);
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_get_release)
 {
     // Just call push_recv_packet, get_recv_buff, and release_recv_buff
@@ -142,3 +142,71 @@ BOOST_AUTO_TEST_CASE(lmx_sync_tune_test)
     // VCO_PHASE_SYNC_EN must be on in this case
     BOOST_CHECK(mem.mem[0] & (1 << 14));
 }
+
+BOOST_AUTO_TEST_CASE(lmx_tune_plan_test)
+{
+    auto mem           = lmx2572_mem{};
+    size_t num_pokes   = 0;
+    size_t num_batches = 0;
+    size_t batch_size  = 0;
+    auto lo            = lmx2572_iface::make(
+        [&](const uint8_t addr, const uint16_t data) {
+            num_pokes++;
+            mem.poke16(addr, data);
+        },
+        [&](const uint8_t addr) -> uint16_t { return mem.peek16(addr); },
+        [](const uhd::time_spec_t&) {},
+        "",
+        [&](const std::vector<std::pair<uint8_t, uint16_t>>& writes) {
+            num_batches++;
+            batch_size = writes.size();
+            for (const auto& write : writes) {
+                mem.poke16(write.first, write.second);
+            }
+            // R0 holds FCAL_EN and must be written last
+            BOOST_CHECK_EQUAL(writes.back().first, 0);
+        });
+    lo->reset();
+    lo->set_sync_mode(true);
+    lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, true);
+    lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_B, false);
+    lo->commit();
+    num_pokes = 0;
+
+    // Making plans must neither touch the device nor the cached settings, so
+    // the next commit only writes R0, which it always does
+    const std::vector<double> freqs = {50 * 64e6, 40 * 64e6, 10 * 64e6, 50.5 * 64e6};
+    std::vector<lmx2572_iface::tune_plan_t> plans;
+    const auto mem_before = mem.mem;
+    num_batches           = 0;
+    for (const double freq : freqs) {
+        plans.push_back(lo->make_tune_plan(freq, 64e6, false));
+    }
+    BOOST_CHECK_EQUAL(num_batches, 0);
+    lo->commit();
+    BOOST_CHECK_EQUAL(batch_size, 1);
+    BOOST_CHECK(mem.mem == mem_before);
+
+    // Tuning through plans must result in the same device state as direct tuning
+    auto ref_mem = lmx2572_mem{};
+    auto ref_lo  = lmx2572_iface::make(
+        [&](const uint8_t addr, const uint16_t data) { ref_mem.poke16(addr, data); },
+        [&](const uint8_t addr) -> uint16_t { return ref_mem.peek16(addr); },
+        [](const uhd::time_spec_t&) {});
+    ref_lo->reset();
+    ref_lo->set_sync_mode(true);
+    ref_lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, true);
+    ref_lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_B, false);
+    for (size_t i = 0; i < 2 * freqs.size(); i++) {
+        const size_t idx = i % freqs.size();
+        BOOST_CHECK_EQUAL(lo->set_tune_plan(plans[idx]),
+            ref_lo->set_frequency(freqs[idx], 64e6, false));
+        num_batches = 0;
+        lo->commit();
+        ref_lo->commit();
+        BOOST_CHECK_EQUAL(num_batches, 1);
+        BOOST_CHECK(mem.mem == ref_mem.mem);
+    }
+    // Every register was written through the batch function
+    BOOST_CHECK_EQUAL(num_pokes, 0);
+}
@@ -0,0 +1,195 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/usrp/common/adf535x.hpp>
+#include <uhdlib/usrp/common/lmx2572.hpp>
+#include <uhdlib/usrp/common/max287x.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace std::chrono;
+
+//! Stand-in for the register bus, which counts the writes and can emulate their cost
+class reg_bus
+{
+public:
+    reg_bus(const double write_cost_us)
+        : _write_cost(duration<double>(write_cost_us / 1e6))
+    {
+    }
+
+    void write(const size_t num_regs)
+    {
+        num_writes += num_regs;
+        if (_write_cost.count() > 0) {
+            const auto end = steady_clock::now() + num_regs * _write_cost;
+            while (steady_clock::now() < end) {
+            }
+        }
+    }
+
+    size_t num_writes = 0;
+
+private:
+    const duration<double> _write_cost;
+};
+
+/*!
+ * Hops over a list of frequencies and prints the hop rate
+ *
+ * \param name Name of the run
+ * \param bus The register bus of the synthesizer
+ * \param freqs The frequencies to hop over
+ * \param num_hops Number of hops
+ * \param hop Function which tunes to a frequency and writes the registers
+ */
+void benchmark_hops(const std::string& name,
+    reg_bus& bus,
+    const std::vector<double>& freqs,
+    const size_t num_hops,
+    const std::function<void(size_t)>& hop)
+{
+    // Visit every frequency once so the first measured hops don't differ
+    for (size_t i = 0; i < freqs.size(); i++) {
+        hop(i);
+    }
+    bus.num_writes   = 0;
+    const auto start = steady_clock::now();
+    for (size_t i = 0; i < num_hops; i++) {
+        hop(i % freqs.size());
+    }
+    const duration<double> elapsed = steady_clock::now() - start;
+    std::cout << boost::format("%-24s %10.1f k hops/s %7.2f us/hop %6.2f writes/hop")
+                     % name % (num_hops / elapsed.count() / 1e3)
+                     % (elapsed.count() * 1e6 / num_hops)
+                     % (double(bus.num_writes) / num_hops)
+              << std::endl;
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    size_t num_hops;
+    size_t num_freqs;
+    double write_cost_us;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("hops", po::value<size_t>(&num_hops)->default_value(100000), "number of hops per run")
+        ("freqs", po::value<size_t>(&num_freqs)->default_value(16), "number of frequencies to hop over")
+        ("write-cost", po::value<double>(&write_cost_us)->default_value(0.0), "emulated duration of a register write in microseconds")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD LO Tune Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of hopping LO synthesizers over a list of\n"
+                     "    frequencies, either tuning directly or loading precomputed\n"
+                     "    tune plans.\n"
+                     "    No hardware is needed to run this benchmark.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Frequencies spread over a range, like a hopping pattern would
+    const auto make_freqs = [num_freqs](const double start, const double stop) {
+        std::vector<double> freqs;
+        for (size_t i = 0; i < num_freqs; i++) {
+            freqs.push_back(start + (stop - start) * i / num_freqs + 1.234e6 * i);
+        }
+        return freqs;
+    };
+
+    {
+        // LMX2572 as configured on ZBX
+        reg_bus bus(write_cost_us);
+        auto lmx = lmx2572_iface::make([&](uint8_t, uint16_t) { bus.write(1); },
+            [](uint8_t addr) -> uint16_t { return addr == 125 ? 0x2288 : 0; },
+            [](const uhd::time_spec_t&) {},
+            "",
+            [&](const std::vector<std::pair<uint8_t, uint16_t>>& writes) {
+                bus.write(writes.size());
+            });
+        lmx->reset();
+        lmx->set_sync_mode(true);
+        lmx->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, true);
+        lmx->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_B, false);
+        lmx->commit();
+        const auto freqs = make_freqs(1e9, 6e9);
+        std::vector<lmx2572_iface::tune_plan_t> plans;
+        for (const double freq : freqs) {
+            plans.push_back(lmx->make_tune_plan(freq, 64e6, false));
+        }
+        benchmark_hops("LMX2572 set_frequency", bus, freqs, num_hops, [&](size_t i) {
+            lmx->set_frequency(freqs[i], 64e6, false);
+            lmx->commit();
+        });
+        benchmark_hops("LMX2572 set_tune_plan", bus, freqs, num_hops, [&](size_t i) {
+            lmx->set_tune_plan(plans[i]);
+            lmx->commit();
+        });
+    }
+
+    {
+        // MAX2871 as configured on UBX
+        reg_bus bus(write_cost_us);
+        auto max = max287x_iface::make<max2871>(
+            [&](const std::vector<uint32_t>& regs) { bus.write(regs.size()); });
+        max->commit();
+        const auto freqs = make_freqs(500e6, 6e9);
+        std::vector<max287x_iface::tune_plan_t> plans;
+        for (const double freq : freqs) {
+            plans.push_back(max->make_tune_plan(freq, 50e6, 50e6, false));
+        }
+        benchmark_hops("MAX2871 set_frequency", bus, freqs, num_hops, [&](size_t i) {
+            max->set_frequency(freqs[i], 50e6, 50e6, false);
+            max->commit();
+        });
+        benchmark_hops("MAX2871 set_tune_plan", bus, freqs, num_hops, [&](size_t i) {
+            max->set_tune_plan(plans[i]);
+            max->commit();
+        });
+    }
+
+    {
+        // ADF5356 as configured on TwinRX
+        reg_bus bus(write_cost_us);
+        auto adf = adf535x_iface::make_adf5356(
+            [&](const std::vector<uint32_t> regs) { bus.write(regs.size()); },
+            [](const uint32_t) {});
+        adf->set_pfd_freq(12.5e6);
+        adf->set_output_power(adf535x_iface::OUTPUT_POWER_5DBM);
+        adf->set_reference_freq(100e6);
+        adf->set_muxout_mode(adf535x_iface::MUXOUT_DLD);
+        adf->commit();
+        const auto freqs = make_freqs(2e9, 6.8e9);
+        std::vector<adf535x_iface::tune_plan_t> plans;
+        for (const double freq : freqs) {
+            plans.push_back(adf->make_tune_plan(freq));
+        }
+        benchmark_hops("ADF5356 set_frequency", bus, freqs, num_hops, [&](size_t i) {
+            adf->set_frequency(freqs[i], 2, true);
+        });
+        benchmark_hops("ADF5356 set_tune_plan", bus, freqs, num_hops, [&](size_t i) {
+            adf->set_tune_plan(plans[i], true);
+        });
+    }
+
+    return EXIT_SUCCESS;
+}
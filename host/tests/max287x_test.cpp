@@ -206,3 +206,36 @@ BOOST_AUTO_TEST_CASE(max2871_set_frequency_int_n_test)
         static_cast<max2871_regs_t::int_n_mode_t>(
             (test_lo->get_register(0) >> 31) & 0x1));
 }
+
+// Test that loading tune plans results in the same register writes as tuning
+// directly, and that making a plan leaves the register cache untouched
+BOOST_AUTO_TEST_CASE(max2871_tune_plan_test)
+{
+    std::vector<uint32_t> writes;
+    auto test_lo = max287x_iface::make<max2871>(
+        [&](const std::vector<uint32_t>& regs) { writes = regs; });
+    std::vector<uint32_t> ref_writes;
+    auto ref_lo = max287x_iface::make<max2871>(
+        [&](const std::vector<uint32_t>& regs) { ref_writes = regs; });
+    test_lo->commit();
+    ref_lo->commit();
+
+    const std::vector<double> freqs = {1.2e9, 2.41e9, 4.5e9, 75e6};
+    std::vector<max287x_iface::tune_plan_t> plans;
+    for (const double freq : freqs) {
+        plans.push_back(test_lo->make_tune_plan(freq, 50e6, 50e6, false));
+    }
+    UHD_CHECK_REGMAP(test_lo, expected_init_values);
+
+    for (size_t i = 0; i < 2 * freqs.size(); i++) {
+        const size_t idx = i % freqs.size();
+        BOOST_CHECK_EQUAL(test_lo->set_tune_plan(plans[idx]),
+            ref_lo->set_frequency(freqs[idx], 50e6, 50e6, false));
+        for (uint8_t addr = 0; addr <= 5; addr++) {
+            BOOST_CHECK_EQUAL(test_lo->get_register(addr), ref_lo->get_register(addr));
+        }
+        test_lo->commit();
+        ref_lo->commit();
+        BOOST_CHECK(writes == ref_writes);
+    }
+}
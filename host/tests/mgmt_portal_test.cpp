@@ -0,0 +1,396 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "common/mock_link.hpp"
+#include <uhd/exception.hpp>
+#include <uhd/utils/paths.hpp>
+#include <uhdlib/rfnoc/chdr_ctrl_xport.hpp>
+#include <uhdlib/rfnoc/mgmt_portal.hpp>
+#include <uhdlib/rfnoc/topo_graph.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
+#include <stdlib.h> // setenv or _putenv
+#include <boost/test/unit_test.hpp>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <set>
+
+using namespace uhd;
+using namespace uhd::rfnoc;
+using namespace uhd::rfnoc::chdr;
+using namespace uhd::transport;
+using uhd::rfnoc::detail::topo_graph_t;
+using uhd::rfnoc::detail::topo_node_t;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr device_id_t HOST_DEVICE_ID = 1;
+constexpr device_id_t DEVICE_ID      = 2;
+constexpr sep_id_t MY_EPID           = 1;
+constexpr size_t FRAME_SIZE          = 1024;
+constexpr size_t NUM_FRAMES          = 32;
+//! Number of ports of the crossbar. The transport adapter is on port 0.
+constexpr uint32_t XBAR_NUM_PORTS = 4;
+
+const chdr_packet_factory pkt_factory(CHDR_W_64, ENDIANNESS_LITTLE);
+
+using node_type = topo_node_t::node_type;
+
+/*! Simulates the management logic of an RFNoC device
+ *
+ * The device has a transport adapter, which is connected to port 0 of a
+ * crossbar. Stream endpoints are connected to the other crossbar ports.
+ * Requests are handled when the host looks for a response, all at once.
+ */
+class mock_mgmt_device
+{
+public:
+    using packet_t = std::pair<boost::shared_array<uint8_t>, size_t>;
+
+    //! Stream endpoint instance by crossbar port. Requests to other ports get lost.
+    std::map<uint16_t, uint16_t> sep_ports;
+    //! If false, the device doesn't return the tags of the requests
+    bool echo_tags = true;
+    //! If true, the responses to the requests handled at once are reversed
+    bool reverse_responses = false;
+    //! If true, every response is sent twice
+    bool duplicate_responses = false;
+
+    //! Number of requests received
+    size_t num_requests = 0;
+    //! Maximum number of requests that were handled at once
+    size_t max_requests_at_once = 0;
+
+    //! Handle the requests sent since the last call, and return the responses
+    std::deque<packet_t> handle_requests(mock_send_link& send_link)
+    {
+        std::deque<packet_t> responses;
+        const size_t num_packets = send_link.get_num_packets();
+        for (size_t i = 0; i < num_packets; i++) {
+            auto response = _handle_request(send_link.pop_send_packet());
+            if (!response) {
+                continue;
+            }
+            const size_t num_copies = duplicate_responses ? 2 : 1;
+            for (size_t j = 0; j < num_copies; j++) {
+                if (reverse_responses) {
+                    responses.push_front(*response);
+                } else {
+                    responses.push_back(*response);
+                }
+            }
+        }
+        num_requests += num_packets;
+        max_requests_at_once = std::max(max_requests_at_once, num_packets);
+        return responses;
+    }
+
+private:
+    std::optional<packet_t> _handle_request(const packet_t& request_pkt)
+    {
+        auto pkt = pkt_factory.make_mgmt();
+        pkt->refresh(request_pkt.first.get());
+        BOOST_REQUIRE(pkt->get_chdr_header().get_pkt_type() == PKT_TYPE_MGMT);
+        mgmt_payload request;
+        request.set_header(MY_EPID, pkt_factory.get_protover(), CHDR_W_64);
+        pkt->fill_payload(request);
+
+        // Every node takes the first hop, and passes the rest on
+        std::vector<mgmt_op_t> resp_ops;
+        node_type location = node_type::XPORT;
+        uint16_t sep_inst  = 0;
+        while (request.get_num_hops() > 0) {
+            const mgmt_hop_t hop = request.pop_hop();
+            std::optional<uint16_t> dest_port;
+            bool do_return = false;
+            for (size_t i = 0; i < hop.get_num_ops(); i++) {
+                const mgmt_op_t& op = hop.get_op(i);
+                switch (op.get_op_code()) {
+                    case mgmt_op_t::MGMT_OP_INFO_REQ:
+                        resp_ops.emplace_back(mgmt_op_t::MGMT_OP_INFO_RESP,
+                            _get_node_info(location, sep_inst));
+                        break;
+                    case mgmt_op_t::MGMT_OP_SEL_DEST:
+                        BOOST_REQUIRE(location == node_type::XBAR);
+                        dest_port = mgmt_op_t::sel_dest_payload(op.get_op_payload()).dest;
+                        break;
+                    case mgmt_op_t::MGMT_OP_RETURN:
+                        do_return = true;
+                        break;
+                    default:
+                        // Route configuration doesn't matter for a single crossbar
+                        break;
+                }
+            }
+            if (do_return) {
+                // What's left is the hop the host added for the response
+                BOOST_REQUIRE_EQUAL(request.get_num_hops(), 1);
+                return _make_response(request.pop_hop(), resp_ops);
+            }
+            switch (location) {
+                case node_type::XPORT:
+                    location = node_type::XBAR;
+                    break;
+                case node_type::XBAR: {
+                    BOOST_REQUIRE(dest_port);
+                    const auto sep_port = sep_ports.find(*dest_port);
+                    if (sep_port == sep_ports.end()) {
+                        return std::nullopt;
+                    }
+                    location = node_type::STRM_EP;
+                    sep_inst = sep_port->second;
+                } break;
+                default:
+                    return std::nullopt;
+            }
+        }
+        return std::nullopt;
+    }
+
+    mgmt_op_t::node_info_payload _get_node_info(
+        const node_type location, const uint16_t sep_inst) const
+    {
+        switch (location) {
+            case node_type::XBAR:
+                // The instance is the port the request came in on
+                return {DEVICE_ID,
+                    static_cast<uint8_t>(node_type::XBAR),
+                    0,
+                    XBAR_NUM_PORTS | (1 << 8)};
+            case node_type::STRM_EP:
+                return {DEVICE_ID, static_cast<uint8_t>(node_type::STRM_EP), sep_inst, 0};
+            default:
+                return {DEVICE_ID, static_cast<uint8_t>(node_type::XPORT), 0, 0};
+        }
+    }
+
+    packet_t _make_response(const mgmt_hop_t& resp_hop, const std::vector<mgmt_op_t>& ops)
+    {
+        mgmt_hop_t hop;
+        for (size_t i = 0; i < resp_hop.get_num_ops(); i++) {
+            hop.add_op(
+                echo_tags ? resp_hop.get_op(i) : mgmt_op_t(mgmt_op_t::MGMT_OP_NOP));
+        }
+        for (const auto& op : ops) {
+            hop.add_op(op);
+        }
+        mgmt_payload response;
+        response.set_header(0, pkt_factory.get_protover(), CHDR_W_64);
+        response.add_hop(hop);
+
+        chdr_header header;
+        packet_t pkt(boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), 0);
+        pkt_factory.make_mgmt()->refresh(pkt.first.get(), FRAME_SIZE, header, response);
+        pkt.second = header.get_length();
+        // Management payloads always go to EPID 0, the transport adapter
+        // addresses the response to the host
+        header.set_dst_epid(MY_EPID);
+        pkt_factory.make_generic()->refresh(pkt.first.get(), header);
+        return pkt;
+    }
+};
+
+/*! Receive link that returns the responses of a mock_mgmt_device
+ *
+ * The device handles the requests on the send link when there is no
+ * response left to return.
+ */
+class mock_device_recv_link : public recv_link_base<mock_device_recv_link>
+{
+public:
+    using base_t = recv_link_base<mock_device_recv_link>;
+
+    mock_device_recv_link(mock_mgmt_device& device, mock_send_link::sptr send_link)
+        : base_t(NUM_FRAMES, FRAME_SIZE), _device(device), _send_link(send_link)
+    {
+        _buffs.resize(NUM_FRAMES);
+        for (auto& buff : _buffs) {
+            base_t::preload_free_buff(&buff);
+        }
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return NULL_ADAPTER_ID;
+    }
+
+private:
+    friend base_t;
+
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t)
+    {
+        if (_responses.empty()) {
+            _responses = _device.handle_requests(*_send_link);
+        }
+        if (_responses.empty()) {
+            return 0; // timeout
+        }
+        auto* buff_ptr = static_cast<mock_frame_buff*>(&buff);
+        buff_ptr->set_mem(_responses.front().first);
+        buff_ptr->set_packet_size(_responses.front().second);
+        _responses.pop_front();
+        return buff_ptr->packet_size();
+    }
+
+    void release_recv_buff_derived(frame_buff& buff)
+    {
+        static_cast<mock_frame_buff*>(&buff)->set_mem(boost::shared_array<uint8_t>());
+    }
+
+    std::vector<mock_frame_buff> _buffs;
+    mock_mgmt_device& _device;
+    mock_send_link::sptr _send_link;
+    std::deque<mock_mgmt_device::packet_t> _responses;
+};
+
+//! Run a topology discovery on the device, and return the stream endpoints found
+std::set<sep_addr_t> discover(mock_mgmt_device& device, const std::string& cache_key = "")
+{
+    auto send_link = std::make_shared<mock_send_link>(
+        mock_send_link::link_params{FRAME_SIZE, NUM_FRAMES});
+    auto recv_link = std::make_shared<mock_device_recv_link>(device, send_link);
+    auto io_srv    = inline_io_service::make();
+    io_srv->attach_recv_link(recv_link);
+    io_srv->attach_send_link(send_link);
+    auto xport  = chdr_ctrl_xport::make(io_srv,
+        send_link,
+        recv_link,
+        pkt_factory,
+        MY_EPID,
+        NUM_FRAMES / 2,
+        NUM_FRAMES / 2,
+        FRAME_SIZE,
+        []() {});
+    auto portal = mgmt::mgmt_portal::make(*xport,
+        pkt_factory,
+        sep_addr_t(HOST_DEVICE_ID, 0),
+        std::make_shared<topo_graph_t>(),
+        cache_key);
+    return portal->get_reachable_endpoints();
+}
+
+std::set<sep_addr_t> make_sep_addrs(const std::set<uint16_t>& insts)
+{
+    std::set<sep_addr_t> addrs;
+    for (const auto inst : insts) {
+        addrs.insert({DEVICE_ID, inst});
+    }
+    return addrs;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_discovery_out_of_order)
+{
+    mock_mgmt_device device;
+    device.sep_ports           = {{1, 0}, {2, 1}, {3, 2}};
+    device.reverse_responses   = true;
+    device.duplicate_responses = true;
+
+    // Responses are matched by their tags, and the duplicates get dropped
+    BOOST_CHECK(discover(device) == make_sep_addrs({0, 1, 2}));
+    // The crossbar ports were probed in one go
+    BOOST_CHECK_GE(device.max_requests_at_once, 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_discovery_without_tags)
+{
+    mock_mgmt_device device;
+    device.sep_ports = {{1, 0}, {2, 1}, {3, 2}};
+    device.echo_tags = false;
+
+    // Without tags, there's only one request in flight at a time
+    BOOST_CHECK(discover(device) == make_sep_addrs({0, 1, 2}));
+    BOOST_CHECK_EQUAL(device.max_requests_at_once, 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_discovery_timeout)
+{
+    mock_mgmt_device device;
+    // Nothing's connected to port 2, so the probe of that port times out
+    device.sep_ports         = {{1, 0}, {3, 1}};
+    device.reverse_responses = true;
+    BOOST_CHECK(discover(device) == make_sep_addrs({0, 1}));
+
+    // Without a response from the first hop, there's no device
+    auto send_link = std::make_shared<mock_send_link>(
+        mock_send_link::link_params{FRAME_SIZE, NUM_FRAMES});
+    auto recv_link = std::make_shared<mock_recv_link>(
+        mock_recv_link::link_params{FRAME_SIZE, NUM_FRAMES});
+    auto io_srv    = inline_io_service::make();
+    io_srv->attach_recv_link(recv_link);
+    io_srv->attach_send_link(send_link);
+    auto xport = chdr_ctrl_xport::make(io_srv,
+        send_link,
+        recv_link,
+        pkt_factory,
+        MY_EPID,
+        NUM_FRAMES / 2,
+        NUM_FRAMES / 2,
+        FRAME_SIZE,
+        []() {});
+    BOOST_CHECK_THROW(mgmt::mgmt_portal::make(*xport,
+                          pkt_factory,
+                          sep_addr_t(HOST_DEVICE_ID, 0),
+                          std::make_shared<topo_graph_t>()),
+        uhd::io_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_topology_cache)
+{
+    const fs::path cache_home = fs::path(uhd::get_tmp_path()) / "MGMT_PORTAL_TEST";
+    std::error_code ec;
+    fs::remove_all(cache_home, ec);
+    // Non-portable hack to move the cache into a temporary directory
+#ifdef UHD_PLATFORM_WIN32
+    const std::string putenv_str = "XDG_CACHE_HOME=" + cache_home.string();
+    _putenv(putenv_str.c_str());
+#else
+    setenv("XDG_CACHE_HOME", cache_home.string().c_str(), /* overwrite */ 1);
+#endif
+    const std::string cache_key = "mock_device";
+    const fs::path cache_file =
+        cache_home / "uhd" / "topology"
+        / (cache_key + "-" + std::to_string(HOST_DEVICE_ID) + ".txt");
+
+    mock_mgmt_device device;
+    device.sep_ports = {{1, 0}, {2, 1}};
+
+    // The first discovery fills the cache
+    BOOST_CHECK(discover(device, cache_key) == make_sep_addrs({0, 1}));
+    BOOST_REQUIRE(fs::exists(cache_file));
+    const size_t num_uncached_requests = device.num_requests;
+
+    // The second one takes the empty port and the transport adapter's
+    // neighbor from the cache
+    device.num_requests = 0;
+    BOOST_CHECK(discover(device, cache_key) == make_sep_addrs({0, 1}));
+    BOOST_CHECK_EQUAL(device.num_requests, num_uncached_requests - 2);
+
+    // A different endpoint on a validated port makes the cache stale. The
+    // port which the cache has as empty must be probed again.
+    device.sep_ports = {{1, 0}, {2, 5}, {3, 6}};
+    BOOST_CHECK(discover(device, cache_key) == make_sep_addrs({0, 5, 6}));
+    // ...and the cache is up to date again
+    BOOST_CHECK(discover(device, cache_key) == make_sep_addrs({0, 5, 6}));
+
+    // A cache that can't be parsed is ignored, and replaced
+    device.num_requests = 0;
+    discover(device);
+    const size_t num_requests_without_cache = device.num_requests;
+    std::ofstream(cache_file) << "root -1 not/a/node\n";
+    device.num_requests = 0;
+    BOOST_CHECK(discover(device, cache_key) == make_sep_addrs({0, 5, 6}));
+    BOOST_CHECK_EQUAL(device.num_requests, num_requests_without_cache);
+    std::string first_line;
+    std::getline(std::ifstream(cache_file), first_line);
+    BOOST_CHECK_EQUAL(first_line, "# UHD topology cache for mock_device-1");
+
+    fs::remove_all(cache_home, ec);
+}
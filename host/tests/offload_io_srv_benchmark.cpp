@@ -0,0 +1,168 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/utils/semaphore.hpp>
+#include <uhdlib/utils/spsc_queue.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace std::chrono;
+
+constexpr size_t QUEUE_SIZE      = 32;
+constexpr int32_t POP_TIMEOUT_MS = 10;
+
+/*!
+ * Queue that gates every push and pop through a semaphore, as the offload I/O
+ * service used to do. Used as a reference for spsc_queue.
+ */
+template <typename item_t>
+class semaphore_queue
+{
+public:
+    semaphore_queue(const size_t size) : _buffer(size) {}
+
+    void push(const item_t& item)
+    {
+        _buffer[_write_index++] = item;
+        _write_index %= _buffer.size();
+        _item_sem.notify();
+    }
+
+    bool pop(item_t& item, const int32_t timeout_ms)
+    {
+        if (_item_sem.wait_for(timeout_ms)) {
+            item = _buffer[_read_index++];
+            _read_index %= _buffer.size();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    std::vector<item_t> _buffer;
+    size_t _read_index  = 0;
+    size_t _write_index = 0;
+    uhd::semaphore _item_sem;
+};
+
+/*!
+ * Benchmark of the handoff between two threads. The main thread sends an item
+ * to an echo thread, which sends it back through a second queue. Half of the
+ * round trip time is the handoff latency.
+ *
+ * \param name Name of the queue to print
+ * \param gap Time between round trips. Long gaps make the echo thread go to
+ *            sleep between items.
+ * \param run_time Duration of the run
+ */
+template <typename queue_t>
+void benchmark_handoff(
+    const std::string& name, const microseconds gap, const duration<double> run_time)
+{
+    queue_t to_echo(QUEUE_SIZE), from_echo(QUEUE_SIZE);
+    std::atomic<bool> running{true};
+
+    std::thread echo_thread([&]() {
+        size_t item;
+        while (running) {
+            if (to_echo.pop(item, POP_TIMEOUT_MS)) {
+                from_echo.push(item);
+            }
+        }
+    });
+
+    std::vector<double> latencies;
+    const auto end_time = steady_clock::now() + run_time;
+    for (size_t i = 0; steady_clock::now() < end_time; i++) {
+        size_t item;
+        const auto start = steady_clock::now();
+        to_echo.push(i);
+        if (!from_echo.pop(item, POP_TIMEOUT_MS)) {
+            std::cout << "Timeout waiting for echo" << std::endl;
+            break;
+        }
+        const duration<double, std::micro> round_trip(steady_clock::now() - start);
+        latencies.push_back(round_trip.count() / 2);
+
+        const auto next = steady_clock::now() + gap;
+        while (steady_clock::now() < next) {
+            std::this_thread::yield();
+        }
+    }
+
+    running = false;
+    echo_thread.join();
+
+    if (latencies.empty()) {
+        return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](const double p) {
+        return latencies[std::min(
+            size_t(p / 100 * latencies.size()), latencies.size() - 1)];
+    };
+    std::cout << boost::format("%-16s gap %5d us: p50 %7.2f  p90 %7.2f  p99 %8.2f  "
+                               "p99.9 %8.2f  max %9.2f us (%d samples)")
+                     % name % gap.count() % percentile(50) % percentile(90)
+                     % percentile(99) % percentile(99.9) % latencies.back()
+                     % latencies.size()
+              << std::endl;
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    double run_time;
+    std::vector<size_t> gaps;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("duration", po::value<double>(&run_time)->default_value(1.0), "duration of each run in seconds")
+        ("gap-us", po::value<std::vector<size_t>>(&gaps)->multitoken()->default_value({0, 50, 1000}, "0 50 1000"), "time between handoffs in microseconds")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Offload I/O Service Benchmark %s") % desc
+                  << std::endl;
+        std::cout << "    Benchmark of the queues that hand off frame buffers\n"
+                     "    between the offload thread and its clients. No\n"
+                     "    hardware is needed to run this benchmark.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of the handoff between two threads              \n";
+    std::cout << "                                                          \n";
+    std::cout << "   Measures one-way latency percentiles.                  \n";
+    std::cout << "----------------------------------------------------------\n";
+    for (const size_t gap : gaps) {
+        benchmark_handoff<uhd::spsc_queue<size_t>>(
+            "spsc_queue", microseconds(gap), duration<double>(run_time));
+        benchmark_handoff<semaphore_queue<size_t>>(
+            "semaphore_queue", microseconds(gap), duration<double>(run_time));
+    }
+    std::cout << "\n";
+
+    return EXIT_SUCCESS;
+}
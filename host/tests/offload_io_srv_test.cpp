@@ -5,10 +5,17 @@
 //
 
 #include "common/mock_link.hpp"
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/log_add_impl.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <boost/test/unit_test.hpp>
 #include <atomic>
+#include <chrono>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace uhd::transport;
 
@@ -351,3 +358,160 @@ BOOST_AUTO_TEST_CASE(test_attach_detach)
     mock_io_srv->allocate_recv_frames(2, 1);
     recv_client2->release_recv_buff(recv_client2->get_recv_buff(100));
 }
+
+BOOST_AUTO_TEST_CASE(test_multi_thread_send_recv)
+{
+    params_t params;
+    params.num_threads = 3;
+    auto mock_io_srv   = std::make_shared<mock_io_service>();
+    auto io_srv        = std::dynamic_pointer_cast<offload_io_service>(
+        offload_io_service::make(mock_io_srv, params));
+    BOOST_CHECK_EQUAL(io_srv->get_thread_stats().size(), 3);
+
+    std::vector<recv_link_if::sptr> recv_links;
+    std::vector<send_link_if::sptr> send_links;
+    std::vector<recv_io_if::sptr> recv_clients;
+    std::vector<send_io_if::sptr> send_clients;
+    for (size_t i = 0; i < 4; i++) {
+        auto recv_link = make_recv_link(5);
+        auto send_link = make_send_link(5);
+        io_srv->attach_recv_link(recv_link);
+        io_srv->attach_send_link(send_link);
+        for (size_t j = 0; j < 10; j++) {
+            recv_link->push_back_recv_packet(
+                boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+        }
+        recv_links.push_back(recv_link);
+        send_links.push_back(send_link);
+        recv_clients.push_back(
+            io_srv->make_recv_client(recv_link, 1, nullptr, nullptr, 0, nullptr));
+        send_clients.push_back(io_srv->make_send_client(
+            send_link, 1, nullptr, nullptr, 0, nullptr, nullptr));
+    }
+
+    // Clients that don't share links are spread across all threads
+    size_t num_groups = 0;
+    for (const auto& stats : io_srv->get_thread_stats()) {
+        BOOST_CHECK(stats.num_client_groups > 0);
+        num_groups += stats.num_client_groups;
+    }
+    BOOST_CHECK_EQUAL(num_groups, 8);
+
+    for (size_t i = 0; i < 10; i++) {
+        for (size_t client = 0; client < 4; client++) {
+            mock_io_srv->allocate_recv_frames(client, 1);
+            auto buff = recv_clients[client]->get_recv_buff(100);
+            BOOST_REQUIRE(buff != nullptr);
+            recv_clients[client]->release_recv_buff(std::move(buff));
+            send_clients[client]->release_send_buff(
+                send_clients[client]->get_send_buff(100));
+        }
+    }
+
+    // A disconnected client must not affect the others
+    recv_clients[0].reset();
+    send_clients[0].reset();
+    io_srv->detach_recv_link(recv_links[0]);
+    io_srv->detach_send_link(send_links[0]);
+    auto send_buff = send_clients[1]->get_send_buff(100);
+    BOOST_CHECK(send_buff != nullptr);
+    send_clients[1]->release_send_buff(std::move(send_buff));
+
+    recv_clients.clear();
+    send_clients.clear();
+}
+
+BOOST_AUTO_TEST_CASE(test_multi_thread_rebalance)
+{
+    params_t params;
+    params.client_type        = SEND_ONLY;
+    params.num_threads        = 2;
+    params.rebalance_interval = std::chrono::milliseconds(10);
+    auto mock_io_srv          = std::make_shared<mock_io_service>();
+    auto io_srv               = std::dynamic_pointer_cast<offload_io_service>(
+        offload_io_service::make(mock_io_srv, params));
+
+    // New groups go to the thread with the fewest groups, so clients 0 and 2
+    // are serviced by thread 0, and client 1 by thread 1
+    std::vector<send_io_if::sptr> clients;
+    for (size_t i = 0; i < 3; i++) {
+        const mock_send_link::link_params link_params = {FRAME_SIZE, 5};
+        auto link = std::make_shared<mock_send_link>(link_params, true);
+        io_srv->attach_send_link(link);
+        clients.push_back(
+            io_srv->make_send_client(link, 1, nullptr, nullptr, 0, nullptr, nullptr));
+    }
+    auto stats = io_srv->get_thread_stats();
+    BOOST_CHECK_EQUAL(stats[0].num_client_groups, 2);
+    BOOST_CHECK_EQUAL(stats[1].num_client_groups, 1);
+
+    // Keep clients 0 and 2 busy until one of them is moved to thread 1
+    const auto end_time = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (stats[1].num_migrations == 0 && std::chrono::steady_clock::now() < end_time) {
+        for (size_t i = 0; i < 100; i++) {
+            clients[0]->release_send_buff(clients[0]->get_send_buff(100));
+            clients[2]->release_send_buff(clients[2]->get_send_buff(100));
+        }
+        stats = io_srv->get_thread_stats();
+    }
+    BOOST_CHECK_EQUAL(stats[1].num_migrations, 1);
+    BOOST_CHECK_EQUAL(stats[0].num_client_groups, 1);
+    BOOST_CHECK_EQUAL(stats[1].num_client_groups, 2);
+
+    const uint64_t num_buffs = stats[1].num_buffs;
+    for (size_t i = 0; i < 100; i++) {
+        clients[0]->release_send_buff(clients[0]->get_send_buff(100));
+        clients[2]->release_send_buff(clients[2]->get_send_buff(100));
+    }
+    stats = io_srv->get_thread_stats();
+    BOOST_CHECK(stats[0].num_buffs > 0);
+    BOOST_CHECK(stats[1].num_buffs > num_buffs);
+    BOOST_CHECK(stats[0].busy_time <= stats[0].total_time);
+
+    clients.clear();
+}
+
+BOOST_AUTO_TEST_CASE(test_multi_thread_stats_log)
+{
+    struct log_capture_t
+    {
+        std::mutex mutex;
+        std::vector<std::string> messages;
+    };
+    auto capture = std::make_shared<log_capture_t>();
+    uhd::log::set_log_level(uhd::log::debug);
+    uhd::log::add_logger(
+        "offload_io_srv_test", [capture](const uhd::log::detail::logging_info& info) {
+            if (info.component == "OFFLOAD_IO") {
+                std::lock_guard<std::mutex> lock(capture->mutex);
+                capture->messages.push_back(info.message);
+            }
+        });
+    uhd::log::set_logger_level("offload_io_srv_test", uhd::log::debug);
+
+    params_t params;
+    params.client_type        = SEND_ONLY;
+    params.num_threads        = 2;
+    params.rebalance_interval = std::chrono::milliseconds(10);
+    params.stats_log_interval = std::chrono::milliseconds(20);
+    auto mock_io_srv          = std::make_shared<mock_io_service>();
+    auto io_srv               = offload_io_service::make(mock_io_srv, params);
+
+    // The utilization of every thread is logged periodically
+    std::string stats_msg;
+    const auto end_time = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (stats_msg.empty() && std::chrono::steady_clock::now() < end_time) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::lock_guard<std::mutex> lock(capture->mutex);
+        for (const auto& msg : capture->messages) {
+            if (msg.find("utilization") != std::string::npos) {
+                stats_msg = msg;
+            }
+        }
+    }
+    io_srv.reset();
+    uhd::log::set_logger_level("offload_io_srv_test", uhd::log::off);
+
+    BOOST_CHECK_NE(stats_msg.find("[0] "), std::string::npos);
+    BOOST_CHECK_NE(stats_msg.find("[1] "), std::string::npos);
+}
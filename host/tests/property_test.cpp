@@ -12,6 +12,8 @@
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <string>
+#include <vector>
 
 
 struct coercer_type
@@ -229,6 +231,48 @@ BOOST_AUTO_TEST_CASE(test_prop_tree)
     BOOST_CHECK(not tree->exists("/test/prop1"));
 }
 
+BOOST_AUTO_TEST_CASE(test_prop_tree_list_order)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    tree->create<int>("/test/b");
+    tree->create<int>("/test/c");
+    tree->create<int>("/test/a");
+    tree->remove("/test/c");
+    tree->create<int>("/test/c");
+
+    // Children are listed in the order they were created
+    const std::vector<std::string> expected{"b", "a", "c"};
+    const std::vector<std::string> dirs = tree->list("/test");
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        dirs.begin(), dirs.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_prop_tree_handle)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    tree->create<int>("/test/prop0").set(42);
+
+    uhd::property_handle<int> empty_handle;
+    BOOST_CHECK(!empty_handle);
+
+    auto handle = tree->subtree("/test")->get_handle<int>("prop0");
+    BOOST_REQUIRE(handle);
+    BOOST_CHECK_EQUAL(handle.get_path(), "prop0");
+    BOOST_CHECK_EQUAL(handle->get(), 42);
+    handle->set(23);
+    BOOST_CHECK_EQUAL(tree->access<int>("/test/prop0").get(), 23);
+    BOOST_CHECK_EQUAL(&(*handle), &tree->access<int>("/test/prop0"));
+
+    BOOST_CHECK_THROW(tree->get_handle<std::string>("/test/prop0"), uhd::type_error);
+    BOOST_CHECK_THROW(tree->get_handle<int>("/test/prop1"), uhd::lookup_error);
+    BOOST_CHECK_THROW(tree->get_handle<int>("/test"), uhd::runtime_error);
+
+    // The handle keeps the property alive when it's removed from the tree
+    tree->remove("/test");
+    BOOST_CHECK(not tree->exists("/test/prop0"));
+    BOOST_CHECK_EQUAL(handle->get(), 23);
+}
+
 BOOST_AUTO_TEST_CASE(test_prop_tree_wrong_type)
 {
     uhd::property_tree::sptr tree = uhd::property_tree::make();
@@ -0,0 +1,136 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/property_tree.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace std::chrono;
+
+constexpr size_t NUM_MBOARDS = 2;
+constexpr size_t NUM_CHANS   = 4;
+
+//! Path of the gain property of a channel, at the depth multi_usrp uses
+uhd::fs_path gain_path(const size_t chan)
+{
+    return uhd::fs_path("/mboards") / (chan % NUM_MBOARDS) / "dboards/A/rx_frontends"
+           / (chan / NUM_MBOARDS) / "gains/PGA0/value";
+}
+
+/*!
+ * Benchmark of concurrent property accesses. Every thread alternates between
+ * setting and getting the gain of its own channel, like an AGC loop would.
+ *
+ * \param tree The property tree
+ * \param num_threads Number of threads accessing properties at the same time
+ * \param use_handles Access properties through handles instead of their paths
+ * \param run_time Duration of the run
+ */
+void benchmark_access(uhd::property_tree::sptr tree,
+    const size_t num_threads,
+    const bool use_handles,
+    const duration<double> run_time)
+{
+    std::atomic<bool> running{false};
+    std::atomic<bool> stop{false};
+    std::vector<size_t> num_accesses(num_threads, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < num_threads; i++) {
+        threads.emplace_back([&, i]() {
+            const uhd::fs_path path = gain_path(i % (NUM_MBOARDS * NUM_CHANS));
+            auto handle             = tree->get_handle<double>(path);
+            size_t count            = 0;
+            while (!running) {
+                std::this_thread::yield();
+            }
+            for (; !stop; count += 2) {
+                if (use_handles) {
+                    handle->set(double(count % 64));
+                    handle->get();
+                } else {
+                    tree->access<double>(path).set(double(count % 64));
+                    tree->access<double>(path).get();
+                }
+            }
+            num_accesses[i] = count;
+        });
+    }
+
+    const auto start = steady_clock::now();
+    running          = true;
+    std::this_thread::sleep_for(run_time);
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const duration<double> elapsed = steady_clock::now() - start;
+
+    size_t total = 0;
+    for (const size_t count : num_accesses) {
+        total += count;
+    }
+    std::cout << boost::format("%-8s %2d threads: %8.3f M accesses/s "
+                               "(%7.3f M per thread)")
+                     % (use_handles ? "handle" : "path") % num_threads
+                     % (total / elapsed.count() / 1e6)
+                     % (total / elapsed.count() / 1e6 / num_threads)
+              << std::endl;
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    double run_time;
+    std::vector<size_t> thread_counts;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("duration", po::value<double>(&run_time)->default_value(1.0), "duration of each run in seconds")
+        ("threads", po::value<std::vector<size_t>>(&thread_counts)->multitoken()->default_value({1, 2, 4, 8}, "1 2 4 8"), "number of threads accessing properties")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Property Tree Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of concurrent property get/set throughput.\n"
+                     "    No hardware is needed to run this benchmark.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Populate the tree like a device with a few channels would
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    for (size_t chan = 0; chan < NUM_MBOARDS * NUM_CHANS; chan++) {
+        const uhd::fs_path gains_path = gain_path(chan).branch_path().branch_path();
+        for (const char* name : {"PGA0", "ATT0", "DSA"}) {
+            tree->create<double>(gains_path / name / "value").set(0.0);
+        }
+        for (const char* name : {"freq/value", "bandwidth/value"}) {
+            tree->create<double>(gains_path.branch_path() / name).set(0.0);
+        }
+    }
+
+    for (const size_t num_threads : thread_counts) {
+        benchmark_access(tree, num_threads, false, duration<double>(run_time));
+        benchmark_access(tree, num_threads, true, duration<double>(run_time));
+    }
+
+    return EXIT_SUCCESS;
+}
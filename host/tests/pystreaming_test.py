@@ -0,0 +1,177 @@
+#
+# Copyright 2026 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+"""
+Unit test for the bulk streaming calls and the RX ring of the Python API
+"""
+
+import unittest
+import numpy as np
+import uhd
+from mock_streamer import MockRXStreamer, MockTXStreamer, TICK_RATE
+
+
+def _ramp(first, num_samps, chan=0):
+    """The samples the mock RX streamer receives on a channel"""
+    return np.arange(first, first + num_samps, dtype=np.float32) + 1j * chan
+
+
+class RecvBulkTest(unittest.TestCase):
+    """Test RXStreamer.recv_bulk()"""
+
+    def test_fill_array(self):
+        """recv_bulk() fills the whole array over many recv() calls"""
+        rx_streamer = MockRXStreamer(num_chans=2, max_num_samps=100)
+        samps = np.zeros((2, 1050), dtype=np.complex64)
+        metadata = uhd.types.RXMetadata()
+        self.assertEqual(rx_streamer.recv_bulk(samps, metadata), 1050)
+        self.assertEqual(metadata.error_code, uhd.types.RXMetadataErrorCode.none)
+        self.assertFalse(metadata.end_of_burst)
+        np.testing.assert_array_equal(samps[0], _ramp(0, 1050, 0))
+        np.testing.assert_array_equal(samps[1], _ramp(0, 1050, 1))
+        # The metadata has the time of the first sample
+        self.assertEqual(metadata.time_spec.to_ticks(TICK_RATE), 0)
+        self.assertEqual(rx_streamer.recv_bulk(samps, metadata), 1050)
+        np.testing.assert_array_equal(samps[1], _ramp(1050, 1050, 1))
+        self.assertEqual(metadata.time_spec.to_ticks(TICK_RATE), 1050)
+
+    def test_end_of_burst(self):
+        """recv_bulk() returns early at the end of a burst"""
+        rx_streamer = MockRXStreamer(max_num_samps=100, burst_len=250)
+        samps = np.zeros(1000, dtype=np.complex64)
+        metadata = uhd.types.RXMetadata()
+        self.assertEqual(rx_streamer.recv_bulk(samps, metadata), 250)
+        self.assertTrue(metadata.end_of_burst)
+        self.assertFalse(metadata.more_fragments)
+        np.testing.assert_array_equal(samps[:250], _ramp(0, 250))
+        # After the burst, the error is reported in the metadata
+        self.assertEqual(rx_streamer.recv_bulk(samps, metadata), 0)
+        self.assertEqual(metadata.error_code, uhd.types.RXMetadataErrorCode.timeout)
+
+    def test_bad_arrays(self):
+        """recv_bulk() checks the array like recv()"""
+        rx_streamer = MockRXStreamer(num_chans=2)
+        metadata = uhd.types.RXMetadata()
+        with self.assertRaises(RuntimeError):
+            rx_streamer.recv_bulk(np.zeros(100, dtype=np.complex64), metadata)
+        samps = np.zeros((2, 100), dtype=np.complex64)
+        samps.flags.writeable = False
+        with self.assertRaises(RuntimeError):
+            rx_streamer.recv_bulk(samps, metadata)
+
+
+class SendBulkTest(unittest.TestCase):
+    """Test TXStreamer.send_bulk()"""
+
+    def test_send_array(self):
+        """send_bulk() sends the array once by default"""
+        tx_streamer = MockTXStreamer(num_chans=2, max_num_samps=1000)
+        samps = np.array([_ramp(0, 300, 0), _ramp(0, 300, 1)], dtype=np.complex64)
+        metadata = uhd.types.TXMetadata()
+        self.assertEqual(tx_streamer.send_bulk(samps, metadata), 300)
+        np.testing.assert_array_equal(tx_streamer.get_samples(), samps)
+
+    def test_repeat_burst(self):
+        """send_bulk() repeats the array, and applies the flags to the burst"""
+        tx_streamer = MockTXStreamer(max_num_samps=1000)
+        samps = _ramp(0, 100).astype(np.complex64)
+        metadata = uhd.types.TXMetadata()
+        metadata.start_of_burst = True
+        metadata.end_of_burst = True
+        metadata.has_time_spec = True
+        metadata.time_spec = uhd.types.TimeSpec(1.5)
+        self.assertEqual(tx_streamer.send_bulk(samps, metadata, 250), 250)
+        np.testing.assert_array_equal(
+            tx_streamer.get_samples()[0], np.concatenate((samps, samps, samps[:50])))
+        self.assertEqual(
+            tx_streamer.get_calls(),
+            [(100, True, False, 1.5), (100, False, False, None), (50, False, True, None)])
+
+    def test_timeout(self):
+        """send_bulk() stops at the first send() call which times out"""
+        tx_streamer = MockTXStreamer(max_num_samps=60)
+        samps = np.zeros(100, dtype=np.complex64)
+        metadata = uhd.types.TXMetadata()
+        self.assertEqual(tx_streamer.send_bulk(samps, metadata, 300), 60)
+        self.assertEqual(len(tx_streamer.get_calls()), 1)
+
+    def test_empty_array(self):
+        """send_bulk() can't repeat an empty array"""
+        tx_streamer = MockTXStreamer()
+        metadata = uhd.types.TXMetadata()
+        with self.assertRaises(RuntimeError):
+            tx_streamer.send_bulk(np.zeros(0, dtype=np.complex64), metadata, 100)
+
+
+class RXRingTest(unittest.TestCase):
+    """Test uhd.usrp.RXRing"""
+
+    def test_blocks_in_order(self):
+        """The ring hands out consecutive blocks"""
+        rx_streamer = MockRXStreamer(num_chans=2, max_num_samps=64)
+        ring = uhd.usrp.RXRing(rx_streamer, np.complex64, 1000, 4)
+        ring.start()
+        for i in range(20):
+            block = ring.get(1.0)
+            self.assertIsNotNone(block)
+            samps, metadata = block
+            self.assertEqual(samps.shape, (2, 1000))
+            np.testing.assert_array_equal(samps[0], _ramp(i * 1000, 1000, 0))
+            np.testing.assert_array_equal(samps[1], _ramp(i * 1000, 1000, 1))
+            self.assertEqual(metadata.time_spec.to_ticks(TICK_RATE), i * 1000)
+            del samps, block
+        ring.stop()
+
+    def test_kept_blocks_are_not_refilled(self):
+        """A block is only refilled once its array is deleted"""
+        rx_streamer = MockRXStreamer(max_num_samps=64)
+        ring = uhd.usrp.RXRing(rx_streamer, np.complex64, 100, 4)
+        ring.start()
+        kept = [ring.get(1.0)[0] for _ in range(2)]
+        # Cycle the other two blocks through the ring a few times
+        for i in range(2, 10):
+            samps, _ = ring.get(1.0)
+            np.testing.assert_array_equal(samps[0], _ramp(i * 100, 100))
+            del samps
+        # A view keeps the block leased as well
+        view = kept[0][0, 10:20]
+        del kept
+        kept = [ring.get(1.0)[0] for _ in range(3)]
+        np.testing.assert_array_equal(view, _ramp(10, 10))
+        # All blocks are in use, so the ring can't receive anything else
+        self.assertIsNone(ring.get(0.1))
+        del view
+        samps, _ = ring.get(1.0)
+        np.testing.assert_array_equal(samps[0], _ramp(1300, 100))
+        ring.stop()
+
+    def test_ring_deleted_first(self):
+        """Arrays stay valid after the ring is deleted"""
+        rx_streamer = MockRXStreamer(max_num_samps=64)
+        ring = uhd.usrp.RXRing(rx_streamer, np.complex64, 100, 2)
+        ring.start()
+        samps, _ = ring.get(1.0)
+        ring.stop()
+        del ring
+        np.testing.assert_array_equal(samps[0], _ramp(0, 100))
+
+    def test_end_of_burst(self):
+        """A block ends at the end of a burst, and empty blocks are skipped"""
+        rx_streamer = MockRXStreamer(max_num_samps=64, burst_len=150)
+        ring = uhd.usrp.RXRing(rx_streamer, np.complex64, 100, 4, 0.01)
+        ring.start()
+        samps, metadata = ring.get(1.0)
+        self.assertEqual(samps.shape, (1, 100))
+        self.assertFalse(metadata.end_of_burst)
+        samps, metadata = ring.get(1.0)
+        self.assertEqual(samps.shape, (1, 50))
+        self.assertTrue(metadata.end_of_burst)
+        np.testing.assert_array_equal(samps[0], _ramp(100, 50))
+        self.assertIsNone(ring.get(0.1))
+        ring.stop()
+
+
+if __name__ == '__main__':
+    unittest.main()
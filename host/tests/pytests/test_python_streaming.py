@@ -0,0 +1,158 @@
+#
+# Copyright 2026 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+"""Throughput tests for the bulk streaming calls of the Python API."""
+
+import time
+
+import numpy as np
+import pytest
+import uhd
+
+# Rates at which Python applications are expected to stream without overflows
+# or underflows using the bulk calls. Only one channel, since the Python API is
+# mostly used for single channel captures.
+DUT_RATES = {
+    "n310": (122.88e6, "master_clock_rate=122.88e6"),
+    "n320": (200e6, "master_clock_rate=200e6"),
+    "b206": (30.72e6, "master_clock_rate=30.72e6"),
+    "b210": (30.72e6, "master_clock_rate=30.72e6"),
+    "b310": (61.44e6, "master_clock_rate=61.44e6"),
+    "e320": (61.44e6, "master_clock_rate=61.44e6"),
+    "x310": (200e6, ""),
+    "x310_twinrx": (100e6, ""),
+    "x410": (245.76e6, ""),
+    "x440": (250e6, "master_clock_rate=250e6,skip_mpm_reboot=1"),
+}
+
+# Duration of the continuous tests in seconds
+DURATION = 10.0
+# Duration of the recv_bulk() test in seconds, limited by the size of the array
+BULK_DURATION = 1.0
+
+
+def pytest_generate_tests(metafunc):
+    """Generate parameterized pytest test cases."""
+    dut_type = metafunc.config.getoption("dut_type").lower()
+    metafunc.parametrize("dut_type", [dut_type])
+    rate, args = DUT_RATES[dut_type]
+    metafunc.parametrize("rate,mb_args", [pytest.param(rate, args, id=f"1xRX@{rate:g}")])
+
+
+@pytest.fixture
+def usrp(pytestconfig, dut_type, rate, mb_args):
+    """Create a MultiUSRP for the DUT, configured for the test rate."""
+    device_args = mb_args
+    if dut_type in ["b206", "b210"]:
+        device_args += f",type=b200,name={pytestconfig.getoption('name')}"
+    elif dut_type == "b310":
+        device_args += f",type=b3xx,resource={pytestconfig.getoption('resource')}"
+    else:
+        device_args += f",addr={pytestconfig.getoption('addr')}"
+    num_recv_frames = pytestconfig.getoption("num_recv_frames")
+    if num_recv_frames:
+        device_args += f",num_recv_frames={num_recv_frames}"
+    usrp = uhd.usrp.MultiUSRP(device_args.strip(","))
+    usrp.set_rx_rate(rate, 0)
+    usrp.set_tx_rate(rate, 0)
+    return usrp
+
+
+def _get_rx_streamer(usrp):
+    st_args = uhd.usrp.StreamArgs("fc32", "sc16")
+    st_args.channels = [0]
+    return usrp.get_rx_stream(st_args)
+
+
+def _stream_cmd(mode):
+    stream_cmd = uhd.types.StreamCMD(mode)
+    stream_cmd.stream_now = True
+    return stream_cmd
+
+
+def _stop_stream(rx_streamer):
+    rx_streamer.issue_stream_cmd(_stream_cmd(uhd.types.StreamMode.stop_cont))
+    flush_buffer = np.empty((1, rx_streamer.get_max_num_samps()), dtype=np.complex64)
+    metadata = uhd.types.RXMetadata()
+    while rx_streamer.recv(flush_buffer, metadata, 0.5):
+        pass
+
+
+def test_recv_bulk(usrp, rate):
+    """Receive BULK_DURATION seconds of samples in a single recv_bulk() call."""
+    rx_streamer = _get_rx_streamer(usrp)
+    num_samps = int(rate * BULK_DURATION)
+    samps = np.empty((1, num_samps), dtype=np.complex64)
+    metadata = uhd.types.RXMetadata()
+
+    rx_streamer.issue_stream_cmd(_stream_cmd(uhd.types.StreamMode.start_cont))
+    start = time.monotonic()
+    num_rx_samps = rx_streamer.recv_bulk(samps, metadata, 1.0)
+    elapsed = time.monotonic() - start
+    _stop_stream(rx_streamer)
+
+    print(f"Received {num_rx_samps} samples at {num_rx_samps / elapsed / 1e6:.2f} Msps")
+    assert metadata.error_code == uhd.types.RXMetadataErrorCode.none, metadata.strerror()
+    assert num_rx_samps == num_samps
+
+
+def test_rx_ring(usrp, rate):
+    """Receive continuously through an RXRing for DURATION seconds."""
+    rx_streamer = _get_rx_streamer(usrp)
+    ring = uhd.usrp.RXRing(rx_streamer, np.complex64, int(rate / 100), 32)
+    ring.start()
+    rx_streamer.issue_stream_cmd(_stream_cmd(uhd.types.StreamMode.start_cont))
+
+    num_rx_samps = 0
+    errors = []
+    start = time.monotonic()
+    while time.monotonic() - start < DURATION:
+        block = ring.get(1.0)
+        assert block is not None, "Timeout while waiting for samples"
+        samps, metadata = block
+        # Touch the samples, like an application would
+        np.abs(samps[0, ::1000])
+        num_rx_samps += samps.shape[1]
+        if metadata.error_code != uhd.types.RXMetadataErrorCode.none:
+            errors.append(metadata.strerror())
+    elapsed = time.monotonic() - start
+
+    ring.stop()
+    _stop_stream(rx_streamer)
+    print(f"Received {num_rx_samps} samples at {num_rx_samps / elapsed / 1e6:.2f} Msps")
+    assert not errors, errors
+    assert num_rx_samps >= 0.95 * rate * elapsed
+
+
+def test_send_bulk(usrp, rate):
+    """Transmit DURATION seconds of samples from a repeated array."""
+    st_args = uhd.usrp.StreamArgs("fc32", "sc16")
+    st_args.channels = [0]
+    tx_streamer = usrp.get_tx_stream(st_args)
+    waveform = (0.5 * np.exp(2j * np.pi * np.arange(10000) / 100)).astype(np.complex64)
+    num_samps = int(rate * DURATION)
+
+    metadata = uhd.types.TXMetadata()
+    metadata.start_of_burst = True
+    metadata.end_of_burst = True
+    start = time.monotonic()
+    num_tx_samps = tx_streamer.send_bulk(waveform.reshape(1, -1), metadata, num_samps, 1.0)
+    elapsed = time.monotonic() - start
+    print(f"Sent {num_tx_samps} samples at {num_tx_samps / elapsed / 1e6:.2f} Msps")
+    assert num_tx_samps == num_samps
+
+    underflows = 0
+    while True:
+        async_md = tx_streamer.recv_async_msg(1.0)
+        if async_md is None:
+            break
+        if async_md.event_code in (
+            uhd.types.TXMetadataEventCode.underflow,
+            uhd.types.TXMetadataEventCode.underflow_in_packet,
+        ):
+            underflows += 1
+        if async_md.event_code == uhd.types.TXMetadataEventCode.burst_ack:
+            break
+    assert underflows == 0
@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/rfnoc/detail/graph.hpp>
+#include <uhd/rfnoc/mock_nodes.hpp>
+#include <uhd/rfnoc/node_accessor.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd::rfnoc;
+using namespace uhd::rfnoc::test;
+using namespace std::chrono;
+
+/*! Benchmark of property propagation in large graphs
+ *
+ * Builds a graph of independent radio -> DDC -> radio chains, which is what
+ * the graph of several devices with many channels looks like, and measures
+ * how long it takes to commit the graph and to propagate a property change
+ * within a single chain.
+ */
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    size_t num_chains, num_iterations;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("chains", po::value<size_t>(&num_chains)->default_value(50), "number of radio -> DDC -> radio chains in the graph")
+        ("iterations", po::value<size_t>(&num_iterations)->default_value(1000), "number of property changes to time")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD RFNoC Graph Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of property propagation in graphs of mock\n"
+                     "    blocks. No hardware is needed to run this benchmark.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // The mock nodes log every resolver call, and the mock radio complains
+    // about its default values during init
+    uhd::log::set_console_level(uhd::log::error);
+
+    node_accessor_t node_accessor{};
+    detail::graph_t graph{};
+    std::vector<std::unique_ptr<mock_radio_node_t>> radios;
+    std::vector<std::unique_ptr<mock_ddc_node_t>> ddcs;
+
+    detail::graph_t::graph_edge_t edge_info;
+    edge_info.src_port        = 0;
+    edge_info.dst_port        = 0;
+    edge_info.is_forward_edge = true;
+    edge_info.edge            = detail::graph_t::graph_edge_t::DYNAMIC;
+
+    for (size_t i = 0; i < num_chains; i++) {
+        radios.push_back(std::make_unique<mock_radio_node_t>(2 * i));
+        auto* rx_radio = radios.back().get();
+        radios.push_back(std::make_unique<mock_radio_node_t>(2 * i + 1));
+        auto* tx_radio = radios.back().get();
+        ddcs.push_back(std::make_unique<mock_ddc_node_t>());
+        auto* ddc = ddcs.back().get();
+
+        node_accessor.init_props(rx_radio);
+        node_accessor.init_props(ddc);
+        node_accessor.init_props(tx_radio);
+        graph.connect(rx_radio, ddc, edge_info);
+        graph.connect(ddc, tx_radio, edge_info);
+    }
+
+    const auto commit_start = steady_clock::now();
+    graph.commit();
+    const duration<double, std::milli> commit_time = steady_clock::now() - commit_start;
+
+    // Alternate the rate of the last TX radio, so every call changes the graph
+    auto& tx_radio   = *radios.back();
+    const auto start = steady_clock::now();
+    for (size_t i = 0; i < num_iterations; i++) {
+        tx_radio.set_property<double>("master_clock_rate", (i % 2) ? 100e6 : 200e6, 0);
+    }
+    const duration<double, std::micro> set_time = steady_clock::now() - start;
+
+    std::cout << boost::format("Graph with %d nodes:") % (3 * num_chains) << std::endl;
+    std::cout << boost::format("    commit():       %10.3f ms") % commit_time.count()
+              << std::endl;
+    std::cout << boost::format("    set_property(): %10.3f us")
+                     % (set_time.count() / num_iterations)
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -8,6 +8,7 @@
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <boost/test/unit_test.hpp>
 #include <chrono>
+#include <cmath>
 #include <complex>
 #include <iostream>
 #include <memory>
@@ -186,9 +187,11 @@ static std::vector<mock_recv_link::sptr> make_links(const size_t num)
 static std::shared_ptr<mock_rx_streamer> make_rx_streamer(
     std::vector<mock_recv_link::sptr> recv_links,
     const std::string& host_format,
-    const std::string& otw_format = "sc16")
+    const std::string& otw_format  = "sc16",
+    const uhd::device_addr_t& args = uhd::device_addr_t())
 {
-    const uhd::stream_args_t stream_args(host_format, otw_format);
+    uhd::stream_args_t stream_args(host_format, otw_format);
+    stream_args.args = args;
     auto streamer = std::make_shared<mock_rx_streamer>(recv_links.size(), stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
@@ -448,6 +451,9 @@ BOOST_AUTO_TEST_CASE(test_recv_one_channel_packet_fragment)
             const size_t ticks_per_sample = static_cast<size_t>(TICK_RATE / SAMP_RATE);
             const size_t expected_ticks   = ticks_per_sample * total_samps_read;
             BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), expected_ticks);
+            BOOST_CHECK_EQUAL(metadata.tick_time.get_ticks(), int64_t(expected_ticks));
+            BOOST_CHECK(metadata.tick_time.get_rate()
+                        == uhd::tick_time_t::rate_t::from_double(TICK_RATE));
 
             for (size_t samp = 0; samp < num_samps; samp++) {
                 const size_t pkt_idx = samp + total_samps_read;
@@ -461,6 +467,83 @@ BOOST_AUTO_TEST_CASE(test_recv_one_channel_packet_fragment)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_tick_time)
+{
+    // Test that the tick time of packets and fragments is exact, even for
+    // timestamps which a double can't hold anymore
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t spp              = streamer->get_max_num_samps();
+    const size_t reads_per_packet = 4;
+    const size_t num_samps        = spp / reads_per_packet;
+    const uint64_t tsf            = (uint64_t(1) << 53) + 1;
+    mock_header_t header;
+    header.has_tsf = true;
+    header.tsf     = tsf;
+    push_back_recv_packet(recv_links[0], header, num_samps * reads_per_packet);
+
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+    const size_t ticks_per_sample = static_cast<size_t>(TICK_RATE / SAMP_RATE);
+    for (size_t j = 0; j < reads_per_packet; j++) {
+        const size_t num_samps_ret =
+            streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+        BOOST_CHECK_EQUAL(metadata.tick_time.get_ticks(),
+            int64_t(tsf + j * num_samps * ticks_per_sample));
+        // time_spec is derived from the tick time
+        BOOST_CHECK(metadata.time_spec == metadata.tick_time.to_time_spec());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_tick_time_late)
+{
+    // Test that fragments of late packets have a time, even if the sample rate
+    // doesn't divide the tick rate, and their common rate is out of range
+    const std::string format("fc32");
+    const double tick_rate    = 245.76e6;
+    const uint64_t tsf        = uint64_t(1700000000) * 245760000;
+    const size_t num_samps    = 100;
+    const double samp_rates[] = {1.5e6, 200e6 / 7, 3.2000003e6};
+
+    for (const double samp_rate : samp_rates) {
+        auto recv_links = make_links(1);
+        auto streamer   = make_rx_streamer(recv_links, format);
+        streamer->set_tick_rate(tick_rate);
+        streamer->set_samp_rate(samp_rate);
+
+        const size_t reads_per_packet = streamer->get_max_num_samps() / num_samps;
+        BOOST_REQUIRE_GT(reads_per_packet, 1);
+        mock_header_t header;
+        header.has_tsf = true;
+        header.tsf     = tsf;
+        push_back_recv_packet(recv_links[0], header, num_samps * reads_per_packet);
+
+        std::vector<std::complex<float>> buff(num_samps);
+        uhd::rx_metadata_t metadata;
+        const uhd::time_spec_t start =
+            uhd::tick_time_t(tsf, uhd::tick_time_t::rate_t::from_double(tick_rate))
+                .to_time_spec();
+        for (size_t j = 0; j < reads_per_packet; j++) {
+            size_t num_samps_ret = 0;
+            BOOST_REQUIRE_NO_THROW(num_samps_ret = streamer->recv(
+                                       buff.data(), buff.size(), metadata, 1.0, false));
+            BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+            BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+            // The tick time is rounded to the tick rate...
+            BOOST_CHECK_EQUAL(metadata.tick_time.get_ticks(),
+                int64_t(tsf) + std::llround(j * num_samps * tick_rate / samp_rate));
+            // ...but time_spec keeps the time between the ticks
+            BOOST_CHECK_SMALL(
+                (metadata.time_spec - start).get_real_secs() - j * num_samps / samp_rate,
+                1e-12);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_seq_error)
 {
     // Test that when we get a sequence error the error is returned in the
@@ -519,6 +602,7 @@ BOOST_AUTO_TEST_CASE(test_recv_seq_error)
         BOOST_CHECK_EQUAL(metadata.out_of_sequence, true);
         size_t metadata_tsf = metadata.time_spec.to_ticks(TICK_RATE);
         BOOST_CHECK_EQUAL(metadata_tsf, expected_tsf);
+        BOOST_CHECK_EQUAL(metadata.tick_time.get_ticks(), int64_t(expected_tsf));
 
         // Next read should succeed
         num_samps_ret = streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
@@ -623,6 +707,67 @@ BOOST_AUTO_TEST_CASE(test_recv_multi_channel_no_tsf)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_multi_channel_convert_threads)
+{
+    // Test that converting channels on multiple threads returns the same
+    // data and metadata, including when packets are read in fragments
+    const size_t NUM_PKTS_TO_TEST = 5;
+    const std::string format("fc32");
+
+    const size_t num_chans = 8;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(
+        recv_links, format, "sc16", uhd::device_addr_t("convert_threads=3"));
+
+    const size_t reads_per_packet = 2;
+    const size_t num_samps        = 20;
+
+    std::vector<std::vector<std::complex<float>>> buffer(num_chans);
+    std::vector<void*> buffers;
+    for (size_t i = 0; i < num_chans; i++) {
+        buffer[i].resize(num_samps);
+        buffers.push_back(&buffer[i].front());
+    }
+
+    uhd::rx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        mock_header_t header;
+        header.eob     = (i == NUM_PKTS_TO_TEST - 1);
+        header.has_tsf = true;
+        header.tsf     = i * 1000;
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            push_back_recv_packet(
+                recv_links[ch], header, num_samps * reads_per_packet, ch * 100);
+        }
+
+        for (size_t j = 0; j < reads_per_packet; j++) {
+            const size_t num_samps_ret =
+                streamer->recv(buffers, num_samps, metadata, 1.0, false);
+
+            BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+            BOOST_CHECK_EQUAL(metadata.end_of_burst, i == NUM_PKTS_TO_TEST - 1);
+            BOOST_CHECK_EQUAL(metadata.more_fragments, j != reads_per_packet - 1);
+            BOOST_CHECK_EQUAL(metadata.fragment_offset, j * num_samps);
+
+            const size_t ticks_per_sample = static_cast<size_t>(TICK_RATE / SAMP_RATE);
+            BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE),
+                i * 1000 + j * num_samps * ticks_per_sample);
+
+            for (size_t ch = 0; ch < num_chans; ch++) {
+                for (size_t samp = 0; samp < num_samps; samp++) {
+                    const size_t n   = ch * 100 + j * num_samps + samp;
+                    const auto value = std::complex<float>(
+                        (n * 2) * SCALE_FACTOR, (n * 2 + 1) * SCALE_FACTOR);
+                    BOOST_CHECK_EQUAL(value, buffer[ch][samp]);
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_multi_channel_seq_error)
 {
     // Test that the streamer handles dropped packets correctly by injecting
@@ -910,6 +1055,100 @@ BOOST_AUTO_TEST_CASE(test_recv_zero_samples)
     BOOST_CHECK_LE(elapsed_time.count(), 1.5);
 }
 
+BOOST_AUTO_TEST_CASE(test_get_recv_buffs)
+{
+    const size_t NUM_PKTS_TO_TEST = 5;
+    const size_t num_chans        = 2;
+    const size_t num_samps        = 20;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(recv_links, "sc16");
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        mock_header_t header;
+        header.eob     = (i % 2 == 0);
+        header.has_tsf = true;
+        header.tsf     = i;
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            push_back_recv_packet(recv_links[ch], header, num_samps, ch * num_samps);
+        }
+    }
+
+    uhd::rx_streamer::wire_buffs_type buffs;
+    uhd::rx_metadata_t metadata;
+
+    // Every link only has a single frame buffer, so each packet must be
+    // released before the next one can be received
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        const size_t num_samps_ret = streamer->get_recv_buffs(buffs, metadata, 1.0);
+
+        BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_CHECK_EQUAL(metadata.end_of_burst, i % 2 == 0);
+        BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), i);
+        BOOST_REQUIRE_EQUAL(buffs.size(), num_chans);
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            const auto* samps = static_cast<const std::complex<uint16_t>*>(buffs[ch]);
+            for (size_t samp = 0; samp < num_samps; samp++) {
+                const size_t n = ch * num_samps + samp;
+                BOOST_CHECK_EQUAL(samps[samp], std::complex<uint16_t>(n * 2, n * 2 + 1));
+            }
+        }
+
+        // Alternate between releasing explicitly and letting the next call
+        // release the packets
+        if (i % 2 == 0) {
+            streamer->release_recv_buffs();
+        }
+    }
+    streamer->release_recv_buffs();
+
+    // Nothing left to receive
+    BOOST_CHECK_EQUAL(streamer->get_recv_buffs(buffs, metadata, 0.0), 0);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+}
+
+BOOST_AUTO_TEST_CASE(test_get_recv_buffs_mixed_with_recv)
+{
+    const std::string format("fc32");
+
+    auto recv_links = make_links(1);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    const size_t spp = streamer->get_max_num_samps();
+    mock_header_t header;
+    header.has_tsf = true;
+    header.tsf     = 0;
+    push_back_recv_packet(recv_links[0], header, spp);
+    push_back_recv_packet(recv_links[0], header, spp);
+
+    // Read the first quarter of the packet with recv(), then get the rest of
+    // it without converting
+    const size_t num_samps = spp / 4;
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    BOOST_CHECK(metadata.more_fragments);
+
+    uhd::rx_streamer::wire_buffs_type buffs;
+    BOOST_CHECK_EQUAL(streamer->get_recv_buffs(buffs, metadata, 1.0), spp - num_samps);
+    BOOST_CHECK(!metadata.more_fragments);
+    BOOST_CHECK_EQUAL(metadata.fragment_offset, num_samps);
+    const size_t ticks_per_sample = static_cast<size_t>(TICK_RATE / SAMP_RATE);
+    BOOST_CHECK_EQUAL(
+        metadata.time_spec.to_ticks(TICK_RATE), ticks_per_sample * num_samps);
+    const auto* samps = static_cast<const std::complex<uint16_t>*>(buffs[0]);
+    BOOST_CHECK_EQUAL(samps[0], std::complex<uint16_t>(num_samps * 2, num_samps * 2 + 1));
+
+    // recv() releases the packets that are still held
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+    BOOST_CHECK_EQUAL(metadata.fragment_offset, 0);
+}
+
 BOOST_AUTO_TEST_CASE(test_get_stream_info)
 {
     const std::string cpu_format("fc32");
@@ -959,3 +1198,60 @@ BOOST_AUTO_TEST_CASE(test_get_stream_info)
     // Test invalid channel index
     BOOST_CHECK_THROW(streamer->get_stream_info(num_chans), uhd::index_error);
 }
+
+BOOST_AUTO_TEST_CASE(test_stream_telemetry)
+{
+    const size_t num_samps = 20;
+    std::vector<std::complex<float>> buff(num_samps);
+    uhd::rx_metadata_t metadata;
+
+    // Telemetry is off by default
+    {
+        auto recv_links = make_links(1);
+        auto streamer   = make_rx_streamer(recv_links, "fc32");
+        push_back_recv_packet(recv_links[0], mock_header_t(), num_samps);
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false);
+        BOOST_CHECK(!streamer->get_stream_info(0).has_key("telemetry_packets"));
+        BOOST_CHECK_EQUAL(streamer->get_telemetry_info(0).size(), 0);
+    }
+
+#ifdef UHD_STREAM_TELEMETRY
+    auto recv_links = make_links(1);
+    uhd::stream_args_t stream_args("fc32", "sc16");
+    stream_args.args = uhd::device_addr_t("telemetry=1");
+    auto streamer    = std::make_shared<mock_rx_streamer>(1, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+    streamer->connect_channel(0, std::make_unique<mock_rx_data_xport>(recv_links[0]));
+
+    // Three packets with a dropped packet before the last one
+    mock_header_t header;
+    header.ignore_seq = false;
+    for (const size_t seq_num : {0, 1, 3}) {
+        header.seq_num = seq_num;
+        push_back_recv_packet(recv_links[0], header, num_samps);
+    }
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    BOOST_CHECK_EQUAL(streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), 0);
+    BOOST_CHECK_EQUAL(
+        streamer->recv(buff.data(), buff.size(), metadata, 1.0, false), num_samps);
+    // No more packets
+    BOOST_CHECK_EQUAL(streamer->recv(buff.data(), buff.size(), metadata, 0.0, false), 0);
+
+    const auto info = streamer->get_stream_info(0);
+    BOOST_CHECK_EQUAL(info["telemetry_packets"], "3");
+    BOOST_CHECK_EQUAL(info["telemetry_bytes"],
+        std::to_string(3 * num_samps * sizeof(std::complex<uint16_t>)));
+    BOOST_CHECK_EQUAL(info["telemetry_seq_errors"], "1");
+    BOOST_CHECK_EQUAL(info["telemetry_overflows"], "0");
+    BOOST_CHECK_EQUAL(info["telemetry_timeouts"], "1");
+    BOOST_CHECK_EQUAL(info["telemetry_convert_count"], "3");
+    BOOST_CHECK_EQUAL(info["telemetry_buff_wait_count"], "5");
+    BOOST_CHECK(info.has_key("telemetry_buff_wait_p99_ns"));
+    BOOST_CHECK_EQUAL(
+        streamer->get_telemetry_info(0)["telemetry_packets"], info["telemetry_packets"]);
+#endif
+}
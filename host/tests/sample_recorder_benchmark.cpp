@@ -0,0 +1,209 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhd/utils/sample_recorder.hpp>
+#include <uhdlib/transport/rx_streamer_impl.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <complex>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd;
+using namespace uhd::transport;
+using namespace std::chrono;
+
+/*!
+ * Mock rx data xport which returns the same packet over and over, so the
+ * recorder is fed by a real rx streamer without any hardware.
+ */
+class mock_rx_data_xport
+{
+public:
+    using uptr = std::unique_ptr<mock_rx_data_xport>;
+
+    struct buff_t
+    {
+        using uptr = std::unique_ptr<buff_t>;
+        std::vector<uint8_t> data;
+    };
+
+    struct packet_info_t
+    {
+        bool eob             = false;
+        bool eov             = false;
+        bool has_tsf         = false;
+        uint64_t tsf         = 0;
+        size_t payload_bytes = 0;
+        const void* payload  = nullptr;
+    };
+
+    mock_rx_data_xport(const size_t buff_size) : _buff_size(buff_size)
+    {
+        _buff = std::make_unique<buff_t>();
+        _buff->data.resize(buff_size);
+        for (size_t i = 0; i < buff_size; i++) {
+            _buff->data[i] = uint8_t(i);
+        }
+
+        _packet_info.has_tsf       = true;
+        _packet_info.payload_bytes = buff_size;
+        _packet_info.payload       = _buff->data.data();
+    }
+
+    std::tuple<buff_t::uptr, packet_info_t, bool> get_recv_buff(const int32_t)
+    {
+        return std::make_tuple(std::move(_buff), _packet_info, false);
+    }
+
+    void release_recv_buff(buff_t::uptr buff)
+    {
+        _buff = std::move(buff);
+    }
+
+    size_t get_mtu() const
+    {
+        return _buff_size;
+    }
+
+    size_t get_chdr_hdr_len() const
+    {
+        return 0;
+    }
+
+    size_t get_max_payload_size() const
+    {
+        return _buff_size;
+    }
+
+    uhd::device_addr_t get_xport_info() const
+    {
+        return uhd::device_addr_t();
+    }
+
+private:
+    size_t _buff_size;
+    buff_t::uptr _buff;
+    packet_info_t _packet_info;
+};
+
+/*!
+ * Mock rx streamer, configured to ignore sequence errors
+ */
+class mock_rx_streamer : public rx_streamer_impl<mock_rx_data_xport, true>
+{
+public:
+    using rx_streamer_impl<mock_rx_data_xport, true>::rx_streamer_impl;
+
+    void issue_stream_cmd(const stream_cmd_t&) override {}
+
+    void post_input_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+};
+
+/*!
+ * Benchmark of sustained recording throughput. A single thread receives from
+ * a mock rx streamer and hands the samples to the recorder, like the
+ * rx_samples_to_file example does.
+ */
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string dir, recorder_args;
+    size_t num_chans, spb;
+    double run_time;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("dir", po::value<std::string>(&dir)->default_value(std::filesystem::temp_directory_path().string()), "directory to write the files to")
+        ("chans", po::value<size_t>(&num_chans)->default_value(2), "number of channels")
+        ("spb", po::value<size_t>(&spb)->default_value(10000), "samples per recv() call")
+        ("duration", po::value<double>(&run_time)->default_value(5.0), "duration of the run in seconds")
+        ("recorder-args", po::value<std::string>(&recorder_args)->default_value(""), "sample recorder arguments, e.g. \"direct_io=0,num_threads=4\"")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Sample Recorder Benchmark %s") % desc
+                  << std::endl;
+        std::cout << "    Benchmark of sustained sc16 recording throughput, fed\n"
+                     "    by an rx streamer with a mock transport. No hardware\n"
+                     "    is needed to run this benchmark.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    constexpr size_t spp = 2000;
+    const size_t bpi     = convert::get_bytes_per_item("sc16");
+    auto streamer =
+        std::make_shared<mock_rx_streamer>(num_chans, stream_args_t("sc16", "sc16"));
+    for (size_t i = 0; i < num_chans; i++) {
+        streamer->connect_channel(i, std::make_unique<mock_rx_data_xport>(spp * bpi));
+    }
+
+    std::vector<std::string> filenames;
+    for (size_t i = 0; i < num_chans; i++) {
+        filenames.push_back(
+            (std::filesystem::path(dir) / ("uhd_recorder_bench_ch" + std::to_string(i)))
+                .string());
+    }
+    auto recorder = sample_recorder::make(filenames, device_addr_t(recorder_args));
+
+    std::vector<std::vector<std::complex<int16_t>>> buffs(
+        num_chans, std::vector<std::complex<int16_t>>(spb));
+    std::vector<void*> buff_ptrs;
+    for (auto& buff : buffs) {
+        buff_ptrs.push_back(buff.data());
+    }
+
+    rx_metadata_t md;
+    uint64_t num_bytes = 0;
+    const auto start   = steady_clock::now();
+    const auto stop    = start + duration<double>(run_time);
+    while (steady_clock::now() < stop) {
+        const size_t num_samps = streamer->recv(buff_ptrs, spb, md, 1.0, false);
+        recorder->write(buff_ptrs, num_samps * bpi);
+        num_bytes += num_samps * bpi * num_chans;
+    }
+    const duration<double> recv_time = steady_clock::now() - start;
+    recorder->close();
+    const duration<double> total_time = steady_clock::now() - start;
+
+    const auto stats = recorder->get_stats();
+    std::cout << boost::format("Recorded %.3f GB on %d channels:") % (num_bytes / 1e9)
+                     % num_chans
+              << std::endl;
+    std::cout << boost::format("    Receive rate:       %8.3f GB/s")
+                     % (num_bytes / recv_time.count() / 1e9)
+              << std::endl;
+    std::cout << boost::format("    Sustained to disk:  %8.3f GB/s")
+                     % (stats.bytes_written / total_time.count() / 1e9)
+              << std::endl;
+    std::cout << boost::format("    Stalls:             %8d (%.3f s)") % stats.num_stalls
+                     % stats.stall_time
+              << std::endl;
+    std::cout << boost::format("    Max pending blocks: %8d") % stats.max_pending_blocks
+              << std::endl;
+
+    for (const auto& filename : filenames) {
+        std::filesystem::remove(filename);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,175 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/sample_recorder.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+//! Temporary directory that is removed with all its contents at the end of a test
+struct temp_dir_fixture
+{
+    temp_dir_fixture()
+        : path(fs::temp_directory_path()
+               / ("uhd_sample_recorder_test_" + std::to_string(std::rand())))
+    {
+        fs::create_directories(path);
+    }
+
+    ~temp_dir_fixture()
+    {
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+
+    std::string file(const std::string& name) const
+    {
+        return (path / name).string();
+    }
+
+    fs::path path;
+};
+
+std::vector<uint8_t> read_file(const std::string& filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    return std::vector<uint8_t>(
+        std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+std::string read_text_file(const std::string& filename)
+{
+    std::ifstream in(filename);
+    return std::string(
+        std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(test_sample_recorder_write, temp_dir_fixture)
+{
+    // Small blocks, so the data spans many blocks and the last block is only
+    // partially filled. Also test both with and without direct I/O. If the
+    // temp directory does not support direct I/O, both are the same.
+    for (const char* direct_io : {"0", "1"}) {
+        const std::vector<std::string> filenames = {file("ch0.dat"), file("ch1.dat")};
+        auto recorder                            = uhd::sample_recorder::make(filenames,
+            uhd::device_addr_t(
+                std::string("block_size=4096,num_blocks=2,num_threads=3,direct_io=")
+                + direct_io));
+        BOOST_CHECK_EQUAL(recorder->get_num_channels(), 2);
+
+        // Write chunks that don't line up with the block size
+        std::vector<std::vector<uint8_t>> expected(2);
+        std::vector<uint8_t> chunk(1000);
+        for (size_t i = 0; i < 50; i++) {
+            for (size_t chan = 0; chan < 2; chan++) {
+                for (size_t j = 0; j < chunk.size(); j++) {
+                    chunk[j] = uint8_t(i * 7 + j + chan * 13);
+                }
+                expected[chan].insert(expected[chan].end(), chunk.begin(), chunk.end());
+                recorder->write(chan, chunk.data(), chunk.size());
+            }
+        }
+        recorder->close();
+        // Closing twice is fine
+        recorder->close();
+
+        for (size_t chan = 0; chan < 2; chan++) {
+            const auto data = read_file(filenames[chan]);
+            BOOST_CHECK_EQUAL(data.size(), expected[chan].size());
+            BOOST_CHECK(data == expected[chan]);
+        }
+
+        const auto stats = recorder->get_stats();
+        BOOST_CHECK_EQUAL(stats.bytes_written, 2 * 50 * chunk.size());
+        BOOST_CHECK_GE(stats.max_pending_blocks, 1);
+
+        BOOST_CHECK_THROW(
+            recorder->write(0, chunk.data(), chunk.size()), uhd::runtime_error);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(test_sample_recorder_write_all_channels, temp_dir_fixture)
+{
+    const std::vector<std::string> filenames = {
+        file("a.dat"), file("b.dat"), file("c.dat")};
+    {
+        auto recorder = uhd::sample_recorder::make(
+            filenames, uhd::device_addr_t("block_size=8192,num_threads=1"));
+        std::vector<std::vector<uint16_t>> buffs(3, std::vector<uint16_t>(3000));
+        std::vector<uint16_t*> buff_ptrs;
+        for (size_t chan = 0; chan < 3; chan++) {
+            for (size_t i = 0; i < buffs[chan].size(); i++) {
+                buffs[chan][i] = uint16_t(chan * 10000 + i);
+            }
+            buff_ptrs.push_back(buffs[chan].data());
+        }
+        recorder->write(buff_ptrs, buffs[0].size() * sizeof(uint16_t));
+
+        // Wrong number of buffers
+        buff_ptrs.pop_back();
+        BOOST_CHECK_THROW(recorder->write(buff_ptrs, 2), uhd::value_error);
+        // The destructor flushes the files
+    }
+
+    for (size_t chan = 0; chan < 3; chan++) {
+        const auto data = read_file(filenames[chan]);
+        BOOST_REQUIRE_EQUAL(data.size(), 3000 * sizeof(uint16_t));
+        const auto* samps = reinterpret_cast<const uint16_t*>(data.data());
+        BOOST_CHECK_EQUAL(samps[0], chan * 10000);
+        BOOST_CHECK_EQUAL(samps[2999], chan * 10000 + 2999);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(test_sample_recorder_sigmf, temp_dir_fixture)
+{
+    auto recorder = uhd::sample_recorder::make(
+        {file("rx.sigmf-data"), file("rx_ch1.dat")}, uhd::device_addr_t("direct_io=0"));
+
+    uhd::sample_recorder::sigmf_meta_t meta;
+    meta.datatype    = "ci16_le";
+    meta.sample_rate = 1e6;
+    meta.frequencies = {2.4e9, 5.8e9};
+    meta.description = "Test \"recording\"";
+    recorder->write_sigmf_meta(meta);
+    recorder->close();
+
+    const std::string meta0 = read_text_file(file("rx.sigmf-meta"));
+    BOOST_CHECK(meta0.find("\"core:datatype\": \"ci16_le\"") != std::string::npos);
+    BOOST_CHECK(meta0.find("\"core:sample_rate\": 1000000") != std::string::npos);
+    BOOST_CHECK(meta0.find("\"core:frequency\": 2400000000") != std::string::npos);
+    BOOST_CHECK(meta0.find("Test \\\"recording\\\"") != std::string::npos);
+    // Conforming data files are not referenced explicitly
+    BOOST_CHECK(meta0.find("core:dataset") == std::string::npos);
+
+    const std::string meta1 = read_text_file(file("rx_ch1.sigmf-meta"));
+    BOOST_CHECK(meta1.find("\"core:frequency\": 5800000000") != std::string::npos);
+    BOOST_CHECK(meta1.find("\"core:dataset\": \"rx_ch1.dat\"") != std::string::npos);
+
+    meta.frequencies = {1e9, 2e9, 3e9};
+    BOOST_CHECK_THROW(recorder->write_sigmf_meta(meta), uhd::value_error);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_sample_recorder_errors, temp_dir_fixture)
+{
+    BOOST_CHECK_THROW(uhd::sample_recorder::make({}), uhd::value_error);
+    BOOST_CHECK_THROW(uhd::sample_recorder::make(
+                          {file("x.dat")}, uhd::device_addr_t("num_blocks=0")),
+        uhd::value_error);
+    BOOST_CHECK_THROW(
+        uhd::sample_recorder::make({file("does_not_exist/x.dat")}), uhd::io_error);
+}
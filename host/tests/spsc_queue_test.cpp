@@ -0,0 +1,109 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/spsc_queue.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono;
+
+BOOST_AUTO_TEST_CASE(test_spsc_queue_fifo)
+{
+    // Odd size to check the queue holds at least as many items as requested
+    uhd::spsc_queue<int> queue(5);
+    int item = -1;
+
+    BOOST_CHECK(!queue.pop(item));
+    BOOST_CHECK(!queue.peek(item));
+    BOOST_CHECK_EQUAL(queue.read_available(), 0);
+
+    // Wrap around the end of the buffer a few times
+    for (int i = 0; i < 20; i += 5) {
+        for (int j = 0; j < 5; j++) {
+            queue.push(i + j);
+        }
+        BOOST_CHECK_EQUAL(queue.read_available(), 5);
+        BOOST_CHECK(queue.peek(item));
+        BOOST_CHECK_EQUAL(item, i);
+        for (int j = 0; j < 5; j++) {
+            BOOST_CHECK(queue.pop(item));
+            BOOST_CHECK_EQUAL(item, i + j);
+        }
+        BOOST_CHECK(!queue.pop(item));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_spsc_queue_timeout)
+{
+    uhd::spsc_queue<int> queue(4);
+    int item = -1;
+
+    BOOST_CHECK(!queue.pop(item, 0));
+
+    const auto start = steady_clock::now();
+    BOOST_CHECK(!queue.pop(item, 20));
+    BOOST_CHECK(steady_clock::now() - start >= milliseconds(20));
+
+    // Items that are already queued are returned right away
+    queue.push(42);
+    BOOST_CHECK(queue.pop(item, 0));
+    BOOST_CHECK_EQUAL(item, 42);
+}
+
+BOOST_AUTO_TEST_CASE(test_spsc_queue_wakeup)
+{
+    // Check that a consumer that went to sleep is woken up by the producer,
+    // well before the timeout expires
+    uhd::spsc_queue<int> queue(4);
+    int item = -1;
+
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(milliseconds(50));
+        queue.push(1);
+    });
+    const auto start = steady_clock::now();
+    BOOST_CHECK(queue.pop(item, 5000));
+    BOOST_CHECK(steady_clock::now() - start < milliseconds(2500));
+    BOOST_CHECK_EQUAL(item, 1);
+    producer.join();
+
+    // Block with no timeout
+    producer = std::thread([&queue]() {
+        std::this_thread::sleep_for(milliseconds(50));
+        queue.push(2);
+    });
+    BOOST_CHECK(queue.pop(item, -1));
+    BOOST_CHECK_EQUAL(item, 2);
+    producer.join();
+}
+
+BOOST_AUTO_TEST_CASE(test_spsc_queue_threads)
+{
+    // Pass items back and forth between two threads, with and without pauses
+    // so that the consumers both poll and sleep
+    constexpr size_t num_items = 20000;
+    uhd::spsc_queue<size_t> to_echo(16), from_echo(16);
+
+    std::thread echo([&]() {
+        size_t item;
+        for (size_t i = 0; i < num_items; i++) {
+            to_echo.pop(item, -1);
+            from_echo.push(item);
+        }
+    });
+
+    size_t item;
+    for (size_t i = 0; i < num_items; i++) {
+        to_echo.push(i);
+        BOOST_REQUIRE(from_echo.pop(item, -1));
+        BOOST_CHECK_EQUAL(item, i);
+        if (i % 1000 == 0) {
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+    }
+    echo.join();
+}
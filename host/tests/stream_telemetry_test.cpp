@@ -0,0 +1,172 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/transport/stream_telemetry.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace uhd::transport;
+
+BOOST_AUTO_TEST_CASE(test_telemetry_counter)
+{
+    telemetry_counter counter;
+    BOOST_CHECK_EQUAL(counter.get(), 0);
+    counter.add();
+    counter.add(41);
+    BOOST_CHECK_EQUAL(counter.get(), 42);
+
+    telemetry_counter max;
+    max.update_max(5);
+    max.update_max(3);
+    BOOST_CHECK_EQUAL(max.get(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_telemetry_histogram)
+{
+    telemetry_histogram histogram;
+    BOOST_CHECK_EQUAL(histogram.get_percentile_ns(0.5), 0);
+
+    // 98 fast values, and two slow outliers
+    for (size_t i = 0; i < 98; i++) {
+        histogram.add(100);
+    }
+    histogram.add(5000);
+    histogram.add(1000000);
+    BOOST_CHECK_EQUAL(histogram.get_count(), 100);
+
+    // 100 lies in the bucket [64, 128)
+    BOOST_CHECK_EQUAL(histogram.get_percentile_ns(0.5), 127);
+    // 99th value is 5000, in the bucket [4096, 8192)
+    BOOST_CHECK_EQUAL(histogram.get_percentile_ns(0.985), 8191);
+    // Never report more than the maximum
+    BOOST_CHECK_EQUAL(histogram.get_percentile_ns(1.0), 1000000);
+
+    uhd::device_addr_t info;
+    histogram.to_info(info, "lat");
+    BOOST_CHECK_EQUAL(info["lat_count"], "100");
+    BOOST_CHECK_EQUAL(info["lat_avg_ns"], std::to_string((98 * 100 + 1005000) / 100));
+    BOOST_CHECK_EQUAL(info["lat_p50_ns"], "127");
+    BOOST_CHECK_EQUAL(info["lat_max_ns"], "1000000");
+
+    // Zero goes into its own bucket, huge values into the last one
+    telemetry_histogram extremes;
+    extremes.add(0);
+    extremes.add(uint64_t(1) << 60);
+    BOOST_CHECK_EQUAL(extremes.get_percentile_ns(0.0), 0);
+    BOOST_CHECK_EQUAL(extremes.get_percentile_ns(0.99), uint64_t(1) << 60);
+}
+
+BOOST_AUTO_TEST_CASE(test_telemetry_switch)
+{
+    BOOST_CHECK(!telemetry_switch().on());
+    BOOST_CHECK(!get_telemetry_switch(uhd::device_addr_t("telemetry=0")).on());
+#ifdef UHD_STREAM_TELEMETRY
+    BOOST_CHECK(get_telemetry_switch(uhd::device_addr_t("telemetry=1")).on());
+#else
+    BOOST_CHECK(!get_telemetry_switch(uhd::device_addr_t("telemetry=1")).on());
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(test_telemetry_switch_env)
+{
+    const uhd::device_addr_t no_args;
+    for (const char* value : {"0", "false", "no", "off", "bogus"}) {
+        setenv("UHD_STREAM_TELEMETRY", value, 1);
+        BOOST_CHECK_MESSAGE(!get_telemetry_switch(no_args).on(), value);
+    }
+    for (const char* value : {"1", "true", "yes"}) {
+        setenv("UHD_STREAM_TELEMETRY", value, 1);
+#ifdef UHD_STREAM_TELEMETRY
+        BOOST_CHECK_MESSAGE(get_telemetry_switch(no_args).on(), value);
+#else
+        BOOST_CHECK_MESSAGE(!get_telemetry_switch(no_args).on(), value);
+#endif
+        // The arg takes precedence
+        BOOST_CHECK(!get_telemetry_switch(uhd::device_addr_t("telemetry=0")).on());
+    }
+    unsetenv("UHD_STREAM_TELEMETRY");
+}
+
+BOOST_AUTO_TEST_CASE(test_telemetry_dumper)
+{
+    const std::string path =
+        (std::filesystem::temp_directory_path()
+            / ("uhd_stream_telemetry_test_" + std::to_string(std::rand()) + ".txt"))
+            .string();
+
+    telemetry_counter counter;
+    auto info_fn = [&counter]() {
+        uhd::device_addr_t info;
+        info["telemetry_count"] = std::to_string(counter.get());
+        return info;
+    };
+
+    // No file, no registration
+    BOOST_CHECK(!telemetry_dumper::register_source(
+        uhd::device_addr_t("telemetry=1"), "src", info_fn));
+    // Telemetry off, no registration
+    BOOST_CHECK(!telemetry_dumper::register_source(
+        uhd::device_addr_t("telemetry=0,telemetry_file=" + path), "src", info_fn));
+
+#ifdef UHD_STREAM_TELEMETRY
+    {
+        const uhd::device_addr_t args(
+            "telemetry=1,telemetry_interval=0.01,telemetry_file=" + path);
+        auto reg_a = telemetry_dumper::register_source(args, "src_a", info_fn);
+        auto reg_b = telemetry_dumper::register_source(args, "src_b", info_fn);
+        BOOST_REQUIRE(reg_a);
+        BOOST_REQUIRE(reg_b);
+        counter.add(7);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        counter.add(1);
+        // Unregistering writes the final values
+    }
+
+    std::ifstream in(path);
+    std::string line;
+    std::vector<std::string> lines;
+    while (std::getline(in, line)) {
+        lines.push_back(line);
+    }
+    std::filesystem::remove(path);
+
+    BOOST_REQUIRE_GE(lines.size(), 2);
+    size_t num_a = 0, num_b = 0;
+    for (const auto& l : lines) {
+        num_a += l.find(" src_a telemetry_count=") != std::string::npos;
+        num_b += l.find(" src_b telemetry_count=") != std::string::npos;
+    }
+    BOOST_CHECK_GE(num_a, 1);
+    BOOST_CHECK_GE(num_b, 1);
+    BOOST_CHECK(lines.back().find("telemetry_count=8") != std::string::npos);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(test_telemetry_dumper_bad_interval)
+{
+#ifdef UHD_STREAM_TELEMETRY
+    const std::string path =
+        (std::filesystem::temp_directory_path()
+            / ("uhd_stream_telemetry_test_" + std::to_string(std::rand()) + ".txt"))
+            .string();
+    auto info_fn = []() { return uhd::device_addr_t(); };
+
+    // Invalid intervals fall back to the default instead of failing
+    for (const std::string interval : {"1s", "0", "-1", "1e-9", "inf", "nan"}) {
+        const uhd::device_addr_t args(
+            "telemetry=1,telemetry_interval=" + interval + ",telemetry_file=" + path);
+        BOOST_CHECK_MESSAGE(
+            telemetry_dumper::register_source(args, "src", info_fn), interval);
+    }
+    std::filesystem::remove(path);
+#endif
+}
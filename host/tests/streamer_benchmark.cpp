@@ -9,9 +9,11 @@
 #include <uhd/utils/safe_main.hpp>
 #include <uhdlib/rfnoc/chdr_rx_data_xport.hpp>
 #include <uhdlib/rfnoc/chdr_tx_data_xport.hpp>
+#include <uhdlib/transport/chdr_replay_link.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <uhdlib/transport/tx_streamer_impl.hpp>
+#include <uhdlib/transport/udp_common.hpp>
 #include <boost/program_options.hpp>
 #include <chrono>
 #include <iostream>
@@ -152,7 +154,7 @@ public:
         return std::make_pair(data + sizeof(info), sizeof(info) + info.payload_bytes);
     }
 
-    void release_send_buff(buff_t::uptr buff)
+    void release_send_buff(buff_t::uptr buff, const bool /*flush*/ = false)
     {
         _buff = std::move(buff);
     }
@@ -306,6 +308,52 @@ static std::shared_ptr<tx_streamer_mock_xport> make_tx_streamer_mock_xport(
     return streamer;
 }
 
+static std::shared_ptr<rx_streamer_mock_xport> make_rx_streamer_mock_xport(
+    const size_t spp,
+    const std::string& format,
+    const size_t num_chans,
+    const size_t convert_threads)
+{
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args["convert_threads"] = std::to_string(convert_threads);
+    auto streamer = std::make_shared<rx_streamer_mock_xport>(num_chans, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+
+    const size_t bpi        = convert::get_bytes_per_item(format);
+    const size_t frame_size = bpi * spp;
+
+    for (size_t i = 0; i < num_chans; i++) {
+        streamer->set_scale_factor(i, SCALE_FACTOR);
+        streamer->connect_channel(i, std::make_unique<mock_rx_data_xport>(frame_size));
+    }
+
+    return streamer;
+}
+
+static std::shared_ptr<tx_streamer_mock_xport> make_tx_streamer_mock_xport(
+    const size_t spp,
+    const std::string& format,
+    const size_t num_chans,
+    const size_t convert_threads)
+{
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args["convert_threads"] = std::to_string(convert_threads);
+    auto streamer = std::make_shared<tx_streamer_mock_xport>(num_chans, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+
+    const size_t bpi        = convert::get_bytes_per_item(format);
+    const size_t frame_size = bpi * spp + sizeof(mock_tx_data_xport::packet_info_t);
+
+    for (size_t i = 0; i < num_chans; i++) {
+        streamer->set_scale_factor(i, SCALE_FACTOR);
+        streamer->connect_channel(i, std::make_unique<mock_tx_data_xport>(frame_size));
+    }
+
+    return streamer;
+}
+
 static std::shared_ptr<rx_streamer_mock_link> make_rx_streamer_mock_link(
     const size_t spp, const std::string& format)
 {
@@ -361,6 +409,48 @@ static std::shared_ptr<rx_streamer_mock_link> make_rx_streamer_mock_link(
     return streamer;
 }
 
+/*!
+ * Creates an rx streamer connected to a link which replays a capture, to
+ * benchmark the receive path with real traffic
+ */
+static std::shared_ptr<rx_streamer_mock_link> make_rx_streamer_replay_link(
+    chdr_replay_link::sptr link,
+    const std::string& format,
+    const std::string& otw_format,
+    const chdr::chdr_packet_factory& pkt_factory,
+    const sep_id_pair_t& epids)
+{
+    const uhd::stream_args_t stream_args(format, otw_format);
+    auto streamer = std::make_shared<rx_streamer_mock_link>(1, stream_args);
+    streamer->set_tick_rate(TICK_RATE);
+    streamer->set_samp_rate(SAMP_RATE);
+    streamer->set_scale_factor(0, SCALE_FACTOR);
+
+    const stream_buff_params_t buff_capacity = {UINT64_MAX, UINT32_MAX};
+    const stream_buff_params_t fc_freq       = {UINT64_MAX, UINT32_MAX};
+    const chdr_rx_data_xport::fc_params_t fc_params{buff_capacity, fc_freq};
+
+    auto io_srv = inline_io_service::make();
+    io_srv->attach_recv_link(link);
+    io_srv->attach_send_link(link);
+
+    auto xport = std::make_unique<chdr_rx_data_xport>(io_srv,
+        link,
+        link,
+        pkt_factory,
+        epids,
+        link->get_num_recv_frames(),
+        fc_params,
+        uhd::device_addr_t(),
+        [io_srv = io_srv, link]() {
+            io_srv->detach_recv_link(link);
+            io_srv->detach_send_link(link);
+        });
+
+    streamer->connect_channel(0, std::move(xport));
+    return streamer;
+}
+
 static std::shared_ptr<tx_streamer_mock_link> make_tx_streamer_mock_link(
     const size_t spp, const std::string& format)
 {
@@ -408,20 +498,24 @@ static std::shared_ptr<tx_streamer_mock_link> make_tx_streamer_mock_link(
 /*!
  * Benchmark of rx streamer
  */
-void benchmark_rx_streamer(
-    rx_streamer::sptr streamer, const size_t spp, const std::string& format)
+void benchmark_rx_streamer(rx_streamer::sptr streamer,
+    const size_t spp,
+    const std::string& format,
+    const size_t iterations = 1e7)
 {
-    // Allocate buffer
+    // Allocate buffers
     const size_t bpi = convert::get_bytes_per_item(format);
-    std::vector<uint8_t> buffer(spp * bpi);
+    std::vector<std::vector<uint8_t>> buffer(streamer->get_num_channels());
     std::vector<void*> buffers;
-    buffers.push_back(buffer.data());
+    for (auto& chan_buffer : buffer) {
+        chan_buffer.resize(spp * bpi);
+        buffers.push_back(chan_buffer.data());
+    }
 
     // Run benchmark
     uhd::rx_metadata_t md;
 
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    const auto start_time = std::chrono::steady_clock::now();
 
     for (size_t i = 0; i < iterations; i++) {
         streamer->recv(buffers, spp, md, 1.0, true);
@@ -431,8 +525,85 @@ void benchmark_rx_streamer(
     const std::chrono::duration<double> elapsed_time(end_time - start_time);
     const double time_per_packet = elapsed_time.count() / iterations;
 
-    std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
-              << time_per_packet * 1e9 << " ns/packet\n";
+    const size_t samps_per_packet = spp * streamer->get_num_channels();
+
+    std::cout << format << ": " << time_per_packet / samps_per_packet * 1e9
+              << " ns/sample, " << time_per_packet * 1e9 << " ns/packet\n";
+}
+
+/*!
+ * Benchmark of rx streamer, receiving packets without converting them
+ */
+void benchmark_rx_streamer_zero_copy(
+    rx_streamer::sptr streamer, const size_t spp, const size_t iterations = 1e7)
+{
+    rx_streamer::wire_buffs_type buffers;
+    uhd::rx_metadata_t md;
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < iterations; i++) {
+        streamer->get_recv_buffs(buffers, md, 1.0);
+        streamer->release_recv_buffs();
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed_time(end_time - start_time);
+    const double time_per_packet = elapsed_time.count() / iterations;
+
+    const size_t samps_per_packet = spp * streamer->get_num_channels();
+
+    std::cout << "zero copy: " << time_per_packet / samps_per_packet * 1e9
+              << " ns/sample, " << time_per_packet * 1e9 << " ns/packet\n";
+}
+
+/*!
+ * Benchmark of rx streamer, receiving all packets of a capture
+ */
+void benchmark_rx_streamer_replay(rx_streamer::sptr streamer,
+    chdr_replay_link::sptr link,
+    const std::string& format,
+    const size_t num_packets)
+{
+    const size_t spp = streamer->get_max_num_samps();
+    const size_t bpi = convert::get_bytes_per_item(format);
+    std::vector<uint8_t> buffer(spp * bpi);
+    uhd::rx_metadata_t md;
+
+    size_t num_samps = 0, num_recv_calls = 0, num_seq_errors = 0, num_eobs = 0;
+    const auto start_time = std::chrono::steady_clock::now();
+    auto end_time         = start_time;
+
+    while (true) {
+        const size_t num_rx = streamer->recv(buffer.data(), spp, md, 1.0, true);
+        if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_TIMEOUT) {
+            // A gap in the capture, or the end of it
+            if (link->get_num_replayed() >= num_packets) {
+                break;
+            }
+            continue;
+        }
+        end_time = std::chrono::steady_clock::now();
+        num_recv_calls++;
+        num_samps += num_rx;
+        if (md.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW
+            && md.out_of_sequence) {
+            num_seq_errors++;
+        }
+        if (md.end_of_burst) {
+            num_eobs++;
+        }
+    }
+
+    const std::chrono::duration<double> elapsed_time(end_time - start_time);
+    std::cout << format << ": " << link->get_num_replayed() << " packets, " << num_samps
+              << " samples in " << elapsed_time.count() << " s ("
+              << num_samps / elapsed_time.count() / 1e6 << " Msps, "
+              << elapsed_time.count() / std::max<size_t>(num_samps, 1) * 1e9
+              << " ns/sample, " << num_recv_calls << " recv calls)\n";
+    std::cout << "    " << num_seq_errors << " sequence errors, " << num_eobs
+              << " end of bursts, " << link->get_num_sent()
+              << " flow control packets sent\n";
 }
 
 /*!
@@ -441,20 +612,23 @@ void benchmark_rx_streamer(
 void benchmark_tx_streamer(tx_streamer::sptr streamer,
     const size_t spp,
     const std::string& format,
-    bool use_time_spec)
+    bool use_time_spec,
+    const size_t iterations = 1e7)
 {
-    // Allocate buffer
+    // Allocate buffers
     const size_t bpi = convert::get_bytes_per_item(format);
-    std::vector<uint8_t> buffer(spp * bpi);
+    std::vector<std::vector<uint8_t>> buffer(streamer->get_num_channels());
     std::vector<void*> buffers;
-    buffers.push_back(buffer.data());
+    for (auto& chan_buffer : buffer) {
+        chan_buffer.resize(spp * bpi);
+        buffers.push_back(chan_buffer.data());
+    }
 
     // Run benchmark
     uhd::tx_metadata_t md;
     md.has_time_spec = use_time_spec;
 
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    const auto start_time = std::chrono::steady_clock::now();
 
     for (size_t i = 0; i < iterations; i++) {
         if (use_time_spec) {
@@ -467,14 +641,77 @@ void benchmark_tx_streamer(tx_streamer::sptr streamer,
     const std::chrono::duration<double> elapsed_time(end_time - start_time);
     const double time_per_packet = elapsed_time.count() / iterations;
 
-    std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
-              << time_per_packet * 1e9 << " ns/packet\n";
+    const size_t samps_per_packet = spp * streamer->get_num_channels();
+
+    std::cout << format << ": " << time_per_packet / samps_per_packet * 1e9
+              << " ns/sample, " << time_per_packet * 1e9 << " ns/packet\n";
+}
+
+/*!
+ * Benchmark of rx and tx streamers with a varying number of channels and
+ * conversion threads
+ */
+void benchmark_convert_threads(const size_t spp,
+    const std::string& format,
+    const std::vector<size_t>& num_chans_list,
+    const std::vector<size_t>& convert_threads_list)
+{
+    // Keep the number of samples converted per run roughly constant
+    const size_t samps_per_run = 2e8;
+
+    for (const size_t num_chans : num_chans_list) {
+        const size_t iterations = samps_per_run / (spp * num_chans);
+        for (const size_t convert_threads : convert_threads_list) {
+            if (convert_threads > num_chans) {
+                continue;
+            }
+            std::cout << "chans: " << num_chans
+                      << ", convert_threads: " << convert_threads << "\n";
+            std::cout << "  recv ";
+            benchmark_rx_streamer(
+                make_rx_streamer_mock_xport(spp, format, num_chans, convert_threads),
+                spp,
+                format,
+                iterations);
+            std::cout << "  send ";
+            benchmark_tx_streamer(
+                make_tx_streamer_mock_xport(spp, format, num_chans, convert_threads),
+                spp,
+                format,
+                false,
+                iterations);
+        }
+    }
 }
 
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
+    std::string convert_threads_format;
+    size_t max_chans, max_convert_threads;
+    std::string replay_file, replay_format, replay_otw, replay_pacing, replay_hugepages;
+    size_t replay_loops, replay_chdr_w;
+    int replay_epid, replay_numa_node;
+    double replay_rate;
+
     po::options_description desc("Allowed options");
-    desc.add_options()("help", "help message");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("convert-threads-format", po::value<std::string>(&convert_threads_format)->default_value("fc32"), "host format for the convert_threads benchmark")
+        ("max-chans", po::value<size_t>(&max_chans)->default_value(16), "largest number of channels for the convert_threads benchmark")
+        ("max-convert-threads", po::value<size_t>(&max_convert_threads)->default_value(8), "largest number of conversion threads for the convert_threads benchmark")
+        ("replay-file", po::value<std::string>(&replay_file), "only run the receive benchmark, replaying the CHDR packets in this capture (.pcap for pcap files, raw captures otherwise)")
+        ("replay-format", po::value<std::string>(&replay_format)->default_value("fc32"), "host format for the replay benchmark")
+        ("replay-otw", po::value<std::string>(&replay_otw)->default_value("sc16"), "over-the-wire format of the captured data packets")
+        ("replay-chdr-w", po::value<size_t>(&replay_chdr_w)->default_value(64), "CHDR width of the captured packets in bits")
+        ("replay-epid", po::value<int>(&replay_epid)->default_value(-1), "destination EPID of the stream to replay (default: that of the first data packet)")
+        ("replay-loops", po::value<size_t>(&replay_loops)->default_value(1), "number of times to replay the capture")
+        ("replay-pacing", po::value<std::string>(&replay_pacing)->default_value("fast"), "fast: as fast as possible, capture: with the timing of the capture, rate: at --replay-rate")
+        ("replay-rate", po::value<double>(&replay_rate)->default_value(1.25e9), "link rate in bytes/s for --replay-pacing=rate")
+        ("replay-hugepages", po::value<std::string>(&replay_hugepages)->default_value("none"), "huge pages for the replay link's frame buffers (2M, 1G, or none)")
+        ("replay-numa-node", po::value<int>(&replay_numa_node)->default_value(-1), "NUMA node to bind the replay link's frame buffers to")
+    ;
+    // clang-format on
 
     po::variables_map vm;
     po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -490,6 +727,65 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
+    if (vm.count("replay-file")) {
+        const auto format = get_capture_format(replay_file);
+        auto capture = std::make_shared<chdr_capture_reader>(replay_file, format);
+        if (replay_epid < 0) {
+            for (size_t i = 0; i < capture->size(); i++) {
+                const chdr::chdr_header header(capture->get_header(i));
+                if (header.get_pkt_type() == chdr::PKT_TYPE_DATA_WITH_TS
+                    || header.get_pkt_type() == chdr::PKT_TYPE_DATA_NO_TS) {
+                    replay_epid = header.get_dst_epid();
+                    break;
+                }
+            }
+            if (replay_epid < 0) {
+                std::cout << "The capture does not contain data packets" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        // Only replay the packets of one stream
+        chdr_capture_reader::filter_t filter;
+        filter.dst_epid = static_cast<uint16_t>(replay_epid);
+        capture         = std::make_shared<chdr_capture_reader>(
+            replay_file, format, ENDIANNESS_LITTLE, filter);
+
+        chdr_replay_link::params_t params;
+        params.num_loops = replay_loops;
+        params.pacing    = replay_pacing == "capture"
+                               ? chdr_replay_link::pacing_t::CAPTURE_TIME
+                           : replay_pacing == "rate"
+                               ? chdr_replay_link::pacing_t::LINK_RATE
+                               : chdr_replay_link::pacing_t::AS_FAST_AS_POSSIBLE;
+        params.link_rate                 = replay_rate;
+        params.buff_mem_params.page_size = parse_buff_page_size(replay_hugepages);
+        params.buff_mem_params.numa_node = replay_numa_node;
+        auto link = chdr_replay_link::make(capture, params);
+
+        const chdr::chdr_packet_factory pkt_factory(
+            bits_to_chdr_w(replay_chdr_w), ENDIANNESS_LITTLE);
+        const sep_id_pair_t epids = {0, static_cast<sep_id_t>(replay_epid)};
+
+        std::cout << "----------------------------------------------------------\n";
+        std::cout << "Benchmark of recv with replayed capture                   \n";
+        std::cout << "                                                          \n";
+        std::cout << "   Measures time spent in the rx streamer, I/O service,   \n";
+        std::cout << "   chdr data xport, and link (copying packets).           \n";
+        std::cout << "----------------------------------------------------------\n";
+        const auto placement = link->get_recv_buff_placement();
+        std::cout << "EPID " << replay_epid << ", " << capture->size()
+                  << " packets per loop, frame buffers in pages of "
+                  << placement.page_size << " bytes on NUMA node "
+                  << placement.numa_node << "\n";
+        auto streamer = make_rx_streamer_replay_link(
+            link, replay_format, replay_otw, pkt_factory, epids);
+        benchmark_rx_streamer_replay(streamer,
+            link,
+            replay_format,
+            capture->size() * replay_loops);
+        return EXIT_SUCCESS;
+    }
+
     const char* formats[] = {"sc16", "fc32", "fc64"};
     constexpr size_t spp  = 1000;
     std::cout << "spp: " << spp << "\n";
@@ -506,6 +802,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         benchmark_rx_streamer(streamer, spp, formats[i]);
     }
 
+    benchmark_rx_streamer_zero_copy(make_rx_streamer_mock_xport(spp, "sc16"), spp);
+
     std::cout << "\n";
     std::cout << "----------------------------------------------------------\n";
     std::cout << "Benchmark of send with mock transport                     \n";
@@ -539,6 +837,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         auto streamer = make_rx_streamer_mock_link(spp, formats[i]);
         benchmark_rx_streamer(streamer, spp, formats[i]);
     }
+    benchmark_rx_streamer_zero_copy(make_rx_streamer_mock_link(spp, "sc16"), spp);
     std::cout << "\n";
 
     std::cout << "----------------------------------------------------------\n";
@@ -562,5 +861,24 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     }
     std::cout << "\n";
 
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of multi-channel conversion with mock transport \n";
+    std::cout << "                                                          \n";
+    std::cout << "   Measures how recv and send scale with the number of    \n";
+    std::cout << "   channels and the convert_threads stream arg.           \n";
+    std::cout << "----------------------------------------------------------\n";
+
+    std::vector<size_t> num_chans_list;
+    for (size_t num_chans = 1; num_chans <= max_chans; num_chans *= 2) {
+        num_chans_list.push_back(num_chans);
+    }
+    std::vector<size_t> convert_threads_list;
+    for (size_t threads = 1; threads <= max_convert_threads; threads *= 2) {
+        convert_threads_list.push_back(threads);
+    }
+    benchmark_convert_threads(
+        spp, convert_threads_format, num_chans_list, convert_threads_list);
+    std::cout << "\n";
+
     return EXIT_SUCCESS;
 }
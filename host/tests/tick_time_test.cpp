@@ -0,0 +1,163 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/types/tick_time.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <limits>
+
+using rate_t = uhd::tick_time_t::rate_t;
+
+BOOST_AUTO_TEST_CASE(test_tick_rate)
+{
+    BOOST_CHECK_EQUAL(rate_t(200000000).get_num(), 200000000u);
+    BOOST_CHECK_EQUAL(rate_t(200000000).get_den(), 1u);
+    // Fractions are reduced
+    BOOST_CHECK_EQUAL(rate_t(400000000, 6).get_num(), 200000000u);
+    BOOST_CHECK_EQUAL(rate_t(400000000, 6).get_den(), 3u);
+    BOOST_CHECK(rate_t(400000000, 6) == rate_t(200000000, 3));
+    BOOST_CHECK(rate_t(200000000, 3) != rate_t(200000000));
+    BOOST_CHECK_THROW(rate_t(0), uhd::value_error);
+    BOOST_CHECK_THROW(rate_t(1, 0), uhd::value_error);
+
+    BOOST_CHECK(rate_t::from_double(200e6) == rate_t(200000000));
+    BOOST_CHECK(rate_t::from_double(245.76e6) == rate_t(245760000));
+    BOOST_CHECK(rate_t::from_double(200e6 / 3) == rate_t(200000000, 3));
+    BOOST_CHECK(rate_t::from_double(184.32e6 / 7) == rate_t(184320000, 7));
+    BOOST_CHECK(rate_t::from_double(0.5) == rate_t(1, 2));
+    BOOST_CHECK_EQUAL(rate_t(200000000, 3).to_double(), 200e6 / 3);
+    BOOST_CHECK_THROW(rate_t::from_double(0.0), uhd::value_error);
+    BOOST_CHECK_THROW(rate_t::from_double(-1.0), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_tick_time_arithmetic)
+{
+    const rate_t tick_rate(200000000);
+    const rate_t samp_rate(50000000);
+
+    uhd::tick_time_t time(1000, tick_rate);
+    time += uhd::tick_time_t(10, tick_rate);
+    BOOST_CHECK_EQUAL(time.get_ticks(), 1010);
+    BOOST_CHECK(time.get_rate() == tick_rate);
+
+    // Samples at an integer fraction of the tick rate keep the tick rate
+    time += uhd::tick_time_t(3, samp_rate);
+    BOOST_CHECK_EQUAL(time.get_ticks(), 1022);
+    BOOST_CHECK(time.get_rate() == tick_rate);
+    time -= uhd::tick_time_t(3, samp_rate);
+    BOOST_CHECK_EQUAL(time.get_ticks(), 1010);
+
+    // Samples which don't align to ticks move to a finer rate
+    const uhd::tick_time_t sum =
+        uhd::tick_time_t(1, tick_rate) + uhd::tick_time_t(1, rate_t(200000000, 3));
+    BOOST_CHECK_EQUAL(sum.get_ticks(), 4);
+    BOOST_CHECK(sum.get_rate() == tick_rate);
+    const uhd::tick_time_t fine =
+        uhd::tick_time_t(1, rate_t(3)) + uhd::tick_time_t(1, rate_t(2));
+    BOOST_CHECK_EQUAL(fine.get_ticks(), 5);
+    BOOST_CHECK(fine.get_rate() == rate_t(6));
+
+    // Equality is independent of the rate
+    BOOST_CHECK(uhd::tick_time_t(4, tick_rate) == uhd::tick_time_t(1, samp_rate));
+    BOOST_CHECK(uhd::tick_time_t(5, tick_rate) != uhd::tick_time_t(1, samp_rate));
+}
+
+BOOST_AUTO_TEST_CASE(test_tick_time_overflow)
+{
+    const rate_t tick_rate(200000000);
+    const rate_t samp_rate(50000000);
+    constexpr int64_t max_ticks = std::numeric_limits<int64_t>::max();
+
+    // Scaling samples by 4 to the tick rate still fits right below the limit
+    uhd::tick_time_t time(0, tick_rate);
+    time += uhd::tick_time_t(max_ticks / 4, samp_rate);
+    BOOST_CHECK_EQUAL(time.get_ticks(), max_ticks / 4 * 4);
+    // ...but not one sample later
+    uhd::tick_time_t big(max_ticks / 4 + 1, samp_rate);
+    BOOST_CHECK_THROW(time -= big, uhd::overflow_error);
+    BOOST_CHECK_THROW(big += uhd::tick_time_t(0, tick_rate), uhd::overflow_error);
+    BOOST_CHECK_THROW(uhd::tick_time_t(-max_ticks / 2, samp_rate)
+                          == uhd::tick_time_t(0, tick_rate),
+        uhd::overflow_error);
+    // A failed conversion leaves the time untouched
+    BOOST_CHECK_EQUAL(big.get_ticks(), max_ticks / 4 + 1);
+    BOOST_CHECK(big.get_rate() == samp_rate);
+
+    // Coprime rates whose common rate doesn't fit into 64 bits
+    const rate_t rate_a(uint64_t(1) << 40);
+    const rate_t rate_b((uint64_t(1) << 40) - 1);
+    BOOST_CHECK_THROW(
+        uhd::tick_time_t(1, rate_a) + uhd::tick_time_t(1, rate_b), uhd::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_tick_time_add_rounded)
+{
+    // A late timestamp and sample rates which don't divide the tick rate. Their
+    // common rate is out of range, so the offset is rounded to ticks instead.
+    const double tick_rate    = 245.76e6;
+    const int64_t tsf         = int64_t(1700000000) * 245760000;
+    const size_t num_samps    = 100;
+    const double samp_rates[] = {1.5e6, 200e6 / 7, 3.2000003e6};
+    for (const double samp_rate : samp_rates) {
+        const uhd::tick_time_t offset(num_samps, rate_t::from_double(samp_rate));
+        uhd::tick_time_t time(tsf, rate_t::from_double(tick_rate));
+        BOOST_CHECK_THROW(time += offset, uhd::overflow_error);
+        BOOST_CHECK(!time.add_rounded(offset));
+        BOOST_CHECK_EQUAL(
+            time.get_ticks(), tsf + std::llround(num_samps * tick_rate / samp_rate));
+        BOOST_CHECK(time.get_rate() == rate_t::from_double(tick_rate));
+    }
+
+    // Sums which fit are exact, like operator+=()
+    uhd::tick_time_t time(1000, rate_t(245760000));
+    BOOST_CHECK(time.add_rounded(uhd::tick_time_t(1, rate_t(1500000))));
+    BOOST_CHECK_EQUAL(time.get_ticks(), 1000 * 25 + 4096);
+    BOOST_CHECK(time.get_rate() == rate_t(uint64_t(245760000) * 25));
+}
+
+BOOST_AUTO_TEST_CASE(test_tick_time_no_drift)
+{
+    // Adding up packets of samples for a long time must not accumulate errors
+    const rate_t tick_rate(245760000);
+    const rate_t samp_rate(245760000, 2);
+    const size_t spp         = 1996;
+    const size_t num_packets = 100000000;
+    uhd::tick_time_t time(0, tick_rate);
+    for (size_t i = 0; i < 1000; i++) {
+        time += uhd::tick_time_t(spp, samp_rate);
+    }
+    BOOST_CHECK_EQUAL(time.get_ticks(), int64_t(1000 * spp * 2));
+    time = uhd::tick_time_t(int64_t(num_packets * spp * 2), tick_rate);
+    time += uhd::tick_time_t(spp, samp_rate);
+    BOOST_CHECK_EQUAL(time.get_ticks(), int64_t((num_packets + 1) * spp * 2));
+}
+
+BOOST_AUTO_TEST_CASE(test_tick_time_to_time_spec)
+{
+    const rate_t tick_rate(200000000);
+    const uhd::time_spec_t ts = uhd::tick_time_t(300000050, tick_rate).to_time_spec();
+    BOOST_CHECK_EQUAL(ts.get_full_secs(), 1);
+    BOOST_CHECK_EQUAL(ts.to_ticks(200e6), 300000050);
+
+    // Whole seconds stay exact for large tick counts
+    const int64_t ticks = int64_t(10) * 365 * 24 * 3600 * 200000000 + 7;
+    const uhd::time_spec_t late = uhd::tick_time_t(ticks, tick_rate).to_time_spec();
+    BOOST_CHECK_EQUAL(late.get_full_secs(), int64_t(10) * 365 * 24 * 3600);
+    BOOST_CHECK_CLOSE(late.get_frac_secs(), 7 / 200e6, 1e-6);
+
+    // Negative times round towards minus infinity, like time_spec_t
+    const uhd::time_spec_t neg = uhd::tick_time_t(-1, tick_rate).to_time_spec();
+    BOOST_CHECK_EQUAL(neg.get_full_secs(), -1);
+    BOOST_CHECK_CLOSE(neg.get_frac_secs(), 1 - 1 / 200e6, 1e-9);
+
+    // Rates which are fractions
+    const uhd::time_spec_t frac =
+        uhd::tick_time_t(200000003, rate_t(200000000, 3)).to_time_spec();
+    BOOST_CHECK_EQUAL(frac.get_full_secs(), 3);
+    BOOST_CHECK_CLOSE(frac.get_frac_secs(), 9 / 200e6, 1e-6);
+    BOOST_CHECK_EQUAL(uhd::tick_time_t().to_time_spec().get_real_secs(), 0.0);
+}
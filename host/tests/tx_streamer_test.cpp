@@ -50,9 +50,13 @@ public:
         return std::make_pair(data + sizeof(info), sizeof(info) + info.payload_bytes);
     }
 
-    void release_send_buff(buff_t::uptr buff)
+    void release_send_buff(buff_t::uptr buff, const bool flush = false)
     {
-        _send_link->release_send_buff(std::move(buff));
+        if (flush) {
+            _send_link->release_send_buff(std::move(buff));
+        } else {
+            _send_link->release_send_buff_deferred(std::move(buff));
+        }
     }
 
     size_t get_mtu() const
@@ -150,9 +154,12 @@ static std::vector<mock_send_link::sptr> make_links(const size_t num)
 }
 
 static std::shared_ptr<mock_tx_streamer> make_tx_streamer(
-    std::vector<mock_send_link::sptr> send_links, const std::string& format)
+    std::vector<mock_send_link::sptr> send_links,
+    const std::string& format,
+    const uhd::device_addr_t& args = uhd::device_addr_t())
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args = args;
     auto streamer = std::make_shared<mock_tx_streamer>(send_links.size(), stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
@@ -583,6 +590,29 @@ BOOST_AUTO_TEST_CASE(test_send_one_channel_multi_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_batched_flush)
+{
+    // A link which would queue up to 8 packets
+    const mock_send_link::link_params params = {FRAME_SIZE, 8, 8};
+    std::vector<mock_send_link::sptr> send_links{
+        std::make_shared<mock_send_link>(params)};
+    auto streamer = make_tx_streamer(send_links, "fc32");
+
+    uhd::tx_metadata_t metadata;
+    const size_t spp = streamer->get_max_num_samps();
+    std::vector<std::complex<float>> buff(spp * 3);
+
+    // All packets must be on the wire once send() returns, even without EOB
+    for (size_t i = 0; i < 2; i++) {
+        const size_t num_sent = streamer->send(&buff.front(), buff.size(), metadata, 1.0);
+        BOOST_CHECK_EQUAL(num_sent, buff.size());
+        BOOST_CHECK_EQUAL(send_links[0]->get_num_packets(), 3 * (i + 1));
+    }
+    for (size_t i = 0; i < 6; i++) {
+        BOOST_CHECK(!std::get<0>(pop_send_packet(send_links[0])).eob);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_send_two_channel_one_packet)
 {
     const size_t NUM_PKTS_TO_TEST = 30;
@@ -645,6 +675,55 @@ BOOST_AUTO_TEST_CASE(test_send_two_channel_one_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_multi_channel_convert_threads)
+{
+    // Test that converting channels on multiple threads sends the same data
+    const size_t NUM_PKTS_TO_TEST = 10;
+    const std::string format("sc16");
+
+    const size_t num_chans = 8;
+
+    auto send_links = make_links(num_chans);
+    auto streamer   = make_tx_streamer(
+        send_links, format, uhd::device_addr_t("convert_threads=3"));
+
+    // Allocate buffers and write different data to each channel
+    const size_t num_samps = 20;
+    std::vector<std::vector<std::complex<uint16_t>>> buff(num_chans);
+    std::vector<void*> buffs;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        for (size_t i = 0; i < num_samps; i++) {
+            const size_t n = ch * 100 + i;
+            buff[ch].push_back(std::complex<uint16_t>(n * 2, n * 2 + 1));
+        }
+        buffs.push_back(buff[ch].data());
+    }
+
+    uhd::tx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        metadata.end_of_burst = (i == NUM_PKTS_TO_TEST - 1);
+        const size_t num_sent = streamer->send(buffs, num_samps, metadata, 1.0);
+        BOOST_CHECK_EQUAL(num_sent, num_samps);
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            mock_tx_data_xport::packet_info_t info;
+            std::complex<uint16_t>* data;
+            size_t packet_samps;
+            boost::shared_array<uint8_t> frame_buff;
+
+            std::tie(info, data, packet_samps, frame_buff) =
+                pop_send_packet(send_links[ch]);
+            BOOST_CHECK_EQUAL(num_samps, packet_samps);
+            BOOST_CHECK_EQUAL(info.eob, i == NUM_PKTS_TO_TEST - 1);
+
+            for (size_t j = 0; j < num_samps; j++) {
+                BOOST_CHECK_EQUAL(buff[ch][j], data[j]);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_meta_data_cache)
 {
     auto send_links = make_links(1);
@@ -0,0 +1,357 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <uhdlib/transport/udp_common.hpp>
+#ifdef HAVE_XDP
+#    include <uhdlib/transport/udp_xdp_link.hpp>
+#    include <fcntl.h>
+#    include <sched.h>
+#    include <unistd.h>
+#endif
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace po   = boost::program_options;
+namespace asio = boost::asio;
+using namespace uhd::transport;
+
+static const std::string LOOPBACK_ADDR = "127.0.0.1";
+
+/*!
+ * UDP sender. Sends packets to a port as fast as possible from its own thread
+ * until it goes out of scope. The sender's socket may be in another network
+ * namespace, e.g., at the other end of a veth pair.
+ */
+class loopback_sender
+{
+public:
+    loopback_sender(const size_t frame_size,
+        const std::string& addr  = LOOPBACK_ADDR,
+        const std::string& netns = "")
+        : _socket(_io_context), _addr(addr), _frame(frame_size)
+    {
+        if (netns.empty()) {
+            _socket.open(asio::ip::udp::v4());
+        } else {
+            _open_in_netns(netns);
+        }
+        _socket.bind(asio::ip::udp::endpoint(asio::ip::make_address(_addr), 0));
+    }
+
+    ~loopback_sender()
+    {
+        _running = false;
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+    }
+
+    std::string get_addr() const
+    {
+        return _addr;
+    }
+
+    std::string get_port() const
+    {
+        return std::to_string(_socket.local_endpoint().port());
+    }
+
+    void start(const std::string& dst_addr, const uint16_t dst_port)
+    {
+        _socket.connect(
+            asio::ip::udp::endpoint(asio::ip::make_address(dst_addr), dst_port));
+        _running = true;
+        _thread  = std::thread([this]() {
+            const int sock_fd = _socket.native_handle();
+            while (_running) {
+                // Errors (e.g., ENOBUFS) are ignored, we just try again
+                ::send(sock_fd, (const char*)_frame.data(), _frame.size(), 0);
+            }
+        });
+    }
+
+    void start(const uint16_t dst_port)
+    {
+        start(LOOPBACK_ADDR, dst_port);
+    }
+
+private:
+    //! Create the socket in a network namespace, it stays there when used later
+    void _open_in_netns(const std::string& netns)
+    {
+#ifdef HAVE_XDP
+        const int own_fd = ::open("/proc/self/ns/net", O_RDONLY);
+        const int ns_fd  = ::open(("/var/run/netns/" + netns).c_str(), O_RDONLY);
+        if (own_fd < 0 || ns_fd < 0 || ::setns(ns_fd, CLONE_NEWNET) != 0) {
+            throw std::runtime_error("Cannot enter network namespace " + netns);
+        }
+        _socket.open(asio::ip::udp::v4());
+        ::setns(own_fd, CLONE_NEWNET);
+        ::close(ns_fd);
+        ::close(own_fd);
+#else
+        throw std::runtime_error("Network namespaces are only supported with XDP");
+#endif
+    }
+
+    asio::io_context _io_context;
+    asio::ip::udp::socket _socket;
+    const std::string _addr;
+    std::vector<uint8_t> _frame;
+    std::atomic<bool> _running{false};
+    std::thread _thread;
+};
+
+//! Return the rate at which packets are received from a link
+double measure_recv_rate(recv_link_if& link, const double duration)
+{
+    size_t num_packets    = 0;
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto end_time   = start_time + std::chrono::duration<double>(duration);
+    while (std::chrono::steady_clock::now() < end_time) {
+        auto buff = link.get_recv_buff(100);
+        if (buff) {
+            num_packets++;
+            link.release_recv_buff(std::move(buff));
+        }
+    }
+    const std::chrono::duration<double> elapsed_time(
+        std::chrono::steady_clock::now() - start_time);
+    return num_packets / elapsed_time.count();
+}
+
+//! Return the rate at which packets are sent through a link
+double measure_send_rate(send_link_if& link, const double duration)
+{
+    size_t num_packets    = 0;
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto end_time   = start_time + std::chrono::duration<double>(duration);
+    while (std::chrono::steady_clock::now() < end_time) {
+        auto buff = link.get_send_buff(100);
+        if (buff) {
+            buff->set_packet_size(link.get_send_frame_size());
+            link.release_send_buff_deferred(std::move(buff));
+            num_packets++;
+        }
+    }
+    link.flush_send_buffs();
+    const std::chrono::duration<double> elapsed_time(
+        std::chrono::steady_clock::now() - start_time);
+    return num_packets / elapsed_time.count();
+}
+
+/*!
+ * Benchmark of udp_recv_batcher on a bare socket
+ */
+void benchmark_recv_batcher(
+    const size_t batch_size, const size_t frame_size, const double duration)
+{
+    loopback_sender sender(frame_size);
+    asio::io_context io_context;
+    auto socket  = open_udp_socket(LOOPBACK_ADDR, sender.get_port(), io_context);
+    auto recv_fn = [socket](size_t size) {
+        return resize_udp_socket_buffer<asio::socket_base::receive_buffer_size>(
+            socket, size);
+    };
+    resize_udp_socket_buffer_with_warning(recv_fn, UDP_DEFAULT_BUFF_SIZE, "recv");
+
+    std::vector<std::vector<uint8_t>> memory(batch_size + 1);
+    std::vector<void*> staging_frames;
+    for (size_t i = 0; i < batch_size; i++) {
+        memory[i].resize(frame_size);
+        staging_frames.push_back(memory[i].data());
+    }
+    memory[batch_size].resize(frame_size);
+    void* frame = memory[batch_size].data();
+
+    udp_recv_batcher batcher(socket->native_handle(), frame_size, staging_frames);
+    sender.start(socket->local_endpoint().port());
+
+    size_t num_packets    = 0;
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto end_time   = start_time + std::chrono::duration<double>(duration);
+    while (std::chrono::steady_clock::now() < end_time) {
+        if (batcher.recv(frame, 100) > 0) {
+            num_packets++;
+        }
+    }
+    const std::chrono::duration<double> elapsed_time(
+        std::chrono::steady_clock::now() - start_time);
+
+    std::cout << boost::format("batch size %4d: %10.0f packets/s, %.3f syscalls/packet")
+                     % batch_size % (num_packets / elapsed_time.count())
+                     % (double(batcher.get_num_syscalls()) / batcher.get_num_packets())
+              << std::endl;
+}
+
+//! Return the parameters of the links under test
+link_params_t make_link_params(const size_t frame_size, const size_t batch_size)
+{
+    link_params_t params;
+    params.recv_frame_size = frame_size;
+    params.send_frame_size = frame_size;
+    params.num_recv_frames = 32;
+    params.num_send_frames = 32;
+    params.recv_buff_size  = UDP_DEFAULT_BUFF_SIZE;
+    params.send_buff_size  = UDP_DEFAULT_BUFF_SIZE;
+    params.recv_batch_size = batch_size;
+    params.send_batch_size = batch_size;
+    return params;
+}
+
+/*!
+ * Benchmark of udp_boost_asio_link
+ */
+void benchmark_udp_link(const size_t batch_size,
+    const size_t frame_size,
+    const double duration,
+    const std::string& sender_addr,
+    const std::string& sender_netns)
+{
+    loopback_sender sender(frame_size, sender_addr, sender_netns);
+    const link_params_t params = make_link_params(frame_size, batch_size);
+
+    size_t recv_socket_buff_size = 0;
+    size_t send_socket_buff_size = 0;
+    auto link                    = udp_boost_asio_link::make(sender.get_addr(),
+        sender.get_port(),
+        params,
+        recv_socket_buff_size,
+        send_socket_buff_size);
+    sender.start(link->get_local_addr(), link->get_local_port());
+    const double recv_rate = measure_recv_rate(*link, duration);
+    const double send_rate = measure_send_rate(*link, duration);
+
+    std::cout << boost::format("batch size %4d: recv %10.0f packets/s, "
+                               "send %10.0f packets/s")
+                     % batch_size % recv_rate % send_rate
+              << std::endl;
+}
+
+#ifdef HAVE_XDP
+/*!
+ * Benchmark of udp_xdp_link
+ */
+void benchmark_xdp_link(const size_t batch_size,
+    const size_t frame_size,
+    const double duration,
+    const std::string& sender_addr,
+    const std::string& sender_netns,
+    const udp_xdp_link::xdp_params_t& xdp_params)
+{
+    loopback_sender sender(frame_size, sender_addr, sender_netns);
+    // Like the devices, buffer as much as the UDP link's socket buffer holds
+    link_params_t params   = make_link_params(frame_size, batch_size);
+    params.num_recv_frames = params.recv_buff_size / frame_size;
+
+    auto link = udp_xdp_link::make(
+        sender.get_addr(), sender.get_port(), params, xdp_params);
+    sender.start(link->get_local_addr(), link->get_local_port());
+    const double recv_rate = measure_recv_rate(*link, duration);
+    const double send_rate = measure_send_rate(*link, duration);
+
+    std::cout << boost::format("batch size %4d: recv %10.0f packets/s, "
+                               "send %10.0f packets/s (%s)")
+                     % batch_size % recv_rate % send_rate
+                     % (link->is_zero_copy() ? "zero-copy" : "copy")
+              << std::endl;
+}
+#endif
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    double duration;
+    size_t frame_size;
+    std::string sender_addr, sender_netns, xdp_args;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("duration", po::value<double>(&duration)->default_value(2.0), "duration of each run in seconds")
+        ("frame-size", po::value<size_t>(&frame_size)->default_value(1472), "UDP payload size in bytes")
+        ("sender-addr", po::value<std::string>(&sender_addr)->default_value(LOOPBACK_ADDR), "IP address of the sender")
+        ("sender-netns", po::value<std::string>(&sender_netns)->default_value(""), "network namespace of the sender (see ip netns)")
+        ("xdp", "also benchmark the AF_XDP link (needs CAP_NET_ADMIN and CAP_BPF)")
+        ("xdp-args", po::value<std::string>(&xdp_args)->default_value("xdp_mode=generic"), "AF_XDP link arguments, e.g., xdp_queue=1,xdp_busy_poll=50")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // Print the help message
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD UDP Receive Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of batched UDP receive. Packets are sent over\n"
+                     "    the loopback interface from a separate thread. No\n"
+                     "    hardware is needed to run this benchmark.\n"
+                     "\n"
+                     "    To compare the UDP and AF_XDP links on a real network\n"
+                     "    driver, put one end of a veth pair into a namespace:\n"
+                     "      ip netns add uhd-bench\n"
+                     "      ip link add veth0 type veth peer name veth1 netns uhd-bench\n"
+                     "      ip addr add 10.99.0.1/24 dev veth0 && ip link set veth0 up\n"
+                     "      ip -n uhd-bench addr add 10.99.0.2/24 dev veth1\n"
+                     "      ip -n uhd-bench link set veth1 up\n"
+                     "    and run with --xdp --sender-netns uhd-bench\n"
+                     "    --sender-addr 10.99.0.2 --xdp-args xdp_mode=native\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const size_t batch_sizes[] = {1, 4, 16, 64};
+
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of batched receive on a bare socket             \n";
+    std::cout << "                                                          \n";
+    std::cout << "   Measures packet rate and receive system calls.         \n";
+    std::cout << "----------------------------------------------------------\n";
+    for (const size_t batch_size : batch_sizes) {
+        benchmark_recv_batcher(batch_size, frame_size, duration);
+    }
+    std::cout << "\n";
+
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of udp_boost_asio_link                          \n";
+    std::cout << "                                                          \n";
+    std::cout << "   Measures packet rates through the link interface.      \n";
+    std::cout << "----------------------------------------------------------\n";
+    for (const size_t batch_size : batch_sizes) {
+        benchmark_udp_link(batch_size, frame_size, duration, sender_addr, sender_netns);
+    }
+    std::cout << "\n";
+
+    if (vm.count("xdp")) {
+#ifdef HAVE_XDP
+        const auto xdp_params =
+            udp_xdp_link::get_xdp_params(uhd::device_addr_t(xdp_args), {});
+        std::cout << "----------------------------------------------------------\n";
+        std::cout << "Benchmark of udp_xdp_link                                 \n";
+        std::cout << "                                                          \n";
+        std::cout << "   Measures packet rates through the link interface.      \n";
+        std::cout << "----------------------------------------------------------\n";
+        for (const size_t batch_size : batch_sizes) {
+            benchmark_xdp_link(
+                batch_size, frame_size, duration, sender_addr, sender_netns, xdp_params);
+        }
+        std::cout << "\n";
+#else
+        std::cout << "AF_XDP support is not built in." << std::endl;
+#endif
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/transport/udp_xdp_link.hpp>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+using namespace uhd::transport;
+namespace asio = boost::asio;
+
+namespace {
+
+const std::string LOOPBACK_ADDR = "127.0.0.1";
+
+link_params_t make_link_params()
+{
+    link_params_t params;
+    params.recv_frame_size = 1472;
+    params.send_frame_size = 1472;
+    params.num_recv_frames = 8;
+    params.num_send_frames = 8;
+    params.send_batch_size = 4;
+    return params;
+}
+
+//! Return a link on the loopback interface, or nullptr without privileges
+udp_xdp_link::sptr make_loopback_link(const uint16_t remote_port)
+{
+    udp_xdp_link::xdp_params_t xdp_params;
+    xdp_params.mode = udp_xdp_link::xdp_mode_t::GENERIC;
+    try {
+        return udp_xdp_link::make(
+            LOOPBACK_ADDR, std::to_string(remote_port), make_link_params(), xdp_params);
+    } catch (const uhd::runtime_error& ex) {
+        std::cout << "Skipping the AF_XDP loopback test: " << ex.what() << std::endl;
+        return nullptr;
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_xdp_params)
+{
+    const auto defaults = udp_xdp_link::get_xdp_params({}, {});
+    BOOST_CHECK(defaults.mode == udp_xdp_link::xdp_mode_t::AUTO);
+    BOOST_CHECK_EQUAL(defaults.queue_id, 0);
+    BOOST_CHECK_EQUAL(defaults.chunk_size, 4096);
+    BOOST_CHECK_EQUAL(defaults.busy_poll_us, 0);
+    BOOST_CHECK_EQUAL(udp_xdp_link::get_max_frame_size(defaults), 4096 - 256 - 42);
+
+    // Stream arguments take precedence over device arguments
+    const auto params = udp_xdp_link::get_xdp_params(
+        uhd::device_addr_t("xdp_mode=native,xdp_queue=2,xdp_busy_poll=50"),
+        uhd::device_addr_t("xdp_queue=3,xdp_chunk_size=2048"));
+    BOOST_CHECK(params.mode == udp_xdp_link::xdp_mode_t::NATIVE);
+    BOOST_CHECK_EQUAL(params.queue_id, 3);
+    BOOST_CHECK_EQUAL(params.chunk_size, 2048);
+    BOOST_CHECK_EQUAL(params.busy_poll_us, 50);
+
+    BOOST_CHECK_THROW(
+        udp_xdp_link::get_xdp_params(uhd::device_addr_t("xdp_mode=fast"), {}),
+        uhd::value_error);
+    BOOST_CHECK_THROW(
+        udp_xdp_link::get_xdp_params(uhd::device_addr_t("xdp_chunk_size=3000"), {}),
+        uhd::value_error);
+    BOOST_CHECK_THROW(
+        udp_xdp_link::get_xdp_params(uhd::device_addr_t("xdp_queue=abc"), {}),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_frame_size_limit)
+{
+    link_params_t params = make_link_params();
+    params.recv_frame_size = 8000;
+    BOOST_CHECK_THROW(udp_xdp_link::make(LOOPBACK_ADDR, "49153", params, {}),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_loopback)
+{
+    asio::io_context io_context;
+    asio::ip::udp::socket peer(io_context);
+    peer.open(asio::ip::udp::v4());
+    peer.bind(asio::ip::udp::endpoint(asio::ip::make_address(LOOPBACK_ADDR), 0));
+
+    auto link = make_loopback_link(peer.local_endpoint().port());
+    if (!link) {
+        return;
+    }
+    BOOST_CHECK_EQUAL(link->get_local_addr(), LOOPBACK_ADDR);
+    peer.connect(asio::ip::udp::endpoint(
+        asio::ip::make_address(LOOPBACK_ADDR), link->get_local_port()));
+
+    // Receive more packets than there are frame buffers
+    for (uint8_t i = 0; i < 32; i++) {
+        std::vector<uint8_t> packet(100 + i);
+        std::iota(packet.begin(), packet.end(), i);
+        peer.send(asio::buffer(packet));
+        auto buff = link->get_recv_buff(1000);
+        BOOST_REQUIRE(buff);
+        BOOST_CHECK_EQUAL(buff->packet_size(), packet.size());
+        BOOST_CHECK(std::memcmp(buff->data(), packet.data(), packet.size()) == 0);
+        link->release_recv_buff(std::move(buff));
+    }
+    BOOST_CHECK(!link->get_recv_buff(10));
+
+    // Packets from other senders are dropped
+    asio::ip::udp::socket other(io_context);
+    other.open(asio::ip::udp::v4());
+    other.send_to(asio::buffer(std::vector<uint8_t>(64)),
+        asio::ip::udp::endpoint(
+            asio::ip::make_address(LOOPBACK_ADDR), link->get_local_port()));
+    BOOST_CHECK(!link->get_recv_buff(10));
+
+    // Send single and batched packets, and release a buffer without a packet.
+    // Packets sent on the loopback interface without a route are dropped by
+    // the kernel, so they are captured with a packet socket instead.
+    const int capture_fd = ::socket(AF_PACKET, SOCK_RAW, htons(ETH_P_IP));
+    BOOST_REQUIRE(capture_fd >= 0);
+    sockaddr_ll capture_addr = {};
+    capture_addr.sll_family   = AF_PACKET;
+    capture_addr.sll_protocol = htons(ETH_P_IP);
+    capture_addr.sll_ifindex  = static_cast<int>(if_nametoindex("lo"));
+    BOOST_REQUIRE(::bind(capture_fd,
+                      reinterpret_cast<sockaddr*>(&capture_addr),
+                      sizeof(capture_addr))
+                  == 0);
+
+    auto empty_buff = link->get_send_buff(100);
+    BOOST_REQUIRE(empty_buff);
+    link->release_send_buff(std::move(empty_buff));
+    for (uint8_t i = 0; i < 32; i++) {
+        auto buff = link->get_send_buff(100);
+        BOOST_REQUIRE(buff);
+        std::memset(buff->data(), i, 200);
+        buff->set_packet_size(200);
+        if (i % 2) {
+            link->release_send_buff_deferred(std::move(buff));
+        } else {
+            link->release_send_buff(std::move(buff));
+        }
+    }
+    link->flush_send_buffs();
+
+    const uint16_t peer_port = peer.local_endpoint().port();
+    std::vector<uint8_t> frame(2000);
+    uint8_t next = 0;
+    while (next < 32) {
+        pollfd pfd = {capture_fd, POLLIN, 0};
+        BOOST_REQUIRE(::poll(&pfd, 1, 1000) > 0);
+        const ssize_t size = ::recv(capture_fd, frame.data(), frame.size(), 0);
+        // Skip other traffic on the loopback interface
+        if (size < 42 || frame[23] != IPPROTO_UDP
+            || ((frame[36] << 8) | frame[37]) != peer_port) {
+            continue;
+        }
+        BOOST_REQUIRE_EQUAL(size, 42 + 200);
+        // IPv4 header with checksum, UDP length, and payload
+        uint32_t sum = 0;
+        for (size_t j = 14; j < 34; j += 2) {
+            sum += (frame[j] << 8) | frame[j + 1];
+        }
+        BOOST_CHECK_EQUAL((sum & 0xFFFF) + (sum >> 16), 0xFFFF);
+        BOOST_CHECK_EQUAL((frame[16] << 8) | frame[17], 20 + 8 + 200);
+        BOOST_CHECK_EQUAL(
+            (frame[34] << 8) | frame[35], link->get_local_port());
+        BOOST_CHECK_EQUAL((frame[38] << 8) | frame[39], 8 + 200);
+        BOOST_CHECK_EQUAL(frame[42], next);
+        BOOST_CHECK_EQUAL(frame[241], next);
+        next++;
+    }
+    ::close(capture_fd);
+}
@@ -153,3 +153,37 @@ BOOST_FIXTURE_TEST_CASE(zbx_set_from_table_test, zbx_cpld_fixture)
     cpld.set_tx_gain_switches(chan, idx, 23);
     BOOST_REQUIRE_EQUAL(tx_table_select, 23);
 }
+
+BOOST_FIXTURE_TEST_CASE(zbx_lo_poke16_batch_test, zbx_cpld_fixture)
+{
+    constexpr uint32_t lo_spi_addr = 0x1020;
+    // Seconds slept since the start of the test
+    const double start_time = mock_reg_iface.sleep_counter.get_real_secs();
+    auto slept              = [&]() {
+        return mock_reg_iface.sleep_counter.get_real_secs() - start_time;
+    };
+
+    cpld.lo_poke16(zbx_lo_t::RX1_LO2, {{0x4B, 0x0800}, {0x2C, 0x0123}, {0x00, 0x251C}});
+    // Only the writes in between are throttled
+    BOOST_CHECK_CLOSE(slept(), 4e-6, 1e-3);
+    BOOST_CHECK_EQUAL(mock_reg_iface.last_addr, lo_spi_addr);
+    BOOST_CHECK(mock_reg_iface.last_chan == zbx_cpld_ctrl::CHAN1);
+    const uint32_t spi_reg = mock_reg_iface.memory.at(lo_spi_addr);
+    BOOST_CHECK_EQUAL(spi_reg & 0xFFFF, 0x251C); // DATA
+    BOOST_CHECK_EQUAL((spi_reg >> 16) & 0x7F, 0x00); // ADDRESS
+    BOOST_CHECK_EQUAL((spi_reg >> 23) & 0x1, 0); // READ_FLAG (write)
+    BOOST_CHECK_EQUAL((spi_reg >> 24) & 0x7, 7); // LO_SELECT (RX1_LO2)
+    BOOST_CHECK_EQUAL((spi_reg >> 28) & 0x1, 1); // START_TRANSACTION
+
+    // The next SPI transaction catches up on the throttle of the last write
+    cpld.lo_poke16(zbx_lo_t::TX0_LO1, 0x01, 0x0808);
+    BOOST_CHECK_CLOSE(slept(), 8e-6, 1e-3);
+    BOOST_CHECK(mock_reg_iface.last_chan == zbx_cpld_ctrl::CHAN0);
+    BOOST_CHECK_EQUAL(mock_reg_iface.memory.at(lo_spi_addr) & 0xFFFF, 0x0808);
+
+    // An empty batch doesn't write or sleep
+    mock_reg_iface.memory.erase(lo_spi_addr);
+    cpld.lo_poke16(zbx_lo_t::TX0_LO1, {});
+    BOOST_CHECK_CLOSE(slept(), 8e-6, 1e-3);
+    BOOST_CHECK_EQUAL(mock_reg_iface.memory.count(lo_spi_addr), 0);
+}
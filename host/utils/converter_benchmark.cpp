@@ -275,7 +275,13 @@ std::string get_priority_name(int prio)
         case 2:
             return "NEON";
         case 3:
-            return "SIMD"; // SSE2/SSSE3 or AVX2
+            return "SSE2";
+        case 4:
+            return "SSSE3";
+        case 5:
+            return "AVX2";
+        case 6:
+            return "AVX512";
         default:
             return "Unknown(" + std::to_string(prio) + ")";
     }
@@ -520,7 +526,7 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         ("samples",  po::value<size_t>(&n_samples)->default_value(1000000), "Number of samples per iteration")
         ("iterations",  po::value<size_t>(&iterations)->default_value(10000), "Number of iterations per benchmark")
         ("priorities", po::value<std::string>(&priorities)->default_value("default"), "Converter priorities. Can be 'default', 'all', or a comma-separated list of priorities.")
-        ("max-prio", po::value<priority_type>(&max_prio)->default_value(5), "Largest available priority (advanced feature)")
+        ("max-prio", po::value<priority_type>(&max_prio)->default_value(7), "Largest available priority (advanced feature)")
         ("n-inputs",   po::value<size_t>(&n_inputs)->default_value(1),  "Number of input vectors")
         ("n-outputs",  po::value<size_t>(&n_outputs)->default_value(1), "Number of output vectors")
         ("debug-converter", "Skip benchmark and print conversion results. Implies iterations==1 and will only run on a single converter.")
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+#
+# Copyright 2026 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+"""
+Decode a binary UHD log file.
+
+Binary log files are written by UHD when the UHD_LOG_BINARY_FILE environment
+variable is set. This tool turns them into text, either in the format of the
+console logger, or in the CSV format of the file logger (UHD_LOG_FILE).
+The file must be decoded on a machine with the same byte order as the one
+that wrote it.
+"""
+
+import argparse
+import datetime
+import os
+import struct
+import sys
+
+MAGIC = b'UHDBLOG1'
+LEVEL_NAMES = ['TRACE', 'DEBUG', 'INFO', 'WARNING', 'ERROR', 'FATAL', 'OFF']
+# Must match uhd::log::binary::record_header
+RECORD_HEADER = struct.Struct('=IIQ')
+
+def parse_args():
+    """ Parse command line arguments """
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('file', help="Binary log file")
+    parser.add_argument('--csv', action='store_true',
+                        help="Print in the CSV format of the UHD log file")
+    parser.add_argument('-l', '--level', default='trace',
+                        help="Only print records at this level or above")
+    return parser.parse_args()
+
+class Reader:
+    """ Sequential reader for a bytes object """
+    def __init__(self, data, pos=0):
+        self.data = data
+        self.pos = pos
+
+    def done(self):
+        """ True if there is nothing left to read """
+        return self.pos >= len(self.data)
+
+    def unpack(self, fmt):
+        """ Read values according to a struct format """
+        values = struct.unpack_from('=' + fmt, self.data, self.pos)
+        self.pos += struct.calcsize('=' + fmt)
+        return values if len(values) > 1 else values[0]
+
+    def string(self):
+        """ Read a string: uint16_t length, followed by the characters """
+        length = self.unpack('H')
+        value = self.data[self.pos:self.pos + length].decode('utf-8', 'replace')
+        self.pos += length
+        return value
+
+def format_args(fmt, args):
+    """ Replace the {} placeholders in fmt, like uhd::log::binary::format_args() """
+    reader = Reader(args)
+    out = ''
+    while True:
+        placeholder = fmt.find('{}')
+        if placeholder < 0 or reader.done():
+            break
+        out += fmt[:placeholder] + format_arg(reader)
+        fmt = fmt[placeholder + 2:]
+    out += fmt
+    while not reader.done():
+        out += ' ' + format_arg(reader)
+    return out
+
+def format_arg(reader):
+    """ Format the next argument """
+    arg_type = reader.unpack('B')
+    if arg_type == 0:
+        return str(reader.unpack('q'))
+    if arg_type == 1:
+        return str(reader.unpack('Q'))
+    if arg_type == 2:
+        return '%g' % reader.unpack('d')
+    if arg_type == 3:
+        return 'true' if reader.unpack('B') else 'false'
+    if arg_type == 4:
+        return hex(reader.unpack('Q'))
+    if arg_type == 5:
+        return reader.string()
+    raise ValueError("Unknown argument type {}".format(arg_type))
+
+def decode(data):
+    """ Generate (time, thread, site, message) for all records in data """
+    if not data.startswith(MAGIC):
+        raise ValueError("Not a binary UHD log file")
+    sites = {}
+    threads = {}
+    reader = Reader(data, len(MAGIC))
+    while not reader.done():
+        tag = data[reader.pos:reader.pos + 1]
+        reader.pos += 1
+        if tag == b'S':
+            site_id, level, line = reader.unpack('IBI')
+            component = reader.string()
+            filename = reader.string()
+            fmt = reader.string()
+            sites[site_id] = (level, component, filename, line, fmt)
+        elif tag == b'T':
+            index = reader.unpack('I')
+            threads[index] = reader.string()
+        elif tag == b'R':
+            index = reader.unpack('I')
+            size, site_id, time_ns = RECORD_HEADER.unpack_from(data, reader.pos)
+            args = data[reader.pos + RECORD_HEADER.size:reader.pos + size]
+            reader.pos += size
+            site = sites[site_id]
+            yield time_ns, threads.get(index, str(index)), site, format_args(site[4], args)
+        else:
+            raise ValueError("Corrupt log file at offset {}".format(reader.pos - 1))
+
+def format_time(time_ns):
+    """ Format a time stamp like the UHD logger """
+    time = datetime.datetime.fromtimestamp(time_ns // 1000000000)
+    return time.strftime('%Y-%m-%d %H:%M:%S') + '.{:06d}'.format(
+        (time_ns % 1000000000) // 1000)
+
+def main():
+    """ Go, go, go! """
+    args = parse_args()
+    level_name = args.level.upper()
+    min_level = int(level_name) if level_name.isdigit() else LEVEL_NAMES.index(level_name)
+    with open(args.file, 'rb') as log_file:
+        data = log_file.read()
+    for time_ns, thread, site, message in decode(data):
+        level, component, filename, line, _ = site
+        if level < min_level:
+            continue
+        if args.csv:
+            print('{},{},{}:{},{},{},{}'.format(
+                format_time(time_ns), thread, os.path.basename(filename), line,
+                level, component, message))
+        else:
+            print('[{}] [{}] [{}] {}'.format(
+                format_time(time_ns), LEVEL_NAMES[level], component, message))
+    return True
+
+if __name__ == "__main__":
+    sys.exit(not main())